@@ -0,0 +1,110 @@
+/*************************************************************
+Bitbase.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+#pragma once
+
+#include "xcommon.h"
+#include "Figure.h"
+#include "array"
+#include "unordered_map"
+
+namespace NEngine
+{
+
+class Board;
+
+// result for side to move
+enum class BitbaseResult { Unknown, Draw, Win, Loss };
+
+struct BitbasePiece
+{
+  Figure::Color color_{};
+  Figure::Type  type_{};
+  // captured if negative
+  int pos_{ -1 };
+};
+
+// win/draw/loss table of one endgame. 2 bits per position
+// white side is the stronger one, for ex. KRKP. en-passant and castling are not considered
+class Bitbase
+{
+public:
+  Bitbase(std::string const& name);
+
+  // figures besides kings. K + Q, R, B, N, P for each side
+  static bool parseName(std::string const& name, std::vector<BitbasePiece>& pieces);
+  // stronger side goes first, figures are sorted by weight
+  static std::string canonicalName(std::vector<BitbasePiece> const& pieces, bool& flip);
+
+  bool valid() const { return count_ > 0 && count_ <= BitbaseFiguresMax - 2; }
+  std::string const& name() const { return name_; }
+  int count() const { return count_; }
+  BitbasePiece const& piece(int i) const { return pieces_[i]; }
+  bool hasPawns() const { return pawns_; }
+  size_t size() const { return size_; }
+
+  // figures positions are given in the same order as in table name
+  size_t index(Figure::Color color, int wk, int bk, int const* pos) const;
+  void decode(size_t idx, Figure::Color& color, int& wk, int& bk, int* pos) const;
+
+  BitbaseResult get(size_t idx) const
+  {
+    return static_cast<BitbaseResult>(((data_[idx >> 2] >> ((idx & 3) << 1)) & 3) + 1);
+  }
+
+  void set(size_t idx, BitbaseResult result);
+
+  // any order of figures. colors are flipped if table is stored for other side
+  BitbaseResult probe(Figure::Color color, int const* kings, BitbasePiece const* pieces, int n, bool flip) const;
+
+  std::vector<uint8>& data() { return data_; }
+  std::vector<uint8> const& data() const { return data_; }
+
+private:
+  std::string name_;
+  int count_{};
+  bool pawns_{};
+  size_t kingsN_{};
+  size_t size_{};
+  std::array<BitbasePiece, BitbaseFiguresMax - 2> pieces_;
+  std::vector<uint8> data_;
+};
+
+class Bitbases
+{
+public:
+  // retrograde analysis of given table and all tables it depends on
+  bool generate(std::string const& name, int threadsN, std::function<void(std::string const&)> const& log);
+
+  bool load(std::string const& fname);
+  bool save(std::string const& fname) const;
+
+  bool empty() const { return tables_.empty(); }
+  Bitbase const* find(std::string const& name) const;
+
+  inline BitbaseResult probe(Board const& board) const
+  {
+    if (codes_.empty())
+      return BitbaseResult::Unknown;
+    return probeBoard(board);
+  }
+
+  // kings are given by colors
+  BitbaseResult probe(Figure::Color color, int const* kings, BitbasePiece const* pieces, int n) const;
+
+private:
+  BitbaseResult probeBoard(Board const& board) const;
+  void add(std::unique_ptr<Bitbase>&& table);
+
+  struct Link
+  {
+    Bitbase const* table_{};
+    bool flip_{};
+  };
+
+  std::vector<std::unique_ptr<Bitbase>> tables_;
+  // figures code to table
+  std::unordered_map<BitMask, Link> codes_;
+};
+
+} // NEngine
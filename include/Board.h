@@ -86,6 +86,7 @@ struct UndoInfo
   Move          move_;
   uint8         mflags_;
   int8          eaten_type_;
+  int8          moved_type_;
   int32         psq32_;
 
   int8 enpassant() const { return data_.en_passant_; }
@@ -108,6 +109,7 @@ struct UndoInfo
     move_ = Move{ true };
     mflags_ = 0;
     eaten_type_ = 0;
+    moved_type_ = 0;
     psq32_ = 0;
   }
 };
@@ -401,8 +403,8 @@ struct Board
   {
     int reps = 1;
     int i = halfmovesCounter_ - from;
-    int stop = halfmovesCounter_ - data_.fiftyMovesCount_; // TODO: is it correct?
-    X_ASSERT(stop < 0, "stop in countReps is invalid");
+    // moves made before position was set up aren't in undo stack
+    int stop = std::max(halfmovesCounter_ - data_.fiftyMovesCount_, 0);
     for(; i >= stop && reps < 3; i -= 2)
     {
       if(undoInfo(i).zcode_ == zcode)
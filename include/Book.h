@@ -0,0 +1,57 @@
+/*************************************************************
+Book.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+#pragma once
+
+#include "xcommon.h"
+#include "Move.h"
+#include "MappedFile.h"
+#include "random"
+
+namespace NEngine
+{
+
+class Board;
+
+// opening book in polyglot format. file is a sorted array of 16 bytes big-endian entries:
+// key (8), move (2), weight (2), learn (4). it's mapped to memory if possible
+class Book
+{
+public:
+  Book();
+
+  Book(Book const&) = delete;
+  Book& operator = (Book const&) = delete;
+
+  bool load(std::string const& fname);
+  void clear();
+
+  bool empty() const { return count_ == 0; }
+  size_t size() const { return count_; }
+
+  // polyglot hash key of position
+  static uint64 key(Board const& board);
+
+  // weighted random choice among book moves. empty move if position isn't found
+  Move move(Board const& board);
+
+private:
+  struct Entry
+  {
+    uint64 key_{};
+    uint16 move_{};
+    uint16 weight_{};
+  };
+
+  Entry entry(size_t i) const;
+  // first entry with given key
+  size_t lowerBound(uint64 key) const;
+  static Move bookMove(Board const& board, uint16 pmove);
+
+  MappedFile file_;
+  uint8 const* data_{};
+  size_t count_{};
+  std::mt19937 rgen_;
+};
+
+} // NEngine
@@ -3,6 +3,7 @@
 #include "xcommon.h"
 #include "xlist.h"
 #include "Board.h"
+#include "History.h"
 #include "xalgorithm.h"
 
 namespace NEngine
@@ -13,13 +14,18 @@ struct CapsGenerator
 {
   using MovesList = xlist<MOVE, NumOfFields>;
 
-  CapsGenerator(BOARD const& board) :
-    board_(board)
+  CapsGenerator(BOARD const& board, SearchHistory const& hist) :
+    board_(board),
+    hist_(hist)
   {}
 
+  // MVV-LVA. captures history for equal ones
   inline void add(int from, int to, Figure::Type new_type)
   {
-    insert_sorted(moves_, MOVE{ from, to, new_type, board_.sortValueOfCap(from, to, new_type) });
+    auto score = board_.sortValueOfCap(from, to, new_type) * CapturesHistoryScale;
+    auto const& hist = hist_.capturesHistory(board_.color(), board_.getField(from).type(), to, board_.getField(to).type());
+    score += std::min(hist.score(), CapturesHistoryScale - 1);
+    insert_sorted(moves_, MOVE{ from, to, new_type, score });
   }
 
   MOVE* next()
@@ -257,6 +263,7 @@ struct CapsGenerator
   }
 
   BOARD const& board_;
+  SearchHistory const& hist_;
   MovesList moves_;
   typename MovesList::iterator iter_;
 }; // CapsGenerator
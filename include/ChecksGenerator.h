@@ -3,6 +3,7 @@
 #include "xcommon.h"
 #include "xlist.h"
 #include "Board.h"
+#include "History.h"
 
 namespace NEngine
 {
@@ -12,13 +13,14 @@ struct ChecksGenerator
 {
   using MovesList = xlist<MOVE, NumOfFields>;
 
-  ChecksGenerator(BOARD const& board) :
-    board_(board)
+  ChecksGenerator(BOARD const& board, SearchHistory const& hist) :
+    board_(board),
+    hist_(hist)
   {}
 
   inline void add(int from, int to)
   {
-    MOVE move{ from, to, Figure::TypeNone, history(board_.color(), from, to).score() };
+    MOVE move{ from, to, Figure::TypeNone, hist_.history(board_.color(), from, to).score() };
     X_ASSERT(find(move), "ChecksGenerator. move exists");
     insert_sorted(moves_, move);
   }
@@ -896,6 +898,7 @@ struct ChecksGenerator
   }
 
   BOARD const& board_;
+  SearchHistory const& hist_;
   MovesList moves_;
   typename MovesList::iterator iter_;
 }; // ChecksGenerator
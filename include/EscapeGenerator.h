@@ -3,6 +3,7 @@
 #include "xcommon.h"
 #include "xlist.h"
 #include "Board.h"
+#include "History.h"
 #include "xalgorithm.h"
 
 namespace NEngine
@@ -15,8 +16,9 @@ struct EscapeGenerator
 
   enum Order { oHash, oGenCaps, oCaps, oKiller, oGenUsual, oUsual, oWeak, oWeakUsual } order_{ oHash };
 
-  EscapeGenerator(BOARD const& board, MOVE const& hmove, MOVE const& killer = MOVE{ true }) :
+  EscapeGenerator(BOARD const& board, SearchHistory const& hist, MOVE const& hmove, MOVE const& killer = MOVE{ true }) :
     board_(board),
+    hist_(hist),
     hmove_(hmove),
     killer_(killer)
   {
@@ -35,7 +37,7 @@ struct EscapeGenerator
 
   inline void add_usual(int from, int to)
   {
-    insert_sorted(usual_, MOVE{ from, to, Figure::TypeNone, history(board_.color(), from, to).score() });
+    insert_sorted(usual_, MOVE{ from, to, Figure::TypeNone, hist_.history(board_.color(), from, to).score() });
   }
 
   inline void generateCaps()
@@ -508,6 +510,7 @@ struct EscapeGenerator
   }
 
   BOARD const& board_;
+  SearchHistory const& hist_;
   MovesList caps_;
   MovesList usual_;
   MovesList weak_;
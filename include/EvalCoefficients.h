@@ -5,178 +5,368 @@ EvalCoefficients.h - Copyright (C) 2016 by Dmitry Sultanov
 #pragma once
 
 #include "xcommon.h"
+#include "string"
+#include "vector"
 
 namespace NEngine
 {
 
+// set of evaluation weights. default values are built-in, could be changed with load() or set()
 struct EvalCoefficients
 {
+  EvalCoefficients();
+
   // single vars
-  static int additionalMatBonus_;
+  int additionalMatBonus_{ 150 };
 
   // pawns
-  static ScoreType32 protectedPawnPressure_;
-  static ScoreType32 pawnPressureStrong_;
-  static ScoreType32 pawnPressureMedium_;
-  static ScoreType32 pawnPressureWeak_;
-  static ScoreType32 pawnBishopTreat_;
+  ScoreType32 protectedPawnPressure_{ 1, 2 };
+  ScoreType32 pawnPressureStrong_{ 13, 22 };
+  ScoreType32 pawnPressureMedium_{ 2, 5 };
+  ScoreType32 pawnPressureWeak_{ 1, 3 };
+  ScoreType32 pawnBishopTreat_{ 0, 3 };
 
   // outpost
-  static ScoreType32 knightOutpost_[2];
-  static ScoreType32 bishopOutpost_[2];
-
-  // forks & other treats
-  static ScoreType bishopsAttackRQ_;
-  static ScoreType bishopsAttack_;
-  static ScoreType bishopsAttackWeak_;
-  static ScoreType knightAttackRQ_;
-  static ScoreType knightAttack_;
-  static ScoreType knightAttackWeak_;
-  static ScoreType pawnAttack_;
-  static ScoreType possibleKnightAttack_[4];
-  static ScoreType possiblePawnAttack_;
-  static ScoreType rookAttackBonus_;
-  static ScoreType queenAttackBonus_;
-  static ScoreType queenUnderRookAttackBonus_;
-  static ScoreType multiattackedBonus_;
-  static ScoreType attackedByKingBonus_;
-  static ScoreType attackedThroughBonus_;
-  static ScoreType discoveredAttackBonus_;
+  ScoreType32 knightOutpost_[2] = { { 6, 2 }, { 10, 3 } };
+  ScoreType32 bishopOutpost_[2] = { {6, 2},  {10, 3} };
+
+  // attacks
+  ScoreType bishopsAttackRQ_{ 40 };
+  ScoreType bishopsAttack_{ 30 };
+  ScoreType bishopsAttackWeak_{ 15 };
+  ScoreType knightAttackRQ_{ 40 };
+  ScoreType knightAttack_{ 30 };
+  ScoreType knightAttackWeak_{ 15 };
+  ScoreType pawnAttack_{ 60 };
+  ScoreType possibleKnightAttack_[4] = { 0, 8, 30, 40 };
+  ScoreType possiblePawnAttack_{ 12 };
+  ScoreType rookAttackBonus_{ 30 };
+  ScoreType queenAttackBonus_{ 30 };
+  ScoreType queenUnderRookAttackBonus_{ 20 };
+  ScoreType multiattackedBonus_{ 25 };
+  ScoreType attackedByKingBonus_{ 20 };
+  ScoreType attackedThroughBonus_{ 20 };
+  ScoreType discoveredAttackBonus_{ 20 };
 
   // immobility
-  static ScoreType immobileAttackBonus_;
-  static ScoreType pinnedFigureBonus_;
+  ScoreType immobileAttackBonus_ = 30;
+  ScoreType pinnedFigureBonus_ = 15;
 
   // check & mat treat
-  static ScoreType32 discoveredCheckBonus_;
+  ScoreType32 discoveredCheckBonus_{ 20, 20 };
 
   // king
-  static ScoreType32 fakeCastle_;
+  ScoreType32 fakeCastle_{ -60, 0 };
 
   // blocked figure
-  static ScoreType32 knightBlocked_;
-  static ScoreType32 bishopBlocked_;
-  static ScoreType32 rookBlocked_;
+  ScoreType32 knightBlocked_{ 60, 50 };
+  ScoreType32 bishopBlocked_{ 60, 50 };
+  ScoreType32 rookBlocked_{ 60, 60 };
 
   // king attacks
-  static int pawnKingAttack_;
-  static int knightKingAttack_;
-  static int bishopKingAttack_;
-  static int rookKingAttack_;
-  static int queenKingAttack_;
+  int pawnKingAttack_{ 15 };
 
-  static int generalKingPressure_;
+  int knightKingAttack_{ 20 };
+  int bishopKingAttack_{ 20 };
+  int rookKingAttack_{ 18 };
+  int queenKingAttack_{ 21 };
 
-    // for special cases
-  static int kingToPawnDistanceMulti_;
-  static int knightToPawnDistanceMulti_;
-  static int kingToKingDistanceMulti_;
-  static int figureToKingDistanceMulti_;
+  int generalKingPressure_{ 3 };
 
   // king threat
-  static int knightChecking_;
-  static int bishopChecking_;
-  static int rookChecking_;
-  static int queenChecking_;
-  static int discoveredChecking_;
-  static int promotionChecking_;
-  static int weakChecking_;
-  static int queenCheckTreatBonus_;
-
-  static int attackedNearKingStrong_;
-  static int attackedNearKingMedium_;
-  static int attackedNearKingWeak_;
-  static int attackedNearKingRem_;
-  static int attackedNearKingOther_;
-  static int attackedNearKingPawns_;
-  static int checkNearKingStrong_;
-  static int checkNearKingMedium_;
-  static int checkNearKingWeak_;
-  static int checkNearKingRem_;
-  static int checkNearKingOther_;
-  static int checkNearKingPawns_;
-  static int possibleMatTreat_;
-  static int possibleMatTreatMyMove_;
-  static int attackThroughPawn_;
-
-  static int kingWeakCheckersCoefficients_;
-  static int kingCheckersCoefficients_[8];
-  static int kingAttackersCoefficients_[8];
-
-  static ScoreType32 doubledPawn_;
-  static ScoreType32 isolatedPawn_[2];
-  static ScoreType32 backwardPawn_[2];
-  static ScoreType32 unprotectedPawn_;
-  static ScoreType32 hasneighborPawn_;
-  static ScoreType32 attackingPawn_[8];
+  int knightChecking_{ 70 };
+  int bishopChecking_{ 30 };
+  int rookChecking_{ 85 };
+  int queenChecking_{ 85 };
+  int discoveredChecking_{ 40 };
+  int promotionChecking_{ 40 };
+  int weakChecking_{ 9 };
+  int queenCheckTreatBonus_{ 50 };
   
-  static int opponentPawnPressure_[8];
+  int attackedNearKingStrong_{ 35 };
+  int attackedNearKingMedium_{ 20 };
+  int attackedNearKingWeak_{ 8 };
+  int attackedNearKingRem_{ 10 };
+  int attackedNearKingOther_{ 4 };
+  int attackedNearKingPawns_{ 3 };
+  int checkNearKingStrong_{ 35 };
+  int checkNearKingMedium_{ 20 };
+  int checkNearKingWeak_{ 8 };
+  int checkNearKingRem_{ 10 };
+  int checkNearKingOther_{ 4 };
+  int checkNearKingPawns_{ 3 };
+  int possibleMatTreat_{ 50 };
+  int possibleMatTreatMyMove_{ 50 };
+  int attackThroughPawn_{ 15 };
+
+  int kingWeakCheckersCoefficients_{ 16 };
+  int kingCheckersCoefficients_[8]  = { 0, 16, 32, 64, 64, 64, 64, 64 };
+  int kingAttackersCoefficients_[8] = { 0,  0,  4,  8, 16, 32, 56, 64 };
+
+  // for special cases
+  int kingToPawnDistanceMulti_{ 3 };
+  int knightToPawnDistanceMulti_{ 1 };
+  int kingToKingDistanceMulti_{ 3 };
+  int figureToKingDistanceMulti_{ 3 };
+
+  // arrays
+  ScoreType32 doubledPawn_ = {-10, -8};
+  ScoreType32 isolatedPawn_[2] = { {-12, -10}, {-17, -12} };
+  ScoreType32 backwardPawn_[2] = { {-12, -10}, {-17, -12} };
+  ScoreType32 unprotectedPawn_ = {-6, -4};
+  ScoreType32 hasneighborPawn_ = {4, 4};
+  ScoreType32 attackingPawn_[8] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 3 }, { 8, 10 }, { 14, 18 }, { 0, 0 }, { 0, 0 } };
+
+  int opponentPawnPressure_[8] = { 20, 20, 15, 10, 7, 1, 0, 0 };
+
+  int pawnShieldA_[4] = { 30, 26, 5, 0 };
+  int pawnShieldB_[4] = { 30, 26, 5, 0 };
+  int pawnShieldC_[4] = { 20, 16, 3, 0 };
+  int pawnShieldAbove_[4] = { 12, 5, 1, 0 };
+
+  // new shield
+  int pawnsShields_[8][8] = {
+    {-20, 32, 30, 15,-10, -20, -20, 0},
+    {-20, 35, 30, 0,-15, -20, -20, 0},
+    {-10, 32, 15, 8, -10, -10, -10, 0},
+    {-10, 15, 10, 6, -10, -10, -10, 0},
+    {-10, 15, 10, 6, -10, -10, -10, 0},
+    {-10, 32, 15, 8, -10, -10, -10, 0},
+    {-20, 35, 30, 5,-15, -20, -20, 0},
+    {-20, 32, 30, 15,-10, -20, -20, 0}
+  };
+  int opawnsShieldAttack_[2][8] = {
+    {0, 3, 1, 0, 0, 0, 0, 0},
+    {30, 18, 6, 5, 3, 2, 1, 0}
+  };
+  int opawnsNearKing_[8] = { 0, 20, 15, 7, 3, 1, 0, 0 };
+  int opawnsAttackCoeffs_[8] = { 0, 32, 32, 32, 16, 8, 4, 0 };
+  int opawnAboveKing_[8] = { 0, 40, 25, 10, 0, 0, 0, 0 };
 
   // rook on open column
-  static ScoreType32 openRook_[2];
+  ScoreType32 openRook_[2] = { {20, 8}, {10, 4} };
 
   // material diff
-  static ScoreType32 doubleBishopBonus_[10];
-  static ScoreType32 doubleKnightBonus_[10];
-  static ScoreType32 twoKnightsBonus_[10];
-  static ScoreType32 twoBishopsBonus_[10];
-  static ScoreType32 twoRooksBonus_[10];
-  static ScoreType32 figureAgainstPawnBonus_[10];
-  static ScoreType32 figuresAgainstRookBonus_[10];
-  static ScoreType32 knightsAgainstRookBonus_[10];
-  static ScoreType32 rookAgainstFigureBonus_[10][10];
-
-  static ScoreType32 noKnightsPenalty_;
-  static ScoreType32 noBishopsPenalty_;
-  static ScoreType32 noRooksPenalty_;
-  static ScoreType32 noQueensPenalty_;
-
-  static int pawnShieldA_[4];
-  static int pawnShieldB_[4];
-  static int pawnShieldC_[4];
-  static int pawnShieldAbove_[4];
-
-  static int opawnAboveKing_[8];
-  static int pawnsShields_[8][8];
-  static int opawnsShieldAttack_[2][8];
-  static int opawnsAttackCoeffs_[8];
-  static int opawnsNearKing_[8];
-  // arrays
-  static ScoreType32 passerPawn_[8];
-  static ScoreType32 passerPawn2_[8];
-  static ScoreType32 passerPawnEx_[8];
-  static ScoreType32 passerUnstoppable_[8];
-  static ScoreType32 passerPawnExS_[8][8];
-  static ScoreType32 passerPawnPGrds_[8];
-  static ScoreType32 passerPawnPGrds2_[8];
-  static ScoreType32 kingToPasserDistanceBonus_[8];
-  static ScoreType32 okingToPasserDistanceBonus_[8];
-  static ScoreType32 kingToPasserDistanceBonus2_[8];
-  static ScoreType32 okingToPasserDistanceBonus2_[8];
-  static ScoreType32 passerPawnMyBefore_[8];
-  static int passerPawnSc_[8]; // special cases only
-  // distance between forwards
-  static int closeToPromotion_[8];
-  static int kingToPawnBonus_[8];
+  // opening, endgame
+  ScoreType32 doubleBishopBonus_[10] = { {0, 0}, {10, 10}, {12, 12}, {15, 15}, {15, 15}, {15, 15}, {15, 15}, {15, 15}, {15, 15}, {15, 15} };
+  ScoreType32 doubleKnightBonus_[10] = { {0, 0}, {3, 3}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5} };
+  ScoreType32 twoKnightsBonus_[10] = { {0, 0}, {10, 5}, {15, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5} };
+  ScoreType32 twoBishopsBonus_[10] = { {5, 5}, {25, 25}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35} };
+  ScoreType32 twoRooksBonus_[10] = { {0, 0}, {5, 5}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10} };
+  ScoreType32 figureAgainstPawnBonus_[10] = { {0, 0}, {25, 10}, {35, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20} };
+  ScoreType32 figuresAgainstRookBonus_[10] = { {0, 0}, {30, 20}, {50, 40}, {60, 50}, {60, 50}, {60, 50}, {60, 50}, {60, 50}, {60, 50}, {60, 50} };
+  ScoreType32 knightsAgainstRookBonus_[10] = { {0, 0}, {12, 12}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20} };
+  ScoreType32 rookAgainstFigureBonus_[10][10] = {
+    { { 60,  30}, { 58,  30}, { 57,  30}, { 56,  30}, { 56,  30}, { 55,  30}, { 55,  30}, { 55,  30}, { 55,  30}, {  0,   0} },
+    { { 55,  26}, { 54,  26}, { 53,  26}, { 52,  26}, { 51,  26}, { 51,  26}, { 50,  26}, { 50,  26}, { 50,  26}, {  0,   0} },
+    { { 51,  23}, { 50,  23}, { 49,  23}, { 48,  23}, { 47,  23}, { 46,  23}, { 46,  23}, { 46,  23}, { 46,  23}, {  0,   0} },
+    { { 47,  20}, { 46,  20}, { 45,  20}, { 44,  20}, { 44,  20}, { 43,  20}, { 43,  20}, { 42,  20}, { 42,  20}, {  0,   0} },
+    { { 45,  18}, { 43,  18}, { 42,  18}, { 41,  18}, { 41,  18}, { 40,  18}, { 40,  18}, { 40,  18}, { 40,  18}, {  0,   0} },
+    { { 42,  17}, { 41,  17}, { 40,  17}, { 39,  17}, { 39,  17}, { 38,  17}, { 38,  17}, { 37,  17}, { 37,  17}, {  0,   0} },
+    { { 41,  15}, { 40,  15}, { 39,  15}, { 38,  15}, { 37,  15}, { 36,  15}, { 36,  15}, { 36,  15}, { 36,  15}, {  0,   0} },
+    { { 40,  15}, { 39,  15}, { 38,  15}, { 37,  15}, { 36,  15}, { 36,  15}, { 35,  15}, { 35,  15}, { 35,  15}, {  0,   0} },
+    { { 40,  15}, { 38,  15}, { 37,  15}, { 36,  15}, { 36,  15}, { 35,  15}, { 35,  15}, { 35,  15}, { 35,  15}, {  0,   0} },
+    { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} }
+  };
+
+  ScoreType32 noKnightsPenalty_ = {5, 5};
+  ScoreType32 noBishopsPenalty_ = {8, 8};
+  ScoreType32 noRooksPenalty_ = {10, 10};
+  ScoreType32 noQueensPenalty_ = {15, 15};
+
+  // passer pawns
+  ScoreType32 passerPawn_[8] = { {  0,   0}, {  1,   2}, {  1,   2}, {  9,  10}, { 27,  30}, { 54,  60}, { 90, 100}, {  0,   0} };
+  ScoreType32 passerPawn2_[8] = { {  0,   0}, {  0,   1}, {  0,   1}, {  4,   5}, { 13,  15}, { 27,  30}, { 45,  50}, {  0,   0} };
+  ScoreType32 passerPawnEx_[8] = { {  0,   0}, {  1,   2}, {  1,   2}, {  4,   5}, { 20,  25}, { 48,  60}, {112, 140}, {  0,   0} };
+  ScoreType32 passerUnstoppable_[8] = { {  0,   0}, {  2,   3}, {  5,   8}, { 10,  17}, { 25,  42}, { 50,  85}, {100, 170}, {  0,   0} };
+  ScoreType32 passerPawnExS_[8][8] = {
+    { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
+    { {  0,   0}, {  0,   1}, {  1,   1}, {  1,   1}, {  1,   1}, {  1,   1}, {  1,   2}, {  0,   0} },
+    { {  0,   0}, {  0,   1}, {  1,   1}, {  1,   1}, {  1,   1}, {  1,   2}, {  0,   0}, {  0,   0} },
+    { {  0,   0}, {  2,   3}, {  3,   3}, {  3,   4}, {  4,   5}, {  0,   0}, {  0,   0}, {  0,   0} },
+    { {  0,   0}, { 13,  16}, { 16,  20}, { 20,  25}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
+    { {  0,   0}, { 36,  45}, { 48,  60}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
+    { {  0,   0}, {112, 140}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
+    { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} }
+  };
+  ScoreType32 passerPawnPGrds_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  1,   2}, {  5,   7}, { 10,  15}, { 18,  25}, {  0,   0} };
+  ScoreType32 passerPawnPGrds2_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   1}, {  2,   3}, {  5,   7}, {  9,  12}, {  0,   0} };
+  ScoreType32 kingToPasserDistanceBonus_[8] = { {  0,   0}, {  0,   0}, {  0,   1}, {  0,   2}, {  0,   5}, {  0,   9}, {  0,  15}, {  0,   0} };
+  ScoreType32 okingToPasserDistanceBonus_[8] = { {  0,   0}, {  0,   1}, {  0,   2}, {  0,   6}, {  0,  13}, {  0,  22}, {  0,  35}, {  0,   0} };
+  ScoreType32 kingToPasserDistanceBonus2_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   1}, {  0,   2}, {  0,   4}, {  0,   7}, {  0,   0} };
+  ScoreType32 okingToPasserDistanceBonus2_[8] = { {  0,   0}, {  0,   0}, {  0,   1}, {  0,   3}, {  0,   6}, {  0,  11}, {  0,  17}, {  0,   0} };
+  ScoreType32 passerPawnMyBefore_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  1,   2}, {  5,   6}, { 10,  12}, { 18,  20}, {  0,   0} };
+  // end of passer pawns
+
+  int passerPawnSc_[8] = { 0, 1, 2, 4, 6, 8, 12, 0 };
+  int closeToPromotion_[8] = { 0, 2, 4, 6, 8, 10, 12, 16 };
+  int kingToPawnBonus_[8] = { 0, 0, 1, 2, 3, 4, 5, 6 };
 
   // mobility
-  static ScoreType32 knightMobility_[16];
-  static ScoreType32 bishopMobility_[16];
-  static ScoreType32 rookMobility_[16];
-  static ScoreType32 queenMobility_[32];
+  ScoreType32 knightMobility_[16] = { {-45, -45}, {-19, -18}, {  6,   8}, {  9,  11}, { 11,  15}, { 14,  17}, { 16,  20}, { 18,  22}, { 20,  25} };
+  ScoreType32 bishopMobility_[16] = { {-30, -30}, {-13, -12}, {  4,   6}, {  5,   8}, {  7,   9}, {  8,  11}, { 10,  13}, { 11,  14}, { 12,  16},
+                                                        { 13,  17}, { 15,  19}, { 16,  20}, { 17,  21}, { 18,  22}, { 19,  23}, { 20,  25} };
+  ScoreType32 rookMobility_[16]   = { {-25, -45}, { -9, -17}, {  7,  10}, { 11,  15}, { 14,  21}, { 18,  26}, { 21,  31}, { 24,  35}, { 27,  40},
+                                                        { 30,  44}, { 33,  48}, { 35,  51}, { 38,  55}, { 40,  58}, { 42,  61}, { 45,  65} };
+  ScoreType32 queenMobility_[32]  = { {-55, -55}, {-22, -21}, { 10,  12}, { 12,  14}, { 14,  17}, { 17,  20}, { 19,  22}, { 21,  25}, { 23,  27},
+                                                        { 25,  30}, { 27,  32}, { 29,  34}, { 31,  36}, { 33,  38}, { 34,  40}, { 36,  42}, { 38,  44}, { 40,  46},
+                                                        { 41,  48}, { 43,  50}, { 44,  52}, { 46,  54}, { 47,  55}, { 49,  57}, { 50,  59}, { 52,  60}, { 53,  62},
+                                                        { 54,  64}, { 56,  65}, { 57,  67}, { 58,  68}, { 60,  70} };
+
+  ScoreType32 knightPinned_ = { 15, 15 };
+  ScoreType32 bishopPinned_ = { 10, 10 };
+  ScoreType32 rookPinned_ = { 15, 15 };
+  ScoreType32 queenPinned_ = { 20, 20 };
+
+  // king position eval for BN-mat
+  int bishopKnightMat_[64] =
+  {
+     30,  20,  10,  -1,  -5, -10, -20, -30,
+     20,  16,   8,  -1,  -6,  -8, -16, -20,
+     10,   8,   6,  -2,  -8,  -6,  -8, -10,
+     -1,  -1,  -2, -15, -15,  -8,  -6,  -5,
+     -5,  -6,  -8, -15, -15,  -2,  -1,  -1,
+    -10,  -8,  -6,  -8,  -2,   6,   8,  10,
+    -20, -16,  -8,  -6,  -1,   8,  16,  20,
+    -30, -20, -10,  -5,  -1,  10,  20,  30
+  };
+
+  ScoreType32 kingDistanceBonus_[8][8] =
+  {
+    {},
+    {},
+    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
+    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
+    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
+    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
+    {},
+    {}
+  };
+
+  // lazy evaluation. maximum expected value of terms not evaluated yet after each stage
+  enum LazyStage { LazyMaterial, LazyPawns, LazyPieces, LazyKingPressure, LazyStagesNum };
+  int lazyMargins_[LazyStagesNum] = { 400, 400, 360, 180 };
+
+  ScoreType32 positionEvaluations_[2][8][64] =
+  {
+    {
+      {
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}
+      },
+      {
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  5,   5}, {  5,   5}, {  5,   6}, {  5,   7}, {  5,   7}, {  5,   6}, {  5,   5}, {  5,   5},
+        {  4,   4}, {  4,   4}, {  5,   4}, { 10,   6}, { 10,   6}, {  5,   5}, {  4,   4}, {  4,   4},
+        {  4,   3}, {  4,   3}, {  9,   4}, { 12,   5}, { 12,   5}, {  9,   4}, {  4,   3}, {  4,   3},
+        {  3,   2}, {  3,   2}, {  7,   3}, { 12,   4}, { 12,   4}, {  7,   3}, {  3,   2}, {  3,   2},
+        {  3,   1}, {  3,   1}, {  5,   2}, { 10,   3}, { 10,   3}, {  5,   2}, {  3,   1}, {  3,   1},
+        {  2,  -1}, {  2,  -2}, {  2,  -3}, { -8,  -4}, { -8,  -4}, {  2,  -3}, {  2,  -2}, {  2,  -1},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}
+      },
+      {
+        {-60, -50}, {-30, -30}, {-18, -10}, {-12, -10}, {-12, -10}, {-18, -10}, {-30, -30}, {-60, -50},
+        {-24, -25}, { -8, -10}, { -2,  -5}, {  6,   0}, {  6,   0}, { -2,  -5}, { -8, -10}, {-24, -25},
+        { -9, -10}, { 12,  -5}, { 14,  10}, { 14,  10}, { 14,  10}, { 14,  10}, { 12,  -5}, { -9, -10},
+        { -6, -10}, {  9,  -2}, { 10,   8}, { 18,  12}, { 18,  12}, { 10,   8}, {  9,  -2}, { -6, -10},
+        { -6, -10}, {  3,   0}, {  9,   8}, { 18,  10}, { 18,  10}, {  9,   8}, {  3,   0}, { -6, -10},
+        {-18, -10}, { -9,  -7}, { -6,  -4}, {  4,   6}, {  4,   6}, { -6,  -4}, { -9,  -7}, {-18, -10},
+        {-24, -20}, {-10, -10}, { -9,  -6}, { -9,  -3}, { -9,  -3}, { -9,  -6}, {-10, -10}, {-24, -20},
+        {-48, -30}, {-36, -15}, {-24, -10}, {-18, -10}, {-18, -10}, {-24, -10}, {-36, -15}, {-48, -30}
+      },
+      {
+        {-23,  -8}, { -8,  -3}, { -8,  -2}, { -8,  -1}, { -8,  -1}, { -8,  -2}, { -8,  -3}, {-23,  -8},
+        { -2,  -3}, {  5,   4}, {  3,   3}, {  0,   3}, {  0,   3}, {  3,   3}, {  5,   4}, { -2,  -3},
+        {  0,  -2}, {  8,   3}, {  7,   5}, {  5,   5}, {  5,   5}, {  7,   5}, {  8,   3}, {  0,  -2},
+        { -4,  -1}, {  7,   3}, { 10,   5}, { 12,   6}, { 12,   6}, { 10,   5}, {  7,   3}, { -4,  -1},
+        { -2,  -1}, {  6,   3}, {  9,   5}, { 12,   6}, { 12,   6}, {  9,   5}, {  6,   3}, { -2,  -1},
+        {  0,  -2}, {  8,   3}, { 10,   5}, {  8,   5}, {  8,   5}, { 10,   5}, {  8,   3}, {  0,  -2},
+        { -2,  -3}, { 10,   4}, {  5,   3}, {  2,   3}, {  2,   3}, {  5,   3}, { 10,   4}, { -2,  -3},
+        {-20,  -8}, { -6,  -3}, { -8,  -2}, { -9,  -1}, { -9,  -1}, { -8,  -2}, { -6,  -3}, {-20,  -8}
+      },
+      {
+        {  2,  -3}, {  2,   2}, {  5,   4}, {  7,   4}, {  7,   4}, {  5,   4}, {  2,   2}, {  2,  -3},
+        {  4,   1}, {  6,   2}, { 10,   5}, { 12,   5}, { 12,   5}, { 10,   5}, {  6,   2}, {  4,   1},
+        {  2,   2}, {  2,   2}, {  6,   5}, {  8,   6}, {  8,   6}, {  6,   5}, {  2,   2}, {  2,   2},
+        {  2,   2}, {  2,   3}, {  4,   6}, {  7,   6}, {  7,   6}, {  4,   6}, {  2,   3}, {  2,   2},
+        {  2,   2}, {  2,   3}, {  3,   6}, {  5,   6}, {  5,   6}, {  3,   6}, {  2,   3}, {  2,   2},
+        {  2,   2}, {  2,   3}, {  2,   5}, {  4,   6}, {  4,   6}, {  2,   5}, {  2,   3}, {  2,   2},
+        { -5,   1}, { -2,   2}, {  1,   5}, {  2,   5}, {  2,   5}, {  1,   5}, { -2,   2}, { -5,   1},
+        { -7,  -3}, { -7,   2}, { -5,   4}, { -3,   4}, { -3,   4}, { -5,   4}, { -7,   2}, { -7,  -3}
+      },
+      {
+        {  0, -12}, {  1,  -6}, {  1,  -2}, {  3,  -2}, {  3,  -2}, {  1,  -2}, {  1,  -6}, {  0, -12},
+        {  2,  -5}, {  3,  -2}, {  4,   1}, {  4,   3}, {  4,   3}, {  4,   1}, {  3,  -2}, {  2,  -5},
+        { -1,  -6}, {  2,   0}, {  3,   5}, {  4,   6}, {  4,   6}, {  3,   5}, {  2,   0}, { -1,  -6},
+        { -2,  -4}, {  2,   1}, {  4,   6}, {  5,   8}, {  5,   8}, {  4,   6}, {  2,   1}, { -2,  -4},
+        { -2,  -4}, {  2,  -1}, {  4,   5}, {  5,   8}, {  5,   8}, {  4,   5}, {  2,  -1}, { -2,  -4},
+        { -2,  -6}, {  2,  -2}, {  3,   3}, {  4,   4}, {  4,   4}, {  3,   3}, {  2,  -2}, { -2,  -6},
+        { -3,  -8}, {  1,  -5}, {  1,  -1}, {  0,   1}, {  0,   1}, {  1,  -1}, {  1,  -5}, { -3,  -8},
+        { -4, -15}, { -2,  -8}, { -1,  -5}, {  0,  -4}, {  0,  -4}, { -1,  -5}, { -2,  -8}, { -4, -15}
+      },
+      {
+        {-60, -37}, {-60, -18}, {-60, -13}, {-60,  -9}, {-60,  -9}, {-60, -13}, {-60, -18}, {-60, -37},
+        {-46, -25}, {-47, -13}, {-48,   2}, {-50,   4}, {-50,   4}, {-48,   2}, {-47, -13}, {-46, -25},
+        {-37, -15}, {-39,   2}, {-41,  10}, {-43,  15}, {-43,  15}, {-41,  10}, {-39,   2}, {-37, -15},
+        {-28, -15}, {-30,   2}, {-32,  15}, {-34,  20}, {-34,  20}, {-32,  15}, {-30,   2}, {-28, -15},
+        {-20, -15}, {-23,   2}, {-27,  15}, {-29,  20}, {-29,  20}, {-27,  15}, {-23,   2}, {-20, -15},
+        {-10, -15}, {-12,   2}, {-15,  10}, {-20,  15}, {-20,  15}, {-15,  10}, {-12,   2}, {-10, -15},
+        { 25, -20}, { 28, -10}, {  5,   2}, {-14,   5}, {-14,   5}, {  5,   2}, { 28, -10}, { 25, -20},
+        { 27, -40}, { 33, -25}, { 20, -15}, {-12, -10}, {-12, -10}, { 20, -15}, { 33, -25}, { 27, -40}
+      },
+      {
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
+        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}
+      }
+    },
+    {
+    }
+  };
+
+  // piece-square table differs from built-in one, so it can't be taken from FiguresManager
+  bool customPositionEvaluations_{};
+
+  enum class ParamType { Int, Score, Score32 };
+
+  struct Param
+  {
+    std::string name_;
+    ParamType   type_;
+    size_t      offset_;
+    int         size_;
+  };
+
+  // list of all coefficients in the order they are written to file
+  static std::vector<Param> const& params();
+
+  // text file contains lines "name v0 v1 ...", ScoreType32 is written as opening/endgame pair
+  // binary file is all values in params() order with header
+  bool load(std::string const& fname);
+  bool save(std::string const& fname, bool binary) const;
 
-  static ScoreType32 knightPinned_;
-  static ScoreType32 bishopPinned_;
-  static ScoreType32 rookPinned_;
-  static ScoreType32 queenPinned_;
+  // name, name[i], name[i].0 or name[i].1 - opening/endgame part of ScoreType32
+  bool set(std::string const& name, int value);
 
-  static int bishopKnightMat_[64];
+  // mirror piece-square table for white color
+  void update();
 
-  // basic king pressure
-  static ScoreType32 kingDistanceBonus_[8][8];
+  // built-in coefficients
+  static EvalCoefficients const& defaults();
 
-  // position evaluation. 0 - black color, 1 - white color; color,type,pos
-  static ScoreType32 positionEvaluations_[2][8][64];
+  // built-in piece-square table. is accumulated by FiguresManager incrementally
+  static ScoreType32 basePositionEvaluations_[2][8][64];
 
   static void initialize();
 };
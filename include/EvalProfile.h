@@ -0,0 +1,145 @@
+/*************************************************************
+EvalProfile.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+#pragma once
+
+#include "xcommon.h"
+#include "EvalCoefficients.h"
+#include "chrono"
+
+#if (defined _MSC_VER)
+#include <intrin.h>
+#elif (defined __x86_64__ || defined __i386__)
+#include <x86intrin.h>
+#endif
+
+namespace NEngine
+{
+
+// CPU ticks. for relative comparison only
+inline uint64 cpu_cycles()
+{
+#if (defined _MSC_VER || defined __x86_64__ || defined __i386__)
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Evaluator statistics. counters are collected only if EVAL_PROFILE is defined
+struct EvalProfile
+{
+  enum Section
+  {
+    AttacksMasks,
+    Knights,
+    Bishops,
+    Rooks,
+    Queens,
+    KingPressure,
+    Passers,
+    SectionsNum
+  };
+
+  uint64 calls_{};
+  uint64 specialCases_{};
+  uint64 lazyExits_[EvalCoefficients::LazyStagesNum] = {};
+  uint64 evalHashProbes_{};
+  uint64 evalHashHits_{};
+  uint64 pawnHashProbes_{};
+  uint64 pawnHashHits_{};
+  uint64 materialHashProbes_{};
+  uint64 materialHashHits_{};
+  uint64 sectionCalls_[SectionsNum] = {};
+  uint64 sectionCycles_[SectionsNum] = {};
+
+  void clear();
+  EvalProfile& operator += (EvalProfile const& other);
+  void print(std::ostream& os) const;
+
+  static char const* sectionName(Section section);
+
+  // measures cycles spent in section till the end of scope
+  class Scope
+  {
+  public:
+    Scope(EvalProfile& profile, Section section) :
+      profile_(profile), section_(section), start_(cpu_cycles())
+    {}
+
+    ~Scope()
+    {
+      profile_.sectionCalls_[section_]++;
+      profile_.sectionCycles_[section_] += cpu_cycles() - start_;
+    }
+
+  private:
+    EvalProfile& profile_;
+    Section section_;
+    uint64 start_;
+  };
+};
+
+#ifdef EVAL_PROFILE
+  #define EVAL_PROFILE_SCOPE(section) EvalProfile::Scope profile_scope_(profile_, EvalProfile::section)
+  #define EVAL_PROFILE_INC(counter) ++profile_.counter
+#else
+  #define EVAL_PROFILE_SCOPE(section)
+  #define EVAL_PROFILE_INC(counter)
+#endif
+
+// distribution of terms not evaluated yet after each lazy eval stage, absolute values
+// is used to calibrate EvalCoefficients::lazyMargins_
+struct LazyEvalStat
+{
+  static const int BucketSize = 8;
+  static const int BucketsNum = 256;
+  static const int StagesNum = EvalCoefficients::LazyStagesNum;
+
+  uint64 hist_[StagesNum][BucketsNum] = {};
+
+  void add(int stage, int remaining)
+  {
+    int bucket = (remaining < 0 ? -remaining : remaining) / BucketSize;
+    if (bucket >= BucketsNum)
+      bucket = BucketsNum - 1;
+    hist_[stage][bucket]++;
+  }
+
+  void clear();
+  LazyEvalStat& operator += (LazyEvalStat const& other);
+  uint64 count(int stage) const;
+
+  // the smallest margin that covers given fraction of evaluations. 0 if no statistics
+  int margin(int stage, double fraction) const;
+
+  void print(std::ostream& os, double fraction) const;
+
+  static char const* stageName(int stage);
+};
+
+// all terms of single evaluation. white side point of view
+struct EvalTrace
+{
+  struct Term
+  {
+    std::string name_;
+    ScoreType32 score32_;
+    ScoreType score_{};
+  };
+
+  std::vector<Term> terms_;
+  std::string specialCase_;
+  int phase_{};
+  int opening_{};
+  int endGame_{};
+  int scoreOffset_{};
+  int scoreMultip_{ 1 };
+  ScoreType result_{};
+
+  void clear();
+  void add(char const* name, ScoreType32 const& score32, ScoreType score);
+  void print(std::ostream& os) const;
+};
+
+} // NEngine
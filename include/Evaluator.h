@@ -5,6 +5,7 @@
 
 #include "xoptimize.h"
 #include "EvalCoefficients.h"
+#include "EvalProfile.h"
 #include "Board.h"
 #include "HashTable.h"
 #include "xindex.h"
@@ -13,6 +14,8 @@
 namespace NEngine
 {
 
+class Bitbases;
+
 class Evaluator
 {
 public:
@@ -87,6 +90,18 @@ public:
   int betta_{};
 
   Board const* board_{ nullptr };
+  EvalCoefficients const* coeff_{ &EvalCoefficients::defaults() };
+  Bitbases const* bitbases_{ nullptr };
+
+  EvalProfile profile_;
+  EvalTrace* trace_{ nullptr };
+
+  // lazy evaluation is allowed for current position
+  bool lazyEval_{};
+  // calibration mode. all terms are evaluated, remaining part is collected after each stage
+  bool lazyCalibration_{};
+  int lazyScores_[EvalCoefficients::LazyStagesNum] = {};
+  LazyEvalStat lazyStat_;
 
 #ifdef USE_EVAL_HASH_PW
   PHashTable ehash_{ 18 };
@@ -105,18 +120,29 @@ public:
 #endif
 
 public:
-  static const int lazyThreshold_ = 1200;
-
   void initialize(Board const* board
 #ifdef USE_EVAL_HASH_ALL
   , AHashTable* evh
 #endif
     );
+  void setCoefficients(EvalCoefficients const* coeff);
+  // endgame bitbases are owned by engine
+  void setBitbases(Bitbases const* bitbases);
   void reset();
 
   ScoreType operator () (ScoreType alpha, ScoreType betta);
   ScoreType materialScore() const;
 
+  // full evaluation with all terms written to trace
+  ScoreType trace(EvalTrace& trace);
+
+  EvalProfile const& profile() const { return profile_; }
+  void clearProfile() { profile_.clear(); }
+
+  void setLazyCalibration(bool on) { lazyCalibration_ = on; }
+  LazyEvalStat const& lazyStat() const { return lazyStat_; }
+  void clearLazyStat() { lazyStat_.clear(); }
+
   inline void prefetch()
   {
 #ifdef USE_EVAL_HASH_PW
@@ -128,6 +154,27 @@ public:
 #endif
   }
 
+  // the same for any board. eval hash too because it is probed first
+  inline void prefetch(Board const& board)
+  {
+#ifdef USE_EVAL_HASH_ALL
+    if (ev_hash_)
+      ev_hash_->prefetch(board.fmgr().hashCode());
+#endif
+
+#ifdef USE_EVAL_HASH_PW
+    ehash_.prefetch(board.fmgr().kpwnCode());
+#endif
+
+#ifdef USE_EVAL_HASH_MD
+    fhash_.prefetch(board.fmgr().fgrsCode());
+#endif
+  }
+
+  // evaluate boards one by one with the same Evaluator. hash items for next boards are prefetched in advance
+  // scores are given from side to move point of view
+  void evaluateBatch(Board const* boards, size_t count, ScoreType* scores);
+
   static const int colored_y_[2][8];
   static const int promo_y_[2];
   static const int delta_y_[2];
@@ -155,12 +202,35 @@ private:
     return Figure::ColorBlack  == board_->color() ? -score : score;
   }
 
+  void traceTerm(char const* name, ScoreType32 const& score32, PhaseInfo const& phase)
+  {
+    if (trace_)
+      trace_->add(name, score32, lipolScore(score32, phase));
+  }
+
+  // partial score after given stage. true if it is so far from [alpha, betta] that the rest could be skipped
+  bool lazyExit(EvalCoefficients::LazyStage stage, ScoreType32 const& score32, PhaseInfo const& phase, ScoreType& score)
+  {
+    if (!lazyEval_ && !lazyCalibration_)
+      return false;
+    score = considerColor(lipolScore(score32, phase));
+    if (lazyCalibration_) {
+      lazyScores_[stage] = score;
+      return false;
+    }
+    auto margin = coeff_->lazyMargins_[stage];
+    return score < alpha_ - margin || score > betta_ + margin;
+  }
+
   /// calculates absolute position evaluation
   ScoreType evaluate(ScoreType alpha, ScoreType betta);
 
   // multiple coefficients for opening/endgame
   PhaseInfo detectPhase() const;
 
+  // the same as FiguresManager::score() but with own piece-square table
+  ScoreType32 positionScore() const;
+
   // calculate or take from hash
   // pawns structure for middle & end game + king's pawn shield
   PasserInfo hashedEvaluation();
@@ -235,6 +305,13 @@ private:
     2 * Figure::figureWeight_[Figure::TypeBishop] +
     2 * Figure::figureWeight_[Figure::TypeRook] +
     Figure::figureWeight_[Figure::TypeQueen];
+
+  // how many boards ahead hash items are prefetched in batch evaluation
+  static const size_t batchPrefetchDistance_ = 4;
 };
 
+// batch evaluation split between threadsN threads, each with own Evaluator and hash tables
+void evaluateBatch(Board const* boards, size_t count, ScoreType* scores, int threadsN,
+                   EvalCoefficients const& coeff = EvalCoefficients::defaults());
+
 } // NEngine
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Move.h"
+#include "MappedFile.h"
 #include "fstream"
 
 namespace NEngine
@@ -84,6 +85,35 @@ ALIGN_MSC(2) struct ALIGN_GCC(2) HItem
 };
 #pragma pack(pop)
 
+// snapshot file is header followed by items
+#pragma pack(push, 1)
+struct HashHeader
+{
+  char   magic_[8]{ 's', 'h', 'a', 'l', 'l', 'o', 'w', 'H' };
+  uint32 version_{ HashSnapshot_Version };
+  uint32 itemSize_{};
+  uint64 size_{};
+  // generation of items
+  uint16 movesCount_{};
+  uint8  reserved_[38]{};
+
+  bool valid(size_t itemSize, size_t fileSize) const
+  {
+    HashHeader const ref;
+    return std::equal(magic_, magic_ + sizeof(magic_), ref.magic_)
+      && version_ == HashSnapshot_Version
+      && itemSize_ == itemSize
+      && size_ > 0 && (size_ & (size_ - 1)) == 0
+      // size_ is checked before multiplication, so product doesn't overflow
+      && fileSize >= sizeof(HashHeader) && itemSize > 0
+      && size_ <= (fileSize - sizeof(HashHeader)) / itemSize
+      && fileSize == sizeof(HashHeader) + size_ * itemSize;
+  }
+};
+#pragma pack(pop)
+
+static_assert(sizeof(HashHeader) == 64, "invalid hash header size");
+
 template <class ITEM>
 class HashTable
 {
@@ -95,12 +125,34 @@ public:
     resize(size);
   }
 
+  // mapped snapshot is copied to own buffer
+  HashTable(HashTable const& other)
+  {
+    *this = other;
+  }
+
+  HashTable& operator = (HashTable const& other)
+  {
+    if(this == &other)
+      return *this;
+    mapped_.reset();
+    buffer_.assign(other.items_, other.items_ + other.size_);
+    items_ = buffer_.data();
+    size_ = other.size_;
+    szMask_ = other.szMask_;
+    movesCount_ = other.movesCount_;
+    return *this;
+  }
+
   void resize(size_t sz)
   {
     if(sz == 0)
       return;
     X_ASSERT(sz > 24, "hash table size is too large");
+    mapped_.reset();
     buffer_.resize((size_t)1 << sz);
+    items_ = buffer_.data();
+    size_ = buffer_.size();
     szMask_ = size() - 1;
     movesCount_ = 0;
   }
@@ -108,17 +160,22 @@ public:
   void clear()
   {
     movesCount_ = 0;
-    std::fill(buffer_.begin(), buffer_.end(), ITEM{});
+    std::fill(items_, items_ + size_, ITEM{});
   }
 
   inline size_t size() const
   {
-    return buffer_.size();
+    return size_;
   }
 
   inline bool empty() const
   {
-    return buffer_.empty();
+    return size_ == 0;
+  }
+
+  inline bool mapped() const
+  {
+    return mapped_ != nullptr;
   }
 
   inline void inc()
@@ -131,54 +188,71 @@ public:
     return movesCount_;
   }
 
+  // snapshot is mapped copy-on-write and used as is. pages are read on first access,
+  // so table is available at once. file isn't changed. false if header doesn't match this table
   bool load(std::string const& fname)
   {
-    movesCount_ = 0;
-    std::ifstream ifs(fname, std::ifstream::binary);
-    if(!ifs)
-      return false;
-    ifs.seekg(0, ifs.end);
-    size_t length = ifs.tellg() / sizeof(ITEM);
-    ifs.seekg(0, ifs.beg);
-    auto sz = log2(length);
-    if(sz == 0)
+    HashHeader header;
+    {
+      std::ifstream ifs(fname, std::ifstream::binary);
+      if(!ifs.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+      ifs.seekg(0, ifs.end);
+      if(!header.valid(sizeof(ITEM), static_cast<size_t>(ifs.tellg())))
+        return false;
+    }
+    std::unique_ptr<MappedFile> mapped{ new MappedFile };
+    if(!mapped->load(fname, true) || !header.valid(sizeof(ITEM), mapped->size()))
       return false;
-    X_ASSERT( (((size_t)1) << sz) != length, "invalid hash size detected");
-    resize(sz);
-    ifs.read(reinterpret_cast<char*>(buffer_.data()), size()*sizeof(ITEM));
-    return (bool)ifs;
+    mapped_ = std::move(mapped);
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    items_ = reinterpret_cast<ITEM*>(mapped_->writableData() + sizeof(HashHeader));
+    size_ = header.size_;
+    szMask_ = size_ - 1;
+    movesCount_ = header.movesCount_;
+    return true;
   }
 
   bool save(std::string const& fname) const
   {
-    if(buffer_.empty())
+    if(empty())
       return false;
     std::ofstream ofs(fname, std::ofstream::binary);
     if(!ofs)
       return false;
-    ofs.write(reinterpret_cast<char const*>(buffer_.data()), size()*sizeof(ITEM));
+    HashHeader header;
+    header.itemSize_ = sizeof(ITEM);
+    header.size_ = size_;
+    header.movesCount_ = movesCount_;
+    ofs.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<char const*>(items_), size()*sizeof(ITEM));
     return (bool)ofs;
   }
 
 #if !(defined __ANDROID__ || defined __GNUC__)
   inline void prefetch(const uint64 code)
   {
-    _mm_prefetch((char*)&buffer_[code & szMask_], _MM_HINT_T0);
+    _mm_prefetch((char*)&items_[code & szMask_], _MM_HINT_T0);
   }
 #else
   inline void prefetch(const uint64 & code)
   {
-    __builtin_prefetch((char*)&buffer_[code & szMask_]);
+    __builtin_prefetch((char*)&items_[code & szMask_]);
   }
 #endif // !__ANDROID__
 protected:
 
   inline ITEM & operator [] (const uint64 code)
   {
-    return buffer_[code & szMask_];
+    return items_[code & szMask_];
   }
 
+  // items are in own buffer or in mapped snapshot
+  ITEM* items_{};
+  size_t size_{};
   std::vector<ITEM> buffer_;
+  std::unique_ptr<MappedFile> mapped_;
   size_t szMask_{0};
   uint16 movesCount_{0};
 };
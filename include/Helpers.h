@@ -7,6 +7,7 @@ Helpers.h - Copyright (C) 2016 by Dmitry Sultanov
 #undef _USE_LOG
 
 #include "Board.h"
+#include "string_view"
 
 namespace NEngine
 {
@@ -20,15 +21,15 @@ enum class eMoveNotation
   mnSAN
 };
 
-eMoveNotation detectNotation(std::string const& str);
+eMoveNotation detectNotation(std::string_view str);
 
 /// e2e4 - Smith notation
 std::string moveToStr(Move const move, bool wbf);
-Move strToMove(std::string const& str, Board const& board);
-Move strToMove(std::string const& str);
+Move strToMove(std::string_view str, Board const& board);
+Move strToMove(std::string_view str);
 
 /// Rxf5+ - Standard algebraic notation
-Move parseSAN(Board const& board, std::string const& str);
+Move parseSAN(Board const& board, std::string_view str);
 std::string printSAN(Board & board, const Move move);
 
 bool load(Board &, std::istream &);
@@ -42,7 +43,44 @@ bool is_any_of(std::string const& of, char c);
 std::vector<std::string> split(std::string const& str, std::function<bool(char)> const& pred);
 
 /// initialize from FEN
-bool fromFEN(std::string const& i_fen, Board& board);
+bool fromFEN(std::string_view i_fen, Board& board);
+
+/// EPD line: FEN and operations "bm", "am", "dmin", "dmax", "hash", "moves" and "score".
+/// views refer to parsed line. move lists are separated with spaces, see nextToken()
+struct EpdView
+{
+  std::string_view fen_;
+  std::string_view bm_;
+  std::string_view am_;
+  std::string_view moves_;
+  int dmin_{};
+  int dmax_{};
+  int score_{};
+  // score is given. it could be 0
+  bool hasScore_{};
+  uint64 hash_{};
+};
+
+/// false if there are less than 4 FEN fields. unknown operations are skipped
+bool parseEPD(std::string_view line, EpdView& epd);
+
+/// cuts next token separated with spaces or tabs from the beginning of str. empty if there is nothing left
+std::string_view nextToken(std::string_view& str);
+
+/// PGN game: FEN and Result tags and moves of main line. views refer to parsed text
+struct PgnView
+{
+  std::string_view fen_;
+  std::string_view result_;
+  std::vector<std::string_view> moves_;
+};
+
+/// comments, variations, NAGs, move numbers and annotation symbols are skipped. false if there is nothing
+bool parsePGN(std::string_view game, PgnView& pgn);
+
+/// cuts next game from the beginning of PGN text. game ends where tags of the next one begin.
+/// false if there are no games left
+bool nextGame(std::string_view& text, std::string_view& game);
 
 /// save current position to FEN
 std::string toFEN(Board const& board);
@@ -55,23 +93,6 @@ inline bool is_nothing_between(int from, int to, const BitMask inv_mask)
   return (btw_msk & inv_mask) == btw_msk;
 }
 
-struct XCounter
-{
-  static int count_;
-  int var0_;
-  int* var_;
-  XCounter(int* var)
-  {
-    var_ = var;
-    if(var_)
-      var0_ = *var_;
-  }
-  ~XCounter()
-  {
-    if(var_)
-      count_ += *var_ - var0_;
-  }
-};
 
 #ifdef _USE_LOG
 void addLog(std::string const& str);
@@ -3,6 +3,8 @@
 #include "xcommon.h"
 #include "xbitmath.h"
 #include "Figure.h"
+#include "Move.h"
+#include "string"
 
 namespace NEngine
 {
@@ -72,18 +74,102 @@ protected:
   //unsigned bad_count_{};
 };
 
-extern History history_[2][NumOfFields][NumOfFields];
+// history of quiet moves [moved type][to] following previous move made 1 or 2 plies ago
+using ContinuationHistory = History[Figure::TypesNum][NumOfFields];
 
-void normalize_history(int n);
-void clear_history();
-void max_history();
-void save_history(std::string const& fname);
-void load_history(std::string const& fname);
-
-static inline History & history(Figure::Color c, int from, int to)
+// previous move made i+1 plies ago. null-move if there is no such move
+template <class BOARD>
+inline auto previousMove(BOARD const& board, int i) -> decltype(&board.reverseUndo(i))
 {
-  X_ASSERT((unsigned)from > 63 || (unsigned)to > 63, "invalid history field index");
-  return history_[c][from][to];
+  if(board.halfmovesCount() <= i)
+    return nullptr;
+  auto const& undo = board.reverseUndo(i);
+  if(undo.is_nullmove() || !undo.moved_type_)
+    return nullptr;
+  return &undo;
 }
 
+// move ordering statistics collected by search. each engine has its own tables shared by its threads
+class SearchHistory
+{
+public:
+  SearchHistory();
+
+  void clear();
+  void save(std::string const& fname) const;
+  void load(std::string const& fname);
+
+  // empty tables for move generation outside of search
+  static SearchHistory const& empty();
+
+  inline History& history(Figure::Color c, int from, int to)
+  {
+    X_ASSERT((unsigned)from > 63 || (unsigned)to > 63, "invalid history field index");
+    return history_[c][from][to];
+  }
+
+  inline History const& history(Figure::Color c, int from, int to) const
+  {
+    X_ASSERT((unsigned)from > 63 || (unsigned)to > 63, "invalid history field index");
+    return history_[c][from][to];
+  }
+
+  inline History& capturesHistory(Figure::Color c, Figure::Type type, int to, Figure::Type eaten)
+  {
+    X_ASSERT((unsigned)to > 63, "invalid history field index");
+    return capturesHistory_[c][type][to][eaten];
+  }
+
+  inline History const& capturesHistory(Figure::Color c, Figure::Type type, int to, Figure::Type eaten) const
+  {
+    X_ASSERT((unsigned)to > 63, "invalid history field index");
+    return capturesHistory_[c][type][to][eaten];
+  }
+
+  template <class BOARD>
+  inline ContinuationHistory* continuationHistory(BOARD const& board, int i)
+  {
+    auto const* undo = previousMove(board, i);
+    if(!undo)
+      return nullptr;
+    return &continuationHistory_[i][board.color()][undo->moved_type_][undo->move_.to()];
+  }
+
+  template <class BOARD>
+  inline ContinuationHistory const* continuationHistory(BOARD const& board, int i) const
+  {
+    auto const* undo = previousMove(board, i);
+    if(!undo)
+      return nullptr;
+    return &continuationHistory_[i][board.color()][undo->moved_type_][undo->move_.to()];
+  }
+
+  template <class BOARD>
+  inline Move counterMove(BOARD const& board) const
+  {
+    auto const* undo = previousMove(board, 0);
+    if(!undo)
+      return Move{ true };
+    return counterMoves_[board.color()][undo->moved_type_][undo->move_.to()];
+  }
+
+  template <class BOARD>
+  inline void setCounterMove(BOARD const& board, Move const move)
+  {
+    if(auto const* undo = previousMove(board, 0))
+      counterMoves_[board.color()][undo->moved_type_][undo->move_.to()] = move;
+  }
+
+private:
+  History history_[2][NumOfFields][NumOfFields];
+
+  // quiet move, that refuted previous opponent's move [color][moved type][to]
+  Move counterMoves_[2][Figure::TypesNum][NumOfFields];
+
+  ContinuationHistory continuationHistory_[2][2][Figure::TypesNum][NumOfFields];
+
+  // history of captures [color][moved type][to][captured type]
+  History capturesHistory_[2][Figure::TypesNum][NumOfFields][Figure::TypesNum];
+};
+
 }
\ No newline at end of file
@@ -0,0 +1,171 @@
+/*************************************************************
+Logger.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+#pragma once
+
+#include "xcommon.h"
+#include "xtime.h"
+#include "atomic"
+#include "thread"
+#include "mutex"
+#include "fstream"
+#include "ostream"
+#include "string_view"
+#include "cstring"
+#include "type_traits"
+#include "unordered_map"
+#include "functional"
+#include "memory"
+
+namespace NEngine
+{
+
+enum class LogLevel : uint8 { Debug, Info, Warning, Error, None };
+
+#pragma pack (push, 1)
+// fixed size item of ring buffer. it's plain text or event of some type, which is formatted by writer thread
+struct LogRecord
+{
+  enum Flags
+  {
+    // protocol output. it's written to output stream and to log
+    Output  = 1,
+    // text is continued in the next record
+    Partial = 2,
+    // continuation of previous record
+    Continued = 4
+  };
+
+  static constexpr uint16 TextType = 0;
+  // the first record of binary file
+  static constexpr uint16 HeaderType = 0xffff;
+  static constexpr size_t HeaderSize = 16;
+  static constexpr size_t DataSize = Logger_RecordSize - HeaderSize;
+
+  // microseconds since logger start
+  int64    time_{};
+  uint16   type_{};
+  LogLevel level_{};
+  uint8    flags_{};
+  uint16   size_{};
+  uint16   reserved_{};
+  char     data_[DataSize];
+};
+#pragma pack (pop)
+
+static_assert(sizeof(LogRecord) == Logger_RecordSize, "invalid log record size");
+
+// bounded lock-free queue with background writer thread. log record is dropped if queue is full,
+// but protocol output waits for free space. records are written in the order of push
+class Logger
+{
+public:
+  // appends text of event record. is called by writer thread
+  using Formatter = std::function<void(LogRecord const&, std::string&)>;
+
+  Logger();
+  ~Logger();
+
+  Logger(Logger const&) = delete;
+  Logger& operator = (Logger const&) = delete;
+
+  // protocol output. null to discard it
+  void setOutput(std::ostream* os);
+  // all records with level not less than given one are written with time stamp. empty name closes log
+  bool openLog(std::string const& fname, LogLevel level = LogLevel::Debug);
+  // events are written as is to binary file. it's array of LogRecord starting with header. empty name closes it
+  bool openBinary(std::string const& fname);
+  void setFormatter(uint16 type, Formatter const& formatter);
+
+  // is there anybody who needs records of this level
+  bool enabled(LogLevel level) const
+  {
+    return level >= level_.load(std::memory_order_relaxed);
+  }
+
+  // long text is split into several records, which are pushed or dropped together
+  void write(LogLevel level, std::string_view text);
+  // protocol output line. it's never dropped
+  void output(std::string_view text);
+
+  template <class T>
+  bool event(uint16 type, LogLevel level, T const& data, bool output = false)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "event should be trivially copyable");
+    static_assert(sizeof(T) <= LogRecord::DataSize, "event is too big");
+    X_ASSERT(type == LogRecord::TextType || type == LogRecord::HeaderType, "invalid event type");
+    if(!output && !enabled(level))
+      return false;
+    return push(type, level, output ? LogRecord::Output : 0, &data, sizeof(T));
+  }
+
+  // waits till all records pushed before are written
+  void flush();
+  size_t dropped() const { return dropped_; }
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> seq_;
+    LogRecord rec_;
+  };
+
+  // data longer than one record occupies several consecutive cells
+  bool push(uint16 type, LogLevel level, uint8 flags, void const* data, size_t size);
+  void writerLoop();
+  // writes all ready records. false if there were no one
+  bool drain();
+  void process(LogRecord const& rec);
+  void updateLevel();
+
+  std::unique_ptr<Cell[]> cells_;
+  size_t const mask_{ Logger_Capacity - 1 };
+  std::atomic<size_t> enqueue_{ 0 };
+  // is changed by writer thread only
+  size_t dequeue_{ 0 };
+  std::atomic<size_t> written_{ 0 };
+  std::atomic<size_t> dropped_{ 0 };
+  std::atomic<LogLevel> level_{ LogLevel::None };
+  NTime::point start_;
+
+  // protects sinks. producers don't touch it
+  std::mutex mutex_;
+  std::ostream* os_{};
+  std::ofstream log_;
+  LogLevel logLevel_{ LogLevel::None };
+  std::ofstream bin_;
+  std::unordered_map<uint16, Formatter> formatters_;
+  // text collected from records till the last part
+  std::string text_;
+
+  std::atomic<bool> stop_{ false };
+  std::thread writer_;
+};
+
+// std::ostream over logger. each line is written as protocol output on flush. it shouldn't be shared by threads
+class LogStream : public std::ostream
+{
+  class Buffer : public std::streambuf
+  {
+  public:
+    explicit Buffer(Logger& logger) : logger_(logger) {}
+
+  protected:
+    int overflow(int c) override;
+    std::streamsize xsputn(char const* s, std::streamsize n) override;
+    int sync() override;
+
+  private:
+    Logger& logger_;
+    std::string line_;
+  };
+
+public:
+  explicit LogStream(Logger& logger);
+  ~LogStream();
+
+private:
+  Buffer buffer_;
+};
+
+} // NEngine
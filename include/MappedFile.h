@@ -0,0 +1,41 @@
+/*************************************************************
+MappedFile.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+#pragma once
+
+#include "xcommon.h"
+
+namespace NEngine
+{
+
+// read-only file contents. it's mapped to memory if possible, otherwise read to buffer
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(MappedFile const&) = delete;
+  MappedFile& operator = (MappedFile const&) = delete;
+
+  // writable contents are mapped copy-on-write. changes aren't written back to file
+  bool load(std::string const& fname, bool writable = false);
+  void clear();
+
+  uint8 const* data() const { return data_; }
+  // nullptr if file isn't loaded as writable
+  uint8* writableData() { return writable_ ? data_ : nullptr; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+private:
+  uint8* data_{};
+  size_t size_{};
+  // whole file if mapping isn't available
+  std::vector<uint8> buffer_;
+  void* mapped_{};
+  size_t mappedSize_{};
+  bool writable_{};
+};
+
+} // NEngine
@@ -170,22 +170,30 @@ xlist<MOVE, NUM> generate(BOARD const& board)
   return moves;
 }
 
+// staged moves generator: hash move, good captures, killers, counter move,
+// quiet moves sorted by history, bad captures and quiets
 template <class BOARD, class MOVE>
 struct FastGenerator
 {
   using MovesList  = xlist<MOVE, NumOfFields>;
   using MovesListU = xlist<MOVE, 128>;
 
-  enum Order { oEscape, oHash, oGenCaps, oCaps, oKiller, oGenUsual, oUsual, oWeak, oWeakUsual } order_{ oEscape };
+  enum Order { oEscape, oHash, oGenCaps, oCaps, oKiller, oKiller2, oCounter, oGenUsual, oUsual, oWeak, oWeakUsual } order_{ oEscape };
 
-  FastGenerator(BOARD const& board, MOVE const hmove, MOVE const killer) :
+  FastGenerator(BOARD const& board, SearchHistory const& hist, MOVE const hmove, MOVE const killer, MOVE const killer2 = MOVE{ true }, MOVE const counter = MOVE{ true }) :
     board_(board),
-    cg_(board), ug_(board), eg_(board, hmove, killer),
+    cg_(board, hist), ug_(board, hist), eg_(board, hist, hmove, killer),
     hmove_(hmove),
-    killer_(killer)
+    killer_(killer),
+    killer2_(killer2),
+    counter_(counter)
   {
     if(killer_ == hmove_)
       killer_ = MOVE{ true };
+    if(killer2_ == hmove_ || killer2_ == killer_)
+      killer2_ = MOVE{ true };
+    if(counter_ == hmove_ || counter_ == killer_ || counter_ == killer2_)
+      counter_ = MOVE{ true };
     if(!board.underCheck())
       order_ = oHash;
   }
@@ -217,8 +225,6 @@ struct FastGenerator
       {
         if(*move == hmove_)
           continue;
-        if (*move == killer_)
-          killer_ = MOVE{ true };
         if(board_.see(*move, 0))
         {
           move->set_ok();
@@ -226,23 +232,25 @@ struct FastGenerator
         }
         weak_.push_back(*move);
       }
-      order_ = killer_ ? oKiller : oGenUsual;
+      order_ = oKiller;
     }
     if(order_ == oKiller)
     {
-      X_ASSERT(!killer_, "try to make do non-exsisting killer");
-      order_ = oGenUsual;
-      bool capture = killer_.new_type() || board_.getField(killer_.to())
-        || (killer_.to() > 0 && board_.enpassant() == killer_.to() && board_.getField(killer_.from()).type() == Figure::TypePawn);
-      if (!capture && board_.possibleMove(killer_) && board_.validateMove(killer_) && board_.see(killer_, 0))
-      {
-        X_ASSERT(!board_.moveExists(killer_), "non-existing killer");
-        killer_.set_ok();
+      order_ = oKiller2;
+      if(quiet(killer_))
         return &killer_;
-      }
-      else
-        killer_ = MOVE{ true };
-      X_ASSERT(!capture && board_.moveExists(killer_), "killer was not detected as valid move");
+    }
+    if(order_ == oKiller2)
+    {
+      order_ = oCounter;
+      if(quiet(killer2_))
+        return &killer2_;
+    }
+    if(order_ == oCounter)
+    {
+      order_ = oGenUsual;
+      if(quiet(counter_))
+        return &counter_;
     }
     if(order_ == oGenUsual)
     {
@@ -253,7 +261,7 @@ struct FastGenerator
     {
       while(auto* move = ug_.next())
       {
-        if(*move == hmove_ || *move == killer_)
+        if(*move == hmove_ || *move == killer_ || *move == killer2_ || *move == counter_)
           continue;
         if(board_.see(*move, 0))
         {
@@ -292,6 +300,25 @@ struct FastGenerator
     return nullptr;
   }
 
+  // killer or counter move is tried before other quiets if it's valid and safe. otherwise it's reset
+  // to be generated as usual move
+  bool quiet(MOVE& move)
+  {
+    if(!move)
+      return false;
+    bool capture = move.new_type() || board_.getField(move.to())
+      || (move.to() > 0 && board_.enpassant() == move.to() && board_.getField(move.from()).type() == Figure::TypePawn);
+    if(!capture && board_.possibleMove(move) && board_.validateMove(move) && board_.see(move, 0))
+    {
+      X_ASSERT(!board_.moveExists(move), "non-existing killer");
+      move.set_ok();
+      return true;
+    }
+    X_ASSERT(!capture && board_.moveExists(move) && board_.validateMove(move) && board_.see(move, 0), "killer was not detected as valid move");
+    move = MOVE{ true };
+    return false;
+  }
+
   CapsGenerator<BOARD, MOVE> cg_;
   UsualGenerator<BOARD, MOVE> ug_;
   EscapeGenerator<BOARD, MOVE> eg_;
@@ -302,6 +329,8 @@ struct FastGenerator
   BOARD const& board_;
   MOVE hmove_;
   MOVE killer_;
+  MOVE killer2_;
+  MOVE counter_;
 };
 
 template <class BOARD, class MOVE>
@@ -312,9 +341,9 @@ struct TacticalGenerator
   enum Order { oEscape, oHash, oGenCaps, oCaps, oGenChecks, oChecks, oStop }
   order_{ oEscape };
 
-  TacticalGenerator(BOARD const& board, MOVE const hmove, int depth) :
+  TacticalGenerator(BOARD const& board, SearchHistory const& hist, MOVE const hmove, int depth) :
     board_(board),
-    cg_(board), ckg_(board), eg_(board, hmove) ,hmove_(hmove), depth_(depth)
+    cg_(board, hist), ckg_(board, hist), eg_(board, hist, hmove) ,hmove_(hmove), depth_(depth)
   {
     if(!board.underCheck())
       order_ = oHash;
@@ -0,0 +1,105 @@
+/*************************************************************
+PackedPosition.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+#pragma once
+
+#include "xcommon.h"
+#include "Move.h"
+#include "MappedFile.h"
+#include "fstream"
+
+namespace NEngine
+{
+
+class Board;
+
+enum class eGameResult : uint8
+{
+  grUnknown,
+  grWhiteWins,
+  grDraw,
+  grBlackWins
+};
+
+#pragma pack (push, 1)
+// position in 32 bytes. figures are stored in order of occupied fields, 4 bits each: color << 3 | type
+struct PackedPosition
+{
+  enum Flags
+  {
+    White     = 1,
+    Castle_K  = 2,
+    Castle_Q  = 4,
+    Castle_k  = 8,
+    Castle_q  = 16,
+    HasScore  = 32
+  };
+
+  uint64 occupied_{};
+  uint8  figures_[16]{};
+  uint8  flags_{};
+  // en-passant field. 0 if there is no one
+  uint8  enpassant_{};
+  uint8  fifty_{};
+  eGameResult result_{};
+  // from side to move point of view
+  int16  score_{};
+  // from | to << 6 | new type << 12. 0 if there is no move
+  uint16 move_{};
+
+  bool hasScore() const { return (flags_ & HasScore) != 0; }
+  Move move() const;
+  void setMove(Move const& move);
+};
+#pragma pack (pop)
+
+static_assert(sizeof(PackedPosition) == 32, "invalid packed position size");
+
+// false if there are more than 32 figures
+bool pack(Board const& board, PackedPosition& pos);
+// figures, side to move, castling, en-passant and fifty moves count. false if position is invalid
+bool unpack(PackedPosition const& pos, Board& board);
+
+// file is a header of PackedPosition size followed by array of positions
+class PackedReader
+{
+public:
+  // false if file isn't found or it has no valid header
+  bool load(std::string const& fname);
+  void clear();
+
+  size_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+  PackedPosition const* begin() const { return positions_; }
+  PackedPosition const* end() const { return positions_ + count_; }
+  PackedPosition const& operator [] (size_t i) const { return positions_[i]; }
+
+  // checks header only
+  static bool isPacked(std::string const& fname);
+
+private:
+  MappedFile file_;
+  PackedPosition const* positions_{};
+  size_t count_{};
+};
+
+// positions are collected in buffer and written by big blocks
+class PackedWriter
+{
+public:
+  ~PackedWriter();
+
+  bool open(std::string const& fname);
+  void write(PackedPosition const& pos);
+  void flush();
+  void close();
+
+  size_t count() const { return count_; }
+
+private:
+  std::ofstream ofs_;
+  std::vector<PackedPosition> buffer_;
+  size_t count_{};
+};
+
+} // NEngine
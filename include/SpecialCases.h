@@ -3,6 +3,7 @@
 #include "xcommon.h"
 #include "Figure.h"
 #include "Board.h"
+#include "Bitbase.h"
 #include "unordered_map"
 
 namespace NEngine
@@ -15,20 +16,28 @@ class SpecialCasesDetector
 public:
   SpecialCasesDetector();
 
-  inline std::pair<SpecialCaseResult, ScoreType> eval(Board const& board) const
+  // bitbases could be null if they aren't loaded
+  inline std::pair<SpecialCaseResult, ScoreType> eval(Board const& board, EvalCoefficients const& coeff, Bitbases const* bitbases) const
   {
     auto const& fmgr = board.fmgr();
     auto const hkey = fmgr.fgrsCode();
+    auto const bbres = bitbases ? bitbases->probe(board) : BitbaseResult::Unknown;
+    if (bbres == BitbaseResult::Draw)
+      return { SpecialCaseResult::DRAW, 0 };
     auto iter = scases_.find(hkey);
     if (iter == scases_.end())
       return { SpecialCaseResult::NO_RESULT, 0 };
-    return (iter->second)(board);
+    auto result = (iter->second)(board, coeff);
+    // exact result is known. don't scale winning score to draw
+    if (bbres != BitbaseResult::Unknown && result.first != SpecialCaseResult::SCORE)
+      return { SpecialCaseResult::NO_RESULT, 0 };
+    return result;
   }
 
 private:
   void initCases();
 
-  std::unordered_map<BitMask, std::function<std::pair<SpecialCaseResult, ScoreType>(Board const&)>> scases_;
+  std::unordered_map<BitMask, std::function<std::pair<SpecialCaseResult, ScoreType>(Board const&, EvalCoefficients const&)>> scases_;
 };
 
 bool kpkPassed(Board const& board, Figure::Color pawnColor, int pawnPos);
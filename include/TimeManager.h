@@ -0,0 +1,67 @@
+/*************************************************************
+TimeManager.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+#pragma once
+
+#include "xcommon.h"
+#include "xtime.h"
+#include "Move.h"
+#include "atomic"
+
+namespace NEngine
+{
+
+// time allocation for one move
+// soft limit is checked after each iteration and adjusted by search stability, hard limit aborts search
+class TimeManager
+{
+public:
+  // no time limit
+  void reset();
+  // exact time for each move
+  void setTimePerMove(NTime::duration const& tm);
+  // remaining time, increment and moves to next time control. 0 moves for sudden death
+  void setTimeControl(NTime::duration const& xtime, NTime::duration const& inc, int movesToGo);
+  // communication and GUI delays reserved for each move
+  void setMoveOverhead(NTime::duration const& overhead);
+
+  bool limited() const { return mode_ != None; }
+
+  // calculate limits and start counting time
+  void start();
+  // time is counted from ponderhit
+  void restart();
+  NTime::duration elapsed() const;
+
+  bool hardLimitReached() const;
+
+  // completed iteration with given best move, its score and share of nodes searched for it
+  // returns true if there is no time for the next one
+  bool iteration(Move best, ScoreType score, double bestNodesShare);
+
+  NTime::duration optimum() const { return optimum_; }
+  NTime::duration softLimit() const { return soft_; }
+  NTime::duration hardLimit() const { return hard_; }
+
+private:
+  enum Mode { None, TimePerMove, TimeControl };
+
+  Mode mode_{ None };
+  NTime::duration xtime_{};
+  NTime::duration inc_{};
+  NTime::duration overhead_{ NTime::from_milliseconds(TimeManager_Overhead_ms) };
+  int movesToGo_{};
+
+  std::atomic<NTime::point> tstart_{ NTime::point{} };
+  NTime::duration optimum_{};
+  NTime::duration soft_{};
+  NTime::duration hard_{};
+
+  // search stability
+  Move best_{ true };
+  ScoreType score_{};
+  int stable_{};
+  int iterations_{};
+};
+
+} // NEngine
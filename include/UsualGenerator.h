@@ -5,26 +5,35 @@
 #include "Board.h"
 #include "History.h"
 #include "xalgorithm.h"
+#include "algorithm"
 
 namespace NEngine
 {
 
+// quiet moves are sorted by butterfly and continuation history
+// sorting is lazy. the best of remaining moves is selected on each next() call
 template <class BOARD, class MOVE>
 struct UsualGenerator
 {
-  using MovesList = xlist<MOVE, BOARD::MovesMax>;
-  
-  UsualGenerator(BOARD const& board) :
-    board_(board)
+  UsualGenerator(BOARD const& board, SearchHistory const& hist) :
+    board_(board),
+    hist_(hist)
   {}
 
 
   MOVE* next()
   {
-    while(iter_ != moves_.end())
+    while(index_ < count_)
     {
-      auto* move = &*iter_;
-      ++iter_;
+      int ibest = index_;
+      for(int i = index_+1; i < count_; ++i)
+      {
+        if(moves_[i] > moves_[ibest])
+          ibest = i;
+      }
+      // keep generation order of remaining moves
+      std::rotate(moves_ + index_, moves_ + ibest, moves_ + ibest + 1);
+      auto* move = &moves_[index_++];
       if(board_.validateMove(*move))
         return move;
     }
@@ -33,7 +42,14 @@ struct UsualGenerator
 
   inline void add(int from, int to)
   {
-    insert_sorted(moves_, MOVE{ from, to, Figure::TypeNone, history(board_.color(), from, to).score() });
+    X_ASSERT(count_ >= BOARD::MovesMax, "too many moves");
+    SortValueType score = hist_.history(board_.color(), from, to).score();
+    auto type = board_.getField(from).type();
+    if(cont1_)
+      score += (*cont1_)[type][to].score();
+    if(cont2_)
+      score += (*cont2_)[type][to].score();
+    moves_[count_++] = MOVE{ from, to, Figure::TypeNone, score };
   }
  
   inline void generateBishops(Figure::Color color, BitMask const mask_all, BitMask const mask_all_inv)
@@ -88,6 +104,8 @@ struct UsualGenerator
     auto const& fmgr = board_.fmgr();
     auto mask_all = fmgr.mask(Figure::ColorWhite) | fmgr.mask(Figure::ColorBlack);
     auto mask_all_inv = ~mask_all;
+    cont1_ = hist_.continuationHistory(board_, 0);
+    cont2_ = hist_.continuationHistory(board_, 1);
 
     // pawns movements except promotions cause it's already generated by caps generator
     auto pw_mask = fmgr.pawn_mask(color) & ~movesTable().promote(color);
@@ -174,12 +192,16 @@ struct UsualGenerator
       }
     }
 
-    iter_ = moves_.begin();
+    index_ = 0;
   }
 
   BOARD const& board_;
-  MovesList moves_;
-  typename MovesList::iterator iter_;
+  SearchHistory const& hist_;
+  ContinuationHistory const* cont1_{};
+  ContinuationHistory const* cont2_{};
+  MOVE moves_[BOARD::MovesMax];
+  int count_{};
+  int index_{};
 };
 
 } // NEngine
\ No newline at end of file
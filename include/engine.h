@@ -5,11 +5,15 @@ engine.h - Copyright (C) 2016 by Dmitry Sultanov
 
 #include "HashTable.h"
 #include "Evaluator.h"
+#include "History.h"
+#include "Bitbase.h"
 #include "xcallback.h"
 #include "xoptions.h"
+#include "TimeManager.h"
 #include "queue"
 #include "array"
 #include "mutex"
+#include "atomic"
 #include "Helpers.h"
 
 namespace NEngine
@@ -20,7 +24,10 @@ struct PlyStack
   PlyStack() {}
 
   SMove killer_;
+  SMove killer2_;
   Move pv_[MaxPly+4];
+  // static evaluation. -ScoreMax if unknown
+  ScoreType eval_{ -ScoreMax };
 
   void clearPV(int depth)
   {
@@ -36,24 +43,35 @@ struct PlyStack
   void clearKiller()
   {
     killer_ = SMove{ true };
+    killer2_ = SMove{ true };
+  }
+
+  void addKiller(Move const move)
+  {
+    if(move == killer_)
+      return;
+    killer2_ = killer_;
+    killer_ = move;
   }
 };
 
 struct SearchParams
 {
-  NTime::duration timeLimit_{};
   int  depthMax_{};
   bool analyze_mode_{};
-  bool timeAdded_{};
+  // search on opponent's time. no time limit till ponderhit
+  std::atomic<bool> ponder_{ false };
+  // number of principal variations to search with exact scores
+  int  multiPV_{ 1 };
   ScoreType scoreLimit_{ Figure::MatScore };
+  // nodes searched by main thread. 0 - no limit
+  int nodesLimit_{};
 };
 
 class Engine
 {
 public:
 
-  static int xcounter_;
-
   // initialize global arrays, tables, masks, etc. write them to it's board_
   Engine();
 
@@ -82,13 +100,47 @@ public:
   void pleaseStop(int ictx);
 
   void setAnalyzeMode(bool);
+  // exact time per move. 0 - no limit
   void setTimeLimit(NTime::duration const& tm);
+  // remaining time, increment and moves to next time control. 0 moves for sudden death
+  void setTimeControl(NTime::duration const& xtime, NTime::duration const& inc, int movesToGo);
+  void setMoveOverhead(NTime::duration const& overhead);
+  TimeManager const& timeManager() const { return tman_; }
   void setMaxDepth(int d);
   void setScoreLimit(ScoreType score);
+  // search is stopped when main thread searched given number of nodes. 0 - no limit
+  void setNodesLimit(int nodes);
+  void setMultiPV(int n);
+  void setPonder(bool ponder);
+  // expected move was played. continue search with normal time limit
+  void ponderHit();
 
   void setMemory(int mb);
   void setThreadsNumber(int n);
 
+  // evaluation coefficients are individual for each engine
+  EvalCoefficients const& evalCoefficients() const { return ecoeffs_; }
+  bool loadEvalCoefficients(std::string const& fname);
+  // endgame bitbases generated by "shallow bitbases"
+  bool loadBitbases(std::string const& fname);
+  void clearBitbases();
+  bool setEvalCoefficient(std::string const& name, int value);
+
+  // evaluation statistics of all threads
+  EvalProfile evalProfile() const;
+  void clearEvalProfile();
+  ScoreType evalTrace(EvalTrace& trace);
+
+  // lazy evaluation margins calibration. statistics is collected by all threads while searching
+  void setLazyEvalCalibration(bool on);
+  LazyEvalStat lazyEvalStat() const;
+  void clearLazyEvalStat();
+  // take margins that cover given fraction of evaluations
+  bool applyLazyEvalStat(double fraction);
+
+  // search tree statistics of all threads, collected by the last search
+  SearchStat const& searchStat() const { return stat_; }
+
 private:
 
   struct CapturesResult
@@ -103,17 +155,20 @@ private:
   bool checkForStop(int ictx);
   void reset();
 
-//  // logging
-  void logPV(int ictx);
-  void logMovies(int ictx);
+  // hashed scores are invalid after coefficients change
+  void evalChanged();
 
   // time control
-  bool tryToAddTime();
   void testTimer(int ictx);
   void testInput(int ictx);
+  // checks input and time limit in separate thread while searching
+  void inputAndTimerLoop();
 
   // search routine
-  ScoreType alphaBetta0(int ictx);
+  // one iteration of iterative deepening with aspiration window around previous score
+  ScoreType aspirationSearch(int ictx, ScoreType scorePrev, bool window);
+  void sendFailBound(int ictx, ScoreType score, SearchResult::Bound bound);
+  ScoreType alphaBetta0(int ictx, ScoreType alpha, ScoreType betta);
   ScoreType processMove0(int ictx, SMove const move, ScoreType const alpha, ScoreType const betta, bool const pv);
   ScoreType alphaBetta(int ictx, int depth, int ply, ScoreType alpha, ScoreType betta, bool pv, bool allow_nm, int signular_count);
 
@@ -157,13 +212,16 @@ private:
   void assemblePV(int ictx, Move const move, bool checking, int ply);
 
   void sortMoves0(int ictx);
+  // insert root move to multi PV lines sorted by score. the worst line is dropped if there are too many
+  void addLine(int ictx, Move const move, ScoreType score, int linesMax);
 
   // is given movement caused by previous. this mean that if we don't do this move we loose
   // we actually check if moved figure was attacked by previously moved one or from direction it was moved from
   bool isRealThreat(int ictx, const Move move);
 
   // analyze mode support
-  bool updateRequested_{ false };
+  std::atomic<bool> updateRequested_{ false };
+  std::atomic<bool> searching_{ false };
   xCallback callbacks_;
 
   // search data
@@ -177,8 +235,14 @@ private:
     std::array<SMove, Board::MovesMax> moves_;
     SearchData sdata_;
     SearchResult sres_;
-    volatile bool stop_{ false };
-
+    // multi PV lines of current iteration
+    std::array<SearchResult::Line, MultiPV_Max> lines_;
+    int linesNum_{};
+    SearchStat stat_;
+    std::atomic<bool> stop_{ false };
+
+    SearchContext() = default;
+    SearchContext(SearchContext const& other);
     SearchContext& operator = (SearchContext const& other);
     void reset();
     void clearStack();
@@ -186,15 +250,33 @@ private:
 
   // multi-threading mode
   std::vector<SearchContext> scontexts_;
+  // sum of threads statistics after search
+  SearchStat stat_;
+
+  // static evaluation, counted by search statistics
+  ScoreType evaluate(SearchContext& sctx, ScoreType alpha, ScoreType betta)
+  {
+    SEARCH_STAT_INC(sctx.stat_, evalCalls_);
+    return sctx.eval_(alpha, betta);
+  }
 
 #ifdef SYNCHRONIZE_LAST_ITER
   std::mutex m_mutex;
 #endif // SYNCHRONIZE_LAST_ITER
 
   SearchParams sparams_;
+  TimeManager tman_;
+  EvalCoefficients ecoeffs_;
+  // null if they aren't loaded
+  std::unique_ptr<Bitbases> bitbases_;
+  bool lazyCalibration_{};
+  // shared by all threads of this engine
+  std::unique_ptr<SearchHistory> history_;
 
 #ifdef USE_HASH
   GHashTable hash_;
+  // size of own table. it's restored when snapshot is unloaded
+  int memoryMb_{};
 #endif
 
 #ifdef USE_EVAL_HASH_ALL
@@ -208,6 +290,11 @@ private:
 public:
   void saveHash(std::string const& fname) const;
   void loadHash(std::string const& fname);
+  // transposition table snapshot with header. loaded one is mapped and used as is if possible
+  bool saveHashTable(std::string const& fname) const;
+  bool loadHashTable(std::string const& fname);
+  // own table of given size instead of mapped snapshot
+  void unloadHashTable();
 
 /// HASH Table
 private:
@@ -223,8 +310,10 @@ private:
     auto& board = sctx.board_;
     auto hitem = hash_.get(board.fmgr().hashCode());
     hitem.encode();
+    SEARCH_STAT_INC(sctx.stat_, ttProbes_);
     if (hitem.hkey_ == board.fmgr().hashKey())
     {
+      SEARCH_STAT_INC(sctx.stat_, ttHits_);
       singular = hitem.singular();
       auto hflag = hitem.flag();
       if (!pv && board.fmgr().weight(Figure::ColorBlack).eval32_ && board.fmgr().weight(Figure::ColorWhite).eval32_)
@@ -239,9 +328,15 @@ private:
             hscore = hscore + ply;
 
           if (hscore >= betta && hflag == Betta)
+          {
+            SEARCH_STAT_INC(sctx.stat_, ttCuts_);
             return Betta;
+          }
           else if (hscore < alpha && hflag == Alpha)
+          {
+            SEARCH_STAT_INC(sctx.stat_, ttCuts_);
             return Alpha;
+          }
         }
       }
       if (hitem.move() && board.validateMoveExpress(hitem.move())) {
@@ -23,6 +23,7 @@ namespace details
   extern SpecialCasesDetector const*  g_specialCases_;
 }
 
+// immutable tables shared by all engines. it's safe to call from several threads
 void initGlobals();
 
 
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "array"
+#include "xcommon.h"
+
+namespace NEngine
+{
+  extern std::array<uint64, 781> const polyglotKeys_;
+} // NEngine
@@ -6,6 +6,7 @@
 #include "engine.h"
 #include "xcommand.h"
 #include "xtime.h"
+#include "Book.h"
 
 #undef  WRITE_LOG_FILE_
 #undef WRITE_ERROR_PGN
@@ -23,8 +24,12 @@ struct ReplyStruct
   NEngine::StateType state_{};
   NEngine::Move best_;
   std::string moveStr_;
+  // expected reply to ponder on
+  std::string ponderStr_;
   bool white_{ false };
   ScoreType score_{};
+  // move is taken from opening book, search result isn't changed
+  bool book_{ false };
 
   operator bool ()
   {
@@ -37,13 +42,22 @@ class Processor
 {
 public:
   bool init();
-  void enableBook(int v);
+  // UCI option by name. unknown names are evaluation coefficients. false if option can't be set
+  bool setOption(std::string const& name, std::string const& value);
+  // book moves are played till given move number. 0 disables book
+  void enableBook(int depth);
+  // empty file name unloads book
+  bool loadBook(std::string const& fname);
   void setHashSize(int mb);
   void setThreadsNumber(int n);
+  void setMultiPV(int n);
   bool setDepth(int depth);
   bool setScoreLimit(ScoreType score);
+  bool setNodesLimit(int nodes);
   bool setTimePerMove(NTime::duration const& tm);
   bool setXtime(NTime::duration const& xtm);
+  bool setIncrement(NTime::duration const& inc);
+  bool setMoveOverhead(NTime::duration const& overhead);
   bool setMovesLeft(int mleft);
   bool setMovesToGo(int mtogo);
   bool setPost(bool);
@@ -57,6 +71,21 @@ public:
   void pgn2file(std::string const& fname);
   void hash2file(std::string const& fname, bool force = false);
   void file2hash(std::string const& fname);
+  // transposition table only. see Engine::loadHashTable
+  bool saveHashTable(std::string const& fname);
+  // empty file name restores own table of Hash size
+  bool loadHashTable(std::string const& fname);
+  bool loadEvalCoefficients(std::string const& fname);
+  // empty file name unloads bitbases
+  bool loadBitbases(std::string const& fname);
+  bool setEvalCoefficient(std::string const& name, int value);
+  bool evalTrace(NEngine::EvalTrace& trace);
+  NEngine::EvalProfile evalProfile() const;
+  void clearEvalProfile();
+  bool setLazyEvalCalibration(bool on);
+  NEngine::LazyEvalStat lazyEvalStat() const;
+  bool applyLazyEvalStat(double fraction);
+  NEngine::SearchStat const& searchStat() const;
   std::string toFEN();
 
   void clear();
@@ -68,13 +97,18 @@ public:
 
   ReplyStruct move(xCmd const& moveCmd);
   bool makeMove(std::string const& moveStr);
-  ReplyStruct reply(bool winboardFormat);
+  ReplyStruct reply(bool winboardFormat, bool ponder = false);
+  void ponderHit();
   bool analyze(int maxDepth);
   void stop();
+  // status line in analyze mode. it only sets flag, so could be called from input thread while searching
+  void needUpdate();
 
   void setCallback(NEngine::xCallback& xcbk);
 
-  NTime::duration giveMoreTime();
+  NEngine::TimeManager const& timeManager() const { return engine_.timeManager(); }
+  // depth, score, nodes and PV of the last search
+  NEngine::SearchResult const& result() const { return engine_.result(); }
 
   bool is_thinking() const { return thinking_; }
 
@@ -87,18 +121,21 @@ private:
   void performAnalyze();
   void updateTiming();
   void setFigure(xCmd const& cmd);
+  NEngine::Move bookMove();
 
   NEngine::Figure::Color boardColor_{};
   NEngine::Figure::Color figureColor_{};
   NEngine::Engine engine_;
+  NEngine::Book book_;
+  int bookDepth_{ Book_DepthDefault };
   int movesLeft_{};
   int movesToGo_{};
   int maxDepth_{};
   NTime::duration xtime_{};
   NTime::duration timePerMove_{};
+  NTime::duration inc_{};
   bool post_{};
   bool thinking_{};
-  unsigned int givetimeCounter_{};
 };
 
 } // NShallow
\ No newline at end of file
@@ -4,7 +4,83 @@ shallow.h - Copyright (C) 2016 by Dmitry Sultanov
 
 #pragma once
 
+#include "string"
+#include "vector"
+#include "functional"
+#include "memory"
+#include "mutex"
+#include "atomic"
+#include "cstdint"
+#include "shallow_export.h"
+
 namespace NShallow
 {
 
+class Processor;
+
+// global tables. it's called by Instance itself, so explicit call is needed only without instances
+SHALLOW_API void initialize();
+
+// search limits. 0 means no limit. search is infinite if there are no limits at all
+struct Limits
+{
+  int depth_{};
+  int64_t nodes_{};
+  int movetime_ms_{};
+};
+
+// best line of current iteration. moves are in coordinate notation
+struct Info
+{
+  int depth_{};
+  int score_{};
+  int64_t nodes_{};
+  int time_ms_{};
+  std::vector<std::string> pv_;
+};
+
+struct Result
+{
+  // empty if there are no moves
+  std::string bestmove_;
+  std::string ponder_;
+  int depth_{};
+  int score_{};
+  int64_t nodes_{};
+  // move is taken from opening book
+  bool book_{};
+};
+
+using InfoCallback = std::function<void(Info const&)>;
+
+// engine in process. calls of one instance are serialized, stop() could be called from any thread.
+// position isn't changed by search
+class SHALLOW_API Instance
+{
+public:
+  Instance();
+  ~Instance();
+
+  Instance(Instance const&) = delete;
+  Instance& operator = (Instance const&) = delete;
+
+  // UCI option, like "Hash", "Threads" or "EvalFile"
+  bool setOption(std::string const& name, std::string const& value);
+  // empty fen is initial position. moves are in coordinate or SAN notation
+  bool setPosition(std::string const& fen, std::vector<std::string> const& moves = {});
+  std::string fen();
+
+  // info is called from search thread
+  Result search(Limits const& limits, InfoCallback const& info = {});
+  void stop();
+  // forget hash and history, like "ucinewgame"
+  void newGame();
+
+private:
+  std::unique_ptr<Processor> proc_;
+  std::mutex mutex_;
+  std::atomic<bool> stop_{};
+  InfoCallback info_;
+};
+
 } // NShallow
@@ -0,0 +1,57 @@
+/*************************************************************
+shallow_c.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#pragma once
+
+/* C interface of NShallow::Instance. see shallow.h */
+
+#include "shallow_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct shallow_instance shallow_instance;
+
+/* pv is space separated list of moves in coordinate notation */
+typedef struct shallow_info
+{
+  int depth;
+  int score;
+  long long nodes;
+  int time_ms;
+  const char* pv;
+} shallow_info;
+
+/* bestmove is empty if there are no moves */
+typedef struct shallow_result
+{
+  char bestmove[8];
+  char ponder[8];
+  int depth;
+  int score;
+  long long nodes;
+  int book;
+} shallow_result;
+
+typedef void (*shallow_info_callback)(shallow_info const* info, void* user_data);
+
+/* NULL on failure */
+SHALLOW_API shallow_instance* shallow_create(void);
+SHALLOW_API void shallow_destroy(shallow_instance* instance);
+
+/* functions below return 0 on failure */
+SHALLOW_API int shallow_set_option(shallow_instance* instance, const char* name, const char* value);
+/* fen is initial position if NULL or empty. moves are separated with spaces, could be NULL */
+SHALLOW_API int shallow_set_position(shallow_instance* instance, const char* fen, const char* moves);
+/* 0 means no limit. callback could be NULL */
+SHALLOW_API int shallow_search(shallow_instance* instance, int depth, long long nodes, int movetime_ms,
+  shallow_info_callback callback, void* user_data, shallow_result* result);
+/* could be called from any thread */
+SHALLOW_API void shallow_stop(shallow_instance* instance);
+SHALLOW_API void shallow_new_game(shallow_instance* instance);
+
+#ifdef __cplusplus
+}
+#endif
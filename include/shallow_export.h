@@ -0,0 +1,17 @@
+/*************************************************************
+shallow_export.h - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#pragma once
+
+/* symbols of C and C++ interfaces are exported from shared library on MSVC */
+
+#if (defined _MSC_VER) && (defined SHALLOW_SHARED)
+  #ifdef SHALLOW_EXPORTS
+    #define SHALLOW_API __declspec(dllexport)
+  #else
+    #define SHALLOW_API __declspec(dllimport)
+  #endif
+#else
+  #define SHALLOW_API
+#endif
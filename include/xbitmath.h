@@ -198,6 +198,38 @@ inline int clear_msb(BitMask& mask)
   return n;
 }
 
+// whole board shifts & fills. a-file is 0 bit, 1-st rank is lowest byte
+inline BitMask shift_east(BitMask mask)
+{
+  return (mask << 1) & 0xfefefefefefefefeULL;
+}
+
+inline BitMask shift_west(BitMask mask)
+{
+  return (mask >> 1) & 0x7f7f7f7f7f7f7f7fULL;
+}
+
+inline BitMask north_fill(BitMask mask)
+{
+  mask |= mask << 8;
+  mask |= mask << 16;
+  mask |= mask << 32;
+  return mask;
+}
+
+inline BitMask south_fill(BitMask mask)
+{
+  mask |= mask >> 8;
+  mask |= mask >> 16;
+  mask |= mask >> 32;
+  return mask;
+}
+
+inline BitMask file_fill(BitMask mask)
+{
+  return north_fill(mask) | south_fill(mask);
+}
+
 inline unsigned mul_div(unsigned v, unsigned n, unsigned d)
 {
   uint64 r = (uint64)v * n;
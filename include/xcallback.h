@@ -14,6 +14,9 @@ namespace NEngine
 class SearchResult
 {
 public:
+  // score is exact or aspiration window fail-high/fail-low bound
+  enum Bound { Exact, Lower, Upper };
+
   SearchResult();
 
   SearchResult& operator = (SearchResult const& other);
@@ -33,7 +36,17 @@ public:
   Move prevBest_{};
   int  depth_{};
   ScoreType score_{};
+  Bound bound_{ Exact };
   std::array<Move, MaxPly + 4> pv_;
+
+  // multi PV mode. best lines sorted by score, the first one is the same as pv_
+  struct Line
+  {
+    ScoreType score_{};
+    std::array<Move, MaxPly + 4> pv_;
+  };
+  int linesNum_{};
+  std::array<Line, MultiPV_Max> lines_;
 };
 
 struct SearchData
@@ -57,21 +70,59 @@ struct SearchData
   NTime::point tprev_{};
   SMove best_;
   ScoreType scoreBest_{-Figure::MatScore};
+  // nodes searched for the best root move in current iteration
+  int bestNodes_{};
+};
+
+// search tree statistics. collected by each thread, counters stay zero if SEARCH_STAT isn't defined
+struct SearchStat
+{
+  uint64 ttProbes_{};
+  uint64 ttHits_{};
+  // hashed score is returned without search
+  uint64 ttCuts_{};
+  uint64 nullMoveTries_{};
+  uint64 nullMoveCuts_{};
+  uint64 futilityPruned_{};
+  uint64 probcutTries_{};
+  uint64 probcutCuts_{};
+  // capture holds in quiescence, but not in reduced depth search
+  uint64 probcutFails_{};
+  uint64 multicutTries_{};
+  uint64 multicutCuts_{};
+  uint64 lmrReduced_{};
+  // reduced move raised alpha and was searched again with full depth
+  uint64 lmrResearched_{};
+  uint64 lmpPruned_{};
+  uint64 iidSearches_{};
+  uint64 singularExts_{};
+  uint64 qsearchNodes_{};
+  // fail high in main search and how many of them were caused by the first move
+  uint64 betaCuts_{};
+  uint64 firstMoveCuts_{};
+  uint64 evalCalls_{};
+
+  void clear();
+  SearchStat& operator += (SearchStat const& other);
+  void print(std::ostream& os) const;
 };
 
+#ifdef SEARCH_STAT
+  #define SEARCH_STAT_INC(stat, counter) ++(stat).counter
+#else
+  #define SEARCH_STAT_INC(stat, counter)
+#endif
+
 using query_input_command    = std::function<bool()>;
-using give_more_time_command = std::function<NTime::duration()>;
 using send_result_command    = std::function<void(SearchResult const&)>;
 using send_stats_command     = std::function<void(SearchData const&)>;
 
 struct xCallback
 {
   query_input_command     queryInput_;
-  give_more_time_command  giveTime_;
   send_result_command     sendOutput_;
   send_result_command     sendFinished_;
   send_stats_command      sendStats_;
-  std::ofstream*          slog_{};
 };
 
 } // NEngine
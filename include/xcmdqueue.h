@@ -21,6 +21,8 @@ public:
   bool isUci() const;
 
   void push(xCmd const& cmd);
+  // there are commands postponed till search is finished
+  bool pending() const;
   xCmd peek();
   xCmd next();
 };
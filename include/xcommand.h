@@ -51,9 +51,16 @@ namespace NShallow
     UCInewgame,
     Position,
     UCIgo,
+    UCIponderhit,
 
     // common
     xQuit,
+
+    // debug
+    xEval,
+    xEvalStat,
+    xLazyEval,
+    xSearchStat,
   };
 
   class xCmd
@@ -65,6 +72,7 @@ namespace NShallow
     xCmd(xType type, std::string&& fen, std::vector<std::string>&& moves);
     xCmd(xType type, int value);
     xCmd(xType type, std::map<std::string, int>&& params);
+    xCmd(xType type, std::map<std::string, int>&& params, std::map<std::string, std::string>&& strParams);
     xCmd(xType type, bool inf);
 
     xType type() const;    
@@ -76,6 +84,8 @@ namespace NShallow
     bool infinite() const;
     int param(std::string const& name) const;
     std::string param(size_t i) const;
+    std::string const& strParam(std::string const& name) const;
+    std::map<std::string, int> const& params() const;
 
     // debug only
     std::string params_to_str() const;
@@ -85,6 +95,7 @@ namespace NShallow
     std::string str_;
     std::vector<std::string> moves_;
     std::map<std::string, int> params_;
+    std::map<std::string, std::string> strParams_;
     int value_{0};
     bool infinite_{false};
   };
@@ -41,10 +41,8 @@ xcommon.h - Copyright (C) 2016 by Dmitry Sultanov
 
 #ifndef NDEBUG
   #define X_ASSERT(v, msg) if ( v ) throw std::runtime_error(msg); else;
-  #define TIMING_FLAG 0xFFF
 #else
   #define X_ASSERT(v, msg)
-  #define TIMING_FLAG 0x3FFF
 #endif
 
 #ifdef PROCESS_MOVES_SEQ
@@ -205,8 +203,6 @@ namespace nst
   extern bool get_bit_dir_[10];
 };
 
-#undef LOG_PV
-
 #ifdef NDEBUG
 #undef USE_MINIDUMP
 #endif
@@ -215,6 +211,12 @@ namespace nst
 #define EXTEND_CHECK_SEE_ONLY
 #undef USE_LAZY_EVAL
 
+// collect Evaluator counters & timings. "evalstat" command prints them
+#undef EVAL_PROFILE
+
+// collect per thread search counters. "stats" command and bench print them
+#define SEARCH_STAT
+
 #ifndef PROCESS_MOVES_SEQ
 
 #define USE_HASH
@@ -228,6 +230,15 @@ namespace nst
 #define USE_IID
 #define USE_NULL_MOVE
 #define USE_LMR
+// reduction is taken from log(depth)*log(moves) table and corrected by history.
+// off till self-play without time losses shows gain
+#undef USE_LMR_TABLE
+#undef USE_LMR_HISTORY
+// late quiet moves are skipped at shallow depth
+#undef USE_LMP
+// no node savings in bench yet. enable after bench or self-play shows a gain
+#undef USE_PROBCUT
+#undef USE_MULTICUT
 
 #else
 
@@ -244,12 +255,17 @@ namespace nst
 #define SINGULAR_EXT
 #undef VERIFY_LMR
 
+// narrow root window around previous iteration score. singular extension is
+// triggered on the whole PV then, so trees at fixed depth are bigger
+#undef USE_ASPIRATION_WINDOWS
+
 #undef SYNCHRONIZE_LAST_ITER
 #define GENERATE_MAT_CHECK_AFTER_HORIZON
 #define AT_LEAST_ONE_MAT_MOVE
 
 static const SortValueType CaptureRecentlyBonus = 10;
 static const SortValueType PromotionBonus = 10;
+static const SortValueType CapturesHistoryScale = 1024;
 
 static const int NumSingularExts = 4;
 static const int NumUsualAfterHorizon = 3;
@@ -258,10 +274,27 @@ static const int ONE_PLY = 16;
 static const int MaxPly = 64;
 static const int LMR_DepthLimit = 2 * ONE_PLY;
 static const int LMR_MinDepthLimit = 5 * ONE_PLY;
+// reduction = log(depth) * log(moves) * 100 / LMR_DivisorPercent plies
+static const int LMR_TableSize = 64;
+static const int LMR_DivisorPercent = 200;
+static const int LMR_ReductionMin = ONE_PLY / 2;
+// quiet move with good history is reduced less, with bad one more
+static const int LMR_HistoryStep = ONE_PLY / 2;
+// late move pruning. moves limit is (LMP_MovesBase + depth^2) / 2, doubled if eval is improving
+static const int LMP_DepthMax = 4 * ONE_PLY;
+static const int LMP_MovesBase = 3;
 static const int NullMove_DepthMin = 2 * ONE_PLY;
 static const int NullMove_PlyReduce = 6 * ONE_PLY;
 static const int Probcut_Depth = 7 * ONE_PLY;
 static const int Probcut_PlyReduce = 4 * ONE_PLY;
+static const int Probcut_Margin = 100;
+static const int Multicut_Depth = 6 * ONE_PLY;
+static const int Multicut_PlyReduce = 4 * ONE_PLY;
+static const int Multicut_Moves = 6;
+static const int Multicut_Cuts = 3;
+static const int AspirationWindow_DepthMin = 5;
+static const int AspirationWindow_Delta = 25;
+static const int AspirationWindow_DeltaMax = 400;
 static const int Betta_ThresholdFP = 250;
 static const int Position_GainFP = 250;
 static const int Position_GainThr = 250;
@@ -270,6 +303,69 @@ static const int AlphaProbCutThreshold = 200;
 static const size_t N_THREADS_MAX = 4;
 static const size_t N_THREADS_DEFAULT = 1;
 
+// max number of principal variations in analyze mode
+static const int MultiPV_Max = 8;
+
+// input and time limit are checked by separate thread with this period. it bounds stop latency
+static const int InputPollPeriod_ms = 1;
+
+// time manager. limits are in percents of optimal time for move
+static const int TimeManager_Overhead_ms = 30;
+// expected number of moves till the end of game in sudden death
+static const int TimeManager_MovesHorizon = 30;
+static const int TimeManager_IncPercent = 75;
+static const int TimeManager_HardPercent = 400;
+// hard limit in percents of remaining time
+static const int TimeManager_MaxPercent = 80;
+// best move changed in the last iteration
+static const int TimeManager_UnstablePercent = 140;
+// best move is the same for several iterations
+static const int TimeManager_StablePercent = 8;
+static const int TimeManager_StableMax = 5;
+// score drop in centipawns and additional time for each of them
+static const int TimeManager_ScoreDropMax = 100;
+static const int TimeManager_ScoreDropPercent = 80;
+// next iteration isn't started if this part of soft limit is spent
+static const int TimeManager_IterationPercent = 60;
+// self-play time manager check. game length limit
+static const int TimePlay_PliesMax = 300;
+// batch analysis. hash size of each engine instance and number of positions read ahead per instance
+static const int BatchAnalyze_HashMb = 16;
+static const int BatchAnalyze_QueuePerInstance = 4;
+
+// endgame bitbases. max number of figures including kings
+static const int BitbaseFiguresMax = 4;
+
+// opening book is used till this move number
+static const int Book_DepthDefault = 16;
+static const int Book_DepthMax = 100;
+
+// async logger. size of ring buffer item in bytes, number of items and writer thread sleep time if there is nothing to write
+static const int Logger_RecordSize = 256;
+static const size_t Logger_Capacity = 4096;
+static const int Logger_PollPeriod_ms = 1;
+
+// transposition table snapshot. increment when layout of hash items is changed
+static const int HashSnapshot_Version = 1;
+
+// packed positions file. number of positions collected before write
+static const int PackedWriter_BufferSize = 4096;
+// pgn positions extraction. games per task of worker thread and number of tasks read ahead per thread
+static const int PgnExtract_GamesPerTask = 256;
+static const int PgnExtract_QueuePerThread = 4;
+// self-play data generation. hash size of each engine, nodes per move and random moves at start
+static const int SelfPlay_HashMb = 16;
+static const int SelfPlay_NodesDefault = 5000;
+static const int SelfPlay_RandomPlies = 8;
+// game is adjudicated if score is at least ResignScore for ResignPlies plies, or it's in DrawScore range
+// for DrawPlies plies after DrawPlyMin. longer games are draws
+static const int SelfPlay_ResignScore = 1000;
+static const int SelfPlay_ResignPlies = 4;
+static const int SelfPlay_DrawScore = 10;
+static const int SelfPlay_DrawPlies = 8;
+static const int SelfPlay_DrawPlyMin = 80;
+static const int SelfPlay_PliesMax = 400;
+
 #ifdef __ANDROID__
 static const size_t HASH_SIZE_DEFAULT = 64;
 #else
@@ -5,8 +5,8 @@
 namespace NEngine
 {
 
-extern int64 x_movesCounter;
-void xsearch(Board& board, int depth);
+// number of moves made
+int64 xsearch(Board& board, int depth);
 bool xverifyMoves(Board&);
 
 } // NEngine
\ No newline at end of file
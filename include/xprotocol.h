@@ -6,6 +6,7 @@ xprotocol.h - Copyright (C) 2016 by Dmitry Sultanov
 #include "xparser.h"
 #include "processor.h"
 #include "xcmdqueue.h"
+#include "Logger.h"
 
 namespace NShallow
 {
@@ -15,17 +16,15 @@ class xProtocolMgr
 public:
 
   xProtocolMgr();
+  ~xProtocolMgr();
 
   bool doCmd();
 
+  // search output is formatted by logger thread
   void printPV(NEngine::SearchResult const& sres);
   void printStat(NEngine::SearchData const& sdata);
   void printBM(NEngine::SearchResult const& sres);
 
-  // uci
-  void printInfo(NEngine::SearchResult const& sres);
-  void printUciStat(NEngine::SearchData const& sdata);
-
   // debug
   void writeError();
 
@@ -42,6 +41,8 @@ private:
 
   void printCmdDbg(xCmd const& cmd) const;
 
+  // it's destroyed last, when search is already finished
+  NEngine::Logger log_;
   Processor proc_;
   xCmdQueue cmds_;
  
@@ -49,8 +50,8 @@ private:
   bool force_ = false;
   bool fenOk_ = true;
 
-  std::ostream& os_;
-  std::unique_ptr<std::ofstream> ofs_log_;
+  // protocol output of main thread
+  NEngine::LogStream os_;
 };
 
 } // NShallow
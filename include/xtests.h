@@ -7,10 +7,10 @@ xtests.h - Copyright (C) 2016 by Dmitry Sultanov
 #pragma once
 
 #include "Helpers.h"
+#include "PackedPosition.h"
 #include "xoptimize.h"
 #include "list"
 #include "functional"
-#include "regex"
 #include "chrono"
 #include "fstream"
 #include "iostream"
@@ -62,10 +62,10 @@ using xTestFen_ErrorCallback = std::function<void(std::string const&)>;
 using xDoOptimize_Callback = std::function<bool(int)>;
 
 template <typename B, typename M, typename U>
-inline void appendMove(xEPD<B, M, U>& epd, std::string const& smove)
+inline void appendMove(xEPD<B, M, U>& epd, std::string_view smove)
 {
 #ifdef PROCESS_MOVES_SEQ
-  epd.board_.stestMoves_.push_back(smove == "_" ? "" : smove);
+  epd.board_.stestMoves_.push_back(smove == "_" ? std::string{} : std::string{ smove });
 #endif
   if(Move move = strToMove(smove, epd.board_))
   {
@@ -80,73 +80,70 @@ class FenTest : public std::vector<xEPD<BOARD, MOVE, UNDO>>
 public:
   FenTest(std::string const& ffname, xTestFen_ErrorCallback const& ecbk)
   {
-    std::regex r("([0-9a-hpnbrqkPNBRQKw/\\s\\-]+[\\s])([\\s]*bm[\\s])?([0-9a-hpnulrqkPNBRQKOx+=!_\\s\\-]+[\\s]?)?([\\s]*dmin[\\s]+)?([0-9]+)?([\\s]*dmax[\\s]+)?([0-9]+)?([\\s]+hash[\\s]+)?([0-9]+)?([\\s]*;[\\s]*\\\")?([\\w\\-]+)?([\\s]*moves[\\s]*)?([0-9a-hprqkPNBRQKOx+=!_\\s\\-]+)?");
+    if(PackedReader::isPacked(ffname))
+    {
+      loadPacked(ffname, ecbk);
+      return;
+    }
     ::std::ifstream ifs(ffname);
-    for(; ifs;)
+    ::std::string sline;
+    while(::std::getline(ifs, sline))
     {
-      ::std::string sline;
-      ::std::getline(ifs, sline);
       trim(sline);
       if(sline.empty())
         continue;
       if(sline[0] == '#')
         continue;
-//      std::cout << sline << std::endl;
-      std::smatch m;
-      if(!std::regex_search(sline, m, r) || m.size() < 4)
+      EpdView ev;
+      if(!parseEPD(sline, ev))
       {
-        ecbk("regex failed on line: " + sline);
+        ecbk("invalid epd on line: " + sline);
         continue;
       }
-      std::string fstr = m[1];
-      std::string mstr = m[3];
       xEPD<BOARD, MOVE, UNDO> epd;
-      if(!fromFEN(fstr, epd.board_))
+      if(!fromFEN(ev.fen_, epd.board_))
       {
-        ecbk("invalid fen: " + fstr);
+        ecbk("invalid fen: " + std::string{ ev.fen_ });
         continue;
       }
-      epd.fen_ = fstr;
-      auto str_moves = NEngine::split(mstr, [](char c) { return NEngine::is_any_of(" \t", c); });
-      for(auto const& smove : str_moves)
-      {
-        if(smove.empty())
-          continue;
+      epd.fen_ = ev.fen_;
+      for(auto smove = nextToken(ev.bm_); !smove.empty(); smove = nextToken(ev.bm_))
         appendMove(epd, smove);
-      }
 #ifdef PROCESS_MOVES_SEQ
-      if (m.size() > 5 && ((std::string)m[4]).find("dmin") != std::string::npos) {
-        epd.board_.stestDepthMin_ = std::stoi(m[5]);
-      }
-      if (m.size() > 7 && ((std::string)m[6]).find("dmax") != std::string::npos) {
-        epd.board_.stestDepthMax_ = std::stoi(m[7]);
-      }
-      if (m.size() > 9 && ((std::string)m[8]).find("hash") != std::string::npos) {
-        epd.board_.stestHashKey_ = std::stoull(m[9]);
-      }
-      if (m.size() > 13 && ((std::string)m[12]).find("moves") != std::string::npos) {
-        std::string imstr = m[13];
-        auto str_imoves = NEngine::split(imstr, [](char c) { return NEngine::is_any_of(" \t", c); });
-        for (auto const& smove : str_imoves)
-        {
-          if (smove.empty())
-            continue;
-          epd.imoves_.push_back(smove);
-        }
-      }
+      epd.board_.stestDepthMin_ = ev.dmin_;
+      epd.board_.stestDepthMax_ = ev.dmax_;
+      epd.board_.stestHashKey_ = ev.hash_;
+      for(auto smove = nextToken(ev.moves_); !smove.empty(); smove = nextToken(ev.moves_))
+        epd.imoves_.emplace_back(smove);
 #endif
-      if(m.size() >= 13 && ((std::string)m[11]).find("score") != std::string::npos)
+      epd.score_ = ev.score_;
+      base_class::push_back(std::move(epd));
+    }
+  }
+
+private:
+  // fen_ is left empty to not spend time on it
+  void loadPacked(std::string const& ffname, xTestFen_ErrorCallback const& ecbk)
+  {
+    PackedReader reader;
+    if(!reader.load(ffname))
+    {
+      ecbk("invalid packed file: " + ffname);
+      return;
+    }
+    base_class::reserve(reader.size());
+    for(size_t i = 0; i < reader.size(); ++i)
+    {
+      auto const& pos = reader[i];
+      xEPD<BOARD, MOVE, UNDO> epd;
+      if(!unpack(pos, epd.board_))
       {
-        std::string sscore = m[13];
-        try
-        {
-          if(!sscore.empty())
-            epd.score_ = std::stoi(sscore);
-        }
-        catch(std::exception const&)
-        {
-        }
+        ecbk("invalid packed position: " + std::to_string(i));
+        continue;
       }
+      if(auto move = pos.move())
+        epd.moves_.push_back(move);
+      epd.score_ = pos.score_;
       base_class::push_back(std::move(epd));
     }
   }
@@ -166,10 +163,6 @@ void testFen(std::string const& ffname,
   auto dt = std::chrono::high_resolution_clock::now() - t;
   std::cout << ft.size() << " positions; time: "
     << std::chrono::duration_cast<std::chrono::milliseconds>(dt).count() << " (ms)" << std::endl;
-  std::cout << "nodes count: " << NEngine::x_movesCounter << std::endl;
-  double ts = std::chrono::duration_cast<std::chrono::milliseconds>(dt).count()/1000.0;
-  std::cout << "NPS: " << NEngine::x_movesCounter/ts << std::endl;
-
 }
 
 void testMovegen(std::string const& ffname);
@@ -177,13 +170,53 @@ void testSee(std::string const& ffname);
 void evaluateFen(std::string const& ffname, std::string const& refname);
 void saveFen(std::string const& ffname, std::string const& refname);
 void see_perf_test(std::string const& fname);
+// KPK bitbase as c++ source. see kpk.cpp
 void kpkTable(std::string const& fname);
+// retrograde analysis of given endgames and all their subsets. default list if empty
+void generateBitbases(std::string const& fname, int threadsN, std::vector<std::string> names);
 void speedTest();
 std::vector<std::string> board2Test(std::string const& epdfile);
 // void epdFolder(std::string const& folder);
 // void pgnFolder(std::string const& folder);
 void generateMoves(std::string const& ffname, std::string const& ofname);
 void analyzeFen(std::string const& fname, std::string const& bestfname, std::string const& seqfname);
+// collect distributions of lazy eval remaining terms while searching given positions
+void calibrateLazyEval(std::string const& fname, int depth);
+// fixed depth search of each position in epd file. prints nodes, time and pruning statistics
+void bench(std::string const& fname, int depth);
+// engine plays with itself with given time control. time usage of each move is printed
+void timePlay(int xtime_ms, int inc_ms, int movesToGo);
+// analysis of epd file by instancesN engines with threadsN threads each. limit is "depth", "nodes" or "movetime" (ms)
+// one line per position with bm, ce, acd, acn, acs and pv opcodes is written in the order of input
+void batchAnalyze(std::string const& fname, std::string const& ofname, int instancesN, int threadsN,
+  std::string const& limitType, int limit);
+// compares FEN/EPD parsing with regex based reference and SAN/Smith round trip of all legal moves.
+// prints mismatches and parsing speed
+void parseTest(std::string const& fname, int repeat);
+// epd or pgn file to packed positions. each position of pgn game is written with move played and game result
+void packPositions(std::string const& fname, std::string const& ofname);
+// packed positions to epd with bm, score and result
+void unpackPositions(std::string const& fname, std::string const& ofname);
+
+// positions of pgn games to extract. plyMax_ = 0 means no limit
+struct PgnFilter
+{
+  int plyMin_{};
+  int plyMax_{};
+  // side to move isn't under check
+  bool noCheck_{};
+  // not under check and move played isn't capture or promotion
+  bool quiet_{};
+};
+
+// positions of pgn games passed filter with move played and game result. games are replayed by threadsN threads.
+// output is packed positions if ofname has .bin extension, epd otherwise
+void extractPositions(std::string const& fname, std::string const& ofname, int threadsN, PgnFilter const& filter);
+// threadsN games are played at once, each by its own engine with fixed nodes search after random opening.
+// positions are written to packed file with search score, move and game result
+void selfPlay(std::string const& ofname, int gamesN, int threadsN, int nodes);
+// enginesN engines search the same positions at once in separate threads. results should be the same as of single engine
+void concurrencyTest(std::string const& ffname, int enginesN, int depth);
 
 } // NEngine
 
@@ -0,0 +1,801 @@
+/*************************************************************
+Bitbase.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "Bitbase.h"
+#include "Board.h"
+#include "xbitmath.h"
+#include "magicbb.h"
+#include "globals.h"
+#include "xtime.h"
+#include "atomic"
+#include "thread"
+#include "fstream"
+#include "sstream"
+
+namespace NEngine
+{
+
+namespace
+{
+
+const char typeNames_[] = " PNBRQK";
+// "SBB1"
+const uint32 bitbaseMagic_ = 0x31424253;
+
+Figure::Type typeFromName(char c)
+{
+  for (int t = Figure::TypePawn; t < Figure::TypeKing; ++t)
+  {
+    if (typeNames_[t] == c)
+      return static_cast<Figure::Type>(t);
+  }
+  return Figure::TypeNone;
+}
+
+// white king is placed to a1-d1-d4 triangle, or to a-d files if there are pawns
+struct KingsIndex
+{
+  KingsIndex()
+  {
+    pawns_.fill(-1);
+    pawnless_.fill(-1);
+    int np = 0, n = 0;
+    for (int pos = 0; pos < NumOfFields; ++pos)
+    {
+      int x = pos & 7, y = pos >> 3;
+      if (x > 3)
+        continue;
+      pawnsPos_[np] = pos;
+      pawns_[pos] = np++;
+      if (y > x)
+        continue;
+      pawnlessPos_[n] = pos;
+      pawnless_[pos] = n++;
+    }
+  }
+
+  std::array<int, NumOfFields> pawns_;
+  std::array<int, NumOfFields> pawnless_;
+  std::array<int, 32> pawnsPos_;
+  std::array<int, 10> pawnlessPos_;
+};
+
+KingsIndex const& kingsIndex()
+{
+  static const KingsIndex kingsIndex_;
+  return kingsIndex_;
+}
+
+// horizontal, vertical and diagonal flips, moving white king to its canonical place
+inline int symmetry(int wk, bool pawns)
+{
+  int x = wk & 7, y = wk >> 3, t = 0;
+  if (x > 3)
+  {
+    t |= 1;
+    x = 7 - x;
+  }
+  if (pawns)
+    return t;
+  if (y > 3)
+  {
+    t |= 2;
+    y = 7 - y;
+  }
+  if (y > x)
+    t |= 4;
+  return t;
+}
+
+inline int transform(int pos, int t)
+{
+  if (t & 1)
+    pos ^= 7;
+  if (t & 2)
+    pos ^= 56;
+  if (t & 4)
+    pos = (pos >> 3) | ((pos & 7) << 3);
+  return pos;
+}
+
+BitMask figuresCode(BitbasePiece const* pieces, int n, bool flip)
+{
+  int counts[2][Figure::TypesNum] = {};
+  for (int i = 0; i < n; ++i)
+  {
+    auto color = flip ? Figure::otherColor(pieces[i].color_) : pieces[i].color_;
+    counts[color][pieces[i].type_]++;
+  }
+  BitMask code = FiguresManager::code(Figure::ColorBlack, Figure::TypeKing, 1) ^ FiguresManager::code(Figure::ColorWhite, Figure::TypeKing, 1);
+  for (int c = 0; c < 2; ++c)
+  {
+    for (int t = Figure::TypePawn; t < Figure::TypeKing; ++t)
+    {
+      if (counts[c][t])
+        code ^= FiguresManager::code(static_cast<Figure::Color>(c), static_cast<Figure::Type>(t), counts[c][t]);
+    }
+  }
+  return code;
+}
+
+template <class T>
+void writeValue(std::ostream& os, T const& v)
+{
+  os.write(reinterpret_cast<char const*>(&v), sizeof(v));
+}
+
+template <class T>
+bool readValue(std::istream& is, T& v)
+{
+  return (bool)is.read(reinterpret_cast<char*>(&v), sizeof(v));
+}
+
+// values while generating
+enum : uint8 { GenUnknown, GenDraw, GenWin, GenLoss, GenIllegal };
+
+struct GenPosition
+{
+  Figure::Color color_{};
+  int kings_[2] = {};
+  int count_{};
+  BitbasePiece pieces_[BitbaseFiguresMax - 2];
+};
+
+// positions are classified iteratively until nothing changes. all unresolved are draw then
+// captures and promotions are taken from already generated tables
+class Generator
+{
+public:
+  Generator(Bitbase& table, Bitbases const& bitbases, int threadsN) :
+    table_(table), bitbases_(bitbases), threadsN_(std::max(threadsN, 1))
+  {}
+
+  // returns number of passes
+  int run()
+  {
+    auto const size = table_.size();
+    values_.reset(new std::atomic<uint8>[size]);
+    parallel([this](size_t from, size_t to)
+    {
+      for (size_t idx = from; idx < to; ++idx)
+        values_[idx].store(legal(idx) ? GenUnknown : GenIllegal, std::memory_order_relaxed);
+    });
+
+    int passes = 0;
+    for (;;)
+    {
+      std::atomic<size_t> changed{};
+      parallel([this, &changed](size_t from, size_t to)
+      {
+        size_t n = 0;
+        for (size_t idx = from; idx < to; ++idx)
+        {
+          if (values_[idx].load(std::memory_order_relaxed) != GenUnknown)
+            continue;
+          auto v = classify(idx);
+          if (v == GenUnknown)
+            continue;
+          values_[idx].store(v, std::memory_order_relaxed);
+          n++;
+        }
+        changed += n;
+      });
+      passes++;
+      if (!changed)
+        break;
+    }
+
+    for (size_t idx = 0; idx < size; ++idx)
+    {
+      switch (values_[idx].load(std::memory_order_relaxed))
+      {
+      case GenWin:
+        table_.set(idx, BitbaseResult::Win);
+        wins_++;
+        break;
+
+      case GenLoss:
+        table_.set(idx, BitbaseResult::Loss);
+        losses_++;
+        break;
+
+      case GenIllegal:
+        table_.set(idx, BitbaseResult::Draw);
+        break;
+
+      default:
+        table_.set(idx, BitbaseResult::Draw);
+        draws_++;
+        break;
+      }
+    }
+    values_.reset();
+    return passes;
+  }
+
+  size_t wins() const { return wins_; }
+  size_t draws() const { return draws_; }
+  size_t losses() const { return losses_; }
+
+private:
+  template <class F>
+  void parallel(F const& f)
+  {
+    auto const size = table_.size();
+    auto const chunk = (size + threadsN_ - 1) / threadsN_;
+    std::vector<std::thread> threads;
+    for (size_t from = 0; from < size; from += chunk)
+    {
+      auto to = std::min(size, from + chunk);
+      threads.emplace_back([&f, from, to]() { f(from, to); });
+    }
+    for (auto& thread : threads)
+      thread.join();
+  }
+
+  GenPosition position(size_t idx) const
+  {
+    GenPosition p;
+    int pos[BitbaseFiguresMax - 2] = {};
+    table_.decode(idx, p.color_, p.kings_[Figure::ColorWhite], p.kings_[Figure::ColorBlack], pos);
+    p.count_ = table_.count();
+    for (int i = 0; i < p.count_; ++i)
+    {
+      p.pieces_[i] = table_.piece(i);
+      p.pieces_[i].pos_ = pos[i];
+    }
+    return p;
+  }
+
+  BitMask mask(GenPosition const& p, Figure::Color color) const
+  {
+    BitMask m = set_mask_bit(p.kings_[color]);
+    for (int i = 0; i < p.count_; ++i)
+    {
+      if (p.pieces_[i].pos_ >= 0 && p.pieces_[i].color_ == color)
+        m |= set_mask_bit(p.pieces_[i].pos_);
+    }
+    return m;
+  }
+
+  bool attacked(GenPosition const& p, Figure::Color acolor, int pos, BitMask occ) const
+  {
+    if (movesTable().caps(Figure::TypeKing, p.kings_[acolor]) & set_mask_bit(pos))
+      return true;
+    for (int i = 0; i < p.count_; ++i)
+    {
+      auto const& f = p.pieces_[i];
+      if (f.pos_ < 0 || f.color_ != acolor)
+        continue;
+      BitMask amask{};
+      switch (f.type_)
+      {
+      case Figure::TypePawn:
+        amask = movesTable().pawnCaps(acolor, f.pos_);
+        break;
+
+      case Figure::TypeKnight:
+        amask = movesTable().caps(Figure::TypeKnight, f.pos_);
+        break;
+
+      case Figure::TypeBishop:
+        amask = magic_ns::bishop_moves(f.pos_, occ);
+        break;
+
+      case Figure::TypeRook:
+        amask = magic_ns::rook_moves(f.pos_, occ);
+        break;
+
+      case Figure::TypeQueen:
+        amask = magic_ns::queen_moves(f.pos_, occ);
+        break;
+
+      default:
+        break;
+      }
+      if (amask & set_mask_bit(pos))
+        return true;
+    }
+    return false;
+  }
+
+  bool legal(size_t idx) const
+  {
+    auto p = position(idx);
+    auto ocolor = Figure::otherColor(p.color_);
+    int wk = p.kings_[Figure::ColorWhite];
+    int bk = p.kings_[Figure::ColorBlack];
+    if (wk == bk || (movesTable().caps(Figure::TypeKing, wk) & set_mask_bit(bk)))
+      return false;
+    BitMask occ = set_mask_bit(wk) | set_mask_bit(bk);
+    for (int i = 0; i < p.count_; ++i)
+    {
+      auto const& f = p.pieces_[i];
+      if (occ & set_mask_bit(f.pos_))
+        return false;
+      int y = f.pos_ >> 3;
+      if (f.type_ == Figure::TypePawn && (y == 0 || y == 7))
+        return false;
+      occ |= set_mask_bit(f.pos_);
+    }
+    // side that made last move can't be under check
+    return !attacked(p, p.color_, p.kings_[ocolor], occ);
+  }
+
+  uint8 value(GenPosition const& q) const
+  {
+    bool same = true;
+    for (int i = 0; i < q.count_ && same; ++i)
+      same = q.pieces_[i].pos_ >= 0 && q.pieces_[i].type_ == table_.piece(i).type_;
+    if (same)
+    {
+      int pos[BitbaseFiguresMax - 2] = {};
+      for (int i = 0; i < q.count_; ++i)
+        pos[i] = q.pieces_[i].pos_;
+      return values_[table_.index(q.color_, q.kings_[Figure::ColorWhite], q.kings_[Figure::ColorBlack], pos)].load(std::memory_order_relaxed);
+    }
+
+    // capture or promotion
+    BitbasePiece pieces[BitbaseFiguresMax - 2];
+    int n = 0;
+    for (int i = 0; i < q.count_; ++i)
+    {
+      if (q.pieces_[i].pos_ >= 0)
+        pieces[n++] = q.pieces_[i];
+    }
+    auto result = bitbases_.probe(q.color_, q.kings_, pieces, n);
+    X_ASSERT(result == BitbaseResult::Unknown, "bitbase for capture or promotion not found");
+    switch (result)
+    {
+    case BitbaseResult::Win:
+      return GenWin;
+
+    case BitbaseResult::Loss:
+      return GenLoss;
+
+    default:
+      return GenDraw;
+    }
+  }
+
+  uint8 classify(size_t idx) const
+  {
+    auto p = position(idx);
+    auto const color = p.color_;
+    auto const ocolor = Figure::otherColor(color);
+    BitMask const own = mask(p, color);
+    BitMask const opp = mask(p, ocolor);
+    BitMask const occ = own | opp;
+    // king of other side can't be attacked in legal position
+    BitMask const targets = ~own & ~set_mask_bit(p.kings_[ocolor]);
+
+    bool moves = false, unknown = false, draw = false;
+
+    // true if opponent loses after this move
+    auto check = [&](GenPosition& q) -> bool
+    {
+      if (attacked(q, ocolor, q.kings_[color], mask(q, color) | mask(q, ocolor)))
+        return false;
+      moves = true;
+      q.color_ = ocolor;
+      auto v = value(q);
+      if (v == GenLoss)
+        return true;
+      unknown = unknown || v == GenUnknown;
+      draw = draw || v == GenDraw;
+      return false;
+    };
+
+    auto capture = [ocolor](GenPosition& q, int to)
+    {
+      for (int j = 0; j < q.count_; ++j)
+      {
+        if (q.pieces_[j].color_ == ocolor && q.pieces_[j].pos_ == to)
+          q.pieces_[j].pos_ = -1;
+      }
+    };
+
+    auto kmoves = movesTable().caps(Figure::TypeKing, p.kings_[color]) & targets;
+    while (kmoves)
+    {
+      int to = clear_lsb(kmoves);
+      auto q = p;
+      q.kings_[color] = to;
+      capture(q, to);
+      if (check(q))
+        return GenWin;
+    }
+
+    for (int i = 0; i < p.count_; ++i)
+    {
+      auto const& f = p.pieces_[i];
+      if (f.color_ != color || f.pos_ < 0)
+        continue;
+
+      if (f.type_ == Figure::TypePawn)
+      {
+        auto pawnMove = [&](int to) -> bool
+        {
+          auto q = p;
+          q.pieces_[i].pos_ = to;
+          capture(q, to);
+          int y = to >> 3;
+          if (y != 0 && y != 7)
+            return check(q);
+          for (int t = Figure::TypeQueen; t >= Figure::TypeKnight; --t)
+          {
+            auto r = q;
+            r.pieces_[i].type_ = static_cast<Figure::Type>(t);
+            if (check(r))
+              return true;
+          }
+          return false;
+        };
+
+        int delta = color == Figure::ColorWhite ? 8 : -8;
+        int to = f.pos_ + delta;
+        if (!(occ & set_mask_bit(to)))
+        {
+          if (pawnMove(to))
+            return GenWin;
+          int y = f.pos_ >> 3;
+          int to2 = to + delta;
+          if (((color == Figure::ColorWhite && y == 1) || (color == Figure::ColorBlack && y == 6)) && !(occ & set_mask_bit(to2)))
+          {
+            if (pawnMove(to2))
+              return GenWin;
+          }
+        }
+        auto pcaps = movesTable().pawnCaps(color, f.pos_) & opp & targets;
+        while (pcaps)
+        {
+          if (pawnMove(clear_lsb(pcaps)))
+            return GenWin;
+        }
+        continue;
+      }
+
+      BitMask fmoves{};
+      switch (f.type_)
+      {
+      case Figure::TypeKnight:
+        fmoves = movesTable().caps(Figure::TypeKnight, f.pos_);
+        break;
+
+      case Figure::TypeBishop:
+        fmoves = magic_ns::bishop_moves(f.pos_, occ);
+        break;
+
+      case Figure::TypeRook:
+        fmoves = magic_ns::rook_moves(f.pos_, occ);
+        break;
+
+      case Figure::TypeQueen:
+        fmoves = magic_ns::queen_moves(f.pos_, occ);
+        break;
+
+      default:
+        break;
+      }
+      fmoves &= targets;
+      while (fmoves)
+      {
+        int to = clear_lsb(fmoves);
+        auto q = p;
+        q.pieces_[i].pos_ = to;
+        capture(q, to);
+        if (check(q))
+          return GenWin;
+      }
+    }
+
+    if (!moves)
+      return attacked(p, ocolor, p.kings_[color], occ) ? GenLoss : GenDraw;
+    if (unknown)
+      return GenUnknown;
+    return draw ? GenDraw : GenLoss;
+  }
+
+  Bitbase& table_;
+  Bitbases const& bitbases_;
+  size_t threadsN_{};
+  // updated in place. values only go from unknown to final, so order of updates doesn't matter
+  std::unique_ptr<std::atomic<uint8>[]> values_;
+  size_t wins_{};
+  size_t draws_{};
+  size_t losses_{};
+};
+
+} // namespace {}
+
+Bitbase::Bitbase(std::string const& name) :
+  name_(name)
+{
+  std::vector<BitbasePiece> pieces;
+  if (!parseName(name, pieces) || pieces.empty() || pieces.size() > pieces_.size())
+    return;
+  count_ = static_cast<int>(pieces.size());
+  std::copy(pieces.begin(), pieces.end(), pieces_.begin());
+  pawns_ = std::any_of(pieces.begin(), pieces.end(), [](BitbasePiece const& p) { return p.type_ == Figure::TypePawn; });
+  kingsN_ = pawns_ ? kingsIndex().pawnsPos_.size() : kingsIndex().pawnlessPos_.size();
+  size_ = 2 * kingsN_ * NumOfFields;
+  for (int i = 0; i < count_; ++i)
+    size_ *= NumOfFields;
+  data_.resize((size_ + 3) / 4);
+}
+
+bool Bitbase::parseName(std::string const& name, std::vector<BitbasePiece>& pieces)
+{
+  pieces.clear();
+  if (name.size() < 2 || name[0] != 'K')
+    return false;
+  auto k2 = name.find('K', 1);
+  if (k2 == std::string::npos)
+    return false;
+  for (size_t i = 1; i < name.size(); ++i)
+  {
+    if (i == k2)
+      continue;
+    auto type = typeFromName(name[i]);
+    if (type == Figure::TypeNone)
+      return false;
+    BitbasePiece p;
+    p.color_ = i < k2 ? Figure::ColorWhite : Figure::ColorBlack;
+    p.type_ = type;
+    pieces.push_back(p);
+  }
+  return true;
+}
+
+std::string Bitbase::canonicalName(std::vector<BitbasePiece> const& pieces, bool& flip)
+{
+  std::vector<int> types[2];
+  int weights[2] = {};
+  for (auto const& p : pieces)
+  {
+    types[p.color_].push_back(p.type_);
+    weights[p.color_] += Figure::figureWeight_[p.type_];
+  }
+  for (auto& t : types)
+    std::sort(t.begin(), t.end(), std::greater<int>());
+  auto const& w = types[Figure::ColorWhite];
+  auto const& b = types[Figure::ColorBlack];
+  if (weights[Figure::ColorWhite] != weights[Figure::ColorBlack])
+    flip = weights[Figure::ColorBlack] > weights[Figure::ColorWhite];
+  else if (w.size() != b.size())
+    flip = b.size() > w.size();
+  else
+    flip = b > w;
+  std::string name = "K";
+  for (auto t : types[flip ? Figure::ColorBlack : Figure::ColorWhite])
+    name += typeNames_[t];
+  name += "K";
+  for (auto t : types[flip ? Figure::ColorWhite : Figure::ColorBlack])
+    name += typeNames_[t];
+  return name;
+}
+
+size_t Bitbase::index(Figure::Color color, int wk, int bk, int const* pos) const
+{
+  int t = symmetry(wk, pawns_);
+  auto const& kindex = pawns_ ? kingsIndex().pawns_ : kingsIndex().pawnless_;
+  X_ASSERT(kindex[transform(wk, t)] < 0, "invalid king position in bitbase");
+  size_t idx = color * kingsN_ + kindex[transform(wk, t)];
+  idx = idx * NumOfFields + transform(bk, t);
+  for (int i = 0; i < count_; ++i)
+    idx = idx * NumOfFields + transform(pos[i], t);
+  return idx;
+}
+
+void Bitbase::decode(size_t idx, Figure::Color& color, int& wk, int& bk, int* pos) const
+{
+  for (int i = count_ - 1; i >= 0; --i)
+  {
+    pos[i] = static_cast<int>(idx % NumOfFields);
+    idx /= NumOfFields;
+  }
+  bk = static_cast<int>(idx % NumOfFields);
+  idx /= NumOfFields;
+  wk = pawns_ ? kingsIndex().pawnsPos_[idx % kingsN_] : kingsIndex().pawnlessPos_[idx % kingsN_];
+  color = static_cast<Figure::Color>(idx / kingsN_);
+}
+
+void Bitbase::set(size_t idx, BitbaseResult result)
+{
+  X_ASSERT(result == BitbaseResult::Unknown || idx >= size_, "invalid bitbase value");
+  int shift = (idx & 3) << 1;
+  auto& d = data_[idx >> 2];
+  d = static_cast<uint8>((d & ~(3 << shift)) | (((int)result - 1) << shift));
+}
+
+BitbaseResult Bitbase::probe(Figure::Color color, int const* kings, BitbasePiece const* pieces, int n, bool flip) const
+{
+  if (n != count_)
+    return BitbaseResult::Unknown;
+  int pos[BitbaseFiguresMax - 2] = {};
+  bool used[BitbaseFiguresMax - 2] = {};
+  for (int i = 0; i < count_; ++i)
+  {
+    int j = 0;
+    for (; j < n; ++j)
+    {
+      auto c = flip ? Figure::otherColor(pieces[j].color_) : pieces[j].color_;
+      if (!used[j] && c == pieces_[i].color_ && pieces[j].type_ == pieces_[i].type_)
+        break;
+    }
+    if (j == n)
+      return BitbaseResult::Unknown;
+    used[j] = true;
+    pos[i] = flip ? pieces[j].pos_ ^ 56 : pieces[j].pos_;
+  }
+  if (flip)
+    return get(index(Figure::otherColor(color), kings[Figure::ColorBlack] ^ 56, kings[Figure::ColorWhite] ^ 56, pos));
+  return get(index(color, kings[Figure::ColorWhite], kings[Figure::ColorBlack], pos));
+}
+
+bool Bitbases::generate(std::string const& name, int threadsN, std::function<void(std::string const&)> const& log)
+{
+  std::vector<BitbasePiece> pieces;
+  if (!Bitbase::parseName(name, pieces) || pieces.empty())
+    return false;
+  bool flip{};
+  auto cname = Bitbase::canonicalName(pieces, flip);
+  if (find(cname))
+    return true;
+  auto table = std::unique_ptr<Bitbase>(new Bitbase(cname));
+  if (!table->valid())
+  {
+    if (log)
+      log(name + ": only " + std::to_string(BitbaseFiguresMax) + " figures are supported");
+    return false;
+  }
+
+  // tables for captures and promotions go first
+  for (int i = 0; i < table->count(); ++i)
+  {
+    std::vector<BitbasePiece> sub;
+    for (int j = 0; j < table->count(); ++j)
+    {
+      if (j != i)
+        sub.push_back(table->piece(j));
+    }
+    if (!sub.empty() && !generate(Bitbase::canonicalName(sub, flip), threadsN, log))
+      return false;
+    if (table->piece(i).type_ != Figure::TypePawn)
+      continue;
+    for (int t = Figure::TypeKnight; t <= Figure::TypeQueen; ++t)
+    {
+      sub.clear();
+      for (int j = 0; j < table->count(); ++j)
+      {
+        sub.push_back(table->piece(j));
+        if (j == i)
+          sub.back().type_ = static_cast<Figure::Type>(t);
+      }
+      if (!generate(Bitbase::canonicalName(sub, flip), threadsN, log))
+        return false;
+    }
+  }
+
+  auto t0 = NTime::now();
+  Generator generator(*table, *this, threadsN);
+  int passes = generator.run();
+  if (log)
+  {
+    std::ostringstream oss;
+    oss << cname << ": " << table->size() << " positions, wins " << generator.wins()
+      << ", draws " << generator.draws() << ", losses " << generator.losses()
+      << ", passes " << passes << ", time " << NTime::milli_seconds<int>(NTime::now() - t0) << " ms";
+    log(oss.str());
+  }
+  add(std::move(table));
+  return true;
+}
+
+bool Bitbases::load(std::string const& fname)
+{
+  std::ifstream ifs(fname, std::ios::binary);
+  uint32 magic{}, count{};
+  if (!ifs || !readValue(ifs, magic) || magic != bitbaseMagic_ || !readValue(ifs, count))
+    return false;
+  std::vector<std::unique_ptr<Bitbase>> tables;
+  for (uint32 i = 0; i < count; ++i)
+  {
+    uint32 len{};
+    if (!readValue(ifs, len) || len > 16)
+      return false;
+    std::string name(len, ' ');
+    if (!ifs.read(&name[0], len))
+      return false;
+    auto table = std::unique_ptr<Bitbase>(new Bitbase(name));
+    uint64 size{};
+    if (!table->valid() || !readValue(ifs, size) || size != table->size())
+      return false;
+    auto& data = table->data();
+    if (!ifs.read(reinterpret_cast<char*>(data.data()), data.size()))
+      return false;
+    tables.push_back(std::move(table));
+  }
+  tables_.clear();
+  codes_.clear();
+  for (auto& table : tables)
+    add(std::move(table));
+  return true;
+}
+
+bool Bitbases::save(std::string const& fname) const
+{
+  std::ofstream ofs(fname, std::ios::binary);
+  if (!ofs)
+    return false;
+  writeValue(ofs, bitbaseMagic_);
+  writeValue(ofs, static_cast<uint32>(tables_.size()));
+  for (auto const& table : tables_)
+  {
+    writeValue(ofs, static_cast<uint32>(table->name().size()));
+    ofs.write(table->name().data(), table->name().size());
+    writeValue(ofs, static_cast<uint64>(table->size()));
+    ofs.write(reinterpret_cast<char const*>(table->data().data()), table->data().size());
+  }
+  return (bool)ofs;
+}
+
+Bitbase const* Bitbases::find(std::string const& name) const
+{
+  auto iter = std::find_if(tables_.begin(), tables_.end(), [&name](std::unique_ptr<Bitbase> const& t) { return t->name() == name; });
+  return iter != tables_.end() ? iter->get() : nullptr;
+}
+
+void Bitbases::add(std::unique_ptr<Bitbase>&& table)
+{
+  BitbasePiece pieces[BitbaseFiguresMax - 2];
+  for (int i = 0; i < table->count(); ++i)
+    pieces[i] = table->piece(i);
+  codes_[figuresCode(pieces, table->count(), true)] = Link{ table.get(), true };
+  // the same code for symmetric material
+  codes_[figuresCode(pieces, table->count(), false)] = Link{ table.get(), false };
+  tables_.push_back(std::move(table));
+}
+
+BitbaseResult Bitbases::probe(Figure::Color color, int const* kings, BitbasePiece const* pieces, int n) const
+{
+  if (n == 0)
+    return BitbaseResult::Draw;
+  auto iter = codes_.find(figuresCode(pieces, n, false));
+  if (iter == codes_.end())
+    return BitbaseResult::Unknown;
+  return iter->second.table_->probe(color, kings, pieces, n, iter->second.flip_);
+}
+
+BitbaseResult Bitbases::probeBoard(Board const& board) const
+{
+  auto const& fmgr = board.fmgr();
+  if (board.enpassant() > 0 || pop_count(fmgr.mask(Figure::ColorWhite) | fmgr.mask(Figure::ColorBlack)) > BitbaseFiguresMax)
+    return BitbaseResult::Unknown;
+  auto iter = codes_.find(fmgr.fgrsCode());
+  if (iter == codes_.end())
+    return BitbaseResult::Unknown;
+  BitbasePiece pieces[BitbaseFiguresMax - 2];
+  int n = 0;
+  for (int c = 0; c < 2; ++c)
+  {
+    auto color = static_cast<Figure::Color>(c);
+    for (int t = Figure::TypePawn; t < Figure::TypeKing; ++t)
+    {
+      auto type = static_cast<Figure::Type>(t);
+      auto mask = fmgr.type_mask(type, color);
+      while (mask)
+      {
+        pieces[n].color_ = color;
+        pieces[n].type_ = type;
+        pieces[n].pos_ = clear_lsb(mask);
+        n++;
+      }
+    }
+  }
+  int kings[2] = { board.kingPos(Figure::ColorBlack), board.kingPos(Figure::ColorWhite) };
+  return iter->second.table_->probe(board.color(), kings, pieces, n, iter->second.flip_);
+}
+
+} // NEngine
@@ -201,11 +201,12 @@ bool Board::hasReps(const Move move) const
   {
     bool reps = false;
     auto i = halfmovesCounter_ - 1;
-    auto stop = halfmovesCounter_ - data_.fiftyMovesCount_; // TODO: is it correct?
+    // moves made before position was set up aren't in undo stack
+    auto stop = std::max(halfmovesCounter_ - data_.fiftyMovesCount_, 0);
     for(; i >= stop && !reps; i -= 2)
     {
       if(undoInfo(i).zcode_ == zcode)
-        reps++;
+        reps = true;
       if(undoInfo(i).irreversible())
         break;
     }
@@ -236,18 +237,15 @@ void Board::clear()
   g_undoStack = undoStack;
 }
 
+// halfmoves counter is depth of undo stack. it isn't derived from moves number,
+// otherwise position from the middle of game doesn't fit small stack
 void Board::setMovesCounter(int c)
 {
   movesCounter_ = c;
-  halfmovesCounter_ = (c - 1)*2 + !color();
-  if(data_.fiftyMovesCount_ > halfmovesCounter_)
-    data_.fiftyMovesCount_ = halfmovesCounter_;
 }
 
 bool Board::invalidate()
 {
-  X_ASSERT(data_.fiftyMovesCount_ > halfmovesCounter_, "invalid moves counters");
-
   Figure::Color ocolor = Figure::otherColor(color());
 
   int ki_pos  = kingPos(color());
@@ -0,0 +1,183 @@
+/*************************************************************
+Book.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "Book.h"
+#include "Board.h"
+#include "polyglot.h"
+
+namespace NEngine
+{
+
+namespace
+{
+
+const size_t entrySize_ = 16;
+
+// polyglot pieces order: black pawn, white pawn, black knight, white knight ...
+inline int pieceKind(Field const& field)
+{
+  return ((field.type() - Figure::TypePawn) << 1) | field.color();
+}
+
+inline uint64 readBE(uint8 const* p, int n)
+{
+  uint64 v = 0;
+  for (int i = 0; i < n; ++i)
+    v = (v << 8) | p[i];
+  return v;
+}
+
+} // namespace {}
+
+Book::Book() :
+  rgen_(std::random_device{}())
+{
+}
+
+void Book::clear()
+{
+  file_.clear();
+  data_ = nullptr;
+  count_ = 0;
+}
+
+bool Book::load(std::string const& fname)
+{
+  clear();
+  if (!file_.load(fname) || file_.size() < entrySize_)
+  {
+    clear();
+    return false;
+  }
+  data_ = file_.data();
+  count_ = file_.size() / entrySize_;
+  return true;
+}
+
+Book::Entry Book::entry(size_t i) const
+{
+  X_ASSERT(i >= count_, "invalid book entry index");
+  auto const* p = data_ + i * entrySize_;
+  Entry e;
+  e.key_ = readBE(p, 8);
+  e.move_ = static_cast<uint16>(readBE(p + 8, 2));
+  e.weight_ = static_cast<uint16>(readBE(p + 10, 2));
+  return e;
+}
+
+size_t Book::lowerBound(uint64 key) const
+{
+  size_t lo = 0, hi = count_;
+  while (lo < hi)
+  {
+    size_t mid = (lo + hi) >> 1;
+    if (readBE(data_ + mid * entrySize_, 8) < key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+uint64 Book::key(Board const& board)
+{
+  uint64 k = 0;
+  for (int i = 0; i < 64; ++i)
+  {
+    auto const field = board.getField(i);
+    if (field)
+      k ^= polyglotKeys_[(pieceKind(field) << 6) | i];
+  }
+
+  if (board.castling_K())
+    k ^= polyglotKeys_[768];
+  if (board.castling_Q())
+    k ^= polyglotKeys_[769];
+  if (board.castling_k())
+    k ^= polyglotKeys_[770];
+  if (board.castling_q())
+    k ^= polyglotKeys_[771];
+
+  // only if en-passant capture is pseudo-legal
+  if (board.enpassant() > 0)
+  {
+    int const epos = board.enpassantPos();
+    int const x = epos & 7;
+    bool capture = false;
+    if (x > 0)
+      capture = board.isFigure(epos - 1, board.color(), Figure::TypePawn);
+    if (x < 7 && !capture)
+      capture = board.isFigure(epos + 1, board.color(), Figure::TypePawn);
+    if (capture)
+      k ^= polyglotKeys_[772 + x];
+  }
+
+  if (board.color() == Figure::ColorWhite)
+    k ^= polyglotKeys_[780];
+
+  return k;
+}
+
+Move Book::bookMove(Board const& board, uint16 pmove)
+{
+  int to = pmove & 63;
+  int const from = (pmove >> 6) & 63;
+  int const promotion = (pmove >> 12) & 7;
+
+  // castling is encoded as king captures own rook
+  auto const ffrom = board.getField(from);
+  if (ffrom.type() == Figure::TypeKing && (from & 7) == 4 && (to >> 3) == (from >> 3))
+  {
+    if ((to & 7) == 7)
+      to = from + 2;
+    else if ((to & 7) == 0)
+      to = from - 2;
+  }
+
+  Move move{ from, to, promotion ? static_cast<Figure::Type>(promotion + Figure::TypePawn) : Figure::TypeNone };
+  if (!board.possibleMove(move) || !board.validateMoveBruteforce(move))
+    return Move{ true };
+  return move;
+}
+
+Move Book::move(Board const& board)
+{
+  if (empty())
+    return Move{ true };
+
+  auto const k = key(board);
+  Move moves[NumOfFields];
+  uint32 weights[NumOfFields];
+  int num = 0;
+  uint32 total = 0;
+  for (size_t i = lowerBound(k); i < count_ && num < NumOfFields; ++i)
+  {
+    auto const e = entry(i);
+    if (e.key_ != k)
+      break;
+    if (!e.weight_)
+      continue;
+    auto const mv = bookMove(board, e.move_);
+    if (!mv)
+      continue;
+    moves[num] = mv;
+    weights[num] = e.weight_;
+    total += e.weight_;
+    num++;
+  }
+
+  if (!total)
+    return Move{ true };
+
+  auto r = std::uniform_int_distribution<uint32>(0, total - 1)(rgen_);
+  for (int i = 0; i < num; ++i)
+  {
+    if (r < weights[i])
+      return moves[i];
+    r -= weights[i];
+  }
+  return Move{ true };
+}
+
+} // NEngine
@@ -4,327 +4,413 @@ EvalCoefficients.cpp - Copyright (C) 2016 by Dmitry Sultanov
 
 #include "Figure.h"
 #include "fstream"
-#include "set"
+#include "sstream"
+#include "cstring"
+#include "cstdlib"
+#include "type_traits"
 #include "algorithm"
 
 namespace NEngine
 {
-  // single vars
-  int EvalCoefficients::additionalMatBonus_{ 150 };
+  ScoreType32 EvalCoefficients::basePositionEvaluations_[2][8][64];
 
-  // pawns
-  ScoreType32 EvalCoefficients::protectedPawnPressure_{ 1, 2 };
-  ScoreType32 EvalCoefficients::pawnPressureStrong_{ 13, 22 };
-  ScoreType32 EvalCoefficients::pawnPressureMedium_{ 2, 5 };
-  ScoreType32 EvalCoefficients::pawnPressureWeak_{ 1, 3 };
-  ScoreType32 EvalCoefficients::pawnBishopTreat_{ 0, 3 };
-
-  // outpost
-  ScoreType32 EvalCoefficients::knightOutpost_[2] = { { 6, 2 }, { 10, 3 } };
-  ScoreType32 EvalCoefficients::bishopOutpost_[2] = { {6, 2},  {10, 3} };
-
-  // attacks
-  ScoreType EvalCoefficients::bishopsAttackRQ_{ 40 };
-  ScoreType EvalCoefficients::bishopsAttack_{ 30 };
-  ScoreType EvalCoefficients::bishopsAttackWeak_{ 15 };
-  ScoreType EvalCoefficients::knightAttackRQ_{ 40 };
-  ScoreType EvalCoefficients::knightAttack_{ 30 };
-  ScoreType EvalCoefficients::knightAttackWeak_{ 15 };
-  ScoreType EvalCoefficients::pawnAttack_{ 60 };
-  ScoreType EvalCoefficients::possibleKnightAttack_[4] = { 0, 8, 30, 40 };
-  ScoreType EvalCoefficients::possiblePawnAttack_{ 12 };
-  ScoreType EvalCoefficients::rookAttackBonus_{ 30 };
-  ScoreType EvalCoefficients::queenAttackBonus_{ 30 };
-  ScoreType EvalCoefficients::queenUnderRookAttackBonus_{ 20 };
-  ScoreType EvalCoefficients::multiattackedBonus_{ 25 };
-  ScoreType EvalCoefficients::attackedByKingBonus_{ 20 };
-  ScoreType EvalCoefficients::attackedThroughBonus_{ 20 };
-  ScoreType EvalCoefficients::discoveredAttackBonus_{ 20 };
-
-  // immobility
-  ScoreType EvalCoefficients::immobileAttackBonus_ = 30;
-  ScoreType EvalCoefficients::pinnedFigureBonus_ = 15;
+  namespace
+  {
+    const char binaryMagic_[4] = { 'S', 'H', 'E', 'V' };
+    const uint32 binaryVersion_ = 2;
 
-  // check & mat treat
-  ScoreType32 EvalCoefficients::discoveredCheckBonus_{ 20, 20 };
+    template <class T>
+    EvalCoefficients::ParamType paramType();
 
-  // king
-  ScoreType32 EvalCoefficients::fakeCastle_{ -60, 0 };
+    template <>
+    EvalCoefficients::ParamType paramType<int>() { return EvalCoefficients::ParamType::Int; }
 
-  // blocked figure
-  ScoreType32 EvalCoefficients::knightBlocked_{ 60, 50 };
-  ScoreType32 EvalCoefficients::bishopBlocked_{ 60, 50 };
-  ScoreType32 EvalCoefficients::rookBlocked_{ 60, 60 };
+    template <>
+    EvalCoefficients::ParamType paramType<ScoreType>() { return EvalCoefficients::ParamType::Score; }
 
-  // king attacks
-  int EvalCoefficients::pawnKingAttack_{ 15 };
+    template <>
+    EvalCoefficients::ParamType paramType<ScoreType32>() { return EvalCoefficients::ParamType::Score32; }
 
-  int EvalCoefficients::knightKingAttack_{ 20 };
-  int EvalCoefficients::bishopKingAttack_{ 20 };
-  int EvalCoefficients::rookKingAttack_{ 18 };
-  int EvalCoefficients::queenKingAttack_{ 21 };
+    template <class T>
+    void addParam(std::vector<EvalCoefficients::Param>& params, EvalCoefficients const& ec, char const* name, T const& field)
+    {
+      using E = typename std::remove_all_extents<T>::type;
+      auto offset = static_cast<size_t>(reinterpret_cast<char const*>(&field) - reinterpret_cast<char const*>(&ec));
+      params.push_back({ name, paramType<E>(), offset, static_cast<int>(sizeof(T) / sizeof(E)) });
+    }
 
-  int EvalCoefficients::generalKingPressure_{ 3 };
+    // ScoreType32 gives 2 values - opening and endgame
+    inline int valuesCount(EvalCoefficients::Param const& p)
+    {
+      return p.type_ == EvalCoefficients::ParamType::Score32 ? p.size_ * 2 : p.size_;
+    }
 
-  // king threat
-  int EvalCoefficients::knightChecking_{ 70 };
-  int EvalCoefficients::bishopChecking_{ 30 };
-  int EvalCoefficients::rookChecking_{ 85 };
-  int EvalCoefficients::queenChecking_{ 85 };
-  int EvalCoefficients::discoveredChecking_{ 40 };
-  int EvalCoefficients::promotionChecking_{ 40 };
-  int EvalCoefficients::weakChecking_{ 9 };
-  int EvalCoefficients::queenCheckTreatBonus_{ 50 };
-  
-  int EvalCoefficients::attackedNearKingStrong_{ 35 };
-  int EvalCoefficients::attackedNearKingMedium_{ 20 };
-  int EvalCoefficients::attackedNearKingWeak_{ 8 };
-  int EvalCoefficients::attackedNearKingRem_{ 10 };
-  int EvalCoefficients::attackedNearKingOther_{ 4 };
-  int EvalCoefficients::attackedNearKingPawns_{ 3 };
-  int EvalCoefficients::checkNearKingStrong_{ 35 };
-  int EvalCoefficients::checkNearKingMedium_{ 20 };
-  int EvalCoefficients::checkNearKingWeak_{ 8 };
-  int EvalCoefficients::checkNearKingRem_{ 10 };
-  int EvalCoefficients::checkNearKingOther_{ 4 };
-  int EvalCoefficients::checkNearKingPawns_{ 3 };
-  int EvalCoefficients::possibleMatTreat_{ 50 };
-  int EvalCoefficients::possibleMatTreatMyMove_{ 50 };
-  int EvalCoefficients::attackThroughPawn_{ 15 };
+    int getValue(EvalCoefficients const& ec, EvalCoefficients::Param const& p, int i)
+    {
+      auto const* ptr = reinterpret_cast<char const*>(&ec) + p.offset_;
+      switch (p.type_)
+      {
+      case EvalCoefficients::ParamType::Int:
+        return reinterpret_cast<int const*>(ptr)[i];
 
-  int EvalCoefficients::kingWeakCheckersCoefficients_{ 16 };
-  int EvalCoefficients::kingCheckersCoefficients_[8]  = { 0, 16, 32, 64, 64, 64, 64, 64 };
-  int EvalCoefficients::kingAttackersCoefficients_[8] = { 0,  0,  4,  8, 16, 32, 56, 64 };
+      case EvalCoefficients::ParamType::Score:
+        return reinterpret_cast<ScoreType const*>(ptr)[i];
 
-  // for special cases
-  int EvalCoefficients::kingToPawnDistanceMulti_{ 3 };
-  int EvalCoefficients::knightToPawnDistanceMulti_{ 1 };
-  int EvalCoefficients::kingToKingDistanceMulti_{ 3 };
-  int EvalCoefficients::figureToKingDistanceMulti_{ 3 };
+      case EvalCoefficients::ParamType::Score32:
+        {
+          auto const& s = reinterpret_cast<ScoreType32 const*>(ptr)[i >> 1];
+          return (i & 1) ? s.eval1() : s.eval0();
+        }
+      }
+      return 0;
+    }
 
-  // arrays
-  ScoreType32 EvalCoefficients::doubledPawn_ = {-10, -8};
-  ScoreType32 EvalCoefficients::isolatedPawn_[2] = { {-12, -10}, {-17, -12} };
-  ScoreType32 EvalCoefficients::backwardPawn_[2] = { {-12, -10}, {-17, -12} };
-  ScoreType32 EvalCoefficients::unprotectedPawn_ = {-6, -4};
-  ScoreType32 EvalCoefficients::hasneighborPawn_ = {4, 4};
-  ScoreType32 EvalCoefficients::attackingPawn_[8] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 3 }, { 8, 10 }, { 14, 18 }, { 0, 0 }, { 0, 0 } };
+    void setValue(EvalCoefficients& ec, EvalCoefficients::Param const& p, int i, int value)
+    {
+      auto* ptr = reinterpret_cast<char*>(&ec) + p.offset_;
+      switch (p.type_)
+      {
+      case EvalCoefficients::ParamType::Int:
+        reinterpret_cast<int*>(ptr)[i] = value;
+        break;
 
-  int EvalCoefficients::opponentPawnPressure_[8] = { 20, 20, 15, 10, 7, 1, 0, 0 };
+      case EvalCoefficients::ParamType::Score:
+        reinterpret_cast<ScoreType*>(ptr)[i] = static_cast<ScoreType>(value);
+        break;
 
-  int EvalCoefficients::pawnShieldA_[4] = { 30, 26, 5, 0 };
-  int EvalCoefficients::pawnShieldB_[4] = { 30, 26, 5, 0 };
-  int EvalCoefficients::pawnShieldC_[4] = { 20, 16, 3, 0 };
-  int EvalCoefficients::pawnShieldAbove_[4] = { 12, 5, 1, 0 };
+      case EvalCoefficients::ParamType::Score32:
+        {
+          auto& s = reinterpret_cast<ScoreType32*>(ptr)[i >> 1];
+          s = (i & 1) ? ScoreType32{ s.eval0(), value } : ScoreType32{ value, s.eval1() };
+        }
+        break;
+      }
+    }
 
-  // new shield
-  int EvalCoefficients::pawnsShields_[8][8] = {
-    {-20, 32, 30, 15,-10, -20, -20, 0},
-    {-20, 35, 30, 0,-15, -20, -20, 0},
-    {-10, 32, 15, 8, -10, -10, -10, 0},
-    {-10, 15, 10, 6, -10, -10, -10, 0},
-    {-10, 15, 10, 6, -10, -10, -10, 0},
-    {-10, 32, 15, 8, -10, -10, -10, 0},
-    {-20, 35, 30, 5,-15, -20, -20, 0},
-    {-20, 32, 30, 15,-10, -20, -20, 0}
-  };
-  int EvalCoefficients::opawnsShieldAttack_[2][8] = {
-    {0, 3, 1, 0, 0, 0, 0, 0},
-    {30, 18, 6, 5, 3, 2, 1, 0}
-  };
-  int EvalCoefficients::opawnsNearKing_[8] = { 0, 20, 15, 7, 3, 1, 0, 0 };
-  int EvalCoefficients::opawnsAttackCoeffs_[8] = { 0, 32, 32, 32, 16, 8, 4, 0 };
-  int EvalCoefficients::opawnAboveKing_[8] = { 0, 40, 25, 10, 0, 0, 0, 0 };
+    EvalCoefficients::Param const* findParam(std::string const& name)
+    {
+      auto const& params = EvalCoefficients::params();
+      auto iter = std::find_if(params.begin(), params.end(), [&name](EvalCoefficients::Param const& p) { return p.name_ == name; });
+      return iter != params.end() ? &*iter : nullptr;
+    }
 
-  // rook on open column
-  ScoreType32 EvalCoefficients::openRook_[2] = { {20, 8}, {10, 4} };
+    bool loadText(EvalCoefficients& ec, std::istream& is)
+    {
+      std::string line;
+      while (std::getline(is, line))
+      {
+        std::istringstream iss(line);
+        std::string name;
+        if (!(iss >> name) || name[0] == '#')
+          continue;
+        auto const* p = findParam(name);
+        if (!p)
+          return false;
+        auto n = valuesCount(*p);
+        for (int i = 0; i < n; ++i)
+        {
+          int value{};
+          if (!(iss >> value))
+            return false;
+          setValue(ec, *p, i, value);
+        }
+      }
+      return true;
+    }
 
-  // material diff
-  // opening, endgame
-  ScoreType32 EvalCoefficients::doubleBishopBonus_[10] = { {0, 0}, {10, 10}, {12, 12}, {15, 15}, {15, 15}, {15, 15}, {15, 15}, {15, 15}, {15, 15}, {15, 15} };
-  ScoreType32 EvalCoefficients::doubleKnightBonus_[10] = { {0, 0}, {3, 3}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5}, {5, 5} };
-  ScoreType32 EvalCoefficients::twoKnightsBonus_[10] = { {0, 0}, {10, 5}, {15, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5}, {20, 5} };
-  ScoreType32 EvalCoefficients::twoBishopsBonus_[10] = { {5, 5}, {25, 25}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35}, {35, 35} };
-  ScoreType32 EvalCoefficients::twoRooksBonus_[10] = { {0, 0}, {5, 5}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10}, {10, 10} };
-  ScoreType32 EvalCoefficients::figureAgainstPawnBonus_[10] = { {0, 0}, {25, 10}, {35, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20}, {40, 20} };
-  ScoreType32 EvalCoefficients::figuresAgainstRookBonus_[10] = { {0, 0}, {30, 20}, {50, 40}, {60, 50}, {60, 50}, {60, 50}, {60, 50}, {60, 50}, {60, 50}, {60, 50} };
-  ScoreType32 EvalCoefficients::knightsAgainstRookBonus_[10] = { {0, 0}, {12, 12}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20}, {25, 20} };
-  ScoreType32 EvalCoefficients::rookAgainstFigureBonus_[10][10] = {
-    { { 60,  30}, { 58,  30}, { 57,  30}, { 56,  30}, { 56,  30}, { 55,  30}, { 55,  30}, { 55,  30}, { 55,  30}, {  0,   0} },
-    { { 55,  26}, { 54,  26}, { 53,  26}, { 52,  26}, { 51,  26}, { 51,  26}, { 50,  26}, { 50,  26}, { 50,  26}, {  0,   0} },
-    { { 51,  23}, { 50,  23}, { 49,  23}, { 48,  23}, { 47,  23}, { 46,  23}, { 46,  23}, { 46,  23}, { 46,  23}, {  0,   0} },
-    { { 47,  20}, { 46,  20}, { 45,  20}, { 44,  20}, { 44,  20}, { 43,  20}, { 43,  20}, { 42,  20}, { 42,  20}, {  0,   0} },
-    { { 45,  18}, { 43,  18}, { 42,  18}, { 41,  18}, { 41,  18}, { 40,  18}, { 40,  18}, { 40,  18}, { 40,  18}, {  0,   0} },
-    { { 42,  17}, { 41,  17}, { 40,  17}, { 39,  17}, { 39,  17}, { 38,  17}, { 38,  17}, { 37,  17}, { 37,  17}, {  0,   0} },
-    { { 41,  15}, { 40,  15}, { 39,  15}, { 38,  15}, { 37,  15}, { 36,  15}, { 36,  15}, { 36,  15}, { 36,  15}, {  0,   0} },
-    { { 40,  15}, { 39,  15}, { 38,  15}, { 37,  15}, { 36,  15}, { 36,  15}, { 35,  15}, { 35,  15}, { 35,  15}, {  0,   0} },
-    { { 40,  15}, { 38,  15}, { 37,  15}, { 36,  15}, { 36,  15}, { 35,  15}, { 35,  15}, { 35,  15}, { 35,  15}, {  0,   0} },
-    { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} }
-  };
+    bool loadBinary(EvalCoefficients& ec, std::istream& is)
+    {
+      uint32 version{}, count{};
+      is.read(reinterpret_cast<char*>(&version), sizeof(version));
+      is.read(reinterpret_cast<char*>(&count), sizeof(count));
+      if (!is || version != binaryVersion_)
+        return false;
+      auto const& params = EvalCoefficients::params();
+      uint32 total{};
+      for (auto const& p : params)
+        total += valuesCount(p);
+      if (count != total)
+        return false;
+      for (auto const& p : params)
+      {
+        auto n = valuesCount(p);
+        for (int i = 0; i < n; ++i)
+        {
+          int32 value{};
+          if (!is.read(reinterpret_cast<char*>(&value), sizeof(value)))
+            return false;
+          setValue(ec, p, i, value);
+        }
+      }
+      return true;
+    }
+  } // namespace {}
 
-  ScoreType32 EvalCoefficients::noKnightsPenalty_ = {5, 5};
-  ScoreType32 EvalCoefficients::noBishopsPenalty_ = {8, 8};
-  ScoreType32 EvalCoefficients::noRooksPenalty_ = {10, 10};
-  ScoreType32 EvalCoefficients::noQueensPenalty_ = {15, 15};
+  EvalCoefficients::EvalCoefficients()
+  {
+    update();
+  }
 
-  // passer pawns
-  ScoreType32 EvalCoefficients::passerPawn_[8] = { {  0,   0}, {  1,   2}, {  1,   2}, {  9,  10}, { 27,  30}, { 54,  60}, { 90, 100}, {  0,   0} };
-  ScoreType32 EvalCoefficients::passerPawn2_[8] = { {  0,   0}, {  0,   1}, {  0,   1}, {  4,   5}, { 13,  15}, { 27,  30}, { 45,  50}, {  0,   0} };
-  ScoreType32 EvalCoefficients::passerPawnEx_[8] = { {  0,   0}, {  1,   2}, {  1,   2}, {  4,   5}, { 20,  25}, { 48,  60}, {112, 140}, {  0,   0} };
-  ScoreType32 EvalCoefficients::passerUnstoppable_[8] = { {  0,   0}, {  2,   3}, {  5,   8}, { 10,  17}, { 25,  42}, { 50,  85}, {100, 170}, {  0,   0} };
-  ScoreType32 EvalCoefficients::passerPawnExS_[8][8] = {
-    { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
-    { {  0,   0}, {  0,   1}, {  1,   1}, {  1,   1}, {  1,   1}, {  1,   1}, {  1,   2}, {  0,   0} },
-    { {  0,   0}, {  0,   1}, {  1,   1}, {  1,   1}, {  1,   1}, {  1,   2}, {  0,   0}, {  0,   0} },
-    { {  0,   0}, {  2,   3}, {  3,   3}, {  3,   4}, {  4,   5}, {  0,   0}, {  0,   0}, {  0,   0} },
-    { {  0,   0}, { 13,  16}, { 16,  20}, { 20,  25}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
-    { {  0,   0}, { 36,  45}, { 48,  60}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
-    { {  0,   0}, {112, 140}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} },
-    { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0} }
-  };
-  ScoreType32 EvalCoefficients::passerPawnPGrds_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  1,   2}, {  5,   7}, { 10,  15}, { 18,  25}, {  0,   0} };
-  ScoreType32 EvalCoefficients::passerPawnPGrds2_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   1}, {  2,   3}, {  5,   7}, {  9,  12}, {  0,   0} };
-  ScoreType32 EvalCoefficients::kingToPasserDistanceBonus_[8] = { {  0,   0}, {  0,   0}, {  0,   1}, {  0,   2}, {  0,   5}, {  0,   9}, {  0,  15}, {  0,   0} };
-  ScoreType32 EvalCoefficients::okingToPasserDistanceBonus_[8] = { {  0,   0}, {  0,   1}, {  0,   2}, {  0,   6}, {  0,  13}, {  0,  22}, {  0,  35}, {  0,   0} };
-  ScoreType32 EvalCoefficients::kingToPasserDistanceBonus2_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  0,   1}, {  0,   2}, {  0,   4}, {  0,   7}, {  0,   0} };
-  ScoreType32 EvalCoefficients::okingToPasserDistanceBonus2_[8] = { {  0,   0}, {  0,   0}, {  0,   1}, {  0,   3}, {  0,   6}, {  0,  11}, {  0,  17}, {  0,   0} };
-  ScoreType32 EvalCoefficients::passerPawnMyBefore_[8] = { {  0,   0}, {  0,   0}, {  0,   0}, {  1,   2}, {  5,   6}, { 10,  12}, { 18,  20}, {  0,   0} };
-  // end of passer pawns
+  std::vector<EvalCoefficients::Param> const& EvalCoefficients::params()
+  {
+    static std::vector<Param> const params_ = []()
+    {
+      std::vector<Param> params;
+      auto const& ec = defaults();
+      addParam(params, ec, "additionalMatBonus", ec.additionalMatBonus_);
+      addParam(params, ec, "protectedPawnPressure", ec.protectedPawnPressure_);
+      addParam(params, ec, "pawnPressureStrong", ec.pawnPressureStrong_);
+      addParam(params, ec, "pawnPressureMedium", ec.pawnPressureMedium_);
+      addParam(params, ec, "pawnPressureWeak", ec.pawnPressureWeak_);
+      addParam(params, ec, "pawnBishopTreat", ec.pawnBishopTreat_);
+      addParam(params, ec, "knightOutpost", ec.knightOutpost_);
+      addParam(params, ec, "bishopOutpost", ec.bishopOutpost_);
+      addParam(params, ec, "bishopsAttackRQ", ec.bishopsAttackRQ_);
+      addParam(params, ec, "bishopsAttack", ec.bishopsAttack_);
+      addParam(params, ec, "bishopsAttackWeak", ec.bishopsAttackWeak_);
+      addParam(params, ec, "knightAttackRQ", ec.knightAttackRQ_);
+      addParam(params, ec, "knightAttack", ec.knightAttack_);
+      addParam(params, ec, "knightAttackWeak", ec.knightAttackWeak_);
+      addParam(params, ec, "pawnAttack", ec.pawnAttack_);
+      addParam(params, ec, "possibleKnightAttack", ec.possibleKnightAttack_);
+      addParam(params, ec, "possiblePawnAttack", ec.possiblePawnAttack_);
+      addParam(params, ec, "rookAttackBonus", ec.rookAttackBonus_);
+      addParam(params, ec, "queenAttackBonus", ec.queenAttackBonus_);
+      addParam(params, ec, "queenUnderRookAttackBonus", ec.queenUnderRookAttackBonus_);
+      addParam(params, ec, "multiattackedBonus", ec.multiattackedBonus_);
+      addParam(params, ec, "attackedByKingBonus", ec.attackedByKingBonus_);
+      addParam(params, ec, "attackedThroughBonus", ec.attackedThroughBonus_);
+      addParam(params, ec, "discoveredAttackBonus", ec.discoveredAttackBonus_);
+      addParam(params, ec, "immobileAttackBonus", ec.immobileAttackBonus_);
+      addParam(params, ec, "pinnedFigureBonus", ec.pinnedFigureBonus_);
+      addParam(params, ec, "discoveredCheckBonus", ec.discoveredCheckBonus_);
+      addParam(params, ec, "fakeCastle", ec.fakeCastle_);
+      addParam(params, ec, "knightBlocked", ec.knightBlocked_);
+      addParam(params, ec, "bishopBlocked", ec.bishopBlocked_);
+      addParam(params, ec, "rookBlocked", ec.rookBlocked_);
+      addParam(params, ec, "pawnKingAttack", ec.pawnKingAttack_);
+      addParam(params, ec, "knightKingAttack", ec.knightKingAttack_);
+      addParam(params, ec, "bishopKingAttack", ec.bishopKingAttack_);
+      addParam(params, ec, "rookKingAttack", ec.rookKingAttack_);
+      addParam(params, ec, "queenKingAttack", ec.queenKingAttack_);
+      addParam(params, ec, "generalKingPressure", ec.generalKingPressure_);
+      addParam(params, ec, "knightChecking", ec.knightChecking_);
+      addParam(params, ec, "bishopChecking", ec.bishopChecking_);
+      addParam(params, ec, "rookChecking", ec.rookChecking_);
+      addParam(params, ec, "queenChecking", ec.queenChecking_);
+      addParam(params, ec, "discoveredChecking", ec.discoveredChecking_);
+      addParam(params, ec, "promotionChecking", ec.promotionChecking_);
+      addParam(params, ec, "weakChecking", ec.weakChecking_);
+      addParam(params, ec, "queenCheckTreatBonus", ec.queenCheckTreatBonus_);
+      addParam(params, ec, "attackedNearKingStrong", ec.attackedNearKingStrong_);
+      addParam(params, ec, "attackedNearKingMedium", ec.attackedNearKingMedium_);
+      addParam(params, ec, "attackedNearKingWeak", ec.attackedNearKingWeak_);
+      addParam(params, ec, "attackedNearKingRem", ec.attackedNearKingRem_);
+      addParam(params, ec, "attackedNearKingOther", ec.attackedNearKingOther_);
+      addParam(params, ec, "attackedNearKingPawns", ec.attackedNearKingPawns_);
+      addParam(params, ec, "checkNearKingStrong", ec.checkNearKingStrong_);
+      addParam(params, ec, "checkNearKingMedium", ec.checkNearKingMedium_);
+      addParam(params, ec, "checkNearKingWeak", ec.checkNearKingWeak_);
+      addParam(params, ec, "checkNearKingRem", ec.checkNearKingRem_);
+      addParam(params, ec, "checkNearKingOther", ec.checkNearKingOther_);
+      addParam(params, ec, "checkNearKingPawns", ec.checkNearKingPawns_);
+      addParam(params, ec, "possibleMatTreat", ec.possibleMatTreat_);
+      addParam(params, ec, "possibleMatTreatMyMove", ec.possibleMatTreatMyMove_);
+      addParam(params, ec, "attackThroughPawn", ec.attackThroughPawn_);
+      addParam(params, ec, "kingWeakCheckersCoefficients", ec.kingWeakCheckersCoefficients_);
+      addParam(params, ec, "kingCheckersCoefficients", ec.kingCheckersCoefficients_);
+      addParam(params, ec, "kingAttackersCoefficients", ec.kingAttackersCoefficients_);
+      addParam(params, ec, "kingToPawnDistanceMulti", ec.kingToPawnDistanceMulti_);
+      addParam(params, ec, "knightToPawnDistanceMulti", ec.knightToPawnDistanceMulti_);
+      addParam(params, ec, "kingToKingDistanceMulti", ec.kingToKingDistanceMulti_);
+      addParam(params, ec, "figureToKingDistanceMulti", ec.figureToKingDistanceMulti_);
+      addParam(params, ec, "doubledPawn", ec.doubledPawn_);
+      addParam(params, ec, "isolatedPawn", ec.isolatedPawn_);
+      addParam(params, ec, "backwardPawn", ec.backwardPawn_);
+      addParam(params, ec, "unprotectedPawn", ec.unprotectedPawn_);
+      addParam(params, ec, "hasneighborPawn", ec.hasneighborPawn_);
+      addParam(params, ec, "attackingPawn", ec.attackingPawn_);
+      addParam(params, ec, "opponentPawnPressure", ec.opponentPawnPressure_);
+      addParam(params, ec, "pawnShieldA", ec.pawnShieldA_);
+      addParam(params, ec, "pawnShieldB", ec.pawnShieldB_);
+      addParam(params, ec, "pawnShieldC", ec.pawnShieldC_);
+      addParam(params, ec, "pawnShieldAbove", ec.pawnShieldAbove_);
+      addParam(params, ec, "pawnsShields", ec.pawnsShields_);
+      addParam(params, ec, "opawnsShieldAttack", ec.opawnsShieldAttack_);
+      addParam(params, ec, "opawnsNearKing", ec.opawnsNearKing_);
+      addParam(params, ec, "opawnsAttackCoeffs", ec.opawnsAttackCoeffs_);
+      addParam(params, ec, "opawnAboveKing", ec.opawnAboveKing_);
+      addParam(params, ec, "openRook", ec.openRook_);
+      addParam(params, ec, "doubleBishopBonus", ec.doubleBishopBonus_);
+      addParam(params, ec, "doubleKnightBonus", ec.doubleKnightBonus_);
+      addParam(params, ec, "twoKnightsBonus", ec.twoKnightsBonus_);
+      addParam(params, ec, "twoBishopsBonus", ec.twoBishopsBonus_);
+      addParam(params, ec, "twoRooksBonus", ec.twoRooksBonus_);
+      addParam(params, ec, "figureAgainstPawnBonus", ec.figureAgainstPawnBonus_);
+      addParam(params, ec, "figuresAgainstRookBonus", ec.figuresAgainstRookBonus_);
+      addParam(params, ec, "knightsAgainstRookBonus", ec.knightsAgainstRookBonus_);
+      addParam(params, ec, "rookAgainstFigureBonus", ec.rookAgainstFigureBonus_);
+      addParam(params, ec, "noKnightsPenalty", ec.noKnightsPenalty_);
+      addParam(params, ec, "noBishopsPenalty", ec.noBishopsPenalty_);
+      addParam(params, ec, "noRooksPenalty", ec.noRooksPenalty_);
+      addParam(params, ec, "noQueensPenalty", ec.noQueensPenalty_);
+      addParam(params, ec, "passerPawn", ec.passerPawn_);
+      addParam(params, ec, "passerPawn2", ec.passerPawn2_);
+      addParam(params, ec, "passerPawnEx", ec.passerPawnEx_);
+      addParam(params, ec, "passerUnstoppable", ec.passerUnstoppable_);
+      addParam(params, ec, "passerPawnExS", ec.passerPawnExS_);
+      addParam(params, ec, "passerPawnPGrds", ec.passerPawnPGrds_);
+      addParam(params, ec, "passerPawnPGrds2", ec.passerPawnPGrds2_);
+      addParam(params, ec, "kingToPasserDistanceBonus", ec.kingToPasserDistanceBonus_);
+      addParam(params, ec, "okingToPasserDistanceBonus", ec.okingToPasserDistanceBonus_);
+      addParam(params, ec, "kingToPasserDistanceBonus2", ec.kingToPasserDistanceBonus2_);
+      addParam(params, ec, "okingToPasserDistanceBonus2", ec.okingToPasserDistanceBonus2_);
+      addParam(params, ec, "passerPawnMyBefore", ec.passerPawnMyBefore_);
+      addParam(params, ec, "passerPawnSc", ec.passerPawnSc_);
+      addParam(params, ec, "closeToPromotion", ec.closeToPromotion_);
+      addParam(params, ec, "kingToPawnBonus", ec.kingToPawnBonus_);
+      addParam(params, ec, "knightMobility", ec.knightMobility_);
+      addParam(params, ec, "bishopMobility", ec.bishopMobility_);
+      addParam(params, ec, "rookMobility", ec.rookMobility_);
+      addParam(params, ec, "queenMobility", ec.queenMobility_);
+      addParam(params, ec, "knightPinned", ec.knightPinned_);
+      addParam(params, ec, "bishopPinned", ec.bishopPinned_);
+      addParam(params, ec, "rookPinned", ec.rookPinned_);
+      addParam(params, ec, "queenPinned", ec.queenPinned_);
+      addParam(params, ec, "bishopKnightMat", ec.bishopKnightMat_);
+      addParam(params, ec, "kingDistanceBonus", ec.kingDistanceBonus_);
+      addParam(params, ec, "lazyMargins", ec.lazyMargins_);
+      addParam(params, ec, "positionEvaluations", ec.positionEvaluations_[0]);
+      return params;
+    }();
+    return params_;
+  }
 
-  int EvalCoefficients::passerPawnSc_[8] = { 0, 1, 2, 4, 6, 8, 12, 0 };
-  int EvalCoefficients::closeToPromotion_[8] = { 0, 2, 4, 6, 8, 10, 12, 16 };
-  int EvalCoefficients::kingToPawnBonus_[8] = { 0, 0, 1, 2, 3, 4, 5, 6 };
+  EvalCoefficients const& EvalCoefficients::defaults()
+  {
+    // built-in piece-square table should be ready to compare with
+    static EvalCoefficients const defaults_ = []()
+    {
+      initialize();
+      return EvalCoefficients{};
+    }();
+    return defaults_;
+  }
 
-  // mobility
-  ScoreType32 EvalCoefficients::knightMobility_[16] = { {-45, -45}, {-19, -18}, {  6,   8}, {  9,  11}, { 11,  15}, { 14,  17}, { 16,  20}, { 18,  22}, { 20,  25} };
-  ScoreType32 EvalCoefficients::bishopMobility_[16] = { {-30, -30}, {-13, -12}, {  4,   6}, {  5,   8}, {  7,   9}, {  8,  11}, { 10,  13}, { 11,  14}, { 12,  16},
-                                                        { 13,  17}, { 15,  19}, { 16,  20}, { 17,  21}, { 18,  22}, { 19,  23}, { 20,  25} };
-  ScoreType32 EvalCoefficients::rookMobility_[16]   = { {-25, -45}, { -9, -17}, {  7,  10}, { 11,  15}, { 14,  21}, { 18,  26}, { 21,  31}, { 24,  35}, { 27,  40},
-                                                        { 30,  44}, { 33,  48}, { 35,  51}, { 38,  55}, { 40,  58}, { 42,  61}, { 45,  65} };
-  ScoreType32 EvalCoefficients::queenMobility_[32]  = { {-55, -55}, {-22, -21}, { 10,  12}, { 12,  14}, { 14,  17}, { 17,  20}, { 19,  22}, { 21,  25}, { 23,  27},
-                                                        { 25,  30}, { 27,  32}, { 29,  34}, { 31,  36}, { 33,  38}, { 34,  40}, { 36,  42}, { 38,  44}, { 40,  46},
-                                                        { 41,  48}, { 43,  50}, { 44,  52}, { 46,  54}, { 47,  55}, { 49,  57}, { 50,  59}, { 52,  60}, { 53,  62},
-                                                        { 54,  64}, { 56,  65}, { 57,  67}, { 58,  68}, { 60,  70} };
+  bool EvalCoefficients::load(std::string const& fname)
+  {
+    std::ifstream ifs(fname, std::ios::in | std::ios::binary);
+    if (!ifs)
+      return false;
 
-  ScoreType32 EvalCoefficients::knightPinned_ = { 15, 15 };
-  ScoreType32 EvalCoefficients::bishopPinned_ = { 10, 10 };
-  ScoreType32 EvalCoefficients::rookPinned_ = { 15, 15 };
-  ScoreType32 EvalCoefficients::queenPinned_ = { 20, 20 };
+    // keep current values if file is broken
+    EvalCoefficients ec{ *this };
+    char magic[sizeof(binaryMagic_)] = {};
+    ifs.read(magic, sizeof(magic));
+    bool ok = false;
+    if (ifs && std::memcmp(magic, binaryMagic_, sizeof(magic)) == 0)
+    {
+      ok = loadBinary(ec, ifs);
+    }
+    else
+    {
+      ifs.clear();
+      ifs.seekg(0);
+      ok = loadText(ec, ifs);
+    }
+    if (!ok)
+      return false;
 
-  // king position eval for BN-mat
-  int EvalCoefficients::bishopKnightMat_[64] =
-  {
-     30,  20,  10,  -1,  -5, -10, -20, -30,
-     20,  16,   8,  -1,  -6,  -8, -16, -20,
-     10,   8,   6,  -2,  -8,  -6,  -8, -10,
-     -1,  -1,  -2, -15, -15,  -8,  -6,  -5,
-     -5,  -6,  -8, -15, -15,  -2,  -1,  -1,
-    -10,  -8,  -6,  -8,  -2,   6,   8,  10,
-    -20, -16,  -8,  -6,  -1,   8,  16,  20,
-    -30, -20, -10,  -5,  -1,  10,  20,  30
-  };
+    ec.update();
+    *this = ec;
+    return true;
+  }
 
-  ScoreType32 EvalCoefficients::kingDistanceBonus_[8][8] =
+  bool EvalCoefficients::save(std::string const& fname, bool binary) const
   {
-    {},
-    {},
-    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
-    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
-    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
-    { {0, 0}, {5, 0}, {4, 0}, {3, 0}, {1, 0}, {0, 0}, {-1, 0}, {-2, 0} },
-    {},
-    {}
-  };
+    std::ofstream ofs(fname, binary ? std::ios::out | std::ios::binary : std::ios::out);
+    if (!ofs)
+      return false;
 
-  ScoreType32 EvalCoefficients::positionEvaluations_[2][8][64] =
-  {
+    auto const& params = EvalCoefficients::params();
+    if (binary)
     {
+      uint32 count{};
+      for (auto const& p : params)
+        count += valuesCount(p);
+      ofs.write(binaryMagic_, sizeof(binaryMagic_));
+      ofs.write(reinterpret_cast<char const*>(&binaryVersion_), sizeof(binaryVersion_));
+      ofs.write(reinterpret_cast<char const*>(&count), sizeof(count));
+      for (auto const& p : params)
       {
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}
-      },
-      {
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  5,   5}, {  5,   5}, {  5,   6}, {  5,   7}, {  5,   7}, {  5,   6}, {  5,   5}, {  5,   5},
-        {  4,   4}, {  4,   4}, {  5,   4}, { 10,   6}, { 10,   6}, {  5,   5}, {  4,   4}, {  4,   4},
-        {  4,   3}, {  4,   3}, {  9,   4}, { 12,   5}, { 12,   5}, {  9,   4}, {  4,   3}, {  4,   3},
-        {  3,   2}, {  3,   2}, {  7,   3}, { 12,   4}, { 12,   4}, {  7,   3}, {  3,   2}, {  3,   2},
-        {  3,   1}, {  3,   1}, {  5,   2}, { 10,   3}, { 10,   3}, {  5,   2}, {  3,   1}, {  3,   1},
-        {  2,  -1}, {  2,  -2}, {  2,  -3}, { -8,  -4}, { -8,  -4}, {  2,  -3}, {  2,  -2}, {  2,  -1},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}
-      },
-      {
-        {-60, -50}, {-30, -30}, {-18, -10}, {-12, -10}, {-12, -10}, {-18, -10}, {-30, -30}, {-60, -50},
-        {-24, -25}, { -8, -10}, { -2,  -5}, {  6,   0}, {  6,   0}, { -2,  -5}, { -8, -10}, {-24, -25},
-        { -9, -10}, { 12,  -5}, { 14,  10}, { 14,  10}, { 14,  10}, { 14,  10}, { 12,  -5}, { -9, -10},
-        { -6, -10}, {  9,  -2}, { 10,   8}, { 18,  12}, { 18,  12}, { 10,   8}, {  9,  -2}, { -6, -10},
-        { -6, -10}, {  3,   0}, {  9,   8}, { 18,  10}, { 18,  10}, {  9,   8}, {  3,   0}, { -6, -10},
-        {-18, -10}, { -9,  -7}, { -6,  -4}, {  4,   6}, {  4,   6}, { -6,  -4}, { -9,  -7}, {-18, -10},
-        {-24, -20}, {-10, -10}, { -9,  -6}, { -9,  -3}, { -9,  -3}, { -9,  -6}, {-10, -10}, {-24, -20},
-        {-48, -30}, {-36, -15}, {-24, -10}, {-18, -10}, {-18, -10}, {-24, -10}, {-36, -15}, {-48, -30}
-      },
-      {
-        {-23,  -8}, { -8,  -3}, { -8,  -2}, { -8,  -1}, { -8,  -1}, { -8,  -2}, { -8,  -3}, {-23,  -8},
-        { -2,  -3}, {  5,   4}, {  3,   3}, {  0,   3}, {  0,   3}, {  3,   3}, {  5,   4}, { -2,  -3},
-        {  0,  -2}, {  8,   3}, {  7,   5}, {  5,   5}, {  5,   5}, {  7,   5}, {  8,   3}, {  0,  -2},
-        { -4,  -1}, {  7,   3}, { 10,   5}, { 12,   6}, { 12,   6}, { 10,   5}, {  7,   3}, { -4,  -1},
-        { -2,  -1}, {  6,   3}, {  9,   5}, { 12,   6}, { 12,   6}, {  9,   5}, {  6,   3}, { -2,  -1},
-        {  0,  -2}, {  8,   3}, { 10,   5}, {  8,   5}, {  8,   5}, { 10,   5}, {  8,   3}, {  0,  -2},
-        { -2,  -3}, { 10,   4}, {  5,   3}, {  2,   3}, {  2,   3}, {  5,   3}, { 10,   4}, { -2,  -3},
-        {-20,  -8}, { -6,  -3}, { -8,  -2}, { -9,  -1}, { -9,  -1}, { -8,  -2}, { -6,  -3}, {-20,  -8}
-      },
-      {
-        {  2,  -3}, {  2,   2}, {  5,   4}, {  7,   4}, {  7,   4}, {  5,   4}, {  2,   2}, {  2,  -3},
-        {  4,   1}, {  6,   2}, { 10,   5}, { 12,   5}, { 12,   5}, { 10,   5}, {  6,   2}, {  4,   1},
-        {  2,   2}, {  2,   2}, {  6,   5}, {  8,   6}, {  8,   6}, {  6,   5}, {  2,   2}, {  2,   2},
-        {  2,   2}, {  2,   3}, {  4,   6}, {  7,   6}, {  7,   6}, {  4,   6}, {  2,   3}, {  2,   2},
-        {  2,   2}, {  2,   3}, {  3,   6}, {  5,   6}, {  5,   6}, {  3,   6}, {  2,   3}, {  2,   2},
-        {  2,   2}, {  2,   3}, {  2,   5}, {  4,   6}, {  4,   6}, {  2,   5}, {  2,   3}, {  2,   2},
-        { -5,   1}, { -2,   2}, {  1,   5}, {  2,   5}, {  2,   5}, {  1,   5}, { -2,   2}, { -5,   1},
-        { -7,  -3}, { -7,   2}, { -5,   4}, { -3,   4}, { -3,   4}, { -5,   4}, { -7,   2}, { -7,  -3}
-      },
-      {
-        {  0, -12}, {  1,  -6}, {  1,  -2}, {  3,  -2}, {  3,  -2}, {  1,  -2}, {  1,  -6}, {  0, -12},
-        {  2,  -5}, {  3,  -2}, {  4,   1}, {  4,   3}, {  4,   3}, {  4,   1}, {  3,  -2}, {  2,  -5},
-        { -1,  -6}, {  2,   0}, {  3,   5}, {  4,   6}, {  4,   6}, {  3,   5}, {  2,   0}, { -1,  -6},
-        { -2,  -4}, {  2,   1}, {  4,   6}, {  5,   8}, {  5,   8}, {  4,   6}, {  2,   1}, { -2,  -4},
-        { -2,  -4}, {  2,  -1}, {  4,   5}, {  5,   8}, {  5,   8}, {  4,   5}, {  2,  -1}, { -2,  -4},
-        { -2,  -6}, {  2,  -2}, {  3,   3}, {  4,   4}, {  4,   4}, {  3,   3}, {  2,  -2}, { -2,  -6},
-        { -3,  -8}, {  1,  -5}, {  1,  -1}, {  0,   1}, {  0,   1}, {  1,  -1}, {  1,  -5}, { -3,  -8},
-        { -4, -15}, { -2,  -8}, { -1,  -5}, {  0,  -4}, {  0,  -4}, { -1,  -5}, { -2,  -8}, { -4, -15}
-      },
-      {
-        {-60, -37}, {-60, -18}, {-60, -13}, {-60,  -9}, {-60,  -9}, {-60, -13}, {-60, -18}, {-60, -37},
-        {-46, -25}, {-47, -13}, {-48,   2}, {-50,   4}, {-50,   4}, {-48,   2}, {-47, -13}, {-46, -25},
-        {-37, -15}, {-39,   2}, {-41,  10}, {-43,  15}, {-43,  15}, {-41,  10}, {-39,   2}, {-37, -15},
-        {-28, -15}, {-30,   2}, {-32,  15}, {-34,  20}, {-34,  20}, {-32,  15}, {-30,   2}, {-28, -15},
-        {-20, -15}, {-23,   2}, {-27,  15}, {-29,  20}, {-29,  20}, {-27,  15}, {-23,   2}, {-20, -15},
-        {-10, -15}, {-12,   2}, {-15,  10}, {-20,  15}, {-20,  15}, {-15,  10}, {-12,   2}, {-10, -15},
-        { 25, -20}, { 28, -10}, {  5,   2}, {-14,   5}, {-14,   5}, {  5,   2}, { 28, -10}, { 25, -20},
-        { 27, -40}, { 33, -25}, { 20, -15}, {-12, -10}, {-12, -10}, { 20, -15}, { 33, -25}, { 27, -40}
-      },
+        auto n = valuesCount(p);
+        for (int i = 0; i < n; ++i)
+        {
+          int32 value = getValue(*this, p, i);
+          ofs.write(reinterpret_cast<char const*>(&value), sizeof(value));
+        }
+      }
+    }
+    else
+    {
+      ofs << "# name values... ScoreType32 is opening/endgame pair" << std::endl;
+      for (auto const& p : params)
       {
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0},
-        {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}, {  0,   0}
+        ofs << p.name_;
+        auto n = valuesCount(p);
+        for (int i = 0; i < n; ++i)
+          ofs << " " << getValue(*this, p, i);
+        ofs << std::endl;
       }
-    },
+    }
+    return static_cast<bool>(ofs);
+  }
+
+  bool EvalCoefficients::set(std::string const& name, int value)
+  {
+    auto pos = name.find_first_of("[.");
+    auto const* p = findParam(name.substr(0, pos));
+    if (!p)
+      return false;
+
+    int index = 0;
+    int part = -1;
+    if (pos != std::string::npos && name[pos] == '[')
     {
+      auto end = name.find(']', pos);
+      if (end == std::string::npos)
+        return false;
+      index = std::atoi(name.c_str() + pos + 1);
+      pos = end + 1;
     }
-  };
+    if (pos < name.size())
+    {
+      if (name[pos] != '.' || pos + 1 >= name.size())
+        return false;
+      part = name[pos + 1] - '0';
+      if (part != 0 && part != 1)
+        return false;
+    }
+    if (index < 0 || index >= p->size_)
+      return false;
 
-  void EvalCoefficients::initialize()
+    if (p->type_ != ParamType::Score32)
+    {
+      setValue(*this, *p, index, value);
+    }
+    else
+    {
+      // set both opening & endgame if part isn't given
+      if (part != 1)
+        setValue(*this, *p, index * 2, value);
+      if (part != 0)
+        setValue(*this, *p, index * 2 + 1, value);
+    }
+    update();
+    return true;
+  }
+
+  void EvalCoefficients::update()
   {
     // copy coefficients for white color with negative sign and flipped position
     for (int t = 0; t < 8; ++t)
@@ -334,5 +420,12 @@ namespace NEngine
         positionEvaluations_[1][t][p] = -positionEvaluations_[0][t][Figure::mirrorIndex_[p]];
       }
     }
+    customPositionEvaluations_ = std::memcmp(positionEvaluations_, basePositionEvaluations_, sizeof(positionEvaluations_)) != 0;
+  }
+
+  void EvalCoefficients::initialize()
+  {
+    EvalCoefficients ec;
+    std::memcpy(basePositionEvaluations_, ec.positionEvaluations_, sizeof(basePositionEvaluations_));
   }
 }
@@ -66,6 +66,7 @@ bool Evaluator::blockedBishop(Figure::Color color, int n) const
 
 void Evaluator::prepareAttacksMasks()
 {
+  EVAL_PROFILE_SCOPE(AttacksMasks);
   auto const& fmgr = board_->fmgr();
   BitMask mask_all_not_pw[2] = {
     mask_all_ & ~fmgr.pawn_mask(Figure::ColorBlack), mask_all_ & ~fmgr.pawn_mask(Figure::ColorWhite)
@@ -201,6 +202,7 @@ void Evaluator::prepareAttacksMasks()
 
 ScoreType32 Evaluator::evaluateKnights()
 {
+  EVAL_PROFILE_SCOPE(Knights);
   auto const& fmgr = board_->fmgr();
   ScoreType32 score[2];
   for (auto color : { Figure::ColorBlack, Figure::ColorWhite })
@@ -223,13 +225,13 @@ ScoreType32 Evaluator::evaluateKnights()
       auto omsk = (nbit | (knight_moves & ~fmgr.mask(color))) & outpost_mask;
       const bool boutpost = omsk != 0ULL;
       const bool bprotect = omsk & finfo_[color].pawnAttacks_;
-      score[color] += EvalCoefficients::knightOutpost_[bprotect] * boutpost;
+      score[color] += coeff_->knightOutpost_[bprotect] * boutpost;
       // king protection
       auto ki_dist = distanceCounter().getDistance(n, board_->kingPos(color));
-      score[color] += EvalCoefficients::kingDistanceBonus_[Figure::TypeKnight][ki_dist];
+      score[color] += coeff_->kingDistanceBonus_[Figure::TypeKnight][ki_dist];
       X_ASSERT_R(board_->discoveredCheck(n, mask_all_, color, board_->kingPos(ocolor)) != discoveredCheck(n, ocolor), "discovered check not detected");
       if (knight_moves && discoveredCheck(n, ocolor)) {
-        finfo_[color].score_mob_ += EvalCoefficients::discoveredCheckBonus_;
+        finfo_[color].score_mob_ += coeff_->discoveredCheckBonus_;
         finfo_[color].discoveredCheck_ = true;
         finfo_[color].discoveredMoves_ |= knight_moves;
       }
@@ -241,19 +243,19 @@ ScoreType32 Evaluator::evaluateKnights()
             isPinned(n, color, ocolor, fmgr.queen_mask(color), fmgr.rook_mask(ocolor), nst::rook) ||
             isPinned(n, color, ocolor, finfo_[color].rq_mask_ & ~finfo_[color].attack_mask_, fmgr.queen_mask(ocolor), nst::none)) {
           qpinned = true;
-          finfo_[color].score_mob_ -= EvalCoefficients::knightPinned_;
+          finfo_[color].score_mob_ -= coeff_->knightPinned_;
         }
       }
 
       if (knight_moves & finfo_[ocolor].ki_fields_)
       {
         finfo_[color].num_attackers_++;
-        finfo_[color].score_king_ += EvalCoefficients::knightKingAttack_;
+        finfo_[color].score_king_ += coeff_->knightKingAttack_;
       }
 
       auto n_moves_mask = knight_moves & (finfo_[color].cango_mask_ | finfo_[ocolor].nbrq_mask_ | finfo_[color].nbrq_mask_);
       auto n_moves = pop_count(n_moves_mask);
-      finfo_[color].score_mob_ += EvalCoefficients::knightMobility_[n_moves & 15];
+      finfo_[color].score_mob_ += coeff_->knightMobility_[n_moves & 15];
 
       if (!n_moves || qpinned) {
         finfo_[color].blockedFigures_ |= set_mask_bit(n);
@@ -265,6 +267,7 @@ ScoreType32 Evaluator::evaluateKnights()
 
 ScoreType32 Evaluator::evaluateBishops()
 {
+  EVAL_PROFILE_SCOPE(Bishops);
   auto const& fmgr = board_->fmgr();
   ScoreType32 score[2];
   for (auto color : { Figure::ColorBlack, Figure::ColorWhite })
@@ -293,15 +296,15 @@ ScoreType32 Evaluator::evaluateBishops()
       auto const omsk = (nbit | (bishop_moves & ~fmgr.mask(color))) & outpost_mask;
       const bool boutpost = omsk != 0ULL;
       const bool bprotect = omsk & finfo_[color].pawnAttacks_;
-      score[color] += EvalCoefficients::bishopOutpost_[bprotect] * boutpost;
+      score[color] += coeff_->bishopOutpost_[bprotect] * boutpost;
 
       // king protection
       auto ki_dist = distanceCounter().getDistance(n, board_->kingPos(color));
-      score[color] += EvalCoefficients::kingDistanceBonus_[Figure::TypeBishop][ki_dist];
+      score[color] += coeff_->kingDistanceBonus_[Figure::TypeBishop][ki_dist];
 
       X_ASSERT_R(board_->discoveredCheck(n, mask_all_, color, board_->kingPos(ocolor)) != discoveredCheck(n, ocolor), "discovered check not detected");
       if (bishop_moves && !finfo_[color].discoveredCheck_ && discoveredCheck(n, ocolor)) {
-        finfo_[color].score_mob_ += EvalCoefficients::discoveredCheckBonus_;
+        finfo_[color].score_mob_ += coeff_->discoveredCheckBonus_;
         finfo_[color].discoveredCheck_ = true;
         finfo_[color].discoveredMoves_ |= bishop_moves;
       }
@@ -312,20 +315,20 @@ ScoreType32 Evaluator::evaluateBishops()
         if (isPinned(n, color, ocolor, fmgr.queen_mask(color), fmgr.rook_mask(ocolor), nst::rook) ||
             isPinned(n, color, ocolor, fmgr.rook_mask(color) & ~finfo_[color].attack_mask_, fmgr.rook_mask(ocolor), nst::rook)) {
           q_pinned = true;
-          finfo_[color].score_mob_ -= EvalCoefficients::bishopPinned_;
+          finfo_[color].score_mob_ -= coeff_->bishopPinned_;
         }
       }
 
       if (bishop_moves_x & finfo_[ocolor].ki_fields_)
       {
         finfo_[color].num_attackers_++;
-        finfo_[color].score_king_ += EvalCoefficients::bishopKingAttack_;
+        finfo_[color].score_king_ += coeff_->bishopKingAttack_;
       }
 
       // mobility
       auto b_moves_mask = bishop_moves & (finfo_[color].cango_mask_ | finfo_[ocolor].nbrq_mask_ | finfo_[color].nbrq_mask_);
       int n_moves = pop_count(b_moves_mask);
-      finfo_[color].score_mob_ += EvalCoefficients::bishopMobility_[n_moves & 15];
+      finfo_[color].score_mob_ += coeff_->bishopMobility_[n_moves & 15];
 
       if (!n_moves || q_pinned) {
         finfo_[color].blockedFigures_ |= set_mask_bit(n);
@@ -337,6 +340,7 @@ ScoreType32 Evaluator::evaluateBishops()
 
 ScoreType32 Evaluator::evaluateRook()
 {
+  EVAL_PROFILE_SCOPE(Rooks);
   auto const& fmgr = board_->fmgr();
   ScoreType32 score[2];
   for (auto color : { Figure::ColorBlack, Figure::ColorWhite })
@@ -359,16 +363,16 @@ ScoreType32 Evaluator::evaluateRook()
       if(!(mask_fwd & fmgr.pawn_mask(color)))
       {
         bool pw_ocolor_n = (mask_fwd & fmgr.pawn_mask(ocolor)) != 0ULL;
-        score[color] += EvalCoefficients::openRook_[pw_ocolor_n];
+        score[color] += coeff_->openRook_[pw_ocolor_n];
       }
 
       // king protection
       auto ki_dist = distanceCounter().getDistance(n, board_->kingPos(color));
-      score[color] += EvalCoefficients::kingDistanceBonus_[Figure::TypeRook][ki_dist];
+      score[color] += coeff_->kingDistanceBonus_[Figure::TypeRook][ki_dist];
 
       X_ASSERT_R(board_->discoveredCheck(n, mask_all_, color, board_->kingPos(ocolor)) != discoveredCheck(n, ocolor), "discovered check not detected");
       if (rook_moves && !finfo_[color].discoveredCheck_ && discoveredCheck(n, ocolor)) {
-        finfo_[color].score_mob_ += EvalCoefficients::discoveredCheckBonus_;
+        finfo_[color].score_mob_ += coeff_->discoveredCheckBonus_;
         finfo_[color].discoveredCheck_ = true;
         finfo_[color].discoveredMoves_ |= rook_moves;
       }
@@ -378,27 +382,27 @@ ScoreType32 Evaluator::evaluateRook()
       {
         if (isPinned(n, color, ocolor, (fmgr.queen_mask(color) | fmgr.rook_mask(color)), fmgr.bishop_mask(ocolor), nst::bishop)) {
           q_pinned = true;
-          finfo_[color].score_mob_ -= EvalCoefficients::rookPinned_;
+          finfo_[color].score_mob_ -= coeff_->rookPinned_;
         }
       }
 
       if (rook_moves_x & finfo_[ocolor].ki_fields_)
       {
         finfo_[color].num_attackers_++;
-        finfo_[color].score_king_ += EvalCoefficients::rookKingAttack_;
+        finfo_[color].score_king_ += coeff_->rookKingAttack_;
       }
 
       auto r_moves_mask = rook_moves & ((finfo_[color].cango_mask_ & ~finfo_[ocolor].nb_attacked_) | finfo_[ocolor].rq_mask_ | finfo_[color].rq_mask_);
       int n_moves = pop_count(r_moves_mask);
-      finfo_[color].score_mob_ += EvalCoefficients::rookMobility_[n_moves & 15];
+      finfo_[color].score_mob_ += coeff_->rookMobility_[n_moves & 15];
 
       // fake castle possible
       if (n_moves < 3) {
         if (fakeCastle(color, n, r_moves_mask)) {
-          finfo_[color].score_mob_ += EvalCoefficients::fakeCastle_;
+          finfo_[color].score_mob_ += coeff_->fakeCastle_;
         }
         else if (blockedRook(color, n, r_moves_mask))
-          finfo_[color].score_mob_ -= EvalCoefficients::rookBlocked_;
+          finfo_[color].score_mob_ -= coeff_->rookBlocked_;
       }
 
       if (!n_moves || q_pinned) {
@@ -411,6 +415,7 @@ ScoreType32 Evaluator::evaluateRook()
 
 ScoreType32 Evaluator::evaluateQueens()
 {
+  EVAL_PROFILE_SCOPE(Queens);
   auto const& fmgr = board_->fmgr();
   ScoreType32 score[2];
   for (auto color : { Figure::ColorBlack, Figure::ColorWhite })
@@ -434,14 +439,14 @@ ScoreType32 Evaluator::evaluateQueens()
 
       // king protection
       auto ki_dist = distanceCounter().getDistance(n, board_->kingPos(color));
-      score[color] += EvalCoefficients::kingDistanceBonus_[Figure::TypeQueen][ki_dist];
+      score[color] += coeff_->kingDistanceBonus_[Figure::TypeQueen][ki_dist];
 
       bool qkattack = queen_moves_xr & finfo_[ocolor].ki_fields_;
       finfo_[color].qkingAttack_ |= qkattack;
       if (qkattack)
       {
         finfo_[color].num_attackers_++;
-        finfo_[color].score_king_ += EvalCoefficients::queenKingAttack_;
+        finfo_[color].score_king_ += coeff_->queenKingAttack_;
       }
 
       bool q_pinned = false;
@@ -449,13 +454,13 @@ ScoreType32 Evaluator::evaluateQueens()
       {
         if (isPinned(n, color, ocolor, finfo_[color].rq_mask_, fmgr.bishop_mask(ocolor) & finfo_[ocolor].attack_mask_, nst::bishop)) {
           q_pinned = true;
-          finfo_[color].score_mob_ -= EvalCoefficients::queenPinned_;
+          finfo_[color].score_mob_ -= coeff_->queenPinned_;
         }
       }
 
       auto q_moves_mask = queen_moves & ((finfo_[color].cango_mask_ & ~finfo_[ocolor].nbr_attacked_) | fmgr.queen_mask(ocolor) | fmgr.queen_mask(color));
       auto n_moves = pop_count(q_moves_mask);
-      finfo_[color].score_mob_ += EvalCoefficients::queenMobility_[n_moves & 31];
+      finfo_[color].score_mob_ += coeff_->queenMobility_[n_moves & 31];
 
       if (q_pinned || !n_moves) {
         finfo_[color].blockedFigures_ |= set_mask_bit(n);
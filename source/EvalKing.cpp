@@ -12,13 +12,13 @@
 
 namespace NEngine
 {
-inline int kingToPawnsScore(const int kpos, BitMask pmsk)
+inline int kingToPawnsScore(EvalCoefficients const& coeff, const int kpos, BitMask pmsk)
 {
     int score = 0;
   while (pmsk) {
     auto n = clear_lsb(pmsk);
       auto dist = distanceCounter().getDistance(kpos, n);
-      score -= EvalCoefficients::kingToPawnBonus_[dist];
+      score -= coeff.kingToPawnBonus_[dist];
   }
     return score;
 }
@@ -73,10 +73,10 @@ int Evaluator::getCastleType2(Figure::Color color) const
 }
 
 template <Figure::Color color>
-int evaluateKingSafety(FiguresManager const& fmgr, BitMask const& pawnAttacks, Index const kingPos);
+int evaluateKingSafety(EvalCoefficients const& coeff, FiguresManager const& fmgr, BitMask const& pawnAttacks, Index const kingPos);
 
 template <>
-int evaluateKingSafety<Figure::ColorWhite>(FiguresManager const& fmgr, BitMask const& pawnAttacks, Index const kingPos)
+int evaluateKingSafety<Figure::ColorWhite>(EvalCoefficients const& coeff, FiguresManager const& fmgr, BitMask const& pawnAttacks, Index const kingPos)
 {
   int score = 0;
   int oscore = 0;
@@ -127,15 +127,15 @@ int evaluateKingSafety<Figure::ColorWhite>(FiguresManager const& fmgr, BitMask c
       odist = opy - ay;
     }
 #ifdef KING_PAWN_SHIELD
-    score += EvalCoefficients::pawnsShields_[x][py];
+    score += coeff.pawnsShields_[x][py];
 #endif
 
 #ifdef KING_PAWN_SHIELD_ATTACK
-    oscore += (EvalCoefficients::opawnsShieldAttack_[canAttack][odist] * EvalCoefficients::opawnsAttackCoeffs_[opy]) >> 5;
+    oscore += (coeff.opawnsShieldAttack_[canAttack][odist] * coeff.opawnsAttackCoeffs_[opy]) >> 5;
 #endif
 
 #ifdef KING_PAWN_NEAR_KING
-    oscore += EvalCoefficients::opawnsNearKing_[opy];
+    oscore += coeff.opawnsNearKing_[opy];
 #endif
   }
   
@@ -143,7 +143,7 @@ int evaluateKingSafety<Figure::ColorWhite>(FiguresManager const& fmgr, BitMask c
   auto kifwdmsk = set_mask_bit(Index(kx, ky1)) & opawns_mask & ~pawnAttacks;
   if (kifwdmsk) {
     int oy = Index(_lsb64(kifwdmsk)).y();
-    score += EvalCoefficients::opawnAboveKing_[oy];
+    score += coeff.opawnAboveKing_[oy];
   }
 #endif
   score -= oscore;
@@ -151,7 +151,7 @@ int evaluateKingSafety<Figure::ColorWhite>(FiguresManager const& fmgr, BitMask c
 }
 
 template <>
-int evaluateKingSafety<Figure::ColorBlack>(FiguresManager const& fmgr, BitMask const& pawnAttacks, Index const kingPos)
+int evaluateKingSafety<Figure::ColorBlack>(EvalCoefficients const& coeff, FiguresManager const& fmgr, BitMask const& pawnAttacks, Index const kingPos)
 {
   int score = 0;
   int oscore = 0;
@@ -204,15 +204,15 @@ int evaluateKingSafety<Figure::ColorBlack>(FiguresManager const& fmgr, BitMask c
     }
 
 #ifdef KING_PAWN_SHIELD
-    score += EvalCoefficients::pawnsShields_[x][py];
+    score += coeff.pawnsShields_[x][py];
 #endif
 
 #ifdef KING_PAWN_SHIELD_ATTACK
-    oscore += (EvalCoefficients::opawnsShieldAttack_[canAttack][odist] * EvalCoefficients::opawnsAttackCoeffs_[opy]) >> 5;
+    oscore += (coeff.opawnsShieldAttack_[canAttack][odist] * coeff.opawnsAttackCoeffs_[opy]) >> 5;
 #endif
 
 #ifdef KING_PAWN_NEAR_KING
-    oscore += EvalCoefficients::opawnsNearKing_[opy];
+    oscore += coeff.opawnsNearKing_[opy];
 #endif
   }
 
@@ -220,7 +220,7 @@ int evaluateKingSafety<Figure::ColorBlack>(FiguresManager const& fmgr, BitMask c
   auto kifwdmsk = set_mask_bit(Index(kx, ky1)) & opawns_mask & ~pawnAttacks;
   if (kifwdmsk) {
     int oy = 7 - Index(_msb64(kifwdmsk)).y();
-    score += EvalCoefficients::opawnAboveKing_[oy];
+    score += coeff.opawnAboveKing_[oy];
   }
 #endif
   score -= oscore;
@@ -230,36 +230,36 @@ int evaluateKingSafety<Figure::ColorBlack>(FiguresManager const& fmgr, BitMask c
 ScoreType32 Evaluator::evaluateKingSafetyW() const
 {
   Index kingPos(board_->kingPos(Figure::ColorWhite));
-  auto score = evaluateKingSafety<Figure::ColorWhite>(board_->fmgr(), finfo_[Figure::ColorWhite].pawnAttacks_, kingPos);
+  auto score = evaluateKingSafety<Figure::ColorWhite>(*coeff_, board_->fmgr(), finfo_[Figure::ColorWhite].pawnAttacks_, kingPos);
   if (board_->castling(Figure::ColorWhite, 0)) {
     Index kingPosK{ 6, promo_y_[Figure::ColorBlack] };
-    int scoreK = evaluateKingSafety<Figure::ColorWhite>(board_->fmgr(), finfo_[Figure::ColorWhite].pawnAttacks_, kingPosK);
+    int scoreK = evaluateKingSafety<Figure::ColorWhite>(*coeff_, board_->fmgr(), finfo_[Figure::ColorWhite].pawnAttacks_, kingPosK);
     score = std::max(score, scoreK);
   }
   if (board_->castling(Figure::ColorWhite, 1)) {
     Index kingPosQ{ 1, promo_y_[Figure::ColorBlack] };
-    int scoreQ = evaluateKingSafety<Figure::ColorWhite>(board_->fmgr(), finfo_[Figure::ColorWhite].pawnAttacks_, kingPosQ);
+    int scoreQ = evaluateKingSafety<Figure::ColorWhite>(*coeff_, board_->fmgr(), finfo_[Figure::ColorWhite].pawnAttacks_, kingPosQ);
     score = std::max(score, scoreQ);
   }
-  auto kpwscore = kingToPawnsScore(board_->kingPos(Figure::ColorWhite), board_->fmgr().pawn_mask(Figure::ColorWhite));
+  auto kpwscore = kingToPawnsScore(*coeff_, board_->kingPos(Figure::ColorWhite), board_->fmgr().pawn_mask(Figure::ColorWhite));
   return ScoreType32{ score, kpwscore };
 }
 
 ScoreType32 Evaluator::evaluateKingSafetyB() const
 {
   Index kingPos(board_->kingPos(Figure::ColorBlack));
-  auto score = evaluateKingSafety<Figure::ColorBlack>(board_->fmgr(), finfo_[Figure::ColorBlack].pawnAttacks_, kingPos);
+  auto score = evaluateKingSafety<Figure::ColorBlack>(*coeff_, board_->fmgr(), finfo_[Figure::ColorBlack].pawnAttacks_, kingPos);
   if (board_->castling(Figure::ColorBlack, 0)) {
     Index kingPosK{ 6, promo_y_[Figure::ColorWhite] };
-    int scoreK = evaluateKingSafety<Figure::ColorBlack>(board_->fmgr(), finfo_[Figure::ColorBlack].pawnAttacks_, kingPosK);
+    int scoreK = evaluateKingSafety<Figure::ColorBlack>(*coeff_, board_->fmgr(), finfo_[Figure::ColorBlack].pawnAttacks_, kingPosK);
     score = std::max(score, scoreK);
   }
   if (board_->castling(Figure::ColorBlack, 1)) {
     Index kingPosQ{ 1, promo_y_[Figure::ColorWhite] };
-    int scoreQ = evaluateKingSafety<Figure::ColorBlack>(board_->fmgr(), finfo_[Figure::ColorBlack].pawnAttacks_, kingPosQ);
+    int scoreQ = evaluateKingSafety<Figure::ColorBlack>(*coeff_, board_->fmgr(), finfo_[Figure::ColorBlack].pawnAttacks_, kingPosQ);
     score = std::max(score, scoreQ);
   }
-  auto kpwscore = kingToPawnsScore(board_->kingPos(Figure::ColorBlack), board_->fmgr().pawn_mask(Figure::ColorBlack));
+  auto kpwscore = kingToPawnsScore(*coeff_, board_->kingPos(Figure::ColorBlack), board_->fmgr().pawn_mask(Figure::ColorBlack));
   return ScoreType32{ score, kpwscore };
 }
 
@@ -315,6 +315,7 @@ bool Evaluator::isMatTreat(
 
 ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscore_o)
 {
+  EVAL_PROFILE_SCOPE(KingPressure);
   const auto& fmgr = board_->fmgr();
   const auto ocolor = Figure::otherColor(color);
   const auto  ki_pos = board_->kingPos(color);
@@ -334,7 +335,7 @@ ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscor
 
   finfo_[color].num_attackers_ += (finfo_[color].pawnAttacks_ & near_oking) != 0ULL;
   finfo_[color].num_attackers_ += (finfo_[color].kingAttacks_ & near_oking) != 0ULL;
-  finfo_[color].score_king_ += EvalCoefficients::pawnKingAttack_ * (!!(finfo_[color].pawnAttacks_ & near_oking_pw));
+  finfo_[color].score_king_ += coeff_->pawnKingAttack_ * (!!(finfo_[color].pawnAttacks_ & near_oking_pw));
 
   auto kn_check = movesTable().caps(Figure::TypeKnight, oki_pos) & finfo_[color].knightMoves_ & fmask_no_check;
   auto bi_check = finfo_[ocolor].bishopMovesKipos_;
@@ -398,24 +399,24 @@ ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscor
   q_check &= can_check_q;
   int num_checkers = (!!p_check) + (!!kn_check) + (!!bi_check) + (!!r_check) + (!!q_check) + finfo_[color].discoveredCheck_;
 
-  int check_score = EvalCoefficients::knightChecking_ * (!!kn_check) +
-    EvalCoefficients::bishopChecking_ * (!!bi_check) +
-    EvalCoefficients::rookChecking_ * (!!r_check) +
-    EvalCoefficients::queenChecking_ * (!!q_check) +
-    EvalCoefficients::discoveredChecking_ * finfo_[color].discoveredCheck_ +
-    EvalCoefficients::promotionChecking_ * (!!p_check);
+  int check_score = coeff_->knightChecking_ * (!!kn_check) +
+    coeff_->bishopChecking_ * (!!bi_check) +
+    coeff_->rookChecking_ * (!!r_check) +
+    coeff_->queenChecking_ * (!!q_check) +
+    coeff_->discoveredChecking_ * finfo_[color].discoveredCheck_ +
+    coeff_->promotionChecking_ * (!!p_check);
 
   int num_attackers = std::min(finfo_[color].num_attackers_, 7);
-  auto attack_coeff = EvalCoefficients::kingAttackersCoefficients_[num_attackers];
+  auto attack_coeff = coeff_->kingAttackersCoefficients_[num_attackers];
   auto check_coeff = 0;
   if (!num_checkers && canCheck) {
-    check_score = EvalCoefficients::weakChecking_;
-    check_coeff = EvalCoefficients::kingWeakCheckersCoefficients_;
+    check_score = coeff_->weakChecking_;
+    check_coeff = coeff_->kingWeakCheckersCoefficients_;
     check_coeff += attack_coeff >> 2;
   }
   else {
     num_checkers = std::min(num_checkers, 4);
-    check_coeff = EvalCoefficients::kingCheckersCoefficients_[num_checkers];
+    check_coeff = coeff_->kingCheckersCoefficients_[num_checkers];
     check_coeff += attack_coeff;
   }
 
@@ -429,12 +430,12 @@ ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscor
     int mediumN = pop_count(medium_msk);
     int weakN = pop_count(weak_msk);
     near_oking_att = candidates_msk | weak_msk;
-    auto near_king_attacks = EvalCoefficients::attackedNearKingStrong_ * strongN;
-    near_king_attacks += EvalCoefficients::attackedNearKingMedium_ * mediumN;
-    near_king_attacks += EvalCoefficients::attackedNearKingWeak_ * weakN;
-    auto near_king_checks = EvalCoefficients::checkNearKingStrong_ * strongN;
-    near_king_checks += EvalCoefficients::checkNearKingMedium_ * mediumN;
-    near_king_checks += EvalCoefficients::checkNearKingWeak_ * weakN;
+    auto near_king_attacks = coeff_->attackedNearKingStrong_ * strongN;
+    near_king_attacks += coeff_->attackedNearKingMedium_ * mediumN;
+    near_king_attacks += coeff_->attackedNearKingWeak_ * weakN;
+    auto near_king_checks = coeff_->checkNearKingStrong_ * strongN;
+    near_king_checks += coeff_->checkNearKingMedium_ * mediumN;
+    near_king_checks += coeff_->checkNearKingWeak_ * weakN;
     attack_coeff += near_king_attacks;
     check_coeff += near_king_checks;
   }
@@ -445,10 +446,10 @@ ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscor
   if (near_oking_rem) {
     int remsN = pop_count(near_oking_rem & ~finfo_[ocolor].attack_mask_);
     int otherN = pop_count(near_oking_rem & finfo_[ocolor].attack_mask_);
-    auto rem_king_attacks = EvalCoefficients::attackedNearKingRem_ * remsN;
-    auto rem_king_checks = EvalCoefficients::checkNearKingRem_ * remsN;
-    rem_king_attacks += EvalCoefficients::attackedNearKingOther_ * otherN;
-    rem_king_checks += EvalCoefficients::checkNearKingOther_ * otherN;
+    auto rem_king_attacks = coeff_->attackedNearKingRem_ * remsN;
+    auto rem_king_checks = coeff_->checkNearKingRem_ * remsN;
+    rem_king_attacks += coeff_->attackedNearKingOther_ * otherN;
+    rem_king_checks += coeff_->checkNearKingOther_ * otherN;
     attack_coeff += rem_king_attacks;
     check_coeff += rem_king_checks;
   }
@@ -456,8 +457,8 @@ ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscor
   auto oking_pw_attacked = (finfo_[color].pawnAttacks_ & near_oking_pw & ~finfo_[ocolor].pawnAttacks_);
   if (oking_pw_attacked) {
     int pawnsN = pop_count(oking_pw_attacked);
-    auto pw_king_attacks = EvalCoefficients::attackedNearKingPawns_ * pawnsN;
-    auto pw_king_checks = EvalCoefficients::checkNearKingPawns_ * pawnsN;
+    auto pw_king_attacks = coeff_->attackedNearKingPawns_ * pawnsN;
+    auto pw_king_checks = coeff_->checkNearKingPawns_ * pawnsN;
     attack_coeff += pw_king_attacks;
     check_coeff += pw_king_checks;
   }
@@ -481,14 +482,14 @@ ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscor
 #ifdef KING_MAT_TREAT_POSSIBILITY
   if((p_check | bi_check | q_check | r_check) && isMatTreat(color, ocolor, finfo_[ocolor].attack_any_but_king_, p_check|q_check, r_check, bi_check)) {
     const bool myMove = (board_->color() == color);
-    check_coeff += EvalCoefficients::possibleMatTreat_ + EvalCoefficients::possibleMatTreatMyMove_ * myMove;
+    check_coeff += coeff_->possibleMatTreat_ + coeff_->possibleMatTreatMyMove_ * myMove;
   }
 #endif
 
   // could be attacked through unprotected pawn in front of king
 #ifdef ATTACK_THROUGH_PAWN
   if (attackThroughPawn) {
-    attack_coeff += EvalCoefficients::attackThroughPawn_;
+    attack_coeff += coeff_->attackThroughPawn_;
   }
 #endif
 
@@ -503,12 +504,12 @@ ScoreType32 Evaluator::evaluateKingPressure(Figure::Color color, int const kscor
     ~(near_oking_att | near_oking_rem);
 
   auto attacks_king_side = general_pressure_mask & Figure::quaterBoard_[ocolor][king_side];
-  int general_score = pop_count(attacks_king_side) * EvalCoefficients::generalKingPressure_;
+  int general_score = pop_count(attacks_king_side) * coeff_->generalKingPressure_;
 
 #ifdef QUEEN_CHECK_TREAT
   if (bi_check || r_check) {
     bool b = checkQTreat(fmgr.queen_mask(ocolor), fmgr.king_mask(ocolor), mask_all_, bi_check, r_check);
-    score += EvalCoefficients::queenCheckTreatBonus_ * b;
+    score += coeff_->queenCheckTreatBonus_ * b;
   }
 #endif
 
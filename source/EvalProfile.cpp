@@ -0,0 +1,227 @@
+/*************************************************************
+EvalProfile.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "EvalProfile.h"
+#include "iomanip"
+
+namespace NEngine
+{
+
+namespace
+{
+  double percent(uint64 n, uint64 total)
+  {
+    return total ? 100.0 * n / total : 0.0;
+  }
+}
+
+void EvalProfile::clear()
+{
+  *this = EvalProfile{};
+}
+
+EvalProfile& EvalProfile::operator += (EvalProfile const& other)
+{
+  calls_ += other.calls_;
+  specialCases_ += other.specialCases_;
+  evalHashProbes_ += other.evalHashProbes_;
+  evalHashHits_ += other.evalHashHits_;
+  pawnHashProbes_ += other.pawnHashProbes_;
+  pawnHashHits_ += other.pawnHashHits_;
+  materialHashProbes_ += other.materialHashProbes_;
+  materialHashHits_ += other.materialHashHits_;
+  for (int i = 0; i < EvalCoefficients::LazyStagesNum; ++i)
+    lazyExits_[i] += other.lazyExits_[i];
+  for (int i = 0; i < SectionsNum; ++i)
+  {
+    sectionCalls_[i] += other.sectionCalls_[i];
+    sectionCycles_[i] += other.sectionCycles_[i];
+  }
+  return *this;
+}
+
+char const* EvalProfile::sectionName(Section section)
+{
+  switch (section)
+  {
+  case AttacksMasks:
+    return "attacks masks";
+
+  case Knights:
+    return "knights";
+
+  case Bishops:
+    return "bishops";
+
+  case Rooks:
+    return "rooks";
+
+  case Queens:
+    return "queens";
+
+  case KingPressure:
+    return "king pressure";
+
+  case Passers:
+    return "passers";
+
+  default:
+    break;
+  }
+  return "";
+}
+
+void EvalProfile::print(std::ostream& os) const
+{
+#ifndef EVAL_PROFILE
+  os << "eval profile is disabled. define EVAL_PROFILE in xcommon.h" << std::endl;
+  return;
+#endif
+
+  auto flags = os.flags();
+  auto precision = os.precision();
+  os << std::fixed << std::setprecision(1);
+  os << "eval calls:     " << calls_ << std::endl;
+  os << "special cases:  " << specialCases_ << " (" << percent(specialCases_, calls_) << "%)" << std::endl;
+  for (int i = 0; i < EvalCoefficients::LazyStagesNum; ++i)
+  {
+    os << "lazy exits (" << LazyEvalStat::stageName(i) << "): " << lazyExits_[i]
+      << " (" << percent(lazyExits_[i], calls_) << "%)" << std::endl;
+  }
+  os << "eval hash:      " << evalHashHits_ << " of " << evalHashProbes_ << " (" << percent(evalHashHits_, evalHashProbes_) << "%)" << std::endl;
+  os << "pawns hash:     " << pawnHashHits_ << " of " << pawnHashProbes_ << " (" << percent(pawnHashHits_, pawnHashProbes_) << "%)" << std::endl;
+  os << "material hash:  " << materialHashHits_ << " of " << materialHashProbes_ << " (" << percent(materialHashHits_, materialHashProbes_) << "%)" << std::endl;
+
+  uint64 totalCycles{};
+  for (int i = 0; i < SectionsNum; ++i)
+    totalCycles += sectionCycles_[i];
+
+  os << std::left << std::setw(16) << "section" << std::right << std::setw(12) << "calls"
+    << std::setw(16) << "cycles" << std::setw(12) << "per call" << std::setw(8) << "%" << std::endl;
+  for (int i = 0; i < SectionsNum; ++i)
+  {
+    os << std::left << std::setw(16) << sectionName((Section)i) << std::right
+      << std::setw(12) << sectionCalls_[i]
+      << std::setw(16) << sectionCycles_[i]
+      << std::setw(12) << (sectionCalls_[i] ? sectionCycles_[i] / sectionCalls_[i] : 0)
+      << std::setw(8) << percent(sectionCycles_[i], totalCycles) << std::endl;
+  }
+  os.flags(flags);
+  os.precision(precision);
+}
+
+void LazyEvalStat::clear()
+{
+  *this = LazyEvalStat{};
+}
+
+LazyEvalStat& LazyEvalStat::operator += (LazyEvalStat const& other)
+{
+  for (int s = 0; s < StagesNum; ++s)
+  {
+    for (int i = 0; i < BucketsNum; ++i)
+      hist_[s][i] += other.hist_[s][i];
+  }
+  return *this;
+}
+
+uint64 LazyEvalStat::count(int stage) const
+{
+  uint64 n{};
+  for (int i = 0; i < BucketsNum; ++i)
+    n += hist_[stage][i];
+  return n;
+}
+
+int LazyEvalStat::margin(int stage, double fraction) const
+{
+  auto total = count(stage);
+  if (!total)
+    return 0;
+  uint64 covered{};
+  for (int i = 0; i < BucketsNum; ++i)
+  {
+    covered += hist_[stage][i];
+    if (covered >= fraction * total)
+      return (i + 1) * BucketSize;
+  }
+  return BucketsNum * BucketSize;
+}
+
+char const* LazyEvalStat::stageName(int stage)
+{
+  switch (stage)
+  {
+  case EvalCoefficients::LazyMaterial:
+    return "material";
+
+  case EvalCoefficients::LazyPawns:
+    return "pawns";
+
+  case EvalCoefficients::LazyPieces:
+    return "pieces";
+
+  case EvalCoefficients::LazyKingPressure:
+    return "king pressure";
+
+  default:
+    break;
+  }
+  return "";
+}
+
+void LazyEvalStat::print(std::ostream& os, double fraction) const
+{
+  static const double fractions[] = { 0.5, 0.9, 0.999 };
+  os << std::left << std::setw(16) << "stage" << std::right << std::setw(12) << "evals";
+  for (auto f : fractions)
+    os << std::setw(8) << f;
+  os << std::setw(8) << fraction << std::endl;
+  for (int s = 0; s < StagesNum; ++s)
+  {
+    os << std::left << std::setw(16) << stageName(s) << std::right << std::setw(12) << count(s);
+    for (auto f : fractions)
+      os << std::setw(8) << margin(s, f);
+    os << std::setw(8) << margin(s, fraction) << std::endl;
+  }
+}
+
+void EvalTrace::clear()
+{
+  *this = EvalTrace{};
+}
+
+void EvalTrace::add(char const* name, ScoreType32 const& score32, ScoreType score)
+{
+  terms_.push_back(Term{ name, score32, score });
+}
+
+void EvalTrace::print(std::ostream& os) const
+{
+  static char const* phases[] = { "opening", "middlegame", "endgame" };
+  if (!specialCase_.empty())
+    os << "special case: " << specialCase_ << std::endl;
+  if (terms_.empty())
+  {
+    os << "result (side to move): " << result_ << std::endl;
+    return;
+  }
+
+  os << "phase: " << phases[phase_] << " (opening " << opening_ << ", endgame " << endGame_ << ")" << std::endl;
+
+  os << std::left << std::setw(20) << "term" << std::right << std::setw(8) << "opening"
+    << std::setw(8) << "endgame" << std::setw(8) << "total" << std::endl;
+  for (auto const& t : terms_)
+  {
+    os << std::left << std::setw(20) << t.name_ << std::right
+      << std::setw(8) << t.score32_.eval0()
+      << std::setw(8) << t.score32_.eval1()
+      << std::setw(8) << t.score_ << std::endl;
+  }
+  if (scoreMultip_ != 1 || scoreOffset_ != 0)
+    os << "draw scale: *" << scoreMultip_ << " >>" << scoreOffset_ << std::endl;
+  os << "result (side to move): " << result_ << std::endl;
+}
+
+} // NEngine
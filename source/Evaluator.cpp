@@ -11,6 +11,7 @@
 #include "Helpers.h"
 #include "xalgorithm.h"
 #include "SpecialCases.h"
+#include "thread"
 
 #define EVALUATE_MATERIAL_DIFFERENCE
 
@@ -57,6 +58,37 @@
 namespace NEngine
 {
 
+namespace
+{
+  char const* specialCaseName(SpecialCaseResult r)
+  {
+    switch (r)
+    {
+    case SpecialCaseResult::SCORE:
+      return "score";
+
+    case SpecialCaseResult::DRAW:
+      return "draw";
+
+    case SpecialCaseResult::ALMOST_DRAW:
+      return "almost draw";
+
+    case SpecialCaseResult::LIKELY_DRAW:
+      return "likely draw";
+
+    case SpecialCaseResult::PROBABLE_DRAW:
+      return "probable draw";
+
+    case SpecialCaseResult::MAYBE_DRAW:
+      return "maybe draw";
+
+    default:
+      break;
+    }
+    return "";
+  }
+} // namespace {}
+
 const int Evaluator::colored_y_[2][8] = {
   { 7, 6, 5, 4, 3, 2, 1, 0 },
   { 0, 1, 2, 3, 4, 5, 6, 7 } };
@@ -132,6 +164,16 @@ void Evaluator::initialize(Board const* board
   board_ = board;
 }
 
+void Evaluator::setCoefficients(EvalCoefficients const* coeff)
+{
+  coeff_ = coeff;
+}
+
+void Evaluator::setBitbases(Bitbases const* bitbases)
+{
+  bitbases_ = bitbases;
+}
+
 void Evaluator::reset()
 {
   finfo_[0] = finfo_[1] = FieldsInfo{};
@@ -263,6 +305,7 @@ void Evaluator::prepare()
 ScoreType Evaluator::operator () (ScoreType alpha, ScoreType betta)
 {
   X_ASSERT(!board_, "Evaluator wasn't properly initialized");
+  EVAL_PROFILE_INC(calls_);
 
   if(!ehash_.empty())
     ehash_.prefetch(board_->fmgr().kpwnCode());
@@ -280,6 +323,64 @@ ScoreType Evaluator::operator () (ScoreType alpha, ScoreType betta)
   return score;
 }
 
+void Evaluator::evaluateBatch(Board const* boards, size_t count, ScoreType* scores)
+{
+  auto const* board0 = board_;
+  for (size_t i = 0; i < count && i < batchPrefetchDistance_; ++i)
+    prefetch(boards[i]);
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (i + batchPrefetchDistance_ < count)
+      prefetch(boards[i + batchPrefetchDistance_]);
+    board_ = &boards[i];
+    scores[i] = (*this)(-ScoreMax, ScoreMax);
+  }
+  board_ = board0;
+}
+
+void evaluateBatch(Board const* boards, size_t count, ScoreType* scores, int threadsN, EvalCoefficients const& coeff)
+{
+  if (!count)
+    return;
+  if (threadsN < 1)
+    threadsN = 1;
+  // too small chunks are not worth to start thread
+  const size_t chunkMin = 1024;
+  size_t chunk = std::max((count + threadsN - 1) / threadsN, chunkMin);
+
+  auto evaluateChunk = [boards, scores, &coeff](size_t from, size_t n)
+  {
+    Evaluator eval;
+    eval.initialize(nullptr
+#ifdef USE_EVAL_HASH_ALL
+      , nullptr
+#endif
+    );
+    eval.setCoefficients(&coeff);
+    eval.evaluateBatch(boards + from, n, scores + from);
+  };
+
+  std::vector<std::thread> threads;
+  size_t from = chunk;
+  for (; from < count; from += chunk)
+    threads.emplace_back(evaluateChunk, from, std::min(chunk, count - from));
+
+  // the first chunk in current thread
+  evaluateChunk(0, std::min(chunk, count));
+
+  for (auto& t : threads)
+    t.join();
+}
+
+ScoreType Evaluator::trace(EvalTrace& trace)
+{
+  trace.clear();
+  trace_ = &trace;
+  trace.result_ = (*this)(-ScoreMax, ScoreMax);
+  trace_ = nullptr;
+  return trace.result_;
+}
+
 ScoreType Evaluator::materialScore() const
 {
   const FiguresManager& fmgr = board_->fmgr();
@@ -295,11 +396,18 @@ ScoreType Evaluator::evaluate(ScoreType alpha, ScoreType betta)
 
   int scoreOffset = 0;
   int scoreMultip = 1;
-  auto spec = specialCases().eval(*board_);
+  auto spec = specialCases().eval(*board_, *coeff_, bitbases_);
+  if (spec.first != SpecialCaseResult::NO_RESULT) {
+    EVAL_PROFILE_INC(specialCases_);
+    if (trace_)
+      trace_->specialCase_ = specialCaseName(spec.first);
+  }
   switch (spec.first) {
   case SpecialCaseResult::SCORE: {
     ScoreType score = spec.second;
     score = considerColor(score);
+    if (trace_)
+      trace_->result_ = score;
     return score;
   }
   case SpecialCaseResult::DRAW: {
@@ -330,44 +438,55 @@ ScoreType Evaluator::evaluate(ScoreType alpha, ScoreType betta)
   }
   }
 
-#ifdef USE_LAZY_EVAL
-  // prepare lazy evaluation
-  alpha_ = (alpha > -Figure::MatScore) ? (int)alpha - lazyThreshold_ : -ScoreMax;
-  betta_ = (betta < +Figure::MatScore) ? (int)betta + lazyThreshold_ : +ScoreMax;
-#endif
-
   // determine game phase (opening, middle or end game)
   auto phaseInfo = detectPhase();
+  if (trace_) {
+    trace_->phase_ = phaseInfo.phase_;
+    trace_->opening_ = phaseInfo.opening_;
+    trace_->endGame_ = phaseInfo.endGame_;
+  }
+
+#ifdef USE_LAZY_EVAL
+  // prepare lazy evaluation. special cases scale score, so it can't be compared with window
+  // passers dominate in endgame and could be very big
+  lazyEval_ = !trace_ && (spec.first == SpecialCaseResult::NO_RESULT) && (phaseInfo.phase_ != GamePhase::EndGame);
+  alpha_ = (alpha > -Figure::MatScore) ? (int)alpha : -ScoreMax;
+  betta_ = (betta < +Figure::MatScore) ? (int)betta : +ScoreMax;
+#endif
 
   const FiguresManager& fmgr = board_->fmgr();
   // evaluate figures weight
 
   ScoreType32 score32 = fmgr.weight();
-  score32 += fmgr.score();
+  traceTerm("material", score32, phaseInfo);
+  auto scorePsq = coeff_->customPositionEvaluations_ ? positionScore() : fmgr.score();
+  traceTerm("position", scorePsq, phaseInfo);
+  score32 += scorePsq;
 
 #ifdef EVALUATE_MATERIAL_DIFFERENCE
   auto mtdiff = evaluateMaterialDiff();
+  traceTerm("material diff", mtdiff, phaseInfo);
   score32 += mtdiff;
 #endif
 
   /// use lazy evaluation
-#ifdef USE_LAZY_EVAL
-  {
-    auto score0 = considerColor(lipolScore(score32, phaseInfo));
-    if ((spec.first == SpecialCaseResult::NO_RESULT) && (score0 < alpha_ || score0 > betta_)) {
-      return score0;
-    }
+  ScoreType lazyScore{};
+  if (lazyExit(EvalCoefficients::LazyMaterial, score32, phaseInfo, lazyScore)) {
+    EVAL_PROFILE_INC(lazyExits_[EvalCoefficients::LazyMaterial]);
+    return lazyScore;
   }
-#endif
 
 #ifdef USE_EVAL_HASH_ALL
   AHEval* heval = nullptr;
   uint32 hkey = 0;
-  if (ev_hash_) {
+  // trace needs all terms to be calculated
+  if (ev_hash_ && !trace_) {
+    EVAL_PROFILE_INC(evalHashProbes_);
     const BitMask code = board_->fmgr().hashCode();
     hkey = (uint32)(code >> 32);
     heval = ev_hash_->get(code);
     if (heval && heval->hkey_ == hkey) {
+      EVAL_PROFILE_INC(evalHashHits_);
       return heval->score_;
     }
   }
@@ -377,71 +496,113 @@ ScoreType Evaluator::evaluate(ScoreType alpha, ScoreType betta)
 
   // take pawns eval from hash if possible
   auto hashedScore = hashedEvaluation();
+  traceTerm("pawns", hashedScore.pwscore_, phaseInfo);
   score32 += hashedScore.pwscore_;
 
+  if (lazyExit(EvalCoefficients::LazyPawns, score32, phaseInfo, lazyScore)) {
+    EVAL_PROFILE_INC(lazyExits_[EvalCoefficients::LazyPawns]);
+    return lazyScore;
+  }
+
   prepareAttacksMasks();
 
   ScoreType32 score_nbrq;
 #ifdef EVALUATE_KNIGHTS
-  score_nbrq = evaluateKnights();
+  auto scoreKnights = evaluateKnights();
+  traceTerm("knights", scoreKnights, phaseInfo);
+  score_nbrq += scoreKnights;
 #endif
 
 #ifdef EVALUATE_BISHOPS
-  score_nbrq += evaluateBishops();
+  auto scoreBishops = evaluateBishops();
+  traceTerm("bishops", scoreBishops, phaseInfo);
+  score_nbrq += scoreBishops;
 #endif
 
 #ifdef EVALUATE_ROOKS
-  score_nbrq += evaluateRook();
+  auto scoreRooks = evaluateRook();
+  traceTerm("rooks", scoreRooks, phaseInfo);
+  score_nbrq += scoreRooks;
 #endif
   
 #ifdef EVALUATE_QUEENS
-  score_nbrq += evaluateQueens();
+  auto scoreQueens = evaluateQueens();
+  traceTerm("queens", scoreQueens, phaseInfo);
+  score_nbrq += scoreQueens;
 #endif
   
   score32 += score_nbrq;
   
   if (detectStalemate()) {
     scoreOffset = 5;
+    lazyEval_ = false;
   }
 
   auto score_mob = finfo_[Figure::ColorWhite].score_mob_;
   score_mob -= finfo_[Figure::ColorBlack].score_mob_;
 
 #ifdef EVALUATE_MOBILITY
+  traceTerm("mobility", score_mob, phaseInfo);
   score32 += score_mob;
 #endif
 
+  if (lazyExit(EvalCoefficients::LazyPieces, score32, phaseInfo, lazyScore)) {
+    EVAL_PROFILE_INC(lazyExits_[EvalCoefficients::LazyPieces]);
+    return lazyScore;
+  }
+
   ScoreType32 scoreKingW = hashedScore.kscores_[Figure::ColorWhite];
   ScoreType32 scoreKingB = hashedScore.kscores_[Figure::ColorBlack];
+  traceTerm("king safety", scoreKingW - scoreKingB, phaseInfo);
 
 #ifdef EVALUATE_KING_PRESSURE
   if (phaseInfo.phase_ != GamePhase::EndGame) {
-    scoreKingW -= evaluateKingPressure(Figure::ColorBlack, hashedScore.kscores_[Figure::ColorWhite].eval0());
-    scoreKingB -= evaluateKingPressure(Figure::ColorWhite, hashedScore.kscores_[Figure::ColorBlack].eval0());
+    auto pressureW = evaluateKingPressure(Figure::ColorBlack, hashedScore.kscores_[Figure::ColorWhite].eval0());
+    auto pressureB = evaluateKingPressure(Figure::ColorWhite, hashedScore.kscores_[Figure::ColorBlack].eval0());
+    traceTerm("king pressure", pressureB - pressureW, phaseInfo);
+    scoreKingW -= pressureW;
+    scoreKingB -= pressureB;
   }
 #endif
 
   ScoreType32 scoreKing = scoreKingW - scoreKingB;
   score32 += scoreKing;
 
+  if (lazyExit(EvalCoefficients::LazyKingPressure, score32, phaseInfo, lazyScore)) {
+    EVAL_PROFILE_INC(lazyExits_[EvalCoefficients::LazyKingPressure]);
+    return lazyScore;
+  }
+
 #ifdef EVALUATE_ATTACKS
   auto scoreAttacks = evaluateAttacks(Figure::ColorWhite);
   scoreAttacks -= evaluateAttacks(Figure::ColorBlack);
+  traceTerm("attacks", scoreAttacks, phaseInfo);
   score32 += scoreAttacks;
 #endif
 
 #ifdef EVALUATE_PAWN_ATTACKS
   auto scorePP = evaluatePawnsAttacks(Figure::ColorWhite);
   scorePP -= evaluatePawnsAttacks(Figure::ColorBlack);
+  traceTerm("pawn attacks", scorePP, phaseInfo);
   score32 += scorePP;
 #endif
 
 #ifdef EVALUATE_PASSER_PAWNS
   auto scorePassers = passersEvaluation(hashedScore);
+  traceTerm("passers", scorePassers, phaseInfo);
   score32 += scorePassers;
 #endif
 
+  traceTerm("total", score32, phaseInfo);
+
   auto result = considerColor(lipolScore(score32, phaseInfo));
+
+  // collect what was left after each stage. the same conditions as for lazy evaluation itself
+  if (lazyCalibration_ && scoreOffset == 0 && scoreMultip == 1 && phaseInfo.phase_ != GamePhase::EndGame) {
+    for (int stage = 0; stage < EvalCoefficients::LazyStagesNum; ++stage)
+      lazyStat_.add(stage, result - lazyScores_[stage]);
+  }
+
   result *= scoreMultip;
   result >>= scoreOffset;
 
@@ -449,6 +610,12 @@ ScoreType Evaluator::evaluate(ScoreType alpha, ScoreType betta)
   result += 5;
 #endif
 
+  if (trace_) {
+    trace_->scoreOffset_ = scoreOffset;
+    trace_->scoreMultip_ = scoreMultip;
+    trace_->result_ = result;
+  }
+
 #ifdef USE_EVAL_HASH_ALL
   if (heval) {
     heval->hkey_ = hkey;
@@ -487,14 +654,36 @@ Evaluator::PhaseInfo Evaluator::detectPhase() const
   return phaseInfo;
 }
 
+ScoreType32 Evaluator::positionScore() const
+{
+  ScoreType32 score;
+  auto const& fmgr = board_->fmgr();
+  for (int c = Figure::ColorBlack; c <= Figure::ColorWhite; ++c)
+  {
+    for (int t = Figure::TypePawn; t <= Figure::TypeKing; ++t)
+    {
+      auto mask = fmgr.type_mask((Figure::Type)t, (Figure::Color)c);
+      for (; mask;)
+      {
+        int p = clear_lsb(mask);
+        // + for black color. invert the sign
+        score -= coeff_->positionEvaluations_[c][t][p];
+      }
+    }
+  }
+  return score;
+}
+
 Evaluator::PasserInfo Evaluator::hashedEvaluation()
 {
 #ifdef USE_EVAL_HASH_PW
   const BitMask code = board_->fmgr().kpwnCode();
   uint32 hkey = (uint32)(code >> 32);
   auto* heval = ehash_.get(code);
+  EVAL_PROFILE_INC(pawnHashProbes_);
   if(heval->hkey_ == hkey)
   {
+    EVAL_PROFILE_INC(pawnHashHits_);
     PasserInfo info;
     info.pwscore_ = heval->pwscore_;
     info.kscores_[Figure::ColorBlack] = heval->kscores_[Figure::ColorBlack];
@@ -596,7 +785,7 @@ bool isPawnBackward<Figure::ColorBlack>(Index const idx, BitMask const pmask, Bi
 }
 
 template <Figure::Color color>
-Evaluator::PasserInfo evaluatePawn(FiguresManager const& fmgr, Evaluator::FieldsInfo const (&finfo)[2])
+Evaluator::PasserInfo evaluatePawn(EvalCoefficients const& coeff, FiguresManager const& fmgr, Evaluator::FieldsInfo const (&finfo)[2])
 {
   const BitMask pmask = fmgr.pawn_mask(color);
   if(!pmask)
@@ -639,27 +828,27 @@ Evaluator::PasserInfo evaluatePawn(FiguresManager const& fmgr, Evaluator::Fields
     bool attack = (opmsk & attackMask) != 0ULL;
 
 #ifdef EVALUATE_ISOLATED_PAWN
-    info.pwscore_ += EvalCoefficients::isolatedPawn_[opened] * isolated;
+    info.pwscore_ += coeff.isolatedPawn_[opened] * isolated;
 #endif
 
 #ifdef EVALUATE_BACKWARD_PAWN
-    info.pwscore_ += EvalCoefficients::backwardPawn_[opened] * backward;
+    info.pwscore_ += coeff.backwardPawn_[opened] * backward;
 #endif
 
 #ifdef EVALUATE_DOUBLED_PAWN
-    info.pwscore_ += EvalCoefficients::doubledPawn_ * doubled;
+    info.pwscore_ += coeff.doubledPawn_ * doubled;
 #endif
 
 #ifdef EVALUATE_UNPROTECTED_PAWN
-    info.pwscore_ += EvalCoefficients::unprotectedPawn_ * unprotected;
+    info.pwscore_ += coeff.unprotectedPawn_ * unprotected;
 #endif
 
 #ifdef EVALUATE_NEIGHBORS_PAWN
-    info.pwscore_ += EvalCoefficients::hasneighborPawn_ * neighbors;
+    info.pwscore_ += coeff.hasneighborPawn_ * neighbors;
 #endif
 
 #ifdef EVALUATE_ATTACKING_PAWN
-    info.pwscore_ += EvalCoefficients::attackingPawn_[cy] * attack;
+    info.pwscore_ += coeff.attackingPawn_[cy] * attack;
 #endif
 
     // passer pawn - save position for further usage
@@ -682,12 +871,146 @@ Evaluator::PasserInfo evaluatePawn(FiguresManager const& fmgr, Evaluator::Fields
   return info;
 }
 
+// one step forward/backward for given color
+template <Figure::Color color>
+inline BitMask pawn_forward(BitMask mask)
+{
+  return color == Figure::ColorWhite ? mask << 8 : mask >> 8;
+}
+
+template <Figure::Color color>
+inline BitMask pawn_backward(BitMask mask)
+{
+  return color == Figure::ColorWhite ? mask >> 8 : mask << 8;
+}
+
+// all fields in front of given ones, not including them
+template <Figure::Color color>
+inline BitMask pawn_front_span(BitMask mask)
+{
+  return color == Figure::ColorWhite ? north_fill(mask << 8) : south_fill(mask >> 8);
+}
+
+// all fields behind given ones, not including them
+template <Figure::Color color>
+inline BitMask pawn_rear_span(BitMask mask)
+{
+  return color == Figure::ColorWhite ? south_fill(mask >> 8) : north_fill(mask << 8);
+}
+
+template <Figure::Color color>
+inline BitMask pawn_attacks(BitMask mask)
+{
+  auto fwd = pawn_forward<color>(mask);
+  return shift_east(fwd) | shift_west(fwd);
+}
+
+// the same as evaluatePawn(), but all pawns are classified at once with whole board shifts & fills
+template <Figure::Color color>
+Evaluator::PasserInfo evaluatePawnMasks(EvalCoefficients const& coeff, FiguresManager const& fmgr, Evaluator::FieldsInfo const (&finfo)[2])
+{
+  const BitMask pmask = fmgr.pawn_mask(color);
+  if(!pmask)
+    return{};
+
+  Evaluator::PasserInfo info;
+
+  const Figure::Color ocolor = Figure::otherColor(color);
+  const BitMask opmsk = fmgr.pawn_mask(ocolor);
+  const auto pawns_all = opmsk | pmask;
+
+  // own pawns on neighbor files, the same row
+  const auto pw_side = shift_east(pmask) | shift_west(pmask);
+  const auto pw_attacks = pawn_attacks<color>(pmask);
+
+  const auto isolated = pmask & ~file_fill(pw_side);
+  const auto opened = pmask & ~pawn_rear_span<color>(pawns_all);
+  const auto guarded = pmask & pw_attacks;
+  const auto neighbors = pmask & (pw_attacks | pw_side);
+  const auto doubled = pmask & ~guarded & pawn_front_span<color>(pmask);
+  // there is own pawn on neighbor file on the same row or behind
+  const auto supported = pmask & (color == Figure::ColorWhite ? north_fill(pw_side) : south_fill(pw_side));
+
+  // backward. field in front is blocked before the next row with own neighbor pawn or 7th row
+  const auto blocked_mask = opmsk | (finfo[ocolor].pawnAttacks_ & ~finfo[color].pawnAttacks_);
+  const BitMask last_rows = color == Figure::ColorWhite ? 0xff00000000000000ULL : 0xffULL;
+  BitMask blocked{};
+  for (auto fields = pawn_backward<color>(blocked_mask & ~last_rows); fields; fields = pawn_backward<color>(fields & ~pw_side))
+    blocked |= fields;
+  // own pawn in front, next field is blocked
+  BitMask blocked_fwd = pmask & pawn_backward<color>(pmask) & pawn_backward<color>(pawn_backward<color>(blocked_mask));
+  if (color == Figure::ColorWhite)
+    blocked_fwd &= (pawn_backward<color>(pw_side) & 0x000000ffffffffffULL) | 0x0000ff0000000000ULL;
+  else
+    blocked_fwd &= pawn_backward<color>(pw_side) & 0xffffffff00000000ULL;
+  const auto backward = pmask & ~isolated & ~supported & (blocked | blocked_fwd);
+  const auto unprotected = pmask & ~isolated & ~backward & ~guarded;
+
+#ifdef EVALUATE_ISOLATED_PAWN
+  info.pwscore_ += coeff.isolatedPawn_[0] * pop_count(isolated & ~opened);
+  info.pwscore_ += coeff.isolatedPawn_[1] * pop_count(isolated & opened);
+#endif
+
+#ifdef EVALUATE_BACKWARD_PAWN
+  info.pwscore_ += coeff.backwardPawn_[0] * pop_count(backward & ~opened);
+  info.pwscore_ += coeff.backwardPawn_[1] * pop_count(backward & opened);
+#endif
+
+#ifdef EVALUATE_DOUBLED_PAWN
+  info.pwscore_ += coeff.doubledPawn_ * pop_count(doubled);
+#endif
+
+#ifdef EVALUATE_UNPROTECTED_PAWN
+  info.pwscore_ += coeff.unprotectedPawn_ * pop_count(unprotected);
+#endif
+
+#ifdef EVALUATE_NEIGHBORS_PAWN
+  info.pwscore_ += coeff.hasneighborPawn_ * pop_count(neighbors);
+#endif
+
+#ifdef EVALUATE_ATTACKING_PAWN
+  // fields, attacked by opponent pawns if they were own
+  const auto ofwd = pawn_backward<color>(opmsk);
+  auto attack = pmask & (shift_east(ofwd) | shift_west(ofwd));
+  for (; attack;) {
+    int const n = clear_lsb(attack);
+    info.pwscore_ += coeff.attackingPawn_[Evaluator::colored_y_[color][n >> 3]];
+  }
+#endif
+
+  // passer pawn - no pawns in front and no opponent pawns on neighbor files
+  const auto ospan = pawn_rear_span<color>(opmsk | shift_east(opmsk) | shift_west(opmsk));
+  info.passers_ = opened & ~ospan;
+  // candidate - opponent pawns could be exchanged with guarding ones
+  auto candidates = opened & ospan & supported;
+  for (; candidates;) {
+    int const n = clear_lsb(candidates);
+    auto guardsN = pop_count(pawnMasks().mask_backward(color, n) & pmask);
+    auto attacksN = pop_count(pawnMasks().mask_attackers(color, n) & opmsk);
+    if (guardsN >= attacksN) {
+      info.passers_ |= set_mask_bit(n);
+    }
+  }
+
+  return info;
+}
+
 Evaluator::PasserInfo Evaluator::evaluatePawns() const
 {
-  auto info_w = evaluatePawn<Figure::ColorWhite>(board_->fmgr(), finfo_);
-  auto info_b = evaluatePawn<Figure::ColorBlack>(board_->fmgr(), finfo_);
+  auto info_w = evaluatePawnMasks<Figure::ColorWhite>(*coeff_, board_->fmgr(), finfo_);
+  auto info_b = evaluatePawnMasks<Figure::ColorBlack>(*coeff_, board_->fmgr(), finfo_);
   info_w.pwscore_ -= info_b.pwscore_;
   info_w.passers_ |= info_b.passers_;
+
+#ifndef NDEBUG
+  // reference implementation, pawn by pawn
+  auto xinfo_w = evaluatePawn<Figure::ColorWhite>(*coeff_, board_->fmgr(), finfo_);
+  auto xinfo_b = evaluatePawn<Figure::ColorBlack>(*coeff_, board_->fmgr(), finfo_);
+  xinfo_w.pwscore_ -= xinfo_b.pwscore_;
+  xinfo_w.passers_ |= xinfo_b.passers_;
+  X_ASSERT(!(info_w.pwscore_ == xinfo_w.pwscore_ && info_w.passers_ == xinfo_w.passers_), "pawns masks evaluation differs from reference");
+#endif
+
   return info_w;
 }
 
@@ -777,7 +1100,7 @@ bool pawnUnstoppable(Board const& board, const Evaluator::FieldsInfo(&finfo)[2],
 }
 
 template <Figure::Color color>
-Evaluator::PasserInfo passerEvaluation(Board const& board, const Evaluator::FieldsInfo(&finfo)[2], BitMask const mask_all, Evaluator::PasserInfo const& pi)
+Evaluator::PasserInfo passerEvaluation(EvalCoefficients const& coeff, Board const& board, const Evaluator::FieldsInfo(&finfo)[2], BitMask const mask_all, Evaluator::PasserInfo const& pi)
 {
   auto const& fmgr = board.fmgr();
   const bool bcolor = board.color() == color;
@@ -827,38 +1150,38 @@ Evaluator::PasserInfo passerEvaluation(Board const& board, const Evaluator::Fiel
     int king_dist = std::min(distanceCounter().getDistance(board.kingPos(color), pp),
       distanceCounter().getDistance(board.kingPos(color), n1));
     if (passmsk & opmsk) {
-      pwscore = EvalCoefficients::passerPawn2_[cy];
+      pwscore = coeff.passerPawn2_[cy];
 
 #ifdef EVALUATE_PASSER_PAWNS_EXTENDED
-      pwscore += EvalCoefficients::passerPawnPGrds2_[cy] * pguards;
+      pwscore += coeff.passerPawnPGrds2_[cy] * pguards;
       pwscore +=
-        EvalCoefficients::okingToPasserDistanceBonus2_[cy] * oking_dist -
-        EvalCoefficients::kingToPasserDistanceBonus2_[cy] * king_dist;
+        coeff.okingToPasserDistanceBonus2_[cy] * oking_dist -
+        coeff.kingToPasserDistanceBonus2_[cy] * king_dist;
 #endif
     }
     else {
-      pwscore = EvalCoefficients::passerPawn_[cy];
+      pwscore = coeff.passerPawn_[cy];
 
 #ifdef EVALUATE_PASSER_PAWNS_EXTENDED
-      pwscore += EvalCoefficients::passerPawnPGrds_[cy] * pguards;
+      pwscore += coeff.passerPawnPGrds_[cy] * pguards;
       pwscore +=
-        EvalCoefficients::okingToPasserDistanceBonus_[cy] * oking_dist -
-        EvalCoefficients::kingToPasserDistanceBonus_[cy] * king_dist;
+        coeff.okingToPasserDistanceBonus_[cy] * oking_dist -
+        coeff.kingToPasserDistanceBonus_[cy] * king_dist;
 #endif
 
 #ifdef EVALUATE_PASSER_PAWNS_UNSTOPPABLE
       if (!(fwd_field & mask_all)) {
         if (!(fwd_field & o_attack_mask)) {
           const bool unstoppable = pawnUnstoppable<color>(board, finfo, mask_all, idx);
-          pwscore += EvalCoefficients::passerUnstoppable_[cy] * unstoppable;
+          pwscore += coeff.passerUnstoppable_[cy] * unstoppable;
           if (!unstoppable && canPromote<color>(board, finfo, mask_all, idx)) {
-            pwscore += EvalCoefficients::passerPawn_[cy];
+            pwscore += coeff.passerPawn_[cy];
           }
         }
         // all forward fields are not blocked by opponent
         auto fwd_mask = fwd_fields & blockers_mask;
         if (!fwd_mask) {
-          pwscore += EvalCoefficients::passerPawnEx_[cy];
+          pwscore += coeff.passerPawnEx_[cy];
         }
         // only few fields are free
         else {
@@ -866,12 +1189,12 @@ Evaluator::PasserInfo passerEvaluation(Board const& board, const Evaluator::Fiel
           int last_cango = Evaluator::colored_y_[color][Index(closest_blocker).y()] - 1;
           int steps = last_cango - cy;
           if (steps > 0) {
-            pwscore += EvalCoefficients::passerPawnExS_[cy][steps];
+            pwscore += coeff.passerPawnExS_[cy][steps];
           }
         }
       }
       else if (fwd_field & fmgr.mask(color)) {
-        pwscore += EvalCoefficients::passerPawnMyBefore_[cy];
+        pwscore += coeff.passerPawnMyBefore_[cy];
       }
 #endif
     }
@@ -883,9 +1206,10 @@ Evaluator::PasserInfo passerEvaluation(Board const& board, const Evaluator::Fiel
 
 ScoreType32 Evaluator::passersEvaluation(PasserInfo const& pi)
 {
+  EVAL_PROFILE_SCOPE(Passers);
   auto const& fmgr = board_->fmgr();
-  auto infoW = NEngine::passerEvaluation<Figure::ColorWhite>(*board_, finfo_, mask_all_, pi);
-  auto infoB = NEngine::passerEvaluation<Figure::ColorBlack>(*board_, finfo_, mask_all_, pi);
+  auto infoW = NEngine::passerEvaluation<Figure::ColorWhite>(*coeff_, *board_, finfo_, mask_all_, pi);
+  auto infoB = NEngine::passerEvaluation<Figure::ColorBlack>(*coeff_, *board_, finfo_, mask_all_, pi);
   infoW.pwscore_ -= infoB.pwscore_;
   return infoW.pwscore_;
 }
@@ -918,8 +1242,10 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
   const BitMask code = board_->fmgr().fgrsCode();
   auto * heval = fhash_.get(code);
   uint32 hkey = (uint32)(code >> 32);
+  EVAL_PROFILE_INC(materialHashProbes_);
   if (heval->hkey_ == hkey)
   {
+    EVAL_PROFILE_INC(materialHashHits_);
     return heval->score_;
   }
 #endif
@@ -939,12 +1265,12 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
   if (fmgr.bishops(Figure::ColorWhite) >= 2)
   {
     const int pawnsN = fmgr.pawns(Figure::ColorWhite);
-    score += EvalCoefficients::doubleBishopBonus_[pawnsN];
+    score += coeff_->doubleBishopBonus_[pawnsN];
   }
   if (fmgr.bishops(Figure::ColorBlack) >= 2)
   {
     const int pawnsN = fmgr.pawns(Figure::ColorBlack);
-    score -= EvalCoefficients::doubleBishopBonus_[pawnsN];
+    score -= coeff_->doubleBishopBonus_[pawnsN];
   }
 #endif
 
@@ -953,12 +1279,12 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
   if (fmgr.knights(Figure::ColorWhite) >= 2)
   {
     const int pawnsN = fmgr.pawns(Figure::ColorWhite);
-    score += EvalCoefficients::doubleKnightBonus_[pawnsN];
+    score += coeff_->doubleKnightBonus_[pawnsN];
   }
   if (fmgr.knights(Figure::ColorBlack) >= 2)
   {
     const int pawnsN = fmgr.pawns(Figure::ColorBlack);
-    score -= EvalCoefficients::doubleKnightBonus_[pawnsN];
+    score -= coeff_->doubleKnightBonus_[pawnsN];
   }
 #endif
 
@@ -970,7 +1296,7 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
     Figure::Color bcolor = static_cast<Figure::Color>(bishopsDiff > 0);
     const int pawnsN = fmgr.pawns(bcolor);
     twoBishops = true;
-    score += EvalCoefficients::twoBishopsBonus_[pawnsN] * bdiff;
+    score += coeff_->twoBishopsBonus_[pawnsN] * bdiff;
   }
 #endif
 
@@ -981,7 +1307,7 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
     int ndiff = sign(knightsDiff);
     Figure::Color ncolor = static_cast<Figure::Color>(knightsDiff > 0);
     const int pawnsN = fmgr.pawns(ncolor);
-    score += EvalCoefficients::twoKnightsBonus_[pawnsN] * ndiff;
+    score += coeff_->twoKnightsBonus_[pawnsN] * ndiff;
   }
 #endif
 
@@ -992,7 +1318,7 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
     Figure::Color fcolor = static_cast<Figure::Color>(figuresDiff > 0);
     const int pawnsN = fmgr.pawns(fcolor);
     int fdiff = sign(figuresDiff);
-    score += EvalCoefficients::figureAgainstPawnBonus_[pawnsN] * fdiff;
+    score += coeff_->figureAgainstPawnBonus_[pawnsN] * fdiff;
   }
 #endif
 
@@ -1012,7 +1338,7 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
     Figure::Color fcolor = Figure::otherColor(rcolor);
     const int rpawnsN = fmgr.pawns(rcolor);
     const int fpawnsN = fmgr.pawns(fcolor);
-    score -= EvalCoefficients::rookAgainstFigureBonus_[rpawnsN][fpawnsN] * rooksDiff;
+    score -= coeff_->rookAgainstFigureBonus_[rpawnsN][fpawnsN] * rooksDiff;
   }
 #endif
 
@@ -1026,11 +1352,11 @@ ScoreType32 Evaluator::evaluateMaterialDiff()
 
     // 2 knights
     if(bishopsDiff == 0)
-      score -= EvalCoefficients::knightsAgainstRookBonus_[fpawnsN] * rooksDiff;
+      score -= coeff_->knightsAgainstRookBonus_[fpawnsN] * rooksDiff;
     else
-      score -= EvalCoefficients::figuresAgainstRookBonus_[fpawnsN] * rooksDiff;
+      score -= coeff_->figuresAgainstRookBonus_[fpawnsN] * rooksDiff;
     if(fmgr.bishops(fcolor) >= 2)
-      score -= EvalCoefficients::doubleBishopBonus_[fpawnsN] * rooksDiff;
+      score -= coeff_->doubleBishopBonus_[fpawnsN] * rooksDiff;
   }
 #endif
 
@@ -1066,11 +1392,11 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
   if (pawn_fork) {
     int pawnsN = pop_count(pawn_fork);
     attackedN += pawnsN;
-    attackScore += EvalCoefficients::pawnAttack_ * pawnsN;
+    attackScore += coeff_->pawnAttack_ * pawnsN;
   }
   if(pawn_fork = (o_mask & ~pw_attacks & finfo_[color].pawnAttacks_)) {
     attackedN++;
-    attackScore += EvalCoefficients::pawnAttack_ >> 2;
+    attackScore += coeff_->pawnAttack_ >> 2;
   }
 
   if (auto pfwd_attacks = (finfo_[color].pawns_fwd_ &
@@ -1081,7 +1407,7 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
       pfwd_attacks = (((pfwd_attacks >> 7) & Figure::pawnCutoffMasks_[0]) | ((pfwd_attacks >> 9) & Figure::pawnCutoffMasks_[1])) & 0x00ffffffffffffff;
     if (auto pawn_fork = (o_mask & pfwd_attacks)) {
       int pawnsN = pop_count(pawn_fork);
-      attackScore += EvalCoefficients::possiblePawnAttack_ * pawnsN;
+      attackScore += coeff_->possiblePawnAttack_ * pawnsN;
     }
   }
 
@@ -1089,7 +1415,7 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
     counted_mask |= kn_fork;
     int knightsN = pop_count(kn_fork);
     attackedN += knightsN;
-    attackScore += EvalCoefficients::knightAttackRQ_ * knightsN;
+    attackScore += coeff_->knightAttackRQ_ * knightsN;
   }
 
   const auto stong_bn_attacks = ~finfo_[ocolor].attack_mask_ | finfo_[color].multiattack_mask_;
@@ -1097,38 +1423,38 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
     counted_mask |= kn_fork;
     int knightsN = pop_count(kn_fork & stong_bn_attacks);
     attackedN += knightsN;
-    attackScore += EvalCoefficients::knightAttack_ * knightsN;
+    attackScore += coeff_->knightAttack_ * knightsN;
     knightsN = pop_count(kn_fork & ~stong_bn_attacks);
     attackedN += knightsN;
-    attackScore += EvalCoefficients::knightAttackWeak_ * knightsN;
+    attackScore += coeff_->knightAttackWeak_ * knightsN;
   }
   if (auto bi_treat = (o_rq_mask & finfo_[color].bishopMoves_ & ~counted_mask)) {
     counted_mask |= bi_treat;
     int bishopsN = pop_count(bi_treat);
     attackedN += bishopsN;
-    attackScore += EvalCoefficients::bishopsAttackRQ_ * bishopsN;
+    attackScore += coeff_->bishopsAttackRQ_ * bishopsN;
   }  
   if (auto bi_treat = (fmgr.knight_mask(ocolor) & finfo_[color].bishopMoves_ & ~counted_mask)) {
     counted_mask |= bi_treat;
     int bishopsN = pop_count(bi_treat & stong_bn_attacks);
     attackedN += bishopsN;
-    attackScore += EvalCoefficients::bishopsAttack_ * bishopsN;
+    attackScore += coeff_->bishopsAttack_ * bishopsN;
     bishopsN = pop_count(bi_treat & ~stong_bn_attacks);
     attackedN += bishopsN;
-    attackScore += EvalCoefficients::bishopsAttackWeak_ * bishopsN;
+    attackScore += coeff_->bishopsAttackWeak_ * bishopsN;
   }
 
   auto qr_possible_mask = ~finfo_[ocolor].attack_mask_ & ~counted_mask;
   if (auto qr_attack = (fmgr.rook_mask(ocolor) & finfo_[color].qbi_attacked_ & qr_possible_mask)) {
     counted_mask |= qr_attack;
     ++attackedN;
-    attackScore += EvalCoefficients::queenAttackBonus_;
+    attackScore += coeff_->queenAttackBonus_;
   }
 
   if (auto r2q_treat = (fmgr.queen_mask(ocolor) & finfo_[color].rookMoves_ & ~counted_mask)) {
     counted_mask |= r2q_treat;
     ++attackedN;
-    attackScore += EvalCoefficients::queenUnderRookAttackBonus_;
+    attackScore += coeff_->queenUnderRookAttackBonus_;
   }
 
   const auto strong_qr_att = ~finfo_[ocolor].attack_mask_ | finfo_[color].multiattack_mask_;
@@ -1139,9 +1465,9 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
     counted_mask |= rtreat_mask;
     int rtreatsN = pop_count(rtreat_mask & strong_qr_att);
     attackedN += rtreatsN;
-    attackScore += EvalCoefficients::rookAttackBonus_ * rtreatsN;
+    attackScore += coeff_->rookAttackBonus_ * rtreatsN;
     rtreatsN = pop_count(rtreat_mask & ~strong_qr_att);
-    attackScore += (EvalCoefficients::rookAttackBonus_ * rtreatsN) >> 2;
+    attackScore += (coeff_->rookAttackBonus_ * rtreatsN) >> 2;
   }
 
   auto qtreat_mask = ~(counted_mask | finfo_[ocolor].pawnAttacks_ | finfo_[ocolor].multiattack_mask_ | finfo_[ocolor].nbr_attacked_);
@@ -1151,18 +1477,18 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
     counted_mask |= qtreat_mask;
     int qtreatsN = pop_count(qtreat_mask & strong_qr_att);
     attackedN += qtreatsN;
-    attackScore += EvalCoefficients::queenAttackBonus_ * qtreatsN;
+    attackScore += coeff_->queenAttackBonus_ * qtreatsN;
     qtreatsN = pop_count(qtreat_mask & ~strong_qr_att);
-    attackScore += (EvalCoefficients::queenAttackBonus_ * qtreatsN) >> 2;
+    attackScore += (coeff_->queenAttackBonus_ * qtreatsN) >> 2;
   }
 
   if (auto king_attacks = (~finfo_[ocolor].attack_any_but_king_ & finfo_[color].kingAttacks_ & fmgr.mask(ocolor) & ~fmgr.pawn_mask(ocolor) & ~counted_mask)) {
     counted_mask |= king_attacks;
     auto ktreatsN = pop_count(king_attacks & ~finfo_[ocolor].attack_mask_);
     attackedN += ktreatsN;
-    attackScore += EvalCoefficients::attackedByKingBonus_ * ktreatsN;
+    attackScore += coeff_->attackedByKingBonus_ * ktreatsN;
     ktreatsN = pop_count(king_attacks & finfo_[ocolor].attack_mask_);
-    attackScore += (EvalCoefficients::attackedByKingBonus_ * ktreatsN) >> 2;
+    attackScore += (coeff_->attackedByKingBonus_ * ktreatsN) >> 2;
   }
 
 #ifdef EVALUATE_POSSIBLE_KNIGHT_ATTACKS
@@ -1186,13 +1512,13 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
     possibleNN = std::max(possibleNN, knightsN);
   }
   possibleNN &= 3;
-  attackScore += (EvalCoefficients::possibleKnightAttack_[possibleNN]) >> ((int)knight_protects);
-  attackScore += EvalCoefficients::knightAttack_ * with_check;
+  attackScore += (coeff_->possibleKnightAttack_[possibleNN]) >> ((int)knight_protects);
+  attackScore += coeff_->knightAttack_ * with_check;
 #endif
 
 #ifdef EVALUATE_MULTIATTACKS
   if (attackedN > 1) {
-    attackScore += EvalCoefficients::multiattackedBonus_ * (attackedN - 1);
+    attackScore += coeff_->multiattackedBonus_ * (attackedN - 1);
   }
 #endif
 
@@ -1202,18 +1528,18 @@ ScoreType32 Evaluator::evaluateAttacks(Figure::Color color)
   //    (finfo_[color].multiattack_mask_ & finfo_[color].nb_attacked_);
   //  auto blocked_attacked = blocked_mask & attacks_mask;
   //  int blockedN = pop_count(blocked_attacked);
-  //  attackScore += EvalCoefficients::immobileAttackBonus_ * blockedN;
+  //  attackScore += coeff_->immobileAttackBonus_ * blockedN;
   //  attackedN += blockedN;
   //}
 
 #ifdef EVALUATE_DISCOVERED_ATTACKS
   if (finfo_[color].discoveredMoves_ & finfo_[ocolor].nbrq_mask_) {
-    attackScore += EvalCoefficients::discoveredAttackBonus_;
+    attackScore += coeff_->discoveredAttackBonus_;
   }
 #endif
 
   //if (finfo_[ocolor].attackedThrough_) {
-  //  attackScore += EvalCoefficients::attackedThroughBonus_;
+  //  attackScore += coeff_->attackedThroughBonus_;
   //}
   
   return ScoreType32{ attackScore, attackScore };
@@ -1231,9 +1557,9 @@ ScoreType32 Evaluator::evaluatePawnsAttacks(Figure::Color color)
   auto medium_attacks = ~strong_attacks & (finfo_[color].multiattack_mask_ & finfo_[color].nb_attacked_);
   auto weak_attacks = ~(strong_attacks | medium_attacks);
   ScoreType32 score{};
-  score += EvalCoefficients::pawnPressureStrong_ * pop_count(pw_unprotected & treats & strong_attacks);
-  score += EvalCoefficients::pawnPressureMedium_ * pop_count(pw_unprotected & treats & medium_attacks);
-  score += EvalCoefficients::pawnPressureWeak_ * pop_count(pw_unprotected & treats & weak_attacks);
+  score += coeff_->pawnPressureStrong_ * pop_count(pw_unprotected & treats & strong_attacks);
+  score += coeff_->pawnPressureMedium_ * pop_count(pw_unprotected & treats & medium_attacks);
+  score += coeff_->pawnPressureWeak_ * pop_count(pw_unprotected & treats & weak_attacks);
   
   // bishop treat
 #ifdef EVALUATE_PAWN_BISHOP_TREAT
@@ -1242,9 +1568,9 @@ ScoreType32 Evaluator::evaluatePawnsAttacks(Figure::Color color)
     auto bi_mask_w = fmgr.bishop_mask(color) &  FiguresCounter::s_whiteMask_;
     auto bi_mask_b = fmgr.bishop_mask(color) & ~FiguresCounter::s_whiteMask_;
     if (bi_mask_w)
-      score += EvalCoefficients::pawnBishopTreat_ * pop_count((pw_unprotected &  FiguresCounter::s_whiteMask_) & ~treats);
+      score += coeff_->pawnBishopTreat_ * pop_count((pw_unprotected &  FiguresCounter::s_whiteMask_) & ~treats);
     if (bi_mask_b)
-      score += EvalCoefficients::pawnBishopTreat_ * pop_count((pw_unprotected & ~FiguresCounter::s_whiteMask_) & ~treats);
+      score += coeff_->pawnBishopTreat_ * pop_count((pw_unprotected & ~FiguresCounter::s_whiteMask_) & ~treats);
   }
 #endif
   return score;
@@ -6,17 +6,13 @@ Helpers.cpp - Copyright (C) 2016 by Dmitry Sultanov
 #include "xindex.h"
 #include "MovesGenerator.h"
 #include "locale"
-#include "regex"
+#include "charconv"
 
 #ifdef _USE_LOG
 #include "fstream"
 #endif
 
 
-// TODO: refactore with std::regex
-static std::regex rfen_{"([a-h1-8pnbrqkPNBRQK/]*)([ \\t]+)([bwKQkqa-h0-9 \\t\\-]*)"};
-static std::regex rafen_{"([bw]+)([ \\t]+)?([\\-KQkq]+)?([ \\t]+)?([\\-a-h\\d]+)?([ \\t]*)?([\\d]*)?([ \\t]*)?([\\d]*)?"};
-
 namespace NEngine
 {
 
@@ -29,7 +25,82 @@ bool iscolumn(char c)
   return c >= 'a' && c <= 'h';
 }
 
-eMoveNotation detectNotation(std::string const& str)
+inline
+bool isrow(char c)
+{
+  return c >= '1' && c <= '8';
+}
+
+inline
+bool isseparator(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+namespace
+{
+
+std::string_view trimmed(std::string_view str)
+{
+  while(!str.empty() && isseparator(str.front()))
+    str.remove_prefix(1);
+  while(!str.empty() && isseparator(str.back()))
+    str.remove_suffix(1);
+  return str;
+}
+
+// whole string should be a number
+template <class T>
+bool toNumber(std::string_view str, T& value)
+{
+  if(str.empty())
+    return false;
+  auto const* end = str.data() + str.size();
+  auto r = std::from_chars(str.data(), end, value);
+  return r.ec == std::errc{} && r.ptr == end;
+}
+
+bool isNumber(std::string_view str)
+{
+  return !str.empty() && std::all_of(str.begin(), str.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+// epd operations are separated with ';'. quoted string is one token
+std::string_view nextEpdToken(std::string_view& str)
+{
+  size_t i = 0;
+  for(; i < str.size() && isseparator(str[i]); ++i);
+  size_t j = i;
+  if(j < str.size() && ';' == str[j])
+    ++j;
+  else if(j < str.size() && '"' == str[j])
+  {
+    j = str.find('"', j + 1);
+    j = (j == std::string_view::npos) ? str.size() : j + 1;
+  }
+  else
+  {
+    for(; j < str.size() && !isseparator(str[j]) && ';' != str[j] && '"' != str[j]; ++j);
+  }
+  auto token = str.substr(i, j - i);
+  str.remove_prefix(j);
+  return token;
+}
+
+} // namespace {}
+
+std::string_view nextToken(std::string_view& str)
+{
+  size_t i = 0;
+  for(; i < str.size() && isseparator(str[i]); ++i);
+  size_t j = i;
+  for(; j < str.size() && !isseparator(str[j]); ++j);
+  auto token = str.substr(i, j - i);
+  str.remove_prefix(j);
+  return token;
+}
+
+eMoveNotation detectNotation(std::string_view str)
 {
   if(str.size() < 2)
     return eMoveNotation::mnUnknown;
@@ -42,10 +113,10 @@ eMoveNotation detectNotation(std::string const& str)
   if(str.size() == 2 && iscolumn(str[0]) && (iscolumn(str[1]) || isdigit(str[1])))
     return eMoveNotation::mnSAN;
 
-  if(str.size() >= 3 && isalpha(str[0]) && (isalnum(str[1]) || str[1] == '-')) // may be SAN
+  if(str.size() >= 3 && isalpha(str[0]) && (isalnum(str[1]) || str[1] == '-' || str[1] == 'x')) // may be SAN
   {
-    static std::string const figletters{"PNBRQK"};
-    if(figletters.find(str[0]) != std::string::npos)
+    static std::string_view const figletters{"PNBRQK"};
+    if(figletters.find(str[0]) != std::string_view::npos)
     {
       if(iscolumn(str[1]) && (isdigit(str[2]) || str[2] == 'x' || iscolumn(str[2])))
         return eMoveNotation::mnSAN;
@@ -58,7 +129,7 @@ eMoveNotation detectNotation(std::string const& str)
     }
 
     /// castle
-    if(str.find("O-O") != std::string::npos)
+    if(str.find("O-O") != std::string_view::npos)
       return eMoveNotation::mnSAN;
 
     /// pawns movement
@@ -73,7 +144,7 @@ eMoveNotation detectNotation(std::string const& str)
   return eMoveNotation::mnUnknown;
 }
 
-Move parseSAN(const Board & board, std::string const& str)
+Move parseSAN(const Board & board, std::string_view str)
 {
   if(str.empty())
     return Move{true};
@@ -90,92 +161,73 @@ Move parseSAN(const Board & board, std::string const& str)
   int xfrom = -1, yfrom = -1;
   int from = -1, to = -1;
   bool capture = false;
-  bool check = false;
-  bool chessmat = false;
 
-  const char * s = str.c_str();
+  auto s = str;
 
-  static std::string const figletters{"PNBRQK"};
-  if(figletters.find_first_of(*s) != std::string::npos)
+  static std::string_view const figletters{"PNBRQK"};
+  if(figletters.find(s[0]) != std::string_view::npos)
   {
-    type = Figure::toFtype(*s);
-    s++;
+    type = Figure::toFtype(s[0]);
+    s.remove_prefix(1);
   }
-  else if(std::string(s).find("O-O-O") != std::string::npos) // long castle
+  else if(s.find("O-O-O") != std::string_view::npos) // long castle
   {
     from = board.color() ? 4 : 60;
     to = board.color() ? 2 : 58;
-    s += 5;
     type = Figure::Type::TypeKing;
   }
-  else if(std::string(s).find("O-O") != std::string::npos) // short castle
+  else if(s.find("O-O") != std::string_view::npos) // short castle
   {
     from = board.color() ? 4 : 60;
     to = board.color() ? 6 : 62;
-    s += 3;
     type = Figure::Type::TypeKing;
   }
 
   if(to < 0) // not found yet
   {
     // should be at least 2 chars
-    size_t n = std::string(s).length();
-    if(n < 2)
+    if(s.size() < 2)
       return Move{true};
 
     if(isdigit(s[0]) && (iscolumn(s[1]) || 'x' == s[1])) // from row number
     {
       yfrom = s[0] - '1';
-      s++;
+      s.remove_prefix(1);
     }
     else if(iscolumn(s[0]) && (iscolumn(s[1]) || 'x' == s[1])) // from column number
     {
       xfrom = s[0] - 'a';
-      s++;
+      s.remove_prefix(1);
     }
-    else if(n > 2 && iscolumn(s[0]) && isdigit(s[1]) && (iscolumn(s[2]) || 'x' == s[2])) // exact from point
+    else if(s.size() > 2 && iscolumn(s[0]) && isdigit(s[1]) && (iscolumn(s[2]) || 'x' == s[2])) // exact from point
     {
       xfrom = s[0] - 'a';
       yfrom = s[1] - '1';
-      s += 2;
+      s.remove_prefix(2);
     }
 
-    if('x' == s[0]) // capture
+    if(!s.empty() && 'x' == s[0]) // capture
     {
       capture = true;
-      s++;
+      s.remove_prefix(1);
     }
 
-    n = std::string(s).length();
-    if(!*s || !iscolumn(s[0]) || n < 2)
+    if(s.size() < 2 || !iscolumn(s[0]) || !isrow(s[1]))
       return Move{true};
 
     to = (s[0] - 'a') | ((s[1] - '1') << 3);
-    s += 2;
-    n = std::string(s).length();
+    s.remove_prefix(2);
 
-    if('=' == s[0] || is_any_of("NBRQ", s[0]))
+    if(!s.empty() && ('=' == s[0] || is_any_of("NBRQ", s[0])))
     {
       if('=' == s[0])
-      {
-        if(n < 2)
-          return Move{true};
-        s++;
-        n = std::string(s).length();
-      }
-      if(n < 1)
+        s.remove_prefix(1);
+      if(s.empty())
         return Move{true};
       new_type = Figure::toFtype(s[0]);
       if(new_type < Figure::Type::TypeKnight || new_type > Figure::Type::TypeQueen)
         return Move{true};
-      s++;
-      n = std::string(s).length();
     }
-
-    if('+' == s[0])
-      check = true;
-    else if('#' == s[0])
-      chessmat = true;
   }
 
   if(to < 0)
@@ -237,8 +289,10 @@ std::string printSAN(Board & board, const Move move)
     if(m == move)
     {
       board.makeMove(move);
-      board.verifyState();
+      // verifyState() would keep mat in undo info and it would be restored by unmakeMove()
       state = board.state();
+      if(!board.hasMove())
+        state |= board.underCheck() ? State::ChessMat : State::Stalemat;
       board.unmakeMove(move);
       found = true;
     }
@@ -370,12 +424,12 @@ std::string moveToStr(const Move move, bool wbf)
   return str;
 }
 
-Move strToMove(std::string const& str)
+Move strToMove(std::string_view str)
 {
   if (str.size() < 4)
     return Move{ true };
 
-  if (!iscolumn(str[0]) || !isdigit(str[1]) && !iscolumn(str[2]) && !isdigit(str[3]))
+  if (!iscolumn(str[0]) || !isrow(str[1]) || !iscolumn(str[2]) || !isrow(str[3]))
     return Move{ true };
 
   int xfrom = str[0] - 'a';
@@ -402,7 +456,7 @@ Move strToMove(std::string const& str)
   return Move{ from, to, new_type };
 }
 
-Move strToMove(std::string const& str, const Board & board)
+Move strToMove(std::string_view str, const Board & board)
 {
   if(str.empty())
     return Move{true};
@@ -431,69 +485,65 @@ Move strToMove(std::string const& str, const Board & board)
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// TODO: rewrite with std::string/std::regex
 /* rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1 */
-bool fromFEN(std::string const& i_fen, Board& board)
+bool fromFEN(std::string_view i_fen, Board& board)
 {
-  static std::string const stdFEN_ = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
   board.clear();
 
-  std::string fen = i_fen.empty() ? stdFEN_ : i_fen;
-  trim(fen);
+  auto fen = trimmed(i_fen);
+  if(fen.empty())
+    fen = stdFEN_;
 
-  std::smatch m;
-  if (!std::regex_search(fen, m, rfen_) || m.size() < 3) {
-    return false;
-  }
-  std::string fstr = m[1];
-  std::string astr = m[3];
-  auto lines = split(fstr, [](char c) { return c == '/'; });
-  for (int y = 7; y >= 0; --y) {
-    auto const& line = lines[7 - y];
-    int x = 0;
-    for (char c : line) {
-      if (x > 7) {
-        break;
-      }
-      if (isdigit(c)) {
-        int dx = c - '0';
-        x += dx;
-        continue;
-      }
-      else if (isalpha(c)) {
-        Figure::Type  ftype = Figure::TypeNone;
-        Figure::Color color = Figure::ColorBlack;
-        if (isupper(c))
-          color = Figure::ColorWhite;
-        ftype = Figure::toFtype(toupper(c));
-        if (Figure::TypeNone == ftype)
-          return false;
-        board.addFigure(color, ftype, Index(x, y));
-        ++x;
-      }
+  // 1 - figures from 8th rank
+  int x = 0, y = 7;
+  for(char c : nextToken(fen))
+  {
+    if('/' == c)
+    {
+      if(x != 8 || y == 0)
+        return false;
+      x = 0;
+      --y;
+      continue;
     }
+    if(isrow(c))
+    {
+      x += c - '0';
+      if(x > 8)
+        return false;
+      continue;
+    }
+    bool const black = c >= 'a' && c <= 'z';
+    auto const ftype = Figure::toFtype(black ? static_cast<char>(c - 'a' + 'A') : c);
+    if(Figure::TypeNone == ftype || x > 7)
+      return false;
+    board.addFigure(black ? Figure::ColorBlack : Figure::ColorWhite, ftype, Index(x, y));
+    ++x;
   }
-  std::smatch sr;
-  if (!std::regex_search(astr, sr, rafen_) || sr.size() < 10) {
+  if(x != 8 || y != 0)
+    return false;
+
+  if(board.fmgr().tcount(Figure::TypeKing, Figure::ColorWhite) != 1 ||
+     board.fmgr().tcount(Figure::TypeKing, Figure::ColorBlack) != 1)
     return false;
+
+  // 2 - color to move
+  auto const scolor = nextToken(fen);
+  if("w" == scolor)
+    board.setColor(Figure::ColorWhite);
+  else if("b" == scolor)
+  {
+    board.setColor(Figure::ColorBlack);
+    board.hashColor();
   }
-  std::string scolor = sr[1];
-  std::string scastle = sr[3];
-  std::string senpass = sr[5];
-  std::string sfifty = sr[7];
-  std::string shalf = sr[9];
-  if (!scolor.empty()) {
-    char c = scolor[0];
-    if ('w' == c)
-      board.setColor(Figure::ColorWhite);
-    else if ('b' == c)
+  else
+    return false;
+
+  // 3 - castling possibility
+  for(char c : nextToken(fen))
+  {
+    switch(c)
     {
-      board.setColor(Figure::ColorBlack);
-      board.hashColor();
-    }
-  }
-  for (char c : scastle) {
-    switch (c) {
     case 'k':
       board.set_castling(Figure::ColorBlack, 0);
       break;
@@ -506,30 +556,41 @@ bool fromFEN(std::string const& i_fen, Board& board)
     case 'Q':
       board.set_castling(Figure::ColorWhite, 1);
       break;
-    default:
+    case '-':
       break;
+    default:
+      return false;
     }
   }
-  if (senpass.size() >= 2 && senpass[0] != '-') {
+
+  // 4 - en passant
+  auto const senpass = nextToken(fen);
+  if(!senpass.empty() && "-" != senpass)
+  {
+    if(senpass.size() != 2 || !iscolumn(senpass[0]) || !isrow(senpass[1]))
+      return false;
     char cx = senpass[0];
     char cy = senpass[1];
     Index enpassant(cx, cy);
-    if (board.color())
+    if(board.color())
       cy--;
     else
       cy++;
     Index pwpos(cx, cy);
     const Field fp = board.getField(pwpos);
-    if (fp.type() != Figure::TypePawn || fp.color() == board.color()) {
+    if(fp.type() != Figure::TypePawn || fp.color() == board.color()) {
       return false;
     }
     board.setEnpassant(enpassant, fp.color());
   }
-  if (!sfifty.empty() && isdigit(sfifty[0])) {
-    board.setFiftyMovesCount(std::stoi(sfifty));
-  }
-  if (!shalf.empty() && isdigit(shalf[0])) {
-    board.setMovesCounter(std::stoi(shalf));
+
+  // 5, 6 - fifty move rule and moves counter are optional. the rest of string is ignored
+  int fifty{}, counter{};
+  if(toNumber(nextToken(fen), fifty) && fifty >= 0)
+  {
+    board.setFiftyMovesCount(std::min(fifty, (int)std::numeric_limits<uint8>::max()));
+    if(toNumber(nextToken(fen), counter) && counter > 0)
+      board.setMovesCounter(counter);
   }
 
   if(!board.invalidate())
@@ -538,6 +599,247 @@ bool fromFEN(std::string const& i_fen, Board& board)
   return true;
 }
 
+bool parseEPD(std::string_view line, EpdView& epd)
+{
+  epd = EpdView{};
+  auto str = trimmed(line);
+
+  // 4 fields of FEN and optional move counters
+  auto const* fen = str.data();
+  for(int i = 0; i < 4; ++i)
+  {
+    if(nextToken(str).empty())
+      return false;
+  }
+  for(int i = 0; i < 2; ++i)
+  {
+    auto rest = str;
+    if(!isNumber(nextToken(rest)))
+      break;
+    str = rest;
+  }
+  epd.fen_ = std::string_view(fen, str.data() - fen);
+
+  // moves without opcode right after FEN are best moves
+  std::string_view* moves = &epd.bm_;
+  bool first = true;
+  for(auto token = nextEpdToken(str); !token.empty(); token = nextEpdToken(str), first = false)
+  {
+    if(";" == token)
+    {
+      moves = nullptr;
+      continue;
+    }
+    if('"' == token.front())
+    {
+      // comment "score N"
+      auto comment = token.substr(1);
+      if(!comment.empty() && '"' == comment.back())
+        comment.remove_suffix(1);
+      if("score" == nextToken(comment) && toNumber(nextToken(comment), epd.score_))
+        epd.hasScore_ = true;
+      continue;
+    }
+    if("bm" == token || "am" == token || "moves" == token)
+    {
+      moves = ("bm" == token) ? &epd.bm_ : (("am" == token) ? &epd.am_ : &epd.moves_);
+      continue;
+    }
+    if("dmin" == token || "dmax" == token || "score" == token || "hash" == token)
+    {
+      auto const operand = nextEpdToken(str);
+      if("hash" == token)
+        toNumber(operand, epd.hash_);
+      else if("score" == token)
+      {
+        if(toNumber(operand, epd.score_))
+          epd.hasScore_ = true;
+      }
+      else
+        toNumber(operand, ("dmin" == token) ? epd.dmin_ : epd.dmax_);
+      moves = nullptr;
+      continue;
+    }
+    // operands of unknown opcode are skipped
+    if(first && detectNotation(token) == eMoveNotation::mnUnknown)
+      moves = nullptr;
+    if(!moves)
+      continue;
+    if(moves->empty())
+      *moves = token;
+    else
+      *moves = std::string_view(moves->data(), token.data() + token.size() - moves->data());
+  }
+  return true;
+}
+
+namespace
+{
+
+// {comment}, ;comment or %escape till the end of line. false if there is no comment
+bool skipComment(std::string_view& str)
+{
+  size_t n = 0;
+  if('{' == str.front())
+    n = str.find('}');
+  else if(';' == str.front() || '%' == str.front())
+    n = str.find('\n');
+  else
+    return false;
+  str.remove_prefix(n == std::string_view::npos ? str.size() : n + 1);
+  return true;
+}
+
+// (variation) including nested ones
+void skipVariation(std::string_view& str)
+{
+  for(int depth = 0; !str.empty();)
+  {
+    if(skipComment(str))
+      continue;
+    char const c = str.front();
+    str.remove_prefix(1);
+    if('(' == c)
+      depth++;
+    else if(')' == c && --depth <= 0)
+      break;
+  }
+}
+
+// [Name "value"]. value may contain escaped quotes and ']'
+void parseTag(std::string_view& str, PgnView& pgn)
+{
+  auto const q0 = str.find('"');
+  auto const e0 = str.find(']');
+  if(q0 == std::string_view::npos || q0 > e0)
+  {
+    str.remove_prefix(e0 == std::string_view::npos ? str.size() : e0 + 1);
+    return;
+  }
+  auto name = str.substr(1, q0 - 1);
+  name = nextToken(name);
+  auto q1 = q0 + 1;
+  for(; q1 < str.size() && '"' != str[q1]; ++q1)
+  {
+    if('\\' == str[q1])
+      ++q1;
+  }
+  auto const value = str.substr(q0 + 1, std::min(q1, str.size()) - q0 - 1);
+  auto const e1 = str.find(']', std::min(q1, str.size()));
+  str.remove_prefix(e1 == std::string_view::npos ? str.size() : e1 + 1);
+  if("FEN" == name)
+    pgn.fen_ = value;
+  else if("Result" == name)
+    pgn.result_ = value;
+}
+
+bool isPgnResult(std::string_view token)
+{
+  return "1-0" == token || "0-1" == token || "1/2-1/2" == token || "*" == token;
+}
+
+} // namespace {}
+
+bool parsePGN(std::string_view game, PgnView& pgn)
+{
+  // moves vector is reused
+  pgn.fen_ = {};
+  pgn.result_ = {};
+  pgn.moves_.clear();
+
+  auto str = game;
+  for(;;)
+  {
+    while(!str.empty() && isseparator(str.front()))
+      str.remove_prefix(1);
+    if(str.empty())
+      break;
+    if(skipComment(str))
+      continue;
+    if('[' == str.front())
+    {
+      parseTag(str, pgn);
+      continue;
+    }
+    if('(' == str.front())
+    {
+      skipVariation(str);
+      continue;
+    }
+
+    static std::string_view const delimiters{"{}();["};
+    size_t j = 0;
+    for(; j < str.size() && !isseparator(str[j]) && delimiters.find(str[j]) == std::string_view::npos; ++j);
+    auto token = str.substr(0, std::max(j, size_t{1}));
+    str.remove_prefix(token.size());
+
+    if(isPgnResult(token))
+    {
+      if(pgn.result_.empty())
+        pgn.result_ = token;
+      break;
+    }
+    // NAG
+    if('$' == token.front())
+      continue;
+    // move number 12. or 12... could be written together with move
+    size_t k = 0;
+    for(; k < token.size() && isdigit(token[k]); ++k);
+    if(k < token.size() && '.' == token[k])
+    {
+      for(; k < token.size() && ('.' == token[k] || isdigit(token[k])); ++k);
+      token.remove_prefix(k);
+    }
+    // annotation symbols !, ?, !? etc
+    while(!token.empty() && ('!' == token.back() || '?' == token.back()))
+      token.remove_suffix(1);
+    if(!token.empty())
+      pgn.moves_.push_back(token);
+  }
+  return !pgn.moves_.empty() || !pgn.fen_.empty();
+}
+
+bool nextGame(std::string_view& text, std::string_view& game)
+{
+  while(!text.empty() && isseparator(text.front()))
+    text.remove_prefix(1);
+  if(text.empty())
+    return false;
+
+  bool moves = false;
+  bool comment = false;
+  size_t i = 0;
+  while(i < text.size())
+  {
+    auto n = text.find('\n', i);
+    n = (n == std::string_view::npos) ? text.size() : n + 1;
+    auto line = trimmed(text.substr(i, n - i));
+    if(!comment && !line.empty() && '[' == line.front())
+    {
+      // tags of the next game
+      if(moves)
+        break;
+    }
+    else if(!line.empty() && (comment || '%' != line.front()))
+    {
+      moves = true;
+      for(char c : line)
+      {
+        if(comment)
+          comment = '}' != c;
+        else if('{' == c)
+          comment = true;
+        else if(';' == c)
+          break;
+      }
+    }
+    i = n;
+  }
+  game = text.substr(0, i);
+  text.remove_prefix(i);
+  return true;
+}
+
 std::string toFEN(Board const& board)
 {
   std::string fen;
@@ -924,7 +1226,6 @@ std::vector<std::string> split(std::string const& str, std::function<bool(char)>
   return result;
 }
 
-int XCounter::count_ = 0;
 
 #ifdef _USE_LOG
 void addLog(std::string const& str)
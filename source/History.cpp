@@ -1,61 +1,42 @@
 #include "History.h"
 #include "fstream"
+#include "algorithm"
 
 namespace NEngine
 {
 
-History history_[2][NumOfFields][NumOfFields] = {};
+SearchHistory::SearchHistory()
+{
+  clear();
+}
 
-void clear_history()
+void SearchHistory::clear()
 {
   for(int c = 0; c < 2; ++c)
     for(int i = 0; i < NumOfFields; ++i)
       for(int j = 0; j < NumOfFields; ++j)
         history_[c][i][j].clear();
+
+  std::fill(&counterMoves_[0][0][0], &counterMoves_[0][0][0] + sizeof(counterMoves_) / sizeof(Move), Move{ true });
+  std::fill(&continuationHistory_[0][0][0][0][0][0], &continuationHistory_[0][0][0][0][0][0] + sizeof(continuationHistory_) / sizeof(History), History{});
+  std::fill(&capturesHistory_[0][0][0][0], &capturesHistory_[0][0][0][0] + sizeof(capturesHistory_) / sizeof(History), History{});
 }
 
-void max_history()
+SearchHistory const& SearchHistory::empty()
 {
-  SortValueType score_max{ 0 };
-  for(int c = 0; c < 2; ++c)
-  {
-    for(int i = 0; i < NumOfFields; ++i)
-    {
-      for(int j = 0; j < NumOfFields; ++j)
-      {
-        if(history_[c][i][j].score() > score_max)
-          score_max = history_[c][i][j].score();
-      }
-    }
-  }
-  std::ofstream ofs("hist_score.txt", std::ios::app);
-  ofs << score_max << std::endl;
+  static std::unique_ptr<SearchHistory const> const empty_{ new SearchHistory };
+  return *empty_;
 }
 
-//void normalize_history(int n)
-//{
-//  for(int c = 0; c < 2; ++c)
-//  {
-//    for(int i = 0; i < NumOfFields; ++i)
-//    {
-//      for(int j = 0; j < NumOfFields; ++j)
-//      {
-//        History & hist = history_[c][i][j];
-//        hist.normalize(n);
-//      }
-//    }
-//  }
-//}
-
-void save_history(std::string const& fname)
+void SearchHistory::save(std::string const& fname) const
 {
   std::ofstream ofs(fname, std::ofstream::binary);
   if(!ofs)
     return;
-  ofs.write(reinterpret_cast<char*>(history_), sizeof(history_));
+  ofs.write(reinterpret_cast<char const*>(history_), sizeof(history_));
 }
 
-void load_history(std::string const& fname)
+void SearchHistory::load(std::string const& fname)
 {
   std::ifstream ifs(fname, std::ifstream::binary);
   if(!ifs)
@@ -0,0 +1,268 @@
+/*************************************************************
+Logger.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "Logger.h"
+#include "cstdio"
+
+namespace NEngine
+{
+
+namespace
+{
+
+const char* levelName(LogLevel level)
+{
+  static const char* names_[] = { "D", "I", "W", "E", "" };
+  return names_[static_cast<int>(level)];
+}
+
+} // namespace {}
+
+Logger::Logger() :
+  cells_(new Cell[Logger_Capacity]),
+  start_(NTime::now())
+{
+  static_assert((Logger_Capacity & (Logger_Capacity - 1)) == 0, "logger capacity should be power of 2");
+  for(size_t i = 0; i < Logger_Capacity; ++i)
+    cells_[i].seq_.store(i, std::memory_order_relaxed);
+  writer_ = std::thread{ [this]() { writerLoop(); } };
+}
+
+Logger::~Logger()
+{
+  stop_ = true;
+  if(writer_.joinable())
+    writer_.join();
+}
+
+void Logger::setOutput(std::ostream* os)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  os_ = os;
+}
+
+bool Logger::openLog(std::string const& fname, LogLevel level)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  log_.close();
+  log_.clear();
+  logLevel_ = LogLevel::None;
+  if(!fname.empty())
+  {
+    log_.open(fname, std::ios::out | std::ios::app);
+    if(log_)
+      logLevel_ = level;
+  }
+  updateLevel();
+  return fname.empty() || static_cast<bool>(log_);
+}
+
+bool Logger::openBinary(std::string const& fname)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  bin_.close();
+  bin_.clear();
+  if(fname.empty())
+    return true;
+  bin_.open(fname, std::ios::out | std::ios::binary);
+  if(!bin_)
+    return false;
+  LogRecord header{};
+  header.type_ = LogRecord::HeaderType;
+  header.size_ = static_cast<uint16>(sizeof(LogRecord));
+  std::memcpy(header.data_, "shallowL", 8);
+  bin_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+  return static_cast<bool>(bin_);
+}
+
+void Logger::setFormatter(uint16 type, Formatter const& formatter)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  formatters_[type] = formatter;
+}
+
+// events are needed by binary file even if they aren't logged
+void Logger::updateLevel()
+{
+  level_ = bin_.is_open() ? LogLevel::Debug : logLevel_;
+}
+
+void Logger::write(LogLevel level, std::string_view text)
+{
+  if(!enabled(level))
+    return;
+  push(LogRecord::TextType, level, 0, text.data(), text.size());
+}
+
+void Logger::output(std::string_view text)
+{
+  push(LogRecord::TextType, LogLevel::Info, LogRecord::Output, text.data(), text.size());
+}
+
+bool Logger::push(uint16 type, LogLevel level, uint8 flags, void const* data, size_t size)
+{
+  // all parts are reserved at once, so parts of different texts are never mixed and never lost separately
+  size_t n = std::max<size_t>((size + LogRecord::DataSize - 1) / LogRecord::DataSize, 1);
+  X_ASSERT(type != LogRecord::TextType && n > 1, "log record is too big");
+  if(n > Logger_Capacity)
+  {
+    n = Logger_Capacity;
+    size = n * LogRecord::DataSize;
+  }
+  bool const output = (flags & LogRecord::Output) != 0;
+  auto pos = enqueue_.load(std::memory_order_relaxed);
+  for(;;)
+  {
+    // cells are released by writer in order, so all of them are free if the last one is
+    auto const last = pos + n - 1;
+    auto seq = cells_[last & mask_].seq_.load(std::memory_order_acquire);
+    auto dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(last);
+    if(dif == 0)
+    {
+      if(enqueue_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed))
+        break;
+    }
+    else if(dif < 0)
+    {
+      // queue is full. GUI would hang without protocol output, so it waits for writer
+      if(!output)
+      {
+        dropped_++;
+        return false;
+      }
+      std::this_thread::yield();
+      pos = enqueue_.load(std::memory_order_relaxed);
+    }
+    else
+      pos = enqueue_.load(std::memory_order_relaxed);
+  }
+
+  auto const time = std::chrono::duration_cast<std::chrono::microseconds>(NTime::now() - start_).count();
+  auto const* bytes = static_cast<char const*>(data);
+  for(size_t i = 0; i < n; ++i)
+  {
+    auto& cell = cells_[(pos + i) & mask_];
+    auto& rec = cell.rec_;
+    auto const offset = i * LogRecord::DataSize;
+    auto const chunk = std::min(size - offset, LogRecord::DataSize);
+    rec.time_ = time;
+    rec.type_ = type;
+    rec.level_ = level;
+    rec.flags_ = flags | (i + 1 < n ? LogRecord::Partial : 0) | (i > 0 ? LogRecord::Continued : 0);
+    rec.size_ = static_cast<uint16>(chunk);
+    if(chunk)
+      std::memcpy(rec.data_, bytes + offset, chunk);
+    cell.seq_.store(pos + i + 1, std::memory_order_release);
+  }
+  return true;
+}
+
+void Logger::flush()
+{
+  auto const target = enqueue_.load(std::memory_order_acquire);
+  while(written_.load(std::memory_order_acquire) < target && writer_.joinable())
+    std::this_thread::sleep_for(std::chrono::milliseconds(Logger_PollPeriod_ms));
+}
+
+void Logger::writerLoop()
+{
+  while(!stop_)
+  {
+    if(!drain())
+      std::this_thread::sleep_for(std::chrono::milliseconds(Logger_PollPeriod_ms));
+  }
+  drain();
+}
+
+bool Logger::drain()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t count = 0;
+  for(;; ++count)
+  {
+    auto& cell = cells_[dequeue_ & mask_];
+    if(cell.seq_.load(std::memory_order_acquire) != dequeue_ + 1)
+      break;
+    process(cell.rec_);
+    cell.seq_.store(dequeue_ + mask_ + 1, std::memory_order_release);
+    dequeue_++;
+  }
+  if(!count)
+    return false;
+  if(os_)
+    os_->flush();
+  if(log_.is_open())
+    log_.flush();
+  written_.store(dequeue_, std::memory_order_release);
+  return true;
+}
+
+void Logger::process(LogRecord const& rec)
+{
+  bool const out = (rec.flags_ & LogRecord::Output) != 0;
+  if(rec.type_ != LogRecord::TextType && bin_.is_open())
+    bin_.write(reinterpret_cast<char const*>(&rec), sizeof(rec));
+
+  // long text is collected from several records. unfinished one is discarded if new text starts
+  if(!(rec.flags_ & LogRecord::Continued))
+    text_.clear();
+  if(rec.type_ == LogRecord::TextType)
+    text_.append(rec.data_, rec.size_);
+  else if(auto iter = formatters_.find(rec.type_); iter != formatters_.end())
+    iter->second(rec, text_);
+  if(rec.flags_ & LogRecord::Partial)
+    return;
+  if(text_.empty() && !out)
+    return;
+
+  if(out && os_)
+    *os_ << text_ << '\n';
+
+  if(log_.is_open() && (out || rec.level_ >= logLevel_))
+  {
+    char stamp[32];
+    std::snprintf(stamp, sizeof(stamp), "%10.3f %s ", rec.time_ / 1000.0, out ? ">" : levelName(rec.level_));
+    log_ << stamp << text_ << '\n';
+  }
+  text_.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+int LogStream::Buffer::overflow(int c)
+{
+  if(c != traits_type::eof())
+    line_.push_back(static_cast<char>(c));
+  return traits_type::not_eof(c);
+}
+
+std::streamsize LogStream::Buffer::xsputn(char const* s, std::streamsize n)
+{
+  line_.append(s, static_cast<size_t>(n));
+  return n;
+}
+
+int LogStream::Buffer::sync()
+{
+  std::string_view str{ line_ };
+  for(auto n = str.find('\n'); n != std::string_view::npos; n = str.find('\n'))
+  {
+    logger_.output(str.substr(0, n));
+    str.remove_prefix(n + 1);
+  }
+  line_.erase(0, line_.size() - str.size());
+  return 0;
+}
+
+LogStream::LogStream(Logger& logger) :
+  std::ostream(&buffer_),
+  buffer_(logger)
+{
+}
+
+LogStream::~LogStream()
+{
+  buffer_.pubsync();
+}
+
+} // NEngine
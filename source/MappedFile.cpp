@@ -0,0 +1,79 @@
+/*************************************************************
+MappedFile.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "MappedFile.h"
+#include "fstream"
+
+#if (defined __unix__) || (defined __APPLE__)
+#define USE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace NEngine
+{
+
+MappedFile::~MappedFile()
+{
+  clear();
+}
+
+void MappedFile::clear()
+{
+#ifdef USE_MMAP
+  if (mapped_)
+    munmap(mapped_, mappedSize_);
+#endif
+  mapped_ = nullptr;
+  mappedSize_ = 0;
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+  data_ = nullptr;
+  size_ = 0;
+  writable_ = false;
+}
+
+bool MappedFile::load(std::string const& fname, bool writable)
+{
+  clear();
+
+#ifdef USE_MMAP
+  int fd = open(fname.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void* p = writable ?
+      mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) :
+      mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      mapped_ = p;
+      mappedSize_ = st.st_size;
+    }
+  }
+  close(fd);
+  if (mapped_)
+  {
+    data_ = reinterpret_cast<uint8*>(mapped_);
+    size_ = mappedSize_;
+    writable_ = writable;
+    return true;
+  }
+#endif
+
+  std::ifstream ifs(fname, std::ios::binary);
+  if (!ifs)
+    return false;
+  buffer_.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+  writable_ = writable;
+  return size_ > 0;
+}
+
+} // NEngine
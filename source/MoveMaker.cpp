@@ -38,6 +38,8 @@ void Board::makeMove(const Move move)
   Field & ffrom = getField(move.from());
   Field & fto = getField(move.to());
 
+  undo.moved_type_ = ffrom.type();
+
   // castle
   auto castle_k = castling(color(), 0);
   auto castle_q = castling(color(), 1);
@@ -279,6 +281,7 @@ void Board::makeNullMove()
   auto& undo = lastUndo();
 
   undo.mflags_ = UndoInfo::Nullmove;
+  undo.moved_type_ = 0;
   // save general data
   undo.data_ = data_;
   // save Zobrist keys
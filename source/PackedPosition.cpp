@@ -0,0 +1,208 @@
+/*************************************************************
+PackedPosition.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "PackedPosition.h"
+#include "Board.h"
+#include "cstring"
+
+namespace NEngine
+{
+
+namespace
+{
+
+// file header is of the same size as position to keep positions aligned
+#pragma pack (push, 1)
+struct PackedHeader
+{
+  char   magic_[8]{ 's', 'h', 'a', 'l', 'l', 'o', 'w', 'P' };
+  uint32 version_{ 1 };
+  uint8  reserved_[20]{};
+};
+#pragma pack (pop)
+
+static_assert(sizeof(PackedHeader) == sizeof(PackedPosition), "invalid packed header size");
+
+bool validHeader(uint8 const* data, size_t size)
+{
+  PackedHeader const header;
+  return size >= sizeof(PackedHeader)
+    && memcmp(data, &header, sizeof(header.magic_) + sizeof(header.version_)) == 0;
+}
+
+} // namespace {}
+
+Move PackedPosition::move() const
+{
+  Move move{ true };
+  move.mask = move_;
+  return move;
+}
+
+void PackedPosition::setMove(Move const& move)
+{
+  move_ = move.mask & 0x7fff;
+}
+
+bool pack(Board const& board, PackedPosition& pos)
+{
+  pos = PackedPosition{};
+  int n = 0;
+  for (int i = 0; i < NumOfFields; ++i)
+  {
+    auto const field = board.getField(i);
+    if (!field)
+      continue;
+    if (n >= 32)
+      return false;
+    pos.occupied_ |= 1ULL << i;
+    pos.figures_[n >> 1] |= ((field.color() << 3) | field.type()) << ((n & 1) << 2);
+    n++;
+  }
+
+  if (board.color() == Figure::ColorWhite)
+    pos.flags_ |= PackedPosition::White;
+  if (board.castling_K())
+    pos.flags_ |= PackedPosition::Castle_K;
+  if (board.castling_Q())
+    pos.flags_ |= PackedPosition::Castle_Q;
+  if (board.castling_k())
+    pos.flags_ |= PackedPosition::Castle_k;
+  if (board.castling_q())
+    pos.flags_ |= PackedPosition::Castle_q;
+  if (board.enpassant() > 0)
+    pos.enpassant_ = board.enpassant();
+  pos.fifty_ = board.fiftyMovesCount();
+  return true;
+}
+
+bool unpack(PackedPosition const& pos, Board& board)
+{
+  // corrupted record. don't read figures out of it
+  if (pop_count(pos.occupied_) > 32)
+    return false;
+
+  board.clear();
+  int n = 0;
+  for (auto mask = pos.occupied_; mask; ++n)
+  {
+    int const i = clear_lsb(mask);
+    int const f = (pos.figures_[n >> 1] >> ((n & 1) << 2)) & 15;
+    auto const type = static_cast<Figure::Type>(f & 7);
+    if (type == Figure::TypeNone || type >= Figure::TypesNum)
+      return false;
+    board.addFigure(static_cast<Figure::Color>(f >> 3), type, i);
+  }
+
+  if (board.fmgr().tcount(Figure::TypeKing, Figure::ColorWhite) != 1 ||
+      board.fmgr().tcount(Figure::TypeKing, Figure::ColorBlack) != 1)
+    return false;
+
+  if (pos.flags_ & PackedPosition::White)
+    board.setColor(Figure::ColorWhite);
+  else
+  {
+    board.setColor(Figure::ColorBlack);
+    board.hashColor();
+  }
+  if (pos.flags_ & PackedPosition::Castle_K)
+    board.set_castling(Figure::ColorWhite, 0);
+  if (pos.flags_ & PackedPosition::Castle_Q)
+    board.set_castling(Figure::ColorWhite, 1);
+  if (pos.flags_ & PackedPosition::Castle_k)
+    board.set_castling(Figure::ColorBlack, 0);
+  if (pos.flags_ & PackedPosition::Castle_q)
+    board.set_castling(Figure::ColorBlack, 1);
+
+  if (pos.enpassant_)
+  {
+    // pawn has just moved through en-passant field
+    int const pawnPos = pos.enpassant_ + (board.color() ? -8 : 8);
+    if (pawnPos < 0 || pawnPos >= NumOfFields)
+      return false;
+    auto const fp = board.getField(pawnPos);
+    if (fp.type() != Figure::TypePawn || fp.color() == board.color())
+      return false;
+    board.setEnpassant(pos.enpassant_, fp.color());
+  }
+  board.setFiftyMovesCount(pos.fifty_);
+  // moves counter isn't stored
+  board.setMovesCounter(1);
+
+  return board.invalidate();
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool PackedReader::load(std::string const& fname)
+{
+  clear();
+  if (!file_.load(fname) || !validHeader(file_.data(), file_.size()))
+  {
+    clear();
+    return false;
+  }
+  positions_ = reinterpret_cast<PackedPosition const*>(file_.data() + sizeof(PackedHeader));
+  count_ = (file_.size() - sizeof(PackedHeader)) / sizeof(PackedPosition);
+  return true;
+}
+
+void PackedReader::clear()
+{
+  file_.clear();
+  positions_ = nullptr;
+  count_ = 0;
+}
+
+bool PackedReader::isPacked(std::string const& fname)
+{
+  std::ifstream ifs(fname, std::ios::binary);
+  PackedHeader header;
+  if (!ifs.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    return false;
+  return validHeader(reinterpret_cast<uint8 const*>(&header), sizeof(header));
+}
+
+//////////////////////////////////////////////////////////////////////////
+PackedWriter::~PackedWriter()
+{
+  close();
+}
+
+bool PackedWriter::open(std::string const& fname)
+{
+  close();
+  ofs_.open(fname, std::ios::binary | std::ios::trunc);
+  if (!ofs_)
+    return false;
+  PackedHeader const header;
+  ofs_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+  buffer_.reserve(PackedWriter_BufferSize);
+  count_ = 0;
+  return static_cast<bool>(ofs_);
+}
+
+void PackedWriter::write(PackedPosition const& pos)
+{
+  buffer_.push_back(pos);
+  count_++;
+  if (buffer_.size() >= (size_t)PackedWriter_BufferSize)
+    flush();
+}
+
+void PackedWriter::flush()
+{
+  if (!buffer_.empty() && ofs_.is_open())
+    ofs_.write(reinterpret_cast<char const*>(buffer_.data()), buffer_.size() * sizeof(PackedPosition));
+  buffer_.clear();
+}
+
+void PackedWriter::close()
+{
+  if (!ofs_.is_open())
+    return;
+  flush();
+  ofs_.close();
+}
+
+} // NEngine
@@ -250,7 +250,7 @@ namespace
     return { fortress ? SpecialCaseResult::ALMOST_DRAW : SpecialCaseResult::NO_RESULT, 0 };
   }
   
-  std::pair<SpecialCaseResult, ScoreType> queenAgainstRook(Board const& board, Figure::Color winnerColor)
+  std::pair<SpecialCaseResult, ScoreType> queenAgainstRook(Board const& board, Figure::Color winnerColor, EvalCoefficients const& coeff)
   {
     auto ocolor = Figure::otherColor(winnerColor);
     ScoreType score = Figure::figureWeight_[Figure::TypeQueen] - Figure::figureWeight_[Figure::TypeRook];
@@ -258,7 +258,7 @@ namespace
     Index kingL(board.kingPos(ocolor));
     auto queenW = Index{ _lsb64(board.fmgr().queen_mask(winnerColor)) };
     auto rookL = Index{ _lsb64(board.fmgr().rook_mask(ocolor)) };    
-    score -= EvalCoefficients::positionEvaluations_[0][Figure::TypeKing][kingL].eval1();
+    score -= coeff.positionEvaluations_[0][Figure::TypeKing][kingL].eval1();
     score -= distanceCounter().getDistance(kingW, kingL) * 2;
     score -= distanceCounter().getDistance(queenW, kingL) * 2;
     score += distanceCounter().getDistance(rookL, kingL) * 2;
@@ -272,14 +272,14 @@ namespace
     }
   }
   
-  std::pair<SpecialCaseResult, ScoreType> evalMatCases(Board const& board, Figure::Color winnerColor)
+  std::pair<SpecialCaseResult, ScoreType> evalMatCases(Board const& board, Figure::Color winnerColor, EvalCoefficients const& coeff)
   {
     auto loserColor = Figure::otherColor(winnerColor);
     auto kw = board.kingPos(winnerColor);
     auto kl = board.kingPos(loserColor);
-    auto score = (7 - distanceCounter().getDistance(kw, kl)) * EvalCoefficients::kingToKingDistanceMulti_;
-    score -= EvalCoefficients::positionEvaluations_[0][Figure::TypeKing][kl].eval1();
-    score += board.fmgr().weight(winnerColor).eval1() + EvalCoefficients::additionalMatBonus_;
+    auto score = (7 - distanceCounter().getDistance(kw, kl)) * coeff.kingToKingDistanceMulti_;
+    score -= coeff.positionEvaluations_[0][Figure::TypeKing][kl].eval1();
+    score += board.fmgr().weight(winnerColor).eval1() + coeff.additionalMatBonus_;
     score -= board.fiftyMovesCount();
     if (!winnerColor)
       score = -score;
@@ -287,7 +287,7 @@ namespace
   }
 
   // mat with Bishop & Knight
-  ScoreType bishopKnightMat(Board const& board, Figure::Color winnerColor)
+  ScoreType bishopKnightMat(Board const& board, Figure::Color winnerColor, EvalCoefficients const& coeff)
   {
     auto loserColor = Figure::otherColor(winnerColor);
     int kw = board.kingPos(winnerColor);
@@ -301,7 +301,7 @@ namespace
     {
       kp = Figure::mirrorIndex_[kp];
     }
-    score += EvalCoefficients::bishopKnightMat_[kp] * 2 + EvalCoefficients::additionalMatBonus_;
+    score += coeff.bishopKnightMat_[kp] * 2 + coeff.additionalMatBonus_;
     int ndist = distanceCounter().getDistance(kn, kl);
     int bdist = distanceCounter().getDistance(bp, kl);
     score -= ndist;
@@ -310,33 +310,33 @@ namespace
     return score;
   };
 
-  ScoreType evalKings(Board const& board, Figure::Color winnerColor)
+  ScoreType evalKings(Board const& board, Figure::Color winnerColor, EvalCoefficients const& coeff)
   {
     auto loserColor = Figure::otherColor(winnerColor);
     auto kw = board.kingPos(winnerColor);
     auto kl = board.kingPos(loserColor);
-    auto score = (7 - distanceCounter().getDistance(kw, kl)) * EvalCoefficients::kingToKingDistanceMulti_;
-    score -= EvalCoefficients::positionEvaluations_[0][Figure::TypeKing][kl].eval1();
+    auto score = (7 - distanceCounter().getDistance(kw, kl)) * coeff.kingToKingDistanceMulti_;
+    score -= coeff.positionEvaluations_[0][Figure::TypeKing][kl].eval1();
     score += 30;
     if (auto n_mask = board.fmgr().knight_mask(winnerColor))
     {
       auto np = _lsb64(n_mask);
-      score += (7 - distanceCounter().getDistance(kl, np)) * EvalCoefficients::figureToKingDistanceMulti_;
+      score += (7 - distanceCounter().getDistance(kl, np)) * coeff.figureToKingDistanceMulti_;
     }
     if (auto b_mask = board.fmgr().bishop_mask(winnerColor))
     {
       auto bp = _lsb64(b_mask);
-      score += (7 - distanceCounter().getDistance(kl, bp)) * EvalCoefficients::figureToKingDistanceMulti_;
+      score += (7 - distanceCounter().getDistance(kl, bp)) * coeff.figureToKingDistanceMulti_;
     }
     if (auto n_mask = board.fmgr().knight_mask(loserColor))
     {
       auto np = _lsb64(n_mask);
-      score += distanceCounter().getDistance(kl, np) * EvalCoefficients::figureToKingDistanceMulti_;
+      score += distanceCounter().getDistance(kl, np) * coeff.figureToKingDistanceMulti_;
     }
     if (auto b_mask = board.fmgr().bishop_mask(loserColor))
     {
       auto bp = _lsb64(b_mask);
-      score += distanceCounter().getDistance(kl, bp) * EvalCoefficients::figureToKingDistanceMulti_;
+      score += distanceCounter().getDistance(kl, bp) * coeff.figureToKingDistanceMulti_;
     }
     return score;
   };
@@ -427,7 +427,7 @@ namespace
     return false;
   };
 
-  ScoreType evalKings1Pawn(Board const& board, Figure::Color pawnColor)
+  ScoreType evalKings1Pawn(Board const& board, Figure::Color pawnColor, EvalCoefficients const& coeff)
   {
     Figure::Color ocolor = Figure::otherColor(pawnColor);
     Index p(_lsb64(board.fmgr().pawn_mask(pawnColor)));
@@ -437,21 +437,21 @@ namespace
     int dist_w = distanceCounter().getDistance(kw, pp);
     int dist_l = distanceCounter().getDistance(kl, pp);
     int y = pawn_colored_y_[pawnColor][p.y()];
-    ScoreType score = (7 - dist_w + dist_l) + EvalCoefficients::passerPawnSc_[y];
+    ScoreType score = (7 - dist_w + dist_l) + coeff.passerPawnSc_[y];
     auto kn_mask = board.fmgr().knight_mask(ocolor);
     for (; kn_mask;)
     {
       int n = clear_lsb(kn_mask);
-      score += distanceCounter().getDistance(n, pp) * EvalCoefficients::knightToPawnDistanceMulti_;
+      score += distanceCounter().getDistance(n, pp) * coeff.knightToPawnDistanceMulti_;
     }
     if (!pawnColor)
       score = -score;
     return score;
   }
 
-  ScoreType bishopVsPawn(Board const& board, Figure::Color pawnColor)
+  ScoreType bishopVsPawn(Board const& board, Figure::Color pawnColor, EvalCoefficients const& coeff)
   {
-    ScoreType score = evalKings1Pawn(board, pawnColor);
+    ScoreType score = evalKings1Pawn(board, pawnColor, coeff);
     if (!bishopGoToPawn(board, pawnColor, 0ULL))
     {
       if (kpkPassed(board, pawnColor))
@@ -460,9 +460,9 @@ namespace
     return (pawnColor ? 5 : -5) + score / 2;
   };
 
-  ScoreType knightVsPawn(Board const& board, Figure::Color pawnColor)
+  ScoreType knightVsPawn(Board const& board, Figure::Color pawnColor, EvalCoefficients const& coeff)
   {
-    ScoreType score = evalKings1Pawn(board, pawnColor);
+    ScoreType score = evalKings1Pawn(board, pawnColor, coeff);
     if (!knighGoToPawn(board, pawnColor, 0ULL))
     {
       if (kpkPassed(board, pawnColor))
@@ -471,7 +471,7 @@ namespace
     return (pawnColor ? 5 : -5) + score / 2;
   };
 
-  ScoreType figureVsPawns(Board const& board, Figure::Color winnerColor)
+  ScoreType figureVsPawns(Board const& board, Figure::Color winnerColor, EvalCoefficients const& coeff)
   {
     auto loserColor = Figure::otherColor(winnerColor);
     int kw = board.kingPos(winnerColor);
@@ -483,8 +483,8 @@ namespace
       Index p(clear_lsb(pmask));
       Index pp(p.x(), winnerColor * 7);
       int y = pawn_colored_y_[winnerColor][p.y()];
-      score += EvalCoefficients::passerPawnSc_[y];
-      score += (7 - distanceCounter().getDistance(kw, pp) + distanceCounter().getDistance(kl, pp)) * EvalCoefficients::kingToPawnDistanceMulti_;
+      score += coeff.passerPawnSc_[y];
+      score += (7 - distanceCounter().getDistance(kw, pp) + distanceCounter().getDistance(kl, pp)) * coeff.kingToPawnDistanceMulti_;
     }
     if (winnerColor == Figure::ColorBlack)
       score = -score;
@@ -567,176 +567,176 @@ void SpecialCasesDetector::initCases()
 {
   scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 1 },
     { Figure::TypeKnight, Figure::ColorBlack, 1 },
-    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
   scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 1 },
     { Figure::TypeKnight, Figure::ColorBlack, 1 },
-    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 1 },
     { Figure::TypeKnight, Figure::ColorWhite, 1 },
-    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
   scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 1 },
     { Figure::TypeKnight, Figure::ColorWhite, 1 },
-    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
-    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, evalKings(board, Figure::ColorWhite) };
+    return { SpecialCaseResult::SCORE, evalKings(board, Figure::ColorWhite, coeff) };
   };
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
-    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, evalKings(board, Figure::ColorWhite) };
+    return { SpecialCaseResult::SCORE, evalKings(board, Figure::ColorWhite, coeff) };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
-    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, -evalKings(board, Figure::ColorBlack) };
+    return { SpecialCaseResult::SCORE, -evalKings(board, Figure::ColorBlack, coeff) };
   };
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
-    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, -evalKings(board, Figure::ColorBlack) };
+    return { SpecialCaseResult::SCORE, -evalKings(board, Figure::ColorBlack, coeff) };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
-    { Figure::TypeKnight, Figure::ColorWhite, 2 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorWhite, 2 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
-    { Figure::TypeBishop, Figure::ColorWhite, 2 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorWhite, 2 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
-  { Figure::TypeKnight, Figure::ColorBlack, 2 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypeKnight, Figure::ColorBlack, 2 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
-  { Figure::TypeBishop, Figure::ColorBlack, 2 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypeBishop, Figure::ColorBlack, 2 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
     { Figure::TypeKnight, Figure::ColorWhite, 1 },
-    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
     { Figure::TypeKnight, Figure::ColorBlack, 1 },
-    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
     { Figure::TypeRook, Figure::ColorBlack, 1 },
-    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
     { Figure::TypeRook, Figure::ColorBlack, 1 },
-    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
     { Figure::TypeRook, Figure::ColorWhite, 1 },
-    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
     { Figure::TypeRook, Figure::ColorWhite, 1 },
-    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return bishopRooks(board, Figure::ColorWhite);
   };
 
   scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 2 },
-    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return bishopRooks(board, Figure::ColorBlack);
   };
 
   scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 2 },
-  { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorBlack, 2 },
-  { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypeBishop, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorWhite, 2 },
-    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeBishop, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorBlack, 2 },
-    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorWhite, 2 },
-    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 1 },
     { Figure::TypePawn, Figure::ColorBlack, 1 },
-    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 1 },
     { Figure::TypePawn, Figure::ColorWhite, 1 },
-    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorBlack, 1 },
     { Figure::TypePawn, Figure::ColorBlack, 1 },
-    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorWhite, 1 },
     { Figure::TypePawn, Figure::ColorWhite, 1 },
-    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
@@ -744,7 +744,7 @@ void SpecialCasesDetector::initCases()
   scases_[format({ { Figure::TypeKnight, Figure::ColorWhite, 1 },
     { Figure::TypeRook, Figure::ColorWhite, 1 },
     { Figure::TypePawn, Figure::ColorBlack, 1 },
-    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
@@ -752,7 +752,7 @@ void SpecialCasesDetector::initCases()
   scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 1 },
     { Figure::TypeRook, Figure::ColorWhite, 1 },
     { Figure::TypePawn, Figure::ColorBlack, 1 },
-    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
@@ -760,7 +760,7 @@ void SpecialCasesDetector::initCases()
   scases_[format({ { Figure::TypeKnight, Figure::ColorBlack, 1 },
     { Figure::TypeRook, Figure::ColorBlack, 1 },
     { Figure::TypePawn, Figure::ColorWhite, 1 },
-    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
@@ -768,81 +768,81 @@ void SpecialCasesDetector::initCases()
   scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 1 },
     { Figure::TypeRook, Figure::ColorBlack, 1 },
     { Figure::TypePawn, Figure::ColorWhite, 1 },
-    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::ALMOST_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 2 },
-    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::PROBABLE_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 2 },
-    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeKnight, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return { SpecialCaseResult::PROBABLE_DRAW, 0 };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorBlack, 1 },
   { Figure::TypeBishop, Figure::ColorBlack, 1 } })] =
-    [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, -bishopKnightMat(board, Figure::ColorBlack) };
+    return { SpecialCaseResult::SCORE, -bishopKnightMat(board, Figure::ColorBlack, coeff) };
   };
   scases_[format({ { Figure::TypeKnight, Figure::ColorWhite, 1 },
   { Figure::TypeBishop, Figure::ColorWhite, 1 } })] =
-    [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, +bishopKnightMat(board, Figure::ColorWhite) };
+    return { SpecialCaseResult::SCORE, +bishopKnightMat(board, Figure::ColorWhite, coeff) };
   };
 
   // figure against pawns
   scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 1 },
-  { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, bishopVsPawn(board, Figure::ColorBlack) };
+    return { SpecialCaseResult::SCORE, bishopVsPawn(board, Figure::ColorBlack, coeff) };
   };
   scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 1 },
-  { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, bishopVsPawn(board, Figure::ColorWhite) };
+    return { SpecialCaseResult::SCORE, bishopVsPawn(board, Figure::ColorWhite, coeff) };
   };
   scases_[format({ { Figure::TypeKnight, Figure::ColorWhite, 1 },
-  { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, knightVsPawn(board, Figure::ColorBlack) };
+    return { SpecialCaseResult::SCORE, knightVsPawn(board, Figure::ColorBlack, coeff) };
   };
   scases_[format({ { Figure::TypeKnight, Figure::ColorBlack, 1 },
-  { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, knightVsPawn(board, Figure::ColorWhite) };
+    return { SpecialCaseResult::SCORE, knightVsPawn(board, Figure::ColorWhite, coeff) };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorWhite, 2 },
-  { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, figureVsPawns(board, Figure::ColorBlack) };
+    return { SpecialCaseResult::SCORE, figureVsPawns(board, Figure::ColorBlack, coeff) };
   };
 
   scases_[format({ { Figure::TypeKnight, Figure::ColorBlack, 2 },
-  { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
-    return { SpecialCaseResult::SCORE, figureVsPawns(board, Figure::ColorWhite) };
+    return { SpecialCaseResult::SCORE, figureVsPawns(board, Figure::ColorWhite, coeff) };
   };
 
   // rook against 2 pawns & rook
   scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 },
   { Figure::TypePawn, Figure::ColorBlack, 2 },
-  { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+  { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return pawnsAndRook(board, Figure::ColorBlack);
   };
 
   scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 },
     { Figure::TypePawn, Figure::ColorWhite, 2 },
-    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return pawnsAndRook(board, Figure::ColorWhite);
   };
@@ -852,28 +852,28 @@ void SpecialCasesDetector::initCases()
     auto ocolor = Figure::otherColor(color);
     scases_[format({ { Figure::TypeRook, color, 1 },
     { Figure::TypePawn, color, 1 },
-    { Figure::TypeRook, ocolor, 1 } })] = [color](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    { Figure::TypeRook, ocolor, 1 } })] = [color](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return pawnAndHeavy(board, color);
     };
     // queen against pawn & queen
     scases_[format({ { Figure::TypeQueen, color, 1 },
       { Figure::TypePawn, color, 1 },
-      { Figure::TypeQueen, ocolor, 1 } })] = [color](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+      { Figure::TypeQueen, ocolor, 1 } })] = [color](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return pawnAndHeavy(board, color);
     };
     // rook against 2 pawns & rook
     scases_[format({ { Figure::TypeRook, color, 1 },
       { Figure::TypePawn, color, 2 },
-      { Figure::TypeRook, ocolor, 1 } })] = [color](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+      { Figure::TypeRook, ocolor, 1 } })] = [color](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return twoPawnsAndHeavy(board, color);
     };
     // queen against 2 pawns & queen
     scases_[format({ { Figure::TypeQueen, color, 1 },
       { Figure::TypePawn, color, 2 },
-      { Figure::TypeQueen, ocolor, 1 } })] = [color](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+      { Figure::TypeQueen, ocolor, 1 } })] = [color](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return twoPawnsAndHeavy(board, color);
     };
@@ -886,7 +886,7 @@ void SpecialCasesDetector::initCases()
       { Figure::TypeKnight, Figure::ColorBlack, 1 },
       { Figure::TypeQueen, Figure::ColorWhite, 1 },
       { Figure::TypePawn, Figure::ColorWhite, i }
-      })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+      })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return { SpecialCaseResult::ALMOST_DRAW, 0 };
     };
@@ -896,7 +896,7 @@ void SpecialCasesDetector::initCases()
       { Figure::TypeKnight, Figure::ColorWhite, 1 },
       { Figure::TypeQueen, Figure::ColorBlack, 1 },
       { Figure::TypePawn, Figure::ColorBlack, i }
-      })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+      })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return { SpecialCaseResult::ALMOST_DRAW, 0 };
     };
@@ -906,7 +906,7 @@ void SpecialCasesDetector::initCases()
       { Figure::TypeBishop, Figure::ColorBlack, 1 },
       { Figure::TypeQueen, Figure::ColorWhite, 1 },
       { Figure::TypePawn, Figure::ColorWhite, i },
-      })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+      })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return { SpecialCaseResult::ALMOST_DRAW, 0 };
     };
@@ -916,7 +916,7 @@ void SpecialCasesDetector::initCases()
       { Figure::TypeBishop, Figure::ColorWhite, 1 },
       { Figure::TypeQueen, Figure::ColorBlack, 1 },
       { Figure::TypePawn, Figure::ColorBlack, i },
-      })] = [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+      })] = [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
     {
       return { SpecialCaseResult::ALMOST_DRAW, 0 };
     };
@@ -924,12 +924,12 @@ void SpecialCasesDetector::initCases()
 
   // only 1 pawn
   scases_[format({ { Figure::TypePawn, Figure::ColorBlack, 1 } })] =
-    [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return pawnOnly(board, Figure::ColorBlack);
   };
   scases_[format({ { Figure::TypePawn, Figure::ColorWhite, 1 } })] =
-    [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+    [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
   {
     return pawnOnly(board, Figure::ColorWhite);
   };
@@ -939,14 +939,14 @@ void SpecialCasesDetector::initCases()
   {
     scases_[format({ { Figure::TypeQueen, Figure::ColorBlack, 1 },
       { Figure::TypeRook, Figure::ColorWhite, 1 },
-      { Figure::TypePawn, Figure::ColorWhite, i } })] = [](Board const& board)
+      { Figure::TypePawn, Figure::ColorWhite, i } })] = [](Board const& board, EvalCoefficients const& coeff)
     {
       return queenAgainstRookVsPawnDraw(board, Figure::ColorBlack);
     };
 
     scases_[format({ { Figure::TypeQueen, Figure::ColorWhite, 1 },
       { Figure::TypeRook, Figure::ColorBlack, 1 },
-      { Figure::TypePawn, Figure::ColorBlack, i } })] = [](Board const& board)
+      { Figure::TypePawn, Figure::ColorBlack, i } })] = [](Board const& board, EvalCoefficients const& coeff)
     {
       return queenAgainstRookVsPawnDraw(board, Figure::ColorWhite);
     };
@@ -954,43 +954,43 @@ void SpecialCasesDetector::initCases()
   
   // queen vs. rook
   scases_[format({ { Figure::TypeQueen, Figure::ColorBlack, 1 },
-    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board)
+    { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return queenAgainstRook(board, Figure::ColorBlack);
+    return queenAgainstRook(board, Figure::ColorBlack, coeff);
   };
 
   scases_[format({ { Figure::TypeQueen, Figure::ColorWhite, 1 },
-    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board)
+    { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return queenAgainstRook(board, Figure::ColorWhite);
+    return queenAgainstRook(board, Figure::ColorWhite, coeff);
   };
 
   // some obvious mat cases
-  scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return evalMatCases(board, Figure::ColorBlack);
+    return evalMatCases(board, Figure::ColorBlack, coeff);
   };
-  scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return evalMatCases(board, Figure::ColorWhite);
+    return evalMatCases(board, Figure::ColorWhite, coeff);
   };
 
-  scases_[format({ { Figure::TypeQueen, Figure::ColorBlack, 1 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeQueen, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return evalMatCases(board, Figure::ColorBlack);
+    return evalMatCases(board, Figure::ColorBlack, coeff);
   };
-  scases_[format({ { Figure::TypeQueen, Figure::ColorWhite, 1 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeQueen, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return evalMatCases(board, Figure::ColorWhite);
+    return evalMatCases(board, Figure::ColorWhite, coeff);
   };
 
-  scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 2 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 2 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return evalMatCases(board, Figure::ColorBlack);
+    return evalMatCases(board, Figure::ColorBlack, coeff);
   };
-  scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 2 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 2 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
-    return evalMatCases(board, Figure::ColorWhite);
+    return evalMatCases(board, Figure::ColorWhite, coeff);
   };
 
   // bishop and corner pawn draw
@@ -1000,13 +1000,13 @@ void SpecialCasesDetector::initCases()
     {
       scases_[format({ { Figure::TypeBishop, Figure::ColorWhite, 1 },
         { Figure::TypePawn, Figure::ColorWhite, w },
-        { Figure::TypePawn, Figure::ColorBlack, l } })] = [](Board const& board)
+        { Figure::TypePawn, Figure::ColorBlack, l } })] = [](Board const& board, EvalCoefficients const& coeff)
       {
         return bishopAndPawnsDraw(board, Figure::ColorWhite);
       };
       scases_[format({ { Figure::TypeBishop, Figure::ColorBlack, 1 },
         { Figure::TypePawn, Figure::ColorBlack, w },
-        { Figure::TypePawn, Figure::ColorWhite, l } })] = [](Board const& board)
+        { Figure::TypePawn, Figure::ColorWhite, l } })] = [](Board const& board, EvalCoefficients const& coeff)
       {
         return bishopAndPawnsDraw(board, Figure::ColorBlack);
       };
@@ -1023,7 +1023,7 @@ void SpecialCasesDetector::initCases()
         { Figure::TypeBishop, Figure::ColorBlack, 1 },
         { Figure::TypePawn, Figure::ColorWhite, pw },
         { Figure::TypePawn, Figure::ColorBlack, pb } })] =
-        [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+        [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
       {
         auto const& fmgr = board.fmgr();
         bool bw = (fmgr.bishop_mask(Figure::ColorWhite) & FiguresCounter::s_whiteMask_) != 0ULL;
@@ -1051,7 +1051,7 @@ void SpecialCasesDetector::initCases()
             { Figure::TypePawn, fc, fp },
             { Figure::TypeRook, Figure::otherColor(fc), 1 },
             { Figure::TypePawn, Figure::otherColor(fc), rp } })] =
-            [fp](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+            [fp](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
           {
             return { fp ? SpecialCaseResult::MAYBE_DRAW : SpecialCaseResult::ALMOST_DRAW, 0 };
           };
@@ -1068,7 +1068,7 @@ void SpecialCasesDetector::initCases()
           { Figure::TypePawn, fc, 1 },
           { Figure::TypeRook, Figure::otherColor(fc), 1 },
           { Figure::TypePawn, Figure::otherColor(fc), 1 } })] =
-          [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+          [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
         {
           return { SpecialCaseResult::MAYBE_DRAW, 0 };
         };
@@ -1086,7 +1086,7 @@ void SpecialCasesDetector::initCases()
           { Figure::TypePawn, wfc, 1 },
           { Figure::TypeRook, lfc, 1 },
           { lft, lfc, 1 } })] =
-          [wfc, lfc](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+          [wfc, lfc](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
         {
           auto const& fmgr = board.fmgr();
           if (fmgr.bishop_mask(wfc) && fmgr.bishop_mask(lfc)) {
@@ -1113,7 +1113,7 @@ void SpecialCasesDetector::initCases()
           { Figure::TypePawn, wfc, 1 },
           { Figure::TypeQueen, lfc, 1 },
           { lft, lfc, 1 } })] =
-          [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+          [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
         {
           return { SpecialCaseResult::PROBABLE_DRAW, 0 };
         };
@@ -1130,7 +1130,7 @@ void SpecialCasesDetector::initCases()
           { wft, wfc, 1 },
           { Figure::TypePawn, wfc, 1 },
           { lft, lfc, 1 } })] =
-          [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+          [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
         {
           return { SpecialCaseResult::LIKELY_DRAW, 0 };
         };
@@ -1139,11 +1139,11 @@ void SpecialCasesDetector::initCases()
   }
 
   // rook vs. pawn -> sometimes could be draw
-  scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 }, { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeRook, Figure::ColorBlack, 1 }, { Figure::TypePawn, Figure::ColorWhite, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
     return evalRookPawn(board, Figure::ColorBlack);
   };
-  scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 }, { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board)
+  scases_[format({ { Figure::TypeRook, Figure::ColorWhite, 1 }, { Figure::TypePawn, Figure::ColorBlack, 1 } })] = [](Board const& board, EvalCoefficients const& coeff)
   {
     return evalRookPawn(board, Figure::ColorWhite);
   };
@@ -1170,7 +1170,7 @@ void SpecialCasesDetector::initCases()
                 { Figure::TypeRook, ocolor, 1 },
                 { Figure::TypeBishop, ocolor, obishops },
                 { Figure::TypeKnight, ocolor, oknights } })] =
-                [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+                [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
               {
                 return { SpecialCaseResult::LIKELY_DRAW, 0 };
               };
@@ -1197,7 +1197,7 @@ void SpecialCasesDetector::initCases()
                 { Figure::TypeKnight, color, knights},
                 { Figure::TypeRook, ocolor, 2 },
                 { Figure::TypePawn, ocolor, opawns } })] =
-                [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+                [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
           {
             return { SpecialCaseResult::MAYBE_DRAW, 0 };
           };
@@ -1221,7 +1221,7 @@ void SpecialCasesDetector::initCases()
                 { Figure::TypeKnight, color, knights},
                 { Figure::TypePawn, color, pawns },
                 { Figure::TypeRook, ocolor, 2 } })] =
-                [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+                [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
           {
             return { SpecialCaseResult::LIKELY_DRAW, 0 };
           };
@@ -1245,7 +1245,7 @@ void SpecialCasesDetector::initCases()
                   { Figure::TypePawn, ocolor, opawns },
                   { Figure::TypeBishop, color, bishops},
                   { Figure::TypeKnight, color, knights} })] =
-                  [](Board const& board) -> std::pair<SpecialCaseResult, ScoreType>
+                  [](Board const& board, EvalCoefficients const& coeff) -> std::pair<SpecialCaseResult, ScoreType>
             {
               return { SpecialCaseResult::ALMOST_DRAW, 0 };
             };
@@ -0,0 +1,127 @@
+/*************************************************************
+TimeManager.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "TimeManager.h"
+#include "algorithm"
+#include "cstdlib"
+
+namespace NEngine
+{
+
+void TimeManager::reset()
+{
+  mode_ = None;
+  xtime_ = NTime::duration(0);
+  inc_ = NTime::duration(0);
+  movesToGo_ = 0;
+}
+
+void TimeManager::setTimePerMove(NTime::duration const& tm)
+{
+  reset();
+  if(tm <= NTime::duration(0))
+    return;
+  mode_ = TimePerMove;
+  xtime_ = tm;
+}
+
+void TimeManager::setTimeControl(NTime::duration const& xtime, NTime::duration const& inc, int movesToGo)
+{
+  reset();
+  mode_ = TimeControl;
+  // clock could already be expired. move as fast as possible
+  xtime_ = std::max(xtime, NTime::from_milliseconds(1));
+  inc_ = std::max(inc, NTime::duration(0));
+  movesToGo_ = std::max(movesToGo, 0);
+}
+
+void TimeManager::setMoveOverhead(NTime::duration const& overhead)
+{
+  overhead_ = std::max(overhead, NTime::duration(0));
+}
+
+void TimeManager::start()
+{
+  tstart_ = NTime::now();
+  best_ = Move{ true };
+  score_ = 0;
+  stable_ = 0;
+  iterations_ = 0;
+
+  if(mode_ == TimePerMove)
+  {
+    optimum_ = soft_ = hard_ = std::max(xtime_ - overhead_, xtime_ / 2);
+    return;
+  }
+
+  if(mode_ != TimeControl)
+  {
+    optimum_ = soft_ = hard_ = NTime::duration(0);
+    return;
+  }
+
+  // keep some time for the rest of moves
+  auto available = std::max(xtime_ - overhead_, xtime_ / 10);
+  int mcount = movesToGo_ > 0 ? std::min(movesToGo_, TimeManager_MovesHorizon) : TimeManager_MovesHorizon;
+  auto maximum = available * TimeManager_MaxPercent / 100;
+
+  optimum_ = std::min(available / mcount + inc_ * TimeManager_IncPercent / 100, maximum);
+  hard_ = std::min(optimum_ * TimeManager_HardPercent / 100, maximum);
+  soft_ = optimum_;
+}
+
+void TimeManager::restart()
+{
+  tstart_ = NTime::now();
+}
+
+NTime::duration TimeManager::elapsed() const
+{
+  return NTime::now() - tstart_.load();
+}
+
+bool TimeManager::hardLimitReached() const
+{
+  return limited() && elapsed() > hard_;
+}
+
+bool TimeManager::iteration(Move best, ScoreType score, double bestNodesShare)
+{
+  // exact time per move is limited by hard limit only
+  if(mode_ != TimeControl)
+    return false;
+
+  if(iterations_ > 0)
+  {
+    // best move changes
+    int stabilityPercent = TimeManager_UnstablePercent;
+    if(best == best_)
+    {
+      stable_ = std::min(stable_ + 1, TimeManager_StableMax);
+      stabilityPercent = 100 - stable_ * TimeManager_StablePercent;
+    }
+    else
+      stable_ = 0;
+
+    // score drops
+    int scorePercent = 100;
+    if(std::abs(score) < Figure::MatScore - MaxPly && std::abs(score_) < Figure::MatScore - MaxPly && score < score_)
+      scorePercent += std::min(score_ - score, TimeManager_ScoreDropMax) * TimeManager_ScoreDropPercent / 100;
+
+    // all nodes are spent on best move. there is no alternative
+    int nodesPercent = 150 - static_cast<int>(bestNodesShare * 100);
+    nodesPercent = std::max(50, std::min(nodesPercent, 150));
+
+    soft_ = std::min(optimum_ * stabilityPercent / 100 * scorePercent / 100 * nodesPercent / 100, hard_);
+  }
+
+  best_ = best;
+  score_ = score;
+  iterations_++;
+
+  // next iteration is usually longer than all previous
+  return elapsed() > soft_ * TimeManager_IterationPercent / 100;
+}
+
+} // NEngine
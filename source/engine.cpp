@@ -5,6 +5,9 @@
 #include "engine.h"
 #include "MovesGenerator.h"
 #include "Helpers.h"
+#include "thread"
+#include "chrono"
+#include "algorithm"
 
 namespace NEngine
 {
@@ -14,6 +17,7 @@ void Engine::SearchContext::reset()
   sdata_.reset();
   sres_.reset();
   eval_.reset();
+  stat_.clear();
   clearStack();
   for (auto& m : moves_) {
     m = SMove{true};
@@ -29,6 +33,20 @@ void Engine::SearchContext::clearStack()
   }
 }
 
+Engine::SearchContext::SearchContext(SearchContext const& other) :
+  board_(other.board_),
+  eval_(other.eval_),
+  plystack_(other.plystack_),
+  moves_(other.moves_),
+  sdata_(other.sdata_),
+  sres_(other.sres_),
+  lines_(other.lines_),
+  linesNum_(other.linesNum_),
+  stat_(other.stat_),
+  stop_(other.stop_.load())
+{
+}
+
 Engine::SearchContext& Engine::SearchContext::operator = (SearchContext const& other)
 {
   board_ = static_cast<Board>(other.board_);
@@ -38,7 +56,7 @@ Engine::SearchContext& Engine::SearchContext::operator = (SearchContext const& o
     moves_[i] = other.moves_[i];
   sdata_ = other.sdata_;
   sres_ = other.sres_;
-  stop_ = other.stop_;
+  stop_ = other.stop_.load();
   return *this;
 }
 
@@ -56,8 +74,9 @@ Engine::Engine()
   ev_hash_(0)
 #endif
 {
-  setThreadsNumber(N_THREADS_DEFAULT);
   initGlobals();
+  history_.reset(new SearchHistory);
+  setThreadsNumber(N_THREADS_DEFAULT);
   setMemory(HASH_SIZE_DEFAULT);
 }
 
@@ -73,6 +92,7 @@ void Engine::setMemory(int mb)
     return;
 
 #ifdef USE_HASH
+  memoryMb_ = mb;
   size_t bytesN = mb*1024*1024;
   size_t hitemSize = sizeof(NEngine::GHashTable::ItemType);
   size_t hitemsN = log2((BitMask)(bytesN)/hitemSize);
@@ -116,6 +136,9 @@ void Engine::setThreadsNumber(int n)
       , &ev_hash_
 #endif
     );
+    scontext.eval_.setCoefficients(&ecoeffs_);
+    scontext.eval_.setBitbases(bitbases_.get());
+    scontext.eval_.setLazyCalibration(lazyCalibration_);
   }
 }
 
@@ -133,7 +156,7 @@ bool Engine::fromFEN(std::string const& fen)
   if(!NEngine::fromFEN(fen, tboard))
     return false;
 
-  clear_history();
+  history_->clear();
   for (auto& sctx : scontexts_) {
     sctx.board_.clearStack();
   }
@@ -146,7 +169,7 @@ void Engine::setBoard(Board const& board)
     return;
   for (auto& sctx : scontexts_)
     sctx.stop_ = false;
-  clear_history();
+  history_->clear();
   for (auto& sctx : scontexts_) {
     sctx.board_.clearStack();
   }
@@ -165,13 +188,115 @@ void Engine::clearHash()
 #endif
 }
 
+bool Engine::loadEvalCoefficients(std::string const& fname)
+{
+  if (!ecoeffs_.load(fname))
+    return false;
+  evalChanged();
+  return true;
+}
+
+bool Engine::loadBitbases(std::string const& fname)
+{
+  // keep previous ones on error
+  std::unique_ptr<Bitbases> bitbases{ new Bitbases };
+  if (!bitbases->load(fname))
+    return false;
+  bitbases_ = std::move(bitbases);
+  for (auto& sctx : scontexts_)
+    sctx.eval_.setBitbases(bitbases_.get());
+  evalChanged();
+  return true;
+}
+
+void Engine::clearBitbases()
+{
+  if (!bitbases_)
+    return;
+  bitbases_.reset();
+  for (auto& sctx : scontexts_)
+    sctx.eval_.setBitbases(nullptr);
+  evalChanged();
+}
+
+bool Engine::setEvalCoefficient(std::string const& name, int value)
+{
+  if (!ecoeffs_.set(name, value))
+    return false;
+  evalChanged();
+  return true;
+}
+
+EvalProfile Engine::evalProfile() const
+{
+  EvalProfile profile;
+  for (auto const& sctx : scontexts_)
+    profile += sctx.eval_.profile();
+  return profile;
+}
+
+void Engine::clearEvalProfile()
+{
+  for (auto& sctx : scontexts_)
+    sctx.eval_.clearProfile();
+}
+
+ScoreType Engine::evalTrace(EvalTrace& trace)
+{
+  return scontexts_[0].eval_.trace(trace);
+}
+
+void Engine::setLazyEvalCalibration(bool on)
+{
+  lazyCalibration_ = on;
+  for (auto& sctx : scontexts_)
+    sctx.eval_.setLazyCalibration(on);
+  // scores from hash could prevent evaluation
+  evalChanged();
+}
+
+LazyEvalStat Engine::lazyEvalStat() const
+{
+  LazyEvalStat stat;
+  for (auto const& sctx : scontexts_)
+    stat += sctx.eval_.lazyStat();
+  return stat;
+}
+
+void Engine::clearLazyEvalStat()
+{
+  for (auto& sctx : scontexts_)
+    sctx.eval_.clearLazyStat();
+}
+
+bool Engine::applyLazyEvalStat(double fraction)
+{
+  auto stat = lazyEvalStat();
+  for (int stage = 0; stage < LazyEvalStat::StagesNum; ++stage)
+  {
+    if (!stat.count(stage))
+      return false;
+  }
+  for (int stage = 0; stage < LazyEvalStat::StagesNum; ++stage)
+    ecoeffs_.lazyMargins_[stage] = stat.margin(stage, fraction);
+  evalChanged();
+  return true;
+}
+
+void Engine::evalChanged()
+{
+  clearHash();
+#ifdef USE_EVAL_HASH_ALL
+  ev_hash_.clear();
+#endif
+}
+
 void Engine::reset()
 {
-  sparams_.timeAdded_ = false;
   for (auto& sctx : scontexts_) {
     sctx.reset();
   }
-  clear_history();
+  history_->clear();
 }
 
 void Engine::setCallbacks(xCallback cs)
@@ -186,7 +311,17 @@ void Engine::setAnalyzeMode(bool analyze)
 
 void Engine::setTimeLimit(NTime::duration const& tm)
 {
-  sparams_.timeLimit_ = tm;
+  tman_.setTimePerMove(tm);
+}
+
+void Engine::setTimeControl(NTime::duration const& xtime, NTime::duration const& inc, int movesToGo)
+{
+  tman_.setTimeControl(xtime, inc, movesToGo);
+}
+
+void Engine::setMoveOverhead(NTime::duration const& overhead)
+{
+  tman_.setMoveOverhead(overhead);
 }
 
 void Engine::setMaxDepth(int d)
@@ -200,6 +335,33 @@ void Engine::setScoreLimit(ScoreType score)
   sparams_.scoreLimit_ = score;
 }
 
+void Engine::setNodesLimit(int nodes)
+{
+  sparams_.nodesLimit_ = std::max(nodes, 0);
+}
+
+void Engine::setMultiPV(int n)
+{
+  if(n >= 1 && n <= MultiPV_Max)
+    sparams_.multiPV_ = n;
+}
+
+void Engine::setPonder(bool ponder)
+{
+  sparams_.ponder_ = ponder;
+}
+
+void Engine::ponderHit()
+{
+  if(!sparams_.ponder_)
+    return;
+
+  sparams_.ponder_ = false;
+
+  // time limit is counted from ponderhit
+  tman_.restart();
+}
+
 void Engine::pleaseStop(int ictx)
 {
   if (ictx != 0)
@@ -209,76 +371,45 @@ void Engine::pleaseStop(int ictx)
 
 bool Engine::checkForStop(int ictx)
 {
-  if (ictx != 0)
-    return false;
-  auto& sdata = scontexts_[ictx].sdata_;
-  if (sdata.totalNodes_ && !(sdata.totalNodes_ & TIMING_FLAG))
+  auto& sctx = scontexts_[ictx];
+  // nodes are counted in search thread to get the same tree for the same limit.
+  // limit is applied after the first iteration gave best move, so there is always move to reply
+  if(ictx == 0 && sparams_.nodesLimit_ > 0 && sctx.sres_.best_ && sctx.sdata_.totalNodes_ >= sparams_.nodesLimit_)
+    sctx.stop_ = true;
+  return sctx.stop_;
+}
+
+void Engine::inputAndTimerLoop()
+{
+  while (searching_)
   {
-    if (sparams_.timeLimit_ > NTime::duration(0))
-      testTimer(ictx);
+    std::this_thread::sleep_for(std::chrono::milliseconds(InputPollPeriod_ms));
+    if (tman_.limited() && !sparams_.ponder_)
+      testTimer(0);
     else
-      testInput(ictx);
+      testInput(0);
   }
-  return scontexts_[ictx].stop_;
 }
 
 void Engine::testTimer(int ictx)
 {
   if (ictx != 0)
     return;
-  auto& sdata = scontexts_[ictx].sdata_;
-  if(((NTime::now() - sdata.tstart_) > sparams_.timeLimit_) && !tryToAddTime())
+  auto& sctx = scontexts_[ictx];
+  if(!sctx.stop_ && tman_.hardLimitReached())
     pleaseStop(ictx);
 
   testInput(ictx);
 }
 
-bool Engine::tryToAddTime()
-{
-  if (sparams_.analyze_mode_ || !callbacks_.giveTime_) {
-    return false;
-  }
-
-  auto& sctx = scontexts_[0];
-  auto& sres = sctx.sres_;
-  auto& sdata = sctx.sdata_;
-
-  if ((sdata.best_ && (sdata.counter_ < sdata.numOfMoves_) &&
-      (sres.best_ != sdata.best_ || sres.best_ != sres.prevBest_ || sdata.scoreBest_ < sres.score_-10)) ||
-      (!sdata.best_ && (sres.best_ != sres.prevBest_)))
-  {
-    auto t_add = (callbacks_.giveTime_)();
-    if (NTime::milli_seconds<int>(t_add) > 0)
-    {
-      sparams_.timeLimit_ += t_add;
-      sparams_.timeAdded_ = true;
-      return true;
-    }
-  }
-  return false;
-}
-
 void Engine::testInput(int ictx)
 {
   if (ictx != 0)
     return;
-  auto& sdata = scontexts_[ictx].sdata_;
   if(callbacks_.queryInput_)
   {
     (callbacks_.queryInput_)();
   }
-
-  if(updateRequested_)
-  {
-    updateRequested_ = false;
-    if (callbacks_.sendStats_)
-    {
-      SearchData sdataTotal = sdata;
-      for (size_t i = 1; i < scontexts_.size(); ++i)
-        sdataTotal.nodesCount_ += scontexts_[i].sdata_.nodesCount_;
-      (callbacks_.sendStats_)(sdataTotal);
-    }
-  }
 }
 
 void Engine::assemblePV(int ictx, const Move move, bool checking, int ply)
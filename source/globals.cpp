@@ -4,6 +4,7 @@ Board.h - Copyright (C) 2016 by Dmitry Sultanov
 
 #include "globals.h"
 #include "memory"
+#include "mutex"
 #include "SpecialCases.h"
 
 namespace NEngine
@@ -60,10 +61,11 @@ std::unique_ptr<Globals> globals_;
 
 void initGlobals()
 {
-  if(!globals_)
+  static std::once_flag once;
+  std::call_once(once, []()
   {
     globals_ = std::unique_ptr<Globals>(new Globals);
-  }
+  });
 }
 
 } // NEngine
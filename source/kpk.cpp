@@ -7,146 +7,146 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
   {
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00fffffffffff300ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
     { 0x00ffffffffffc700ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff8f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff1f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff3f00ULL, 0x00ffffffffffff00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffff700ULL },
-    { 0x00ffffffff000000ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff020000ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff030b00ULL, 0x00ffffffffff7f00ULL },
-    { 0x00ffffffc0808000ULL, 0x00ffffffffc0c000ULL },{ 0x00ffffff80000000ULL, 0x00ffffffff808000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },
-    { 0x00ffffff00000200ULL, 0x00ffffffff000200ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000600ULL },{ 0x00ffffff03000200ULL, 0x00ffffffff070f00ULL },{ 0x00ffffff07030100ULL, 0x00ffffffff070f00ULL },
-    { 0x00ffffe0c0808000ULL, 0x00ffffffe0c0c000ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0808000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000400ULL },{ 0x00ffff0100000000ULL, 0x00ffffff03020400ULL },{ 0x00ffff0303000c00ULL, 0x00ffffff07030f00ULL },{ 0x00ffff0707030500ULL, 0x00ffffff0f1b1f00ULL },
-    { 0x00fff0e0c0808000ULL, 0x00fffff0e0c0c000ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000000ULL },
-    { 0x00ff010000000200ULL, 0x00ffff0100000400ULL },{ 0x00ff030100000000ULL, 0x00ffff0301020c00ULL },{ 0x00ff070303000000ULL, 0x00ffff0707030500ULL },{ 0x00ff0f0707090100ULL, 0x00ffff0f0f1f1f00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fff8f0e0c0c000ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
-    { 0x0083010000000200ULL, 0x00ff830100000600ULL },{ 0x0007030100000000ULL, 0x00ff070303020400ULL },{ 0x000f070303000200ULL, 0x00ff0f0707050b00ULL },{ 0x001f0f0707030f00ULL, 0x00ff1f0f0f0f0f00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0c0c000ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000000ULL },
-    { 0x0083010000000200ULL, 0x00c7830100000200ULL },{ 0x0007030100000400ULL, 0x008f070303040600ULL },{ 0x000f070303000000ULL, 0x001f0f0707070f00ULL },{ 0x001f0f0707010700ULL, 0x003f1f0f0f031f00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0c0d200ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0809c00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100000400ULL },{ 0x0007030100000000ULL, 0x008f070303001e00ULL },{ 0x000f070303000000ULL, 0x001f0f07070f0f00ULL },{ 0x001f0f0707030700ULL, 0x003f1f0f0f071f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff000200ULL, 0x00fffffffffff700ULL },
+    { 0x00ffffffff020600ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff060e00ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff0e0e00ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff0f0f00ULL, 0x00ffffffffff7f00ULL },
+    { 0x00ffffffc0808000ULL, 0x00ffffffffc0c000ULL },{ 0x00ffffff80000000ULL, 0x00ffffffff808000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff020200ULL },
+    { 0x00ffffff00000200ULL, 0x00ffffffff060600ULL },{ 0x00ffffff00020600ULL, 0x00ffffffff0e0e00ULL },{ 0x00ffffff03060e00ULL, 0x00ffffffff0f0f00ULL },{ 0x00ffffff070f0f00ULL, 0x00ffffffff1f1f00ULL },
+    { 0x00ffffe0c0808000ULL, 0x00ffffffe0c0c000ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0808000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000200ULL },
+    { 0x00ffff0000000200ULL, 0x00ffffff00020600ULL },{ 0x00ffff0100020600ULL, 0x00ffffff03060e00ULL },{ 0x00ffff0303060e00ULL, 0x00ffffff070f0f00ULL },{ 0x00ffff07070f0f00ULL, 0x00ffffff0f1f1f00ULL },
+    { 0x00fff0e0c0808000ULL, 0x00fffff0e0c0c000ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000200ULL },
+    { 0x00ff010000000200ULL, 0x00ffff0100020600ULL },{ 0x00ff030100020600ULL, 0x00ffff0303060e00ULL },{ 0x00ff070303060e00ULL, 0x00ffff07070f0f00ULL },{ 0x00ff0f07070f0f00ULL, 0x00ffff0f0f1f1f00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fff8f0e0c0c000ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000200ULL },
+    { 0x0083010000000200ULL, 0x00ff830100020600ULL },{ 0x0007030100020600ULL, 0x00ff070303060e00ULL },{ 0x000f070303060e00ULL, 0x00ff0f07070f0f00ULL },{ 0x001f0f07070f0f00ULL, 0x00ff1f0f0f1f1f00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0c0c000ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000200ULL },
+    { 0x0083010000000200ULL, 0x00c7830100020600ULL },{ 0x0007030100020600ULL, 0x008f070303060e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f0f00ULL },{ 0x001f0f07070f0f00ULL, 0x003f1f0f0f1f1f00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0c0fe00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c080fe00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080001e00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000001e00ULL },
+    { 0x0083010000000200ULL, 0x00c7830100021e00ULL },{ 0x0007030100020600ULL, 0x008f070303061e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f1f00ULL },{ 0x001f0f07070f0f00ULL, 0x003f1f0f0f1f1f00ULL },
   },
   {
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffffe700ULL, 0x00ffffffffffff00ULL },
     { 0x00ffffffffffc700ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff8f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff1f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff3f00ULL, 0x00ffffffffffff00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffff700ULL },
-    { 0x00ffffffff000000ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff020000ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff030900ULL, 0x00ffffffffff7f00ULL },
-    { 0x00ffffffc0808000ULL, 0x00ffffffffe0f800ULL },{ 0x00ffffff80000000ULL, 0x00ffffffff808000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff020000ULL },
-    { 0x00ffffff00000000ULL, 0x00ffffffff000600ULL },{ 0x00ffffff00000200ULL, 0x00ffffffff060600ULL },{ 0x00ffffff03000000ULL, 0x00ffffffff070f00ULL },{ 0x00ffffff07030900ULL, 0x00ffffffff071f00ULL },
-    { 0x00ffffe0c0808000ULL, 0x00ffffffe0e0e000ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0808000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01020c00ULL },{ 0x00ffff0303000400ULL, 0x00ffffff07071b00ULL },{ 0x00ffff0707030100ULL, 0x00ffffff0f071700ULL },
-    { 0x00fff0e0c0808000ULL, 0x00fffff0e0e0f000ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000200ULL },
-    { 0x00ff010000000200ULL, 0x00ffff0100000000ULL },{ 0x00ff030100020000ULL, 0x00ffff0303000e00ULL },{ 0x00ff070301000000ULL, 0x00ffff0707071f00ULL },{ 0x00ff0f0707010100ULL, 0x00ffff0f0f071f00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fff8f0e0e0e000ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
-    { 0x0083010000000200ULL, 0x00ff830100000600ULL },{ 0x0007030100000400ULL, 0x00ff070303040800ULL },{ 0x000f070303020c00ULL, 0x00ff0f07070b1b00ULL },{ 0x001f0f0707030100ULL, 0x00ff1f0f0f071700ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0f0f800ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000000ULL },
-    { 0x0083010000000200ULL, 0x00c7830100020000ULL },{ 0x0007030100000400ULL, 0x008f070301060200ULL },{ 0x000f070303000200ULL, 0x001f0f0707030b00ULL },{ 0x001f0f0707050700ULL, 0x003f1f0f0f1f0f00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0e0e800ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c080aa00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080001c00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000001200ULL },
-    { 0x0083010000000000ULL, 0x00c7830100001e00ULL },{ 0x0007030100000200ULL, 0x008f070303061200ULL },{ 0x000f070303000200ULL, 0x001f0f07070f1700ULL },{ 0x001f0f0707010100ULL, 0x003f1f0f0f0f1f00ULL },
-  },
-  {
-    { 0x00ff000000000000ULL, 0x00ffffffffffff00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff000200ULL, 0x00fffffffffff700ULL },
+    { 0x00ffffffff020600ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff060e00ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff0e1e00ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff1f1f00ULL, 0x00ffffffffff7f00ULL },
+    { 0x00ffffffc0808000ULL, 0x00fffffffff4f800ULL },{ 0x00ffffff80000000ULL, 0x00ffffffff808000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff020200ULL },
+    { 0x00ffffff00000200ULL, 0x00ffffffff060600ULL },{ 0x00ffffff00020600ULL, 0x00ffffffff0e0e00ULL },{ 0x00ffffff03060e00ULL, 0x00ffffffff1f1f00ULL },{ 0x00ffffff070f1f00ULL, 0x00ffffffff1f1f00ULL },
+    { 0x00ffffe0c0808000ULL, 0x00ffffffe0f0f800ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0808000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000200ULL },
+    { 0x00ffff0000000200ULL, 0x00ffffff00020600ULL },{ 0x00ffff0100020600ULL, 0x00ffffff03060e00ULL },{ 0x00ffff0303060e00ULL, 0x00ffffff070f1f00ULL },{ 0x00ffff07070f1f00ULL, 0x00ffffff0f1f1f00ULL },
+    { 0x00fff0e0c0808000ULL, 0x00fffff0e0f0f800ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000200ULL },
+    { 0x00ff010000000200ULL, 0x00ffff0100020600ULL },{ 0x00ff030100020600ULL, 0x00ffff0303060e00ULL },{ 0x00ff070303060e00ULL, 0x00ffff07070f1f00ULL },{ 0x00ff0f07070f1f00ULL, 0x00ffff0f0f1f1f00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fff8f0e0f0f800ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000200ULL },
+    { 0x0083010000000200ULL, 0x00ff830100020600ULL },{ 0x0007030100020600ULL, 0x00ff070303060e00ULL },{ 0x000f070303060e00ULL, 0x00ff0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x00ff1f0f0f1f1f00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0f0f800ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000200ULL },
+    { 0x0083010000000200ULL, 0x00c7830100020600ULL },{ 0x0007030100020600ULL, 0x008f070303060e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f1f00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0f0fe00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c080fe00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080007e00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000003e00ULL },
+    { 0x0083010000000200ULL, 0x00c7830100023e00ULL },{ 0x0007030100020600ULL, 0x008f070303063e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f3f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f3f00ULL },
+  },
+  {
+    { 0x00fffffffffffe00ULL, 0x00ffffffffffff00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00ffffffffffcf00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff8f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff1f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff3f00ULL, 0x00ffffffffffff00ULL },
-    { 0x00ffffffffa0c000ULL, 0x00fffffffffffe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffffff000000ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff032100ULL, 0x00ffffffffff7f00ULL },
-    { 0x00ffffffc0c08000ULL, 0x00fffffffff8f000ULL },{ 0x00ffffff80000000ULL, 0x00ffffffffc0d000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff020000ULL },
-    { 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff0e0600ULL },{ 0x00ffffff03000000ULL, 0x00ffffffff0f0f00ULL },{ 0x00ffffff07030100ULL, 0x00ffffffff0f3f00ULL },
-    { 0x00ffffe0c0e0f000ULL, 0x00fffffff0f0e400ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0c0a000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000600ULL },{ 0x00ffff0100000000ULL, 0x00ffffff03000600ULL },{ 0x00ffff0301000e00ULL, 0x00ffffff070f0300ULL },{ 0x00ffff0707010900ULL, 0x00ffffff0f0f0700ULL },
-    { 0x00fff0e0c0a0c000ULL, 0x00fffff0f0e0d400ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0c0f000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000400ULL, 0x00ffff0303020e00ULL },{ 0x00ff070303020200ULL, 0x00ffff0707070f00ULL },{ 0x00ff0f0707010100ULL, 0x00ffff0f0f0f2f00ULL },
-    { 0x00f8f0e0c080c000ULL, 0x00fff8f0f0e0e000ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0c0e000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070303020600ULL },{ 0x000f070303000600ULL, 0x00ff0f0707070b00ULL },{ 0x001f0f0707030100ULL, 0x00ff1f0f0f071f00ULL },
-    { 0x00f8f0e0c0c08000ULL, 0x00fcf8f0f0f0ec00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0e0e000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100020200ULL },{ 0x0007030100000200ULL, 0x008f070303020200ULL },{ 0x000f070303040000ULL, 0x001f0f0707030b00ULL },{ 0x001f0f0707010100ULL, 0x003f1f0f0f1f1f00ULL },
-    { 0x00f8f0e0c0c0d000ULL, 0x00fcf8f0f0e0ee00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0c0cc00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080001400ULL },{ 0x00c1800000000000ULL, 0x00e3c18000002000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100003600ULL },{ 0x0007030100000200ULL, 0x008f070303062c00ULL },{ 0x000f070301000000ULL, 0x001f0f0707031700ULL },{ 0x001f0f0707010300ULL, 0x003f1f0f0f0f3700ULL },
+    { 0x00ffffffffe8f400ULL, 0x00fffffffffffe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffffff020400ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff060e00ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff0e1e00ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff1f3f00ULL, 0x00ffffffffff7f00ULL },
+    { 0x00ffffffc0e0f000ULL, 0x00fffffffffcfc00ULL },{ 0x00ffffff80000000ULL, 0x00ffffffffe8f000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff020000ULL },
+    { 0x00ffffff00000000ULL, 0x00ffffffff060600ULL },{ 0x00ffffff00020600ULL, 0x00ffffffff0e0e00ULL },{ 0x00ffffff03060e00ULL, 0x00ffffffff1f1f00ULL },{ 0x00ffffff070f1f00ULL, 0x00ffffffff3f3f00ULL },
+    { 0x00ffffe0c0e0f000ULL, 0x00fffffff0f8fc00ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0e0f000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff00020600ULL },{ 0x00ffff0100020600ULL, 0x00ffffff03060e00ULL },{ 0x00ffff0303060e00ULL, 0x00ffffff070f1f00ULL },{ 0x00ffff07070f1f00ULL, 0x00ffffff0f1f3f00ULL },
+    { 0x00fff0e0c0e0f000ULL, 0x00fffff0f0f8fc00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0e0f000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100020600ULL },{ 0x00ff030100020600ULL, 0x00ffff0303060e00ULL },{ 0x00ff070303060e00ULL, 0x00ffff07070f1f00ULL },{ 0x00ff0f07070f1f00ULL, 0x00ffff0f0f1f3f00ULL },
+    { 0x00f8f0e0c0e0f000ULL, 0x00fff8f0f0f8fc00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0e0f000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100020600ULL },{ 0x0007030100020600ULL, 0x00ff070303060e00ULL },{ 0x000f070303060e00ULL, 0x00ff0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x00ff1f0f0f1f3f00ULL },
+    { 0x00f8f0e0c0e0f000ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0e0f000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000000ULL },
+    { 0x0083010000000000ULL, 0x00c7830100020600ULL },{ 0x0007030100020600ULL, 0x008f070303060e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f3f00ULL },
+    { 0x00f8f0e0c0e0f000ULL, 0x00fcf8f0f0f8fe00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0e0fe00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080007e00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000007e00ULL },
+    { 0x0083010000000000ULL, 0x00c7830100027e00ULL },{ 0x0007030100020600ULL, 0x008f070303067e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f7f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f7f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffff9f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff1f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff3f00ULL, 0x00ffffffffffff00ULL },
-    { 0x00ffffffffc8a000ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff004000ULL, 0x00fffffffffffd00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff0a0000ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff011100ULL, 0x00ffffffffff7f00ULL },
-    { 0x00ffffffe0e08000ULL, 0x00fffffffffcd000ULL },{ 0x00ffffff80402000ULL, 0x00ffffffffd0e800ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff004000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },
-    { 0x00ffffff00000000ULL, 0x00ffffffff000200ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff080200ULL },{ 0x00ffffff03000000ULL, 0x00ffffffff0b1700ULL },{ 0x00ffffff07030300ULL, 0x00ffffffff0f1f00ULL },
-    { 0x00ffffe0e0c0e000ULL, 0x00fffffff0e0f000ULL },{ 0x00ffffc080404000ULL, 0x00ffffffe0e0c000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80406000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff03040400ULL },{ 0x00ffff0303000200ULL, 0x00ffffff07030700ULL },{ 0x00ffff0707010300ULL, 0x00ffffff0f170700ULL },
-    { 0x00fff0e0e0c0c800ULL, 0x00fffff0f0e0d000ULL },{ 0x00ffe0c080402000ULL, 0x00ffffe0e0e0d800ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080400000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0303020a00ULL },{ 0x00ff070303020000ULL, 0x00ffff07070b0f00ULL },{ 0x00ff0f0707010100ULL, 0x00ffff0f0f0f3f00ULL },
-    { 0x00f8f0e0e0a08000ULL, 0x00fff8f0f0f0f000ULL },{ 0x00f0e0c080406000ULL, 0x00fff0e0e0a0e000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080400000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100000200ULL },{ 0x0007030100000200ULL, 0x00ff070303040200ULL },{ 0x000f070303000000ULL, 0x00ff0f0707070700ULL },{ 0x001f0f0707030300ULL, 0x00ff1f0f0f1b1700ULL },
-    { 0x00f8f0e0e0c0c000ULL, 0x00fcf8f0f0e0f400ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0e0c0e000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080404000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100000200ULL },{ 0x0007030100000000ULL, 0x008f070303020200ULL },{ 0x000f070303000000ULL, 0x001f0f07070b0700ULL },{ 0x001f0f0707010100ULL, 0x003f1f0f0f1b1f00ULL },
-    { 0x00f8f0e0e0c0c000ULL, 0x00fcf8f0f0f0f000ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0e0c0c000ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080007200ULL },{ 0x00c1800000000000ULL, 0x00e3c18000002a00ULL },
-    { 0x0083010000000000ULL, 0x00c7830100001200ULL },{ 0x0007030100000000ULL, 0x008f070303025200ULL },{ 0x000f070303020200ULL, 0x001f0f0707013300ULL },{ 0x001f0f0707030700ULL, 0x003f1f0f0f0f6700ULL },
+    { 0x00fffffffff8fc00ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff506800ULL, 0x00fffffffffffd00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff040a00ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffff0e1e00ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff1f3f00ULL, 0x00ffffffffff7f00ULL },
+    { 0x00ffffffe0f0f800ULL, 0x00fffffffffcfc00ULL },{ 0x00ffffff80406000ULL, 0x00fffffffff8f800ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff506000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },
+    { 0x00ffffff00000000ULL, 0x00ffffffff040200ULL },{ 0x00ffffff00000200ULL, 0x00ffffffff0e0e00ULL },{ 0x00ffffff03060e00ULL, 0x00ffffffff1f1f00ULL },{ 0x00ffffff070f1f00ULL, 0x00ffffffff3f3f00ULL },
+    { 0x00ffffe0e0f0f800ULL, 0x00fffffff0f8fc00ULL },{ 0x00ffffc080406000ULL, 0x00ffffffe0f0f800ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80406000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff00000200ULL },{ 0x00ffff0100000200ULL, 0x00ffffff03060e00ULL },{ 0x00ffff0303060e00ULL, 0x00ffffff070f1f00ULL },{ 0x00ffff07070f1f00ULL, 0x00ffffff0f1f3f00ULL },
+    { 0x00fff0e0e0f0f800ULL, 0x00fffff0f0f8fc00ULL },{ 0x00ffe0c080406000ULL, 0x00ffffe0e0f0f800ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080406000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100000200ULL },{ 0x00ff030100000200ULL, 0x00ffff0303060e00ULL },{ 0x00ff070303060e00ULL, 0x00ffff07070f1f00ULL },{ 0x00ff0f07070f1f00ULL, 0x00ffff0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fff8f0f0f8fc00ULL },{ 0x00f0e0c080406000ULL, 0x00fff0e0e0f0f800ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080406000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100000200ULL },{ 0x0007030100000200ULL, 0x00ff070303060e00ULL },{ 0x000f070303060e00ULL, 0x00ff0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x00ff1f0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c080406000ULL, 0x00f8f0e0e0f0f800ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080406000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000000ULL },
+    { 0x0083010000000000ULL, 0x00c7830100000200ULL },{ 0x0007030100000200ULL, 0x008f070303060e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8fe00ULL },{ 0x00f0e0c080406000ULL, 0x00f8f0e0e0f0fe00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080407e00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000007e00ULL },
+    { 0x0083010000000000ULL, 0x00c7830100007e00ULL },{ 0x0007030100000200ULL, 0x008f070303067e00ULL },{ 0x000f070303060e00ULL, 0x001f0f07070f7f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f7f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff900ULL, 0x00ffffffffffff00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffff3f00ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffff3f00ULL, 0x00ffffffffffff00ULL },
-    { 0x00ffffffff808000ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff004000ULL, 0x00fffffffffffb00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff010300ULL, 0x00ffffffffff7f00ULL },
-    { 0x00ffffffe0808000ULL, 0x00ffffffffe8f000ULL },{ 0x00ffffffc0002000ULL, 0x00ffffffffe0d000ULL },{ 0x00ffffff00004000ULL, 0x00ffffffff005000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff004000ULL },
-    { 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000200ULL },{ 0x00ffffff01000200ULL, 0x00ffffffff0f0b00ULL },{ 0x00ffffff07030100ULL, 0x00ffffffff173700ULL },
-    { 0x00ffffe0e0c0c800ULL, 0x00fffffff0f8e800ULL },{ 0x00ffffc080607000ULL, 0x00ffffffe0c0d000ULL },{ 0x00ffff8000000000ULL, 0x00ffffffc0404000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00004000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff07030b00ULL },{ 0x00ffff0707010500ULL, 0x00ffffff0f130f00ULL },
-    { 0x00fff0e0e0c0e000ULL, 0x00fffff0f0e8f400ULL },{ 0x00ffe0c0c0004000ULL, 0x00ffffe0e0f0e000ULL },{ 0x00ffc08000004000ULL, 0x00ffffc0c0400000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301020000ULL, 0x00ffff0707071700ULL },{ 0x00ff0f0707030100ULL, 0x00ffff0f0f031f00ULL },
-    { 0x00f8f0e0c080a000ULL, 0x00fff8f0f0e8fc00ULL },{ 0x00f0e0c0c0400000ULL, 0x00fff0e0e0f09800ULL },{ 0x00e0c08000004000ULL, 0x00ffe0c0c0404000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070301020000ULL },{ 0x000f070301000400ULL, 0x00ff0f07070b0b00ULL },{ 0x001f0f0707030100ULL, 0x00ff1f0f0f072f00ULL },
-    { 0x00f8f0e0e0908000ULL, 0x00fcf8f0f0e8f400ULL },{ 0x00f0e0c0c0000000ULL, 0x00f8f0e0e0e0e800ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c0c0404000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000004000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100000000ULL },{ 0x0007030100000000ULL, 0x008f070301000600ULL },{ 0x000f070301000000ULL, 0x001f0f0707031700ULL },{ 0x001f0f0707010100ULL, 0x003f1f0f0f071700ULL },
-    { 0x00f8f0e0e0c0c000ULL, 0x00fcf8f0f0e8f600ULL },{ 0x00f0e0c0c0004000ULL, 0x00f8f0e0e0c0da00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c0c0001800ULL },{ 0x00c1800000000000ULL, 0x00e3c18000004c00ULL },
-    { 0x0083010000000000ULL, 0x00c7830100006600ULL },{ 0x0007030100000000ULL, 0x008f070301006400ULL },{ 0x000f070301000200ULL, 0x001f0f07070f1b00ULL },{ 0x001f0f0707030300ULL, 0x003f1f0f0f177700ULL },
+    { 0x00fffffffff8fc00ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff707800ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff205000ULL, 0x00fffffffffffb00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff0a1600ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffff1f3f00ULL, 0x00ffffffffff7f00ULL },
+    { 0x00ffffffe0f0f800ULL, 0x00fffffffffcfc00ULL },{ 0x00ffffffc0607000ULL, 0x00fffffffff8f800ULL },{ 0x00ffffff00004000ULL, 0x00ffffffff707000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff204000ULL },
+    { 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff0a0600ULL },{ 0x00ffffff01020600ULL, 0x00ffffffff1f1f00ULL },{ 0x00ffffff070f1f00ULL, 0x00ffffffff3f3f00ULL },
+    { 0x00ffffe0e0f0f800ULL, 0x00fffffff0f8fc00ULL },{ 0x00ffffc0c0607000ULL, 0x00ffffffe0f0f800ULL },{ 0x00ffff8000004000ULL, 0x00ffffffc0607000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00004000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01020600ULL },{ 0x00ffff0301020600ULL, 0x00ffffff070f1f00ULL },{ 0x00ffff07070f1f00ULL, 0x00ffffff0f1f3f00ULL },
+    { 0x00fff0e0e0f0f800ULL, 0x00fffff0f0f8fc00ULL },{ 0x00ffe0c0c0607000ULL, 0x00ffffe0e0f0f800ULL },{ 0x00ffc08000004000ULL, 0x00ffffc0c0607000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000004000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301020600ULL },{ 0x00ff070301020600ULL, 0x00ffff07070f1f00ULL },{ 0x00ff0f07070f1f00ULL, 0x00ffff0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fff8f0f0f8fc00ULL },{ 0x00f0e0c0c0607000ULL, 0x00fff0e0e0f0f800ULL },{ 0x00e0c08000004000ULL, 0x00ffe0c0c0607000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000004000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070301020600ULL },{ 0x000f070301020600ULL, 0x00ff0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x00ff1f0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0f800ULL },{ 0x00e0c08000004000ULL, 0x00f1e0c0c0607000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000004000ULL },
+    { 0x0083010000000000ULL, 0x00c7830100000000ULL },{ 0x0007030100000000ULL, 0x008f070301020600ULL },{ 0x000f070301020600ULL, 0x001f0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8fe00ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0fe00ULL },{ 0x00e0c08000004000ULL, 0x00f1e0c0c0607e00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000007e00ULL },
+    { 0x0083010000000000ULL, 0x00c7830100007e00ULL },{ 0x0007030100000000ULL, 0x008f070301027e00ULL },{ 0x000f070301020600ULL, 0x001f0f07070f7f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f0f1f7f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff300ULL, 0x00ffffffffffff00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff000000000000ULL, 0x00ffffffffffff00ULL },
-    { 0x00ffffffff808000ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff200000ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffff700ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff010700ULL, 0x00ffffffffff7f00ULL },
-    { 0x00ffffffe0c0c000ULL, 0x00ffffffffe8dc00ULL },{ 0x00ffffffc0400000ULL, 0x00ffffffffe0d800ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff006000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff402000ULL },
-    { 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff01000000ULL, 0x00ffffffff070700ULL },{ 0x00ffffff03050300ULL, 0x00ffffffff371f00ULL },
-    { 0x00ffffe0e0c08000ULL, 0x00fffffff0e0e400ULL },{ 0x00ffffc0c0206000ULL, 0x00ffffffe0c0f000ULL },{ 0x00ffff8000400000ULL, 0x00ffffffc0005000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00404000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03030700ULL },{ 0x00ffff0703030300ULL, 0x00ffffff0f070f00ULL },
-    { 0x00fff0e0e0808000ULL, 0x00fffff0f0f0fc00ULL },{ 0x00ffe0c0c0204000ULL, 0x00ffffe0e0f0e000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc0c0002000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000404000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703070700ULL },{ 0x00ff0f0703030100ULL, 0x00ffff0f0f030f00ULL },
-    { 0x00f8f0e0e0c0c800ULL, 0x00fff8f0f0e0e800ULL },{ 0x00f0e0c0c0004000ULL, 0x00fff0e0e0e0f000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0c0006000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703030300ULL },{ 0x001f0f0703030700ULL, 0x00ff1f0f0f1f1700ULL },
-    { 0x00f8f0e0e0c0c000ULL, 0x00fcf8f0f0e8c000ULL },{ 0x00f0e0c0c0000000ULL, 0x00f8f0e0e0d0e800ULL },{ 0x00e0c08000004000ULL, 0x00f1e0c0c0404000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000002000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100000000ULL },{ 0x0007030100000000ULL, 0x008f070301000000ULL },{ 0x000f070301000000ULL, 0x001f0f0703030300ULL },{ 0x001f0f0703070300ULL, 0x003f1f0f0f071700ULL },
-    { 0x00f8f0e0c0c0a000ULL, 0x00fcf8f0f0c8f400ULL },{ 0x00f0e0c0c0000000ULL, 0x00f8f0e0e0c0dc00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c0c0007c00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000004800ULL },
-    { 0x0083010000000000ULL, 0x00c7830100004400ULL },{ 0x0007030100000000ULL, 0x008f070301006c00ULL },{ 0x000f070301000000ULL, 0x001f0f0703035b00ULL },{ 0x001f0f0703030100ULL, 0x003f1f0f0f170700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffff7f00ULL, 0x00ffffffffffff00ULL },
+    { 0x00fffffffff8fc00ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff707800ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff607000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff402000ULL, 0x00fffffffffff700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff172f00ULL, 0x00ffffffffff7f00ULL },
+    { 0x00ffffffe0f0f800ULL, 0x00fffffffffcfc00ULL },{ 0x00ffffffc0607000ULL, 0x00fffffffff8f800ULL },{ 0x00ffffff00406000ULL, 0x00ffffffff707000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff606000ULL },
+    { 0x00ffffff00000000ULL, 0x00ffffffff400000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff01000000ULL, 0x00ffffffff170f00ULL },{ 0x00ffffff03070f00ULL, 0x00ffffffff3f3f00ULL },
+    { 0x00ffffe0e0f0f800ULL, 0x00fffffff0f8fc00ULL },{ 0x00ffffc0c0607000ULL, 0x00ffffffe0f0f800ULL },{ 0x00ffff8000406000ULL, 0x00ffffffc0607000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00406000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03070f00ULL },{ 0x00ffff0703070f00ULL, 0x00ffffff0f1f3f00ULL },
+    { 0x00fff0e0e0f0f800ULL, 0x00fffff0f0f8fc00ULL },{ 0x00ffe0c0c0607000ULL, 0x00ffffe0e0f0f800ULL },{ 0x00ffc08000406000ULL, 0x00ffffc0c0607000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000406000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703070f00ULL },{ 0x00ff0f0703070f00ULL, 0x00ffff0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fff8f0f0f8fc00ULL },{ 0x00f0e0c0c0607000ULL, 0x00fff0e0e0f0f800ULL },{ 0x00e0c08000406000ULL, 0x00ffe0c0c0607000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000406000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703070f00ULL },{ 0x001f0f0703070f00ULL, 0x00ff1f0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0f800ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0c0607000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000406000ULL },
+    { 0x0083010000000000ULL, 0x00c7830100000000ULL },{ 0x0007030100000000ULL, 0x008f070301000000ULL },{ 0x000f070301000000ULL, 0x001f0f0703070f00ULL },{ 0x001f0f0703070f00ULL, 0x003f1f0f0f1f3f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8fe00ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0fe00ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0c0607e00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000407e00ULL },
+    { 0x0083010000000000ULL, 0x00c7830100007e00ULL },{ 0x0007030100000000ULL, 0x008f070301007e00ULL },{ 0x000f070301000000ULL, 0x001f0f0703077f00ULL },{ 0x001f0f0703070f00ULL, 0x003f1f0f0f1f7f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
     { 0x00ffffffffffe700ULL, 0x00ffffffffffff00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffffffc8c000ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff401000ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff400000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffff700ULL },
-    { 0x00ffffffff000000ULL, 0x00ffffffffffef00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffffe0808000ULL, 0x00ffffffffd8c800ULL },{ 0x00ffffffc0400000ULL, 0x00ffffffffd0f800ULL },{ 0x00ffffff00004000ULL, 0x00ffffffff006000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },
-    { 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff01000000ULL, 0x00ffffffff010100ULL },{ 0x00ffffff03010100ULL, 0x00ffffffff2f0700ULL },
-    { 0x00ffffe0e0c0c000ULL, 0x00fffffff0f8f800ULL },{ 0x00ffffc0c0204000ULL, 0x00ffffffe0e0e000ULL },{ 0x00ffff8000000000ULL, 0x00ffffffc0406000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00406000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03010100ULL },{ 0x00ffff0703010100ULL, 0x00ffffff070f0f00ULL },
-    { 0x00fff0e0e0d0c000ULL, 0x00fffff0f0e8f800ULL },{ 0x00ffe0c0c0005000ULL, 0x00ffffe0e0d0d000ULL },{ 0x00ffc08000004000ULL, 0x00ffffc0c0005000ULL },{ 0x00ff800000004000ULL, 0x00ffff8000000000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100004000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f07070700ULL },
-    { 0x00f8f0e0e0908000ULL, 0x00fff8f0f0f0c800ULL },{ 0x00f0e0c0c0004000ULL, 0x00fff0e0e0e0f000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0c0404000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000404000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f070f1b00ULL },
-    { 0x00f8f0e0e080d000ULL, 0x00fcf8f0f0c8d800ULL },{ 0x00f0e0c0c0001000ULL, 0x00f8f0e0e0f0e000ULL },{ 0x00e0c08000400000ULL, 0x00f1e0c0c0203000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000400000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100000000ULL },{ 0x0007030100000000ULL, 0x008f070301000000ULL },{ 0x000f070301000000ULL, 0x001f0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07070f00ULL },
-    { 0x00f8f0e0e0c08000ULL, 0x00fcf8f0f0e8c000ULL },{ 0x00f0e0c0c0004000ULL, 0x00f8f0e0e0c0f800ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c0c0006000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000406800ULL },
-    { 0x0083010000000000ULL, 0x00c7830100001000ULL },{ 0x0007030100000000ULL, 0x008f070301007800ULL },{ 0x000f070301000000ULL, 0x001f0f0703010900ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07075b00ULL },
+    { 0x00fffffffff8f800ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff707800ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff607000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff406000ULL, 0x00fffffffffff700ULL },
+    { 0x00ffffffff004000ULL, 0x00ffffffffffef00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffffe0f0f800ULL, 0x00fffffffff8f800ULL },{ 0x00ffffffc0607000ULL, 0x00fffffffff8f800ULL },{ 0x00ffffff00406000ULL, 0x00ffffffff707000ULL },{ 0x00ffffff00004000ULL, 0x00ffffffff606000ULL },
+    { 0x00ffffff00000000ULL, 0x00ffffffff404000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff01000000ULL, 0x00ffffffff010100ULL },{ 0x00ffffff03010100ULL, 0x00ffffffff2f1f00ULL },
+    { 0x00ffffe0e0f0f800ULL, 0x00fffffff0f8f800ULL },{ 0x00ffffc0c0607000ULL, 0x00ffffffe0f0f800ULL },{ 0x00ffff8000406000ULL, 0x00ffffffc0607000ULL },{ 0x00ffff0000004000ULL, 0x00ffffff00406000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff00004000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03010100ULL },{ 0x00ffff0703010100ULL, 0x00ffffff070f1f00ULL },
+    { 0x00fff0e0e0f0f800ULL, 0x00fffff0f0f8f800ULL },{ 0x00ffe0c0c0607000ULL, 0x00ffffe0e0f0f800ULL },{ 0x00ffc08000406000ULL, 0x00ffffc0c0607000ULL },{ 0x00ff800000004000ULL, 0x00ffff8000406000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100004000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f070f1f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fff8f0f0f8f800ULL },{ 0x00f0e0c0c0607000ULL, 0x00fff0e0e0f0f800ULL },{ 0x00e0c08000406000ULL, 0x00ffe0c0c0607000ULL },{ 0x00c1800000004000ULL, 0x00ffc18000406000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100004000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f070f1f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8f800ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0f800ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0c0607000ULL },{ 0x00c1800000004000ULL, 0x00e3c18000406000ULL },
+    { 0x0083010000000000ULL, 0x00c7830100004000ULL },{ 0x0007030100000000ULL, 0x008f070301000000ULL },{ 0x000f070301000000ULL, 0x001f0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f070f1f00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0fc00ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0c0607c00ULL },{ 0x00c1800000004000ULL, 0x00e3c18000407c00ULL },
+    { 0x0083010000000000ULL, 0x00c7830100007c00ULL },{ 0x0007030100000000ULL, 0x008f070301007e00ULL },{ 0x000f070301000000ULL, 0x001f0f0703017f00ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f070f7f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
     { 0x00ffffffffffc700ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffcf00ULL, 0x00ffffffffffff00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffffffc09000ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff002000ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff000000ULL, 0x00fffffffffff700ULL },
-    { 0x00ffffffff000000ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffdf00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffffe080a000ULL, 0x00fffffffff0e000ULL },{ 0x00ffffffc0600000ULL, 0x00ffffffffc0f000ULL },{ 0x00ffffff00002000ULL, 0x00ffffffff002000ULL },{ 0x00ffffff00004000ULL, 0x00ffffffff604000ULL },
-    { 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff01000000ULL, 0x00ffffffff010100ULL },{ 0x00ffffff03010100ULL, 0x00ffffffff030300ULL },
-    { 0x00ffffe0e0808000ULL, 0x00fffffff0f0e800ULL },{ 0x00ffffc080002000ULL, 0x00ffffffe0c0f000ULL },{ 0x00ffff8000004000ULL, 0x00ffffffc0006000ULL },{ 0x00ffff0000004000ULL, 0x00ffffff00404000ULL },
+    { 0x00fffffffff0f000ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffff707000ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffff607000ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffff406000ULL, 0x00fffffffffff700ULL },
+    { 0x00ffffffff004000ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffff000000ULL, 0x00ffffffffffdf00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffffe0f0f000ULL, 0x00fffffffff8f800ULL },{ 0x00ffffffc0607000ULL, 0x00fffffffff0f000ULL },{ 0x00ffffff00406000ULL, 0x00ffffffff707000ULL },{ 0x00ffffff00004000ULL, 0x00ffffffff606000ULL },
+    { 0x00ffffff00000000ULL, 0x00ffffffff404000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff000000ULL },{ 0x00ffffff01000000ULL, 0x00ffffffff010100ULL },{ 0x00ffffff03010100ULL, 0x00ffffffff030300ULL },
+    { 0x00ffffe0e0f0f000ULL, 0x00fffffff0f8f800ULL },{ 0x00ffffc0c0607000ULL, 0x00ffffffe0f0f000ULL },{ 0x00ffff8000406000ULL, 0x00ffffffc0607000ULL },{ 0x00ffff0000004000ULL, 0x00ffffff00406000ULL },
     { 0x00ffff0000000000ULL, 0x00ffffff00004000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03010100ULL },{ 0x00ffff0703010100ULL, 0x00ffffff07030300ULL },
-    { 0x00fff0e0e080e000ULL, 0x00fffff0f0f0c000ULL },{ 0x00ffe0c0c0004000ULL, 0x00ffffe0e0f0f000ULL },{ 0x00ffc08000004000ULL, 0x00ffffc080406000ULL },{ 0x00ff800000000000ULL, 0x00ffff8000004000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f07030300ULL },
-    { 0x00f8f0e0e080a000ULL, 0x00fff8f0f0e8f000ULL },{ 0x00f0e0c0c0004000ULL, 0x00fff0e0e0a0e000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0c0006000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000004000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f07030300ULL },
-    { 0x00f8f0e0e0908000ULL, 0x00fcf8f0f0f0e000ULL },{ 0x00f0e0c0c0000000ULL, 0x00f8f0e0e090e000ULL },{ 0x00e0c08000002000ULL, 0x00f1e0c080204000ULL },{ 0x00c1800000004000ULL, 0x00e3c18000404000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100000000ULL },{ 0x0007030100000000ULL, 0x008f070301000000ULL },{ 0x000f070301000000ULL, 0x001f0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07030300ULL },
-    { 0x00f8f0e0e080e000ULL, 0x00fcf8f0f0d0e000ULL },{ 0x00f0e0c0c0000000ULL, 0x00f8f0e0e0c0e000ULL },{ 0x00e0c08000400000ULL, 0x00f1e0c0c0007000ULL },{ 0x00c1800000000000ULL, 0x00e3c18000407000ULL },
-    { 0x0083010000000000ULL, 0x00c7830100004000ULL },{ 0x0007030100000000ULL, 0x008f070301002000ULL },{ 0x000f070301000000ULL, 0x001f0f0703017100ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07031300ULL },
+    { 0x00fff0e0e0f0f000ULL, 0x00fffff0f0f8f800ULL },{ 0x00ffe0c0c0607000ULL, 0x00ffffe0e0f0f000ULL },{ 0x00ffc08000406000ULL, 0x00ffffc0c0607000ULL },{ 0x00ff800000004000ULL, 0x00ffff8000406000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100004000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f07030300ULL },
+    { 0x00f8f0e0e0f0f000ULL, 0x00fff8f0f0f8f800ULL },{ 0x00f0e0c0c0607000ULL, 0x00fff0e0e0f0f000ULL },{ 0x00e0c08000406000ULL, 0x00ffe0c0c0607000ULL },{ 0x00c1800000004000ULL, 0x00ffc18000406000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100004000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f07030300ULL },
+    { 0x00f8f0e0e0f0f000ULL, 0x00fcf8f0f0f8f800ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0f000ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0c0607000ULL },{ 0x00c1800000004000ULL, 0x00e3c18000406000ULL },
+    { 0x0083010000000000ULL, 0x00c7830100004000ULL },{ 0x0007030100000000ULL, 0x008f070301000000ULL },{ 0x000f070301000000ULL, 0x001f0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07030300ULL },
+    { 0x00f8f0e0e0f0f000ULL, 0x00fcf8f0f0f8f800ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0e0f0f800ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0c0607800ULL },{ 0x00c1800000004000ULL, 0x00e3c18000407800ULL },
+    { 0x0083010000000000ULL, 0x00c7830100007800ULL },{ 0x0007030100000000ULL, 0x008f070301007800ULL },{ 0x000f070301000000ULL, 0x001f0f0703017f00ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07037f00ULL },
   },
   {
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00fffffffffff200ULL, 0x00fffffffffffe00ULL },{ 0x00ffffffffffe200ULL, 0x00fffffffffffe00ULL },
@@ -154,287 +154,287 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff020200ULL, 0x00fffffffffffa00ULL },{ 0x00ffffffff020200ULL, 0x00fffffffffff600ULL },
     { 0x00ffffffff070600ULL, 0x00ffffffffffee00ULL },{ 0x00ffffffff070e00ULL, 0x00ffffffffffde00ULL },{ 0x00ffffffff0f0e00ULL, 0x00ffffffffffbe00ULL },{ 0x00ffffffff0f0e00ULL, 0x00ffffffffff7e00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff020000ULL },{ 0x00ffffff00020200ULL, 0x00ffffffff070200ULL },
-    { 0x00ffffff02040600ULL, 0x00ffffffff070600ULL },{ 0x00ffffff06020400ULL, 0x00ffffffff0f0e00ULL },{ 0x00ffffff0f0a0e00ULL, 0x00ffffffff0f0e00ULL },{ 0x00ffffff0f0f0e00ULL, 0x00ffffffff1f1e00ULL },
-    { 0x00ffffe0c0808000ULL, 0x00ffffffe0c0c000ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0808000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000200ULL, 0x00ffffff02020200ULL },
-    { 0x00ffff0000020600ULL, 0x00ffffff06060600ULL },{ 0x00ffff0102040200ULL, 0x00ffffff0f0e0e00ULL },{ 0x00ffff03070e0e00ULL, 0x00ffffff0f0f0e00ULL },{ 0x00ffff070f070e00ULL, 0x00ffffff1f1f1e00ULL },
-    { 0x00fff0e0c0808000ULL, 0x00fffff0e0c0c200ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808600ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000200ULL },{ 0x00ff800000000200ULL, 0x00ffff8000020200ULL },
-    { 0x00ff010000020600ULL, 0x00ffff0102020600ULL },{ 0x00ff030102060400ULL, 0x00ffff03070e0e00ULL },{ 0x00ff0703070e0e00ULL, 0x00ffff070f0f0e00ULL },{ 0x00ff0f070f0f0e00ULL, 0x00ffff0f1f1f1e00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fff8f0e0c0c000ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000200ULL, 0x00ffc18000020000ULL },
-    { 0x0083010000000200ULL, 0x00ff830102060600ULL },{ 0x0007030102060600ULL, 0x00ff0703070e0e00ULL },{ 0x000f070307060a00ULL, 0x00ff0f070f0f0e00ULL },{ 0x001f0f070f0f0e00ULL, 0x00ff1f0f1f1f1e00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0c0c600ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0808e00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000400ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000e00ULL },
-    { 0x0083010000020600ULL, 0x00c7830102020600ULL },{ 0x0007030102060600ULL, 0x008f070307060e00ULL },{ 0x000f0703070e0e00ULL, 0x001f0f070f0f0e00ULL },{ 0x001f0f070f070e00ULL, 0x003f1f0f1f1f1e00ULL },
-    { 0x00f8f0e0c0808c00ULL, 0x00fcf8f0e0c0cc00ULL },{ 0x00f0e0c080000600ULL, 0x00f8f0e0c0809c00ULL },{ 0x00e0c08000000800ULL, 0x00f1e0c080001a00ULL },{ 0x00c1800000000600ULL, 0x00e3c18000020600ULL },
-    { 0x0083010000000e00ULL, 0x00c7830102060600ULL },{ 0x0007030102060c00ULL, 0x008f0703070e1e00ULL },{ 0x000f070307060e00ULL, 0x001f0f070f0f0e00ULL },{ 0x001f0f070f070e00ULL, 0x003f1f0f1f1f1e00ULL },
+    { 0x00ffffff02060600ULL, 0x00ffffffff070600ULL },{ 0x00ffffff06060600ULL, 0x00ffffffff0f0e00ULL },{ 0x00ffffff0f0e0e00ULL, 0x00ffffffff0f0e00ULL },{ 0x00ffffff0f0f0e00ULL, 0x00ffffffff1f1e00ULL },
+    { 0x00ffffe0c0808000ULL, 0x00ffffffe0c0c000ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0808000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000200ULL },{ 0x00ffff0000000200ULL, 0x00ffffff02020600ULL },
+    { 0x00ffff0000020600ULL, 0x00ffffff06060600ULL },{ 0x00ffff0102060600ULL, 0x00ffffff0f0e0e00ULL },{ 0x00ffff03070e0e00ULL, 0x00ffffff0f0f0e00ULL },{ 0x00ffff070f0f0e00ULL, 0x00ffffff1f1f1e00ULL },
+    { 0x00fff0e0c0808000ULL, 0x00fffff0e0c0fe00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c080fe00ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000200ULL },{ 0x00ff800000000200ULL, 0x00ffff8000020600ULL },
+    { 0x00ff010000020600ULL, 0x00ffff0102060600ULL },{ 0x00ff030102060600ULL, 0x00ffff03070e0e00ULL },{ 0x00ff0703070e0e00ULL, 0x00ffff070f0f0e00ULL },{ 0x00ff0f070f0f0e00ULL, 0x00ffff0f1f1f1e00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fff8f0e0c0c000ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000200ULL },{ 0x00c1800000000200ULL, 0x00ffc18000020600ULL },
+    { 0x0083010000020600ULL, 0x00ff830102060600ULL },{ 0x0007030102060600ULL, 0x00ff0703070e0e00ULL },{ 0x000f0703070e0e00ULL, 0x00ff0f070f0f0e00ULL },{ 0x001f0f070f0f0e00ULL, 0x00ff1f0f1f1f1e00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0e0c0fe00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c080fe00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000e00ULL },{ 0x00c1800000000200ULL, 0x00e3c18000020e00ULL },
+    { 0x0083010000020600ULL, 0x00c7830102060e00ULL },{ 0x0007030102060600ULL, 0x008f0703070e0e00ULL },{ 0x000f0703070e0e00ULL, 0x001f0f070f0f0e00ULL },{ 0x001f0f070f0f0e00ULL, 0x003f1f0f1f1f1e00ULL },
+    { 0x00f8f0e0c080fe00ULL, 0x00fcf8f0e0c0fe00ULL },{ 0x00f0e0c080000e00ULL, 0x00f8f0e0c080fe00ULL },{ 0x00e0c08000000e00ULL, 0x00f1e0c080001e00ULL },{ 0x00c1800000000e00ULL, 0x00e3c18000021e00ULL },
+    { 0x0083010000020e00ULL, 0x00c7830102061e00ULL },{ 0x0007030102060e00ULL, 0x008f0703070e1e00ULL },{ 0x000f0703070e0e00ULL, 0x001f0f070f0f1e00ULL },{ 0x001f0f070f0f0e00ULL, 0x003f1f0f1f1f1e00ULL },
   },
   {
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffffe500ULL, 0x00fffffffffffd00ULL },
     { 0x00ffffffffffc500ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffffff8d00ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffffff1d00ULL, 0x00fffffffffffd00ULL },{ 0x00ffffffffff3d00ULL, 0x00fffffffffffd00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff070500ULL, 0x00fffffffffff500ULL },
-    { 0x00ffffffff070500ULL, 0x00ffffffffffed00ULL },{ 0x00ffffffff0f0d00ULL, 0x00ffffffffffdd00ULL },{ 0x00ffffffff0f1500ULL, 0x00ffffffffffbd00ULL },{ 0x00ffffffff1f1d00ULL, 0x00ffffffffff7d00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff070100ULL },
-    { 0x00ffffff02060000ULL, 0x00ffffffff0f0500ULL },{ 0x00ffffff06080400ULL, 0x00ffffffff0f0d00ULL },{ 0x00ffffff0f0a0400ULL, 0x00ffffffff1f1d00ULL },{ 0x00ffffff1f1f1d00ULL, 0x00ffffffff1f1d00ULL },
+    { 0x00ffffffff070500ULL, 0x00ffffffffffed00ULL },{ 0x00ffffffff0f0d00ULL, 0x00ffffffffffdd00ULL },{ 0x00ffffffff0f1d00ULL, 0x00ffffffffffbd00ULL },{ 0x00ffffffff1f1d00ULL, 0x00ffffffffff7d00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff00020000ULL, 0x00ffffffff070100ULL },
+    { 0x00ffffff02060400ULL, 0x00ffffffff0f0500ULL },{ 0x00ffffff060e0c00ULL, 0x00ffffffff0f0d00ULL },{ 0x00ffffff0f0e0c00ULL, 0x00ffffffff1f1d00ULL },{ 0x00ffffff1f1f1d00ULL, 0x00ffffffff1f1d00ULL },
     { 0x00ffffe0c0808000ULL, 0x00fffffff4f8fc00ULL },{ 0x00ffffc080000000ULL, 0x00ffffffc0808000ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff02020400ULL },
-    { 0x00ffff0000000400ULL, 0x00ffffff06060400ULL },{ 0x00ffff0102020c00ULL, 0x00ffffff0f0e0c00ULL },{ 0x00ffff0307060c00ULL, 0x00ffffff1f171d00ULL },{ 0x00ffff070f1f1d00ULL, 0x00ffffff1f1f1d00ULL },
-    { 0x00fff0e0c0808000ULL, 0x00fffff0f0f8fc00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808c00ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080001400ULL },{ 0x00ff800000000000ULL, 0x00ffff8000000400ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0102060c00ULL },{ 0x00ff030102060c00ULL, 0x00ffff0307060c00ULL },{ 0x00ff070307060800ULL, 0x00ffff070f0f1d00ULL },{ 0x00ff0f070f0f1d00ULL, 0x00ffff0f1f1f1d00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fff8f0f0f8fc00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000020000ULL },
-    { 0x0083010000020400ULL, 0x00ff830102060c00ULL },{ 0x0007030102060c00ULL, 0x00ff0703070e0c00ULL },{ 0x000f0703070e0c00ULL, 0x00ff0f070f1f1d00ULL },{ 0x001f0f070f0f0d00ULL, 0x00ff1f0f1f1f1d00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0808c00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080000400ULL },{ 0x00c1800000000000ULL, 0x00e3c18000000c00ULL },
-    { 0x0083010000000400ULL, 0x00c7830102021c00ULL },{ 0x0007030102020c00ULL, 0x008f0703070e0c00ULL },{ 0x000f070307060400ULL, 0x001f0f070f0f1d00ULL },{ 0x001f0f070f071d00ULL, 0x003f1f0f1f1f1d00ULL },
-    { 0x00f8f0e0c0809800ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c0808c00ULL },{ 0x00e0c08000000c00ULL, 0x00f1e0c080001400ULL },{ 0x00c1800000001c00ULL, 0x00e3c18000003c00ULL },
-    { 0x0083010000001400ULL, 0x00c7830102020c00ULL },{ 0x0007030102020c00ULL, 0x008f0703070e0c00ULL },{ 0x000f0703070e1000ULL, 0x001f0f070f1f1d00ULL },{ 0x001f0f070f171d00ULL, 0x003f1f0f1f1f1d00ULL },
-  },
-  {
-    { 0x00ff000000000000ULL, 0x00fffffffffffb00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffff0000020400ULL, 0x00ffffff06060c00ULL },{ 0x00ffff0102060c00ULL, 0x00ffffff0f0e0c00ULL },{ 0x00ffff03070e0c00ULL, 0x00ffffff1f1f1d00ULL },{ 0x00ffff070f1f1d00ULL, 0x00ffffff1f1f1d00ULL },
+    { 0x00fff0e0c0808000ULL, 0x00fffff0f0f8fc00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c080fc00ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080007c00ULL },{ 0x00ff800000000000ULL, 0x00ffff8000020400ULL },
+    { 0x00ff010000020400ULL, 0x00ffff0102060c00ULL },{ 0x00ff030102060c00ULL, 0x00ffff03070e0c00ULL },{ 0x00ff0703070e0c00ULL, 0x00ffff070f1f1d00ULL },{ 0x00ff0f070f1f1d00ULL, 0x00ffff0f1f1f1d00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fff8f0f0f8fc00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000020400ULL },
+    { 0x0083010000020400ULL, 0x00ff830102060c00ULL },{ 0x0007030102060c00ULL, 0x00ff0703070e0c00ULL },{ 0x000f0703070e0c00ULL, 0x00ff0f070f1f1d00ULL },{ 0x001f0f070f1f1d00ULL, 0x00ff1f0f1f1f1d00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0c080fc00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080007c00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000021c00ULL },
+    { 0x0083010000020400ULL, 0x00c7830102061c00ULL },{ 0x0007030102060c00ULL, 0x008f0703070e1c00ULL },{ 0x000f0703070e0c00ULL, 0x001f0f070f1f1d00ULL },{ 0x001f0f070f1f1d00ULL, 0x003f1f0f1f1f1d00ULL },
+    { 0x00f8f0e0c080fc00ULL, 0x00fcf8f0f0f8fc00ULL },{ 0x00f0e0c080007c00ULL, 0x00f8f0e0c080fc00ULL },{ 0x00e0c08000001c00ULL, 0x00f1e0c080007c00ULL },{ 0x00c1800000001c00ULL, 0x00e3c18000023c00ULL },
+    { 0x0083010000021c00ULL, 0x00c7830102063c00ULL },{ 0x0007030102061c00ULL, 0x008f0703070e3c00ULL },{ 0x000f0703070e1c00ULL, 0x001f0f070f1f3d00ULL },{ 0x001f0f070f1f1d00ULL, 0x003f1f0f1f1f3d00ULL },
+  },
+  {
+    { 0x00fffffffffffa00ULL, 0x00fffffffffffb00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00ffffffffffcb00ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffffff8b00ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffffff1b00ULL, 0x00fffffffffffb00ULL },{ 0x00ffffffffff3b00ULL, 0x00fffffffffffb00ULL },
-    { 0x00fffffffffef800ULL, 0x00fffffffffffa00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffffff0f0b00ULL, 0x00ffffffffffeb00ULL },{ 0x00ffffffff0f0b00ULL, 0x00ffffffffffdb00ULL },{ 0x00ffffffff1f1b00ULL, 0x00ffffffffffbb00ULL },{ 0x00ffffffff1f1b00ULL, 0x00ffffffffff7b00ULL },
-    { 0x00ffffffe8f0f000ULL, 0x00fffffffffef800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffff02000200ULL, 0x00ffffffff0f0300ULL },{ 0x00ffffff06080a00ULL, 0x00ffffffff1f0b00ULL },{ 0x00ffffff0f0e0a00ULL, 0x00ffffffff1f1b00ULL },{ 0x00ffffff1f171b00ULL, 0x00ffffffff3f3b00ULL },
-    { 0x00ffffe0e0f0f000ULL, 0x00fffffffcfcfa00ULL },{ 0x00ffffc080000000ULL, 0x00ffffffe8f0f800ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff02000200ULL },
-    { 0x00ffff0000000200ULL, 0x00ffffff06060a00ULL },{ 0x00ffff0102020a00ULL, 0x00ffffff0f061a00ULL },{ 0x00ffff0307021a00ULL, 0x00ffffff1f0f1b00ULL },{ 0x00ffff070f071b00ULL, 0x00ffffff3f3f3b00ULL },
-    { 0x00fff0e0e0f0f800ULL, 0x00fffff0f8fcfa00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0e0e0fa00ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080000800ULL },{ 0x00ff800000000000ULL, 0x00ffff8000003a00ULL },
-    { 0x00ff010000000200ULL, 0x00ffff0102060a00ULL },{ 0x00ff030102060a00ULL, 0x00ffff0307060a00ULL },{ 0x00ff0703070e1a00ULL, 0x00ffff070f0f1b00ULL },{ 0x00ff0f070f171300ULL, 0x00ffff0f1f3f3b00ULL },
-    { 0x00f8f0e0e0f0f800ULL, 0x00fff8f0f8fcf800ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0e0f0f800ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000200ULL },
-    { 0x0083010000000200ULL, 0x00ff830102060200ULL },{ 0x0007030102000a00ULL, 0x00ff0703070e1a00ULL },{ 0x000f070307021a00ULL, 0x00ff0f070f171b00ULL },{ 0x001f0f070f0f1b00ULL, 0x00ff1f0f1f1f3b00ULL },
-    { 0x00f8f0e0e0e0f000ULL, 0x00fcf8f0f8f0fa00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0e0e0fa00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080001a00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000006a00ULL },
-    { 0x0083010000000200ULL, 0x00c7830102063a00ULL },{ 0x0007030102040200ULL, 0x008f0703070e1a00ULL },{ 0x000f0703070e0a00ULL, 0x001f0f070f1f3b00ULL },{ 0x001f0f070f070b00ULL, 0x003f1f0f1f3f2b00ULL },
-    { 0x00f8f0e0e0e0ea00ULL, 0x00fcf8f0f8fcfa00ULL },{ 0x00f0e0c080001000ULL, 0x00f8f0e0e0f0fa00ULL },{ 0x00e0c08000000800ULL, 0x00f1e0c080000800ULL },{ 0x00c1800000001a00ULL, 0x00e3c18000002a00ULL },
-    { 0x0083010000001200ULL, 0x00c7830102063a00ULL },{ 0x0007030102061a00ULL, 0x008f070307063a00ULL },{ 0x000f070307061a00ULL, 0x001f0f070f1f3b00ULL },{ 0x001f0f070f072b00ULL, 0x003f1f0f1f3f7b00ULL },
+    { 0x00fffffffffefa00ULL, 0x00fffffffffffa00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffffff0f0b00ULL, 0x00ffffffffffeb00ULL },{ 0x00ffffffff0f0b00ULL, 0x00ffffffffffdb00ULL },{ 0x00ffffffff1f1b00ULL, 0x00ffffffffffbb00ULL },{ 0x00ffffffff1f3b00ULL, 0x00ffffffffff7b00ULL },
+    { 0x00ffffffe8f4f800ULL, 0x00fffffffffef800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffff02040200ULL, 0x00ffffffff0f0300ULL },{ 0x00ffffff060e0a00ULL, 0x00ffffffff1f0b00ULL },{ 0x00ffffff0f1e1a00ULL, 0x00ffffffff1f1b00ULL },{ 0x00ffffff1f1f1b00ULL, 0x00ffffffff3f3b00ULL },
+    { 0x00ffffe0e0f0f800ULL, 0x00fffffffcfcfa00ULL },{ 0x00ffffc080000000ULL, 0x00ffffffe8f0f800ULL },{ 0x00ffff8000000000ULL, 0x00ffffff80000000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff02000200ULL },
+    { 0x00ffff0000000200ULL, 0x00ffffff06060a00ULL },{ 0x00ffff0102060a00ULL, 0x00ffffff0f0e1a00ULL },{ 0x00ffff03070e1a00ULL, 0x00ffffff1f1f1b00ULL },{ 0x00ffff070f1f1b00ULL, 0x00ffffff3f3f3b00ULL },
+    { 0x00fff0e0e0f0f800ULL, 0x00fffff0f8fcfa00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0e0f0fa00ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080007a00ULL },{ 0x00ff800000000000ULL, 0x00ffff8000007a00ULL },
+    { 0x00ff010000000200ULL, 0x00ffff0102060a00ULL },{ 0x00ff030102060a00ULL, 0x00ffff03070e1a00ULL },{ 0x00ff0703070e1a00ULL, 0x00ffff070f1f1b00ULL },{ 0x00ff0f070f1f1b00ULL, 0x00ffff0f1f3f3b00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fff8f0f8fcfa00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0e0f0f800ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c080000000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000200ULL },
+    { 0x0083010000000200ULL, 0x00ff830102060a00ULL },{ 0x0007030102060a00ULL, 0x00ff0703070e1a00ULL },{ 0x000f0703070e1a00ULL, 0x00ff0f070f1f1b00ULL },{ 0x001f0f070f1f1b00ULL, 0x00ff1f0f1f3f3b00ULL },
+    { 0x00f8f0e0e0f0f800ULL, 0x00fcf8f0f8fcfa00ULL },{ 0x00f0e0c080000000ULL, 0x00f8f0e0e0f0fa00ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c080007a00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000007a00ULL },
+    { 0x0083010000000200ULL, 0x00c7830102063a00ULL },{ 0x0007030102060a00ULL, 0x008f0703070e3a00ULL },{ 0x000f0703070e1a00ULL, 0x001f0f070f1f3b00ULL },{ 0x001f0f070f1f1b00ULL, 0x003f1f0f1f3f3b00ULL },
+    { 0x00f8f0e0e0f0fa00ULL, 0x00fcf8f0f8fcfa00ULL },{ 0x00f0e0c080007a00ULL, 0x00f8f0e0e0f0fa00ULL },{ 0x00e0c08000007a00ULL, 0x00f1e0c080007a00ULL },{ 0x00c1800000003a00ULL, 0x00e3c18000007a00ULL },
+    { 0x0083010000003a00ULL, 0x00c7830102067a00ULL },{ 0x0007030102063a00ULL, 0x008f0703070e7a00ULL },{ 0x000f0703070e3a00ULL, 0x001f0f070f1f7b00ULL },{ 0x001f0f070f1f3b00ULL, 0x003f1f0f1f3f7b00ULL },
   },
   {
     { 0x00fffffffffff400ULL, 0x00fffffffffff700ULL },{ 0x00fffffffffff400ULL, 0x00fffffffffff700ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffff9700ULL, 0x00fffffffffff700ULL },{ 0x00ffffffffff1700ULL, 0x00fffffffffff700ULL },{ 0x00ffffffffff3700ULL, 0x00fffffffffff700ULL },
     { 0x00fffffffffcf400ULL, 0x00fffffffffff600ULL },{ 0x00fffffffffcf400ULL, 0x00fffffffffff500ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff1f1700ULL, 0x00ffffffffffd700ULL },{ 0x00ffffffff1f1700ULL, 0x00ffffffffffb700ULL },{ 0x00ffffffff3f3700ULL, 0x00ffffffffff7700ULL },
-    { 0x00fffffff8e8f400ULL, 0x00fffffffffef400ULL },{ 0x00ffffffd0407000ULL, 0x00fffffffffcf000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff04020600ULL, 0x00ffffffff1f0700ULL },{ 0x00ffffff0f020600ULL, 0x00ffffffff3f1700ULL },{ 0x00ffffff1f0f3700ULL, 0x00ffffffff3f3700ULL },
-    { 0x00ffffe0f0d8f000ULL, 0x00fffffffcfcf600ULL },{ 0x00ffffc0c0607000ULL, 0x00fffffff8f8f400ULL },{ 0x00ffff8000000000ULL, 0x00ffffffd0607000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff04020600ULL },{ 0x00ffff0100000600ULL, 0x00ffffff0f0e1600ULL },{ 0x00ffff0307021600ULL, 0x00ffffff1f1f3700ULL },{ 0x00ffff070f1f0700ULL, 0x00ffffff3f3f3700ULL },
-    { 0x00fff0e0f0f8f400ULL, 0x00fffff0f8f0f400ULL },{ 0x00ffe0c0c0607000ULL, 0x00ffffe0f0f0f000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc0c0607400ULL },{ 0x00ff800000000000ULL, 0x00ffff8000001400ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100021600ULL },{ 0x00ff030100020600ULL, 0x00ffff03070e0600ULL },{ 0x00ff0703070e1600ULL, 0x00ffff070f0f3700ULL },{ 0x00ff0f070f171700ULL, 0x00ffff0f1f1f3700ULL },
-    { 0x00f8f0e0f0e8f000ULL, 0x00fff8f0f8fcf400ULL },{ 0x00f0e0c0c0405000ULL, 0x00fff0e0f0f0f400ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0c0607000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100020600ULL },{ 0x0007030100020600ULL, 0x00ff0703070e0600ULL },{ 0x000f070307021600ULL, 0x00ff0f070f1f1700ULL },{ 0x001f0f070f1f1700ULL, 0x00ff1f0f1f3f2700ULL },
-    { 0x00f8f0e0f0f0f400ULL, 0x00fcf8f0f8fcf600ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0f0f8f600ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c0c0607600ULL },{ 0x00c1800000000000ULL, 0x00e3c18000007600ULL },
-    { 0x0083010000000000ULL, 0x00c7830100023600ULL },{ 0x0007030100020600ULL, 0x008f070307063600ULL },{ 0x000f0703070e1600ULL, 0x001f0f070f1f3700ULL },{ 0x001f0f070f0f3700ULL, 0x003f1f0f1f3f3700ULL },
-    { 0x00f8f0e0f0f0f400ULL, 0x00fcf8f0f8fcf600ULL },{ 0x00f0e0c0c0605600ULL, 0x00f8f0e0f0f0f600ULL },{ 0x00e0c08000007600ULL, 0x00f1e0c0c0607600ULL },{ 0x00c1800000005200ULL, 0x00e3c18000007600ULL },
-    { 0x0083010000000200ULL, 0x00c7830100027600ULL },{ 0x0007030100005200ULL, 0x008f070307067600ULL },{ 0x000f070307067600ULL, 0x001f0f070f0f7700ULL },{ 0x001f0f070f0f2700ULL, 0x003f1f0f1f3f3700ULL },
+    { 0x00fffffff8fcf400ULL, 0x00fffffffffef400ULL },{ 0x00ffffffd0687000ULL, 0x00fffffffffcf000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff040a0600ULL, 0x00ffffffff1f0700ULL },{ 0x00ffffff0f1e1600ULL, 0x00ffffffff3f1700ULL },{ 0x00ffffff1f3f3700ULL, 0x00ffffffff3f3700ULL },
+    { 0x00ffffe0f0f8f400ULL, 0x00fffffffcfcf600ULL },{ 0x00ffffc0c0607000ULL, 0x00fffffff8f8f400ULL },{ 0x00ffff8000000000ULL, 0x00ffffffd0607000ULL },{ 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff04020600ULL },{ 0x00ffff0100020600ULL, 0x00ffffff0f0e1600ULL },{ 0x00ffff03070e1600ULL, 0x00ffffff1f1f3700ULL },{ 0x00ffff070f1f3700ULL, 0x00ffffff3f3f3700ULL },
+    { 0x00fff0e0f0f8f400ULL, 0x00fffff0f8fcf600ULL },{ 0x00ffe0c0c0607000ULL, 0x00ffffe0f0f8f400ULL },{ 0x00ffc08000000000ULL, 0x00ffffc0c0607600ULL },{ 0x00ff800000000000ULL, 0x00ffff8000007600ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100027600ULL },{ 0x00ff030100020600ULL, 0x00ffff03070e1600ULL },{ 0x00ff0703070e1600ULL, 0x00ffff070f1f3700ULL },{ 0x00ff0f070f1f3700ULL, 0x00ffff0f1f3f3700ULL },
+    { 0x00f8f0e0f0f8f400ULL, 0x00fff8f0f8fcf600ULL },{ 0x00f0e0c0c0607000ULL, 0x00fff0e0f0f8f400ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0c0607000ULL },{ 0x00c1800000000000ULL, 0x00ffc18000000000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100020600ULL },{ 0x0007030100020600ULL, 0x00ff0703070e1600ULL },{ 0x000f0703070e1600ULL, 0x00ff0f070f1f3700ULL },{ 0x001f0f070f1f3700ULL, 0x00ff1f0f1f3f3700ULL },
+    { 0x00f8f0e0f0f8f400ULL, 0x00fcf8f0f8fcf600ULL },{ 0x00f0e0c0c0607000ULL, 0x00f8f0e0f0f8f600ULL },{ 0x00e0c08000000000ULL, 0x00f1e0c0c0607600ULL },{ 0x00c1800000000000ULL, 0x00e3c18000007600ULL },
+    { 0x0083010000000000ULL, 0x00c7830100027600ULL },{ 0x0007030100020600ULL, 0x008f0703070e7600ULL },{ 0x000f0703070e1600ULL, 0x001f0f070f1f7700ULL },{ 0x001f0f070f1f3700ULL, 0x003f1f0f1f3f7700ULL },
+    { 0x00f8f0e0f0f8f600ULL, 0x00fcf8f0f8fcf600ULL },{ 0x00f0e0c0c0607600ULL, 0x00f8f0e0f0f8f600ULL },{ 0x00e0c08000007600ULL, 0x00f1e0c0c0607600ULL },{ 0x00c1800000007600ULL, 0x00e3c18000007600ULL },
+    { 0x0083010000007600ULL, 0x00c7830100027600ULL },{ 0x0007030100027600ULL, 0x008f0703070e7600ULL },{ 0x000f0703070e7600ULL, 0x001f0f070f1f7700ULL },{ 0x001f0f070f1f7700ULL, 0x003f1f0f1f3f7700ULL },
   },
   {
     { 0x00ffffffffffec00ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffffffe800ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffffffe900ULL, 0x00ffffffffffef00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffff2f00ULL, 0x00ffffffffffef00ULL },{ 0x00ffffffffff2f00ULL, 0x00ffffffffffef00ULL },
     { 0x00fffffffffcec00ULL, 0x00ffffffffffee00ULL },{ 0x00fffffffff8e800ULL, 0x00ffffffffffed00ULL },{ 0x00fffffffff8e800ULL, 0x00ffffffffffeb00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff3f2f00ULL, 0x00ffffffffffaf00ULL },{ 0x00ffffffff3f2f00ULL, 0x00ffffffffff6f00ULL },
-    { 0x00fffffff8f8ec00ULL, 0x00fffffffffcec00ULL },{ 0x00fffffff0706000ULL, 0x00fffffffffce800ULL },{ 0x00ffffff20406000ULL, 0x00fffffffff8e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff0b160e00ULL, 0x00ffffffff3f0f00ULL },{ 0x00ffffff1f072f00ULL, 0x00ffffffff7f2f00ULL },
-    { 0x00ffffe0f0f8ec00ULL, 0x00fffffffcfcec00ULL },{ 0x00ffffc0e0506000ULL, 0x00fffffff8f8ec00ULL },{ 0x00ffff8000406000ULL, 0x00fffffff0706800ULL },{ 0x00ffff0000000000ULL, 0x00ffffff20406000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff0b060e00ULL },{ 0x00ffff0303060e00ULL, 0x00ffffff1f1f0f00ULL },{ 0x00ffff070f172700ULL, 0x00ffffff3f3f6f00ULL },
-    { 0x00fff0e0f0e8ec00ULL, 0x00fffff0f8f8ec00ULL },{ 0x00ffe0c0e0606000ULL, 0x00ffffe0f0f8e800ULL },{ 0x00ffc08000004000ULL, 0x00ffffc0e0706800ULL },{ 0x00ff800000000000ULL, 0x00ffff8000406e00ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100006000ULL },{ 0x00ff030100000000ULL, 0x00ffff0303066e00ULL },{ 0x00ff070303020e00ULL, 0x00ffff070f1f2f00ULL },{ 0x00ff0f070f0f0f00ULL, 0x00ffff0f1f3f6f00ULL },
-    { 0x00f8f0e0f0e8ec00ULL, 0x00fff8f0f8fcec00ULL },{ 0x00f0e0c0e0606000ULL, 0x00fff0e0f0f8e800ULL },{ 0x00e0c08000404000ULL, 0x00ffe0c0e0706800ULL },{ 0x00c1800000000000ULL, 0x00ffc18000406000ULL },
-    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070303060e00ULL },{ 0x000f070303060e00ULL, 0x00ff0f070f1f0f00ULL },{ 0x001f0f070f1f2f00ULL, 0x00ff1f0f1f3f6f00ULL },
-    { 0x00f8f0e0f0f0ec00ULL, 0x00fcf8f0f8fcec00ULL },{ 0x00f0e0c0e0606000ULL, 0x00f8f0e0f0f8ec00ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0e0706800ULL },{ 0x00c1800000000000ULL, 0x00e3c18000406e00ULL },
-    { 0x0083010000000000ULL, 0x00c7830100006c00ULL },{ 0x0007030100000000ULL, 0x008f070303066e00ULL },{ 0x000f070303020e00ULL, 0x001f0f070f1f6f00ULL },{ 0x001f0f070f0f2700ULL, 0x003f1f0f1f3f6f00ULL },
-    { 0x00f8f0e0f0e0ec00ULL, 0x00fcf8f0f8fcee00ULL },{ 0x00f0e0c0e0606800ULL, 0x00f8f0e0f0f8ee00ULL },{ 0x00e0c08000404c00ULL, 0x00f1e0c0e0706e00ULL },{ 0x00c1800000004c00ULL, 0x00e3c18000406600ULL },
-    { 0x0083010000004c00ULL, 0x00c7830100006c00ULL },{ 0x0007030100000c00ULL, 0x008f070303062e00ULL },{ 0x000f070303062e00ULL, 0x001f0f070f1f6f00ULL },{ 0x001f0f070f1f6700ULL, 0x003f1f0f1f1f6f00ULL },
+    { 0x00fffffff8fcec00ULL, 0x00fffffffffcec00ULL },{ 0x00fffffff0786800ULL, 0x00fffffffffce800ULL },{ 0x00ffffff20506000ULL, 0x00fffffffff8e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff0b160e00ULL, 0x00ffffffff3f0f00ULL },{ 0x00ffffff1f3f2f00ULL, 0x00ffffffff7f2f00ULL },
+    { 0x00ffffe0f0f8ec00ULL, 0x00fffffffcfcec00ULL },{ 0x00ffffc0e0706800ULL, 0x00fffffff8f8ec00ULL },{ 0x00ffff8000406000ULL, 0x00fffffff0706800ULL },{ 0x00ffff0000000000ULL, 0x00ffffff20406000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff00000000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff0b060e00ULL },{ 0x00ffff0303060e00ULL, 0x00ffffff1f1f2f00ULL },{ 0x00ffff070f1f2f00ULL, 0x00ffffff3f3f6f00ULL },
+    { 0x00fff0e0f0f8ec00ULL, 0x00fffff0f8fcec00ULL },{ 0x00ffe0c0e0706800ULL, 0x00ffffe0f0f8ec00ULL },{ 0x00ffc08000406000ULL, 0x00ffffc0e0706800ULL },{ 0x00ff800000000000ULL, 0x00ffff8000406e00ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100006e00ULL },{ 0x00ff030100000000ULL, 0x00ffff0303066e00ULL },{ 0x00ff070303060e00ULL, 0x00ffff070f1f2f00ULL },{ 0x00ff0f070f1f2f00ULL, 0x00ffff0f1f3f6f00ULL },
+    { 0x00f8f0e0f0f8ec00ULL, 0x00fff8f0f8fcec00ULL },{ 0x00f0e0c0e0706800ULL, 0x00fff0e0f0f8ec00ULL },{ 0x00e0c08000406000ULL, 0x00ffe0c0e0706800ULL },{ 0x00c1800000000000ULL, 0x00ffc18000406000ULL },
+    { 0x0083010000000000ULL, 0x00ff830100000000ULL },{ 0x0007030100000000ULL, 0x00ff070303060e00ULL },{ 0x000f070303060e00ULL, 0x00ff0f070f1f2f00ULL },{ 0x001f0f070f1f2f00ULL, 0x00ff1f0f1f3f6f00ULL },
+    { 0x00f8f0e0f0f8ec00ULL, 0x00fcf8f0f8fcee00ULL },{ 0x00f0e0c0e0706800ULL, 0x00f8f0e0f0f8ee00ULL },{ 0x00e0c08000406000ULL, 0x00f1e0c0e0706e00ULL },{ 0x00c1800000000000ULL, 0x00e3c18000406e00ULL },
+    { 0x0083010000000000ULL, 0x00c7830100006e00ULL },{ 0x0007030100000000ULL, 0x008f070303066e00ULL },{ 0x000f070303060e00ULL, 0x001f0f070f1f6f00ULL },{ 0x001f0f070f1f2f00ULL, 0x003f1f0f1f3f6f00ULL },
+    { 0x00f8f0e0f0f8ee00ULL, 0x00fcf8f0f8fcee00ULL },{ 0x00f0e0c0e0706e00ULL, 0x00f8f0e0f0f8ee00ULL },{ 0x00e0c08000406e00ULL, 0x00f1e0c0e0706e00ULL },{ 0x00c1800000006e00ULL, 0x00e3c18000406e00ULL },
+    { 0x0083010000006e00ULL, 0x00c7830100006e00ULL },{ 0x0007030100006e00ULL, 0x008f070303066e00ULL },{ 0x000f070303066e00ULL, 0x001f0f070f1f6f00ULL },{ 0x001f0f070f1f6f00ULL, 0x003f1f0f1f3f6f00ULL },
   },
   {
     { 0x00ffffffffffdc00ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffffffd800ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffffffd100ULL, 0x00ffffffffffdf00ULL },{ 0x00ffffffffffd300ULL, 0x00ffffffffffdf00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff000000000000ULL, 0x00ffffffffffdf00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffffff5f00ULL, 0x00ffffffffffdf00ULL },
     { 0x00fffffffff8dc00ULL, 0x00ffffffffffde00ULL },{ 0x00fffffffff8d800ULL, 0x00ffffffffffdd00ULL },{ 0x00fffffffff0d000ULL, 0x00ffffffffffdb00ULL },{ 0x00fffffffff0d000ULL, 0x00ffffffffffd700ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff7f1f00ULL, 0x00ffffffffff5f00ULL },
-    { 0x00fffffff8f0d800ULL, 0x00fffffffffcdc00ULL },{ 0x00fffffff0705800ULL, 0x00fffffffff8d800ULL },{ 0x00ffffff60304000ULL, 0x00fffffffff8d000ULL },{ 0x00ffffff40204000ULL, 0x00fffffffff0c000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff170f0700ULL, 0x00ffffffff7f1f00ULL },
-    { 0x00ffffe0f0f0d800ULL, 0x00fffffffcfcdc00ULL },{ 0x00ffffc0e0405800ULL, 0x00fffffff8f8d800ULL },{ 0x00ffff8040605000ULL, 0x00fffffff0705800ULL },{ 0x00ffff0000004000ULL, 0x00ffffff60605000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff40004000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff170f1f00ULL },{ 0x00ffff0707071f00ULL, 0x00ffffff3f0f5f00ULL },
-    { 0x00fff0e0f0f0d800ULL, 0x00fffff0f8fcdc00ULL },{ 0x00ffe0c0e0105800ULL, 0x00ffffe0f0f8d800ULL },{ 0x00ffc08040405000ULL, 0x00ffffc0e0705800ULL },{ 0x00ff800000004000ULL, 0x00ffff8040605000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100005800ULL },{ 0x00ff030100000000ULL, 0x00ffff0301005400ULL },{ 0x00ff070301000000ULL, 0x00ffff07070f5f00ULL },{ 0x00ff0f07070f1700ULL, 0x00ffff0f1f3f5f00ULL },
-    { 0x00f8f0e0f0f8d800ULL, 0x00fff8f0f8fcdc00ULL },{ 0x00f0e0c0e0505800ULL, 0x00fff0e0f0f8d800ULL },{ 0x00e0c08040404000ULL, 0x00ffe0c0e0505800ULL },{ 0x00c1800000004000ULL, 0x00ffc18040605000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff7f5f00ULL, 0x00ffffffffff5f00ULL },
+    { 0x00fffffff8f8d800ULL, 0x00fffffffffcdc00ULL },{ 0x00fffffff0785800ULL, 0x00fffffffff8d800ULL },{ 0x00ffffff60705000ULL, 0x00fffffffff8d000ULL },{ 0x00ffffff40204000ULL, 0x00fffffffff0c000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff172f1f00ULL, 0x00ffffffff7f1f00ULL },
+    { 0x00ffffe0f0f8d800ULL, 0x00fffffffcfcdc00ULL },{ 0x00ffffc0e0705800ULL, 0x00fffffff8f8d800ULL },{ 0x00ffff8040605000ULL, 0x00fffffff0705800ULL },{ 0x00ffff0000004000ULL, 0x00ffffff60605000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff40004000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff170f1f00ULL },{ 0x00ffff07070f1f00ULL, 0x00ffffff3f3f5f00ULL },
+    { 0x00fff0e0f0f8d800ULL, 0x00fffff0f8fcdc00ULL },{ 0x00ffe0c0e0705800ULL, 0x00ffffe0f0f8d800ULL },{ 0x00ffc08040605000ULL, 0x00ffffc0e0705800ULL },{ 0x00ff800000004000ULL, 0x00ffff8040605000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100005e00ULL },{ 0x00ff030100000000ULL, 0x00ffff0301005e00ULL },{ 0x00ff070301000000ULL, 0x00ffff07070f5f00ULL },{ 0x00ff0f07070f1f00ULL, 0x00ffff0f1f3f5f00ULL },
+    { 0x00f8f0e0f0f8d800ULL, 0x00fff8f0f8fcdc00ULL },{ 0x00f0e0c0e0705800ULL, 0x00fff0e0f0f8d800ULL },{ 0x00e0c08040605000ULL, 0x00ffe0c0e0705800ULL },{ 0x00c1800000004000ULL, 0x00ffc18040605000ULL },
     { 0x0083010000000000ULL, 0x00ff830100004000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f07070f1f00ULL },{ 0x001f0f07070f1f00ULL, 0x00ff1f0f1f3f5f00ULL },
-    { 0x00f8f0e0f0f0d800ULL, 0x00fcf8f0f8fcdc00ULL },{ 0x00f0e0c0e0405800ULL, 0x00f8f0e0f0f8d800ULL },{ 0x00e0c08040405000ULL, 0x00f1e0c0e0705c00ULL },{ 0x00c1800000004000ULL, 0x00e3c18040605c00ULL },
-    { 0x0083010000000000ULL, 0x00c7830100005e00ULL },{ 0x0007030100000000ULL, 0x008f070301005c00ULL },{ 0x000f070301000000ULL, 0x001f0f07070f5f00ULL },{ 0x001f0f0707070700ULL, 0x003f1f0f1f1f5f00ULL },
-    { 0x00f8f0e0f0e8d800ULL, 0x00fcf8f0f8fcdc00ULL },{ 0x00f0e0c0e0605800ULL, 0x00f8f0e0f0f8dc00ULL },{ 0x00e0c08040605800ULL, 0x00f1e0c0e0705800ULL },{ 0x00c1800000004c00ULL, 0x00e3c18040605c00ULL },
-    { 0x0083010000005c00ULL, 0x00c7830100005800ULL },{ 0x0007030100005800ULL, 0x008f070301005800ULL },{ 0x000f070301004800ULL, 0x001f0f07070f5f00ULL },{ 0x001f0f07070f5f00ULL, 0x003f1f0f1f3f5f00ULL },
+    { 0x00f8f0e0f0f8d800ULL, 0x00fcf8f0f8fcdc00ULL },{ 0x00f0e0c0e0705800ULL, 0x00f8f0e0f0f8dc00ULL },{ 0x00e0c08040605000ULL, 0x00f1e0c0e0705c00ULL },{ 0x00c1800000004000ULL, 0x00e3c18040605c00ULL },
+    { 0x0083010000000000ULL, 0x00c7830100005e00ULL },{ 0x0007030100000000ULL, 0x008f070301005e00ULL },{ 0x000f070301000000ULL, 0x001f0f07070f5f00ULL },{ 0x001f0f07070f1f00ULL, 0x003f1f0f1f3f5f00ULL },
+    { 0x00f8f0e0f0f8dc00ULL, 0x00fcf8f0f8fcde00ULL },{ 0x00f0e0c0e0705c00ULL, 0x00f8f0e0f0f8de00ULL },{ 0x00e0c08040605c00ULL, 0x00f1e0c0e0705e00ULL },{ 0x00c1800000005c00ULL, 0x00e3c18040605e00ULL },
+    { 0x0083010000005c00ULL, 0x00c7830100005e00ULL },{ 0x0007030100005e00ULL, 0x008f070301005e00ULL },{ 0x000f070301005e00ULL, 0x001f0f07070f5f00ULL },{ 0x001f0f07070f5f00ULL, 0x003f1f0f1f3f5f00ULL },
   },
   {
     { 0x00ffffffffffbc00ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffffffb800ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffffffb100ULL, 0x00ffffffffffbf00ULL },{ 0x00ffffffffffa300ULL, 0x00ffffffffffbf00ULL },
     { 0x00ffffffffffa700ULL, 0x00ffffffffffbf00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffffffff8b800ULL, 0x00ffffffffffbe00ULL },{ 0x00fffffffff0b800ULL, 0x00ffffffffffbd00ULL },{ 0x00fffffffff0b000ULL, 0x00ffffffffffbb00ULL },{ 0x00ffffffffe0a000ULL, 0x00ffffffffffb700ULL },
     { 0x00ffffffffe0a000ULL, 0x00ffffffffffaf00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00fffffff8e8b800ULL, 0x00fffffffff8b800ULL },{ 0x00fffffff0703000ULL, 0x00fffffffff8b800ULL },{ 0x00ffffff60303000ULL, 0x00fffffffff0b000ULL },{ 0x00ffffff40200000ULL, 0x00fffffffff0a000ULL },
+    { 0x00fffffff8f8b800ULL, 0x00fffffffff8b800ULL },{ 0x00fffffff0703000ULL, 0x00fffffffff8b800ULL },{ 0x00ffffff60703000ULL, 0x00fffffffff0b000ULL },{ 0x00ffffff40602000ULL, 0x00fffffffff0a000ULL },
     { 0x00ffffff00400000ULL, 0x00ffffffffe08000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffe0f0f8b000ULL, 0x00fffffff8f8b800ULL },{ 0x00ffffc0e0703000ULL, 0x00fffffff8f8b800ULL },{ 0x00ffff8040003000ULL, 0x00fffffff0703000ULL },{ 0x00ffff0000400000ULL, 0x00ffffff60603000ULL },
-    { 0x00ffff0000000000ULL, 0x00ffffff40002000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03010100ULL },{ 0x00ffff0703010100ULL, 0x00ffffff2f1f3f00ULL },
-    { 0x00fff0e0f0f0b800ULL, 0x00fffff0f8f8b800ULL },{ 0x00ffe0c0e0503000ULL, 0x00ffffe0f0f0b800ULL },{ 0x00ffc08040403000ULL, 0x00ffffc0e0703000ULL },{ 0x00ff800000402000ULL, 0x00ffff8040602000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0100400000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301001000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703012100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f0f1f3f00ULL },
-    { 0x00f8f0e0f0f0b000ULL, 0x00fff8f0f8f8b800ULL },{ 0x00f0e0c0e0503000ULL, 0x00fff0e0f0f0b800ULL },{ 0x00e0c08040602000ULL, 0x00ffe0c0e0703000ULL },{ 0x00c1800000000000ULL, 0x00ffc18040603000ULL },
+    { 0x00ffffe0f0f8b800ULL, 0x00fffffff8f8b800ULL },{ 0x00ffffc0e0703000ULL, 0x00fffffff8f8b800ULL },{ 0x00ffff8040603000ULL, 0x00fffffff0703000ULL },{ 0x00ffff0000402000ULL, 0x00ffffff60603000ULL },
+    { 0x00ffff0000000000ULL, 0x00ffffff40402000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01000000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03010100ULL },{ 0x00ffff0703010100ULL, 0x00ffffff2f1f3f00ULL },
+    { 0x00fff0e0f0f8b800ULL, 0x00fffff0f8f8b800ULL },{ 0x00ffe0c0e0703000ULL, 0x00ffffe0f0f8b800ULL },{ 0x00ffc08040603000ULL, 0x00ffffc0e0703000ULL },{ 0x00ff800000402000ULL, 0x00ffff8040603000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0100402000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301003e00ULL },{ 0x00ff070301000000ULL, 0x00ffff0703013f00ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f0f1f3f00ULL },
+    { 0x00f8f0e0f0f8b800ULL, 0x00fff8f0f8f8b800ULL },{ 0x00f0e0c0e0703000ULL, 0x00fff0e0f0f8b800ULL },{ 0x00e0c08040603000ULL, 0x00ffe0c0e0703000ULL },{ 0x00c1800000402000ULL, 0x00ffc18040603000ULL },
     { 0x0083010000000000ULL, 0x00ff830100402000ULL },{ 0x0007030100000000ULL, 0x00ff070301000000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f0f1f3f00ULL },
-    { 0x00f8f0e0f0f8b000ULL, 0x00fcf8f0f8f8b800ULL },{ 0x00f0e0c0e0702000ULL, 0x00f8f0e0f0e8b800ULL },{ 0x00e0c08040403000ULL, 0x00f1e0c0e0703800ULL },{ 0x00c1800000402000ULL, 0x00e3c18040603800ULL },
-    { 0x0083010000000000ULL, 0x00c7830100403800ULL },{ 0x0007030100000000ULL, 0x008f070301003800ULL },{ 0x000f070301000000ULL, 0x001f0f0703013900ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f0f0f3f00ULL },
-    { 0x00f8f0e0f0f0b800ULL, 0x00fcf8f0f8f8bc00ULL },{ 0x00f0e0c0e0303000ULL, 0x00f8f0e0f0f8b800ULL },{ 0x00e0c08040403800ULL, 0x00f1e0c0e0603000ULL },{ 0x00c1800000402000ULL, 0x00e3c18040603800ULL },
-    { 0x0083010000003800ULL, 0x00c7830100403800ULL },{ 0x0007030100003000ULL, 0x008f070301003800ULL },{ 0x000f070301003800ULL, 0x001f0f0703013100ULL },{ 0x001f0f0703013100ULL, 0x003f1f0f0f1f3f00ULL },
+    { 0x00f8f0e0f0f8b800ULL, 0x00fcf8f0f8f8b800ULL },{ 0x00f0e0c0e0703000ULL, 0x00f8f0e0f0f8b800ULL },{ 0x00e0c08040603000ULL, 0x00f1e0c0e0703800ULL },{ 0x00c1800000402000ULL, 0x00e3c18040603800ULL },
+    { 0x0083010000000000ULL, 0x00c7830100403800ULL },{ 0x0007030100000000ULL, 0x008f070301003e00ULL },{ 0x000f070301000000ULL, 0x001f0f0703013f00ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f0f1f3f00ULL },
+    { 0x00f8f0e0f0f8b800ULL, 0x00fcf8f0f8f8bc00ULL },{ 0x00f0e0c0e0703800ULL, 0x00f8f0e0f0f8bc00ULL },{ 0x00e0c08040603800ULL, 0x00f1e0c0e0703c00ULL },{ 0x00c1800000403800ULL, 0x00e3c18040603c00ULL },
+    { 0x0083010000003800ULL, 0x00c7830100403c00ULL },{ 0x0007030100003800ULL, 0x008f070301003e00ULL },{ 0x000f070301003e00ULL, 0x001f0f0703013f00ULL },{ 0x001f0f0703013f00ULL, 0x003f1f0f0f1f3f00ULL },
   },
   {
     { 0x00ffffffffff7c00ULL, 0x00ffffffffff7f00ULL },{ 0x00ffffffffff7800ULL, 0x00ffffffffff7f00ULL },{ 0x00ffffffffff7100ULL, 0x00ffffffffff7f00ULL },{ 0x00ffffffffff6300ULL, 0x00ffffffffff7f00ULL },
     { 0x00ffffffffff4700ULL, 0x00ffffffffff7f00ULL },{ 0x00ffffffffff4f00ULL, 0x00ffffffffff7f00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffffffff07000ULL, 0x00ffffffffff7e00ULL },{ 0x00fffffffff07000ULL, 0x00ffffffffff7d00ULL },{ 0x00ffffffffe07000ULL, 0x00ffffffffff7b00ULL },{ 0x00ffffffffe06000ULL, 0x00ffffffffff7700ULL },
     { 0x00ffffffff404000ULL, 0x00ffffffffff6f00ULL },{ 0x00ffffffff404000ULL, 0x00ffffffffff5f00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00fffffff0f07000ULL, 0x00fffffffff87000ULL },{ 0x00fffffff0507000ULL, 0x00fffffffff07000ULL },{ 0x00ffffff60606000ULL, 0x00fffffffff07000ULL },{ 0x00ffffff40204000ULL, 0x00ffffffffe06000ULL },
-    { 0x00ffffff00004000ULL, 0x00ffffffffe04000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff400000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffe0f0f07000ULL, 0x00fffffff8f87800ULL },{ 0x00ffffc0e0704000ULL, 0x00fffffff0f07000ULL },{ 0x00ffff8040406000ULL, 0x00fffffff0707000ULL },{ 0x00ffff0000006000ULL, 0x00ffffff60606000ULL },
+    { 0x00fffffff0f07000ULL, 0x00fffffffff87800ULL },{ 0x00fffffff0707000ULL, 0x00fffffffff07000ULL },{ 0x00ffffff60606000ULL, 0x00fffffffff07000ULL },{ 0x00ffffff40606000ULL, 0x00ffffffffe06000ULL },
+    { 0x00ffffff00404000ULL, 0x00ffffffffe04000ULL },{ 0x00ffffff00000000ULL, 0x00ffffffff400000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffe0f0f07000ULL, 0x00fffffff8f87800ULL },{ 0x00ffffc0e0707000ULL, 0x00fffffff0f07000ULL },{ 0x00ffff8040606000ULL, 0x00fffffff0707000ULL },{ 0x00ffff0000406000ULL, 0x00ffffff60606000ULL },
     { 0x00ffff0000004000ULL, 0x00ffffff40406000ULL },{ 0x00ffff0100000000ULL, 0x00ffffff01004000ULL },{ 0x00ffff0301000000ULL, 0x00ffffff03010100ULL },{ 0x00ffff0703010100ULL, 0x00ffffff07030300ULL },
-    { 0x00fff0e0f0f07000ULL, 0x00fffff0f8f87800ULL },{ 0x00ffe0c0e0406000ULL, 0x00ffffe0f0f07000ULL },{ 0x00ffc08040606000ULL, 0x00ffffc0e0707000ULL },{ 0x00ff800000406000ULL, 0x00ffff8040606000ULL },
-    { 0x00ff010000004000ULL, 0x00ffff0100404000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301004000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703014100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f07036300ULL },
-    { 0x00f8f0e0f0f07000ULL, 0x00fff8f0f8f87800ULL },{ 0x00f0e0c0e0606000ULL, 0x00fff0e0f0f07000ULL },{ 0x00e0c08040006000ULL, 0x00ffe0c0e0407000ULL },{ 0x00c1800000004000ULL, 0x00ffc18040606000ULL },
-    { 0x0083010000004000ULL, 0x00ff830100404000ULL },{ 0x0007030100000000ULL, 0x00ff070301004000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f07030300ULL },
-    { 0x00f8f0e0f0f07000ULL, 0x00fcf8f0f8f87800ULL },{ 0x00f0e0c0e0507000ULL, 0x00f8f0e0f0f07000ULL },{ 0x00e0c08040606000ULL, 0x00f1e0c0e0707000ULL },{ 0x00c1800000406000ULL, 0x00e3c18040606000ULL },
-    { 0x0083010000004000ULL, 0x00c7830100006000ULL },{ 0x0007030100000000ULL, 0x008f070301007000ULL },{ 0x000f070301000000ULL, 0x001f0f0703017100ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07036300ULL },
-    { 0x00f8f0e0f0f07000ULL, 0x00fcf8f0f8f87800ULL },{ 0x00f0e0c0e0605000ULL, 0x00f8f0e0f0f07000ULL },{ 0x00e0c08040606000ULL, 0x00f1e0c0e0607000ULL },{ 0x00c1800000404000ULL, 0x00e3c18040607000ULL },
-    { 0x0083010000004000ULL, 0x00c7830100406000ULL },{ 0x0007030100003000ULL, 0x008f070301007000ULL },{ 0x000f070301000000ULL, 0x001f0f0703017100ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07036300ULL },
+    { 0x00fff0e0f0f07000ULL, 0x00fffff0f8f87800ULL },{ 0x00ffe0c0e0707000ULL, 0x00ffffe0f0f07000ULL },{ 0x00ffc08040606000ULL, 0x00ffffc0e0707000ULL },{ 0x00ff800000406000ULL, 0x00ffff8040606000ULL },
+    { 0x00ff010000004000ULL, 0x00ffff0100406000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301004000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703017f00ULL },{ 0x00ff0f0703010100ULL, 0x00ffff0f07037f00ULL },
+    { 0x00f8f0e0f0f07000ULL, 0x00fff8f0f8f87800ULL },{ 0x00f0e0c0e0707000ULL, 0x00fff0e0f0f07000ULL },{ 0x00e0c08040606000ULL, 0x00ffe0c0e0707000ULL },{ 0x00c1800000406000ULL, 0x00ffc18040606000ULL },
+    { 0x0083010000004000ULL, 0x00ff830100406000ULL },{ 0x0007030100000000ULL, 0x00ff070301004000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f07030300ULL },
+    { 0x00f8f0e0f0f07000ULL, 0x00fcf8f0f8f87800ULL },{ 0x00f0e0c0e0707000ULL, 0x00f8f0e0f0f07000ULL },{ 0x00e0c08040606000ULL, 0x00f1e0c0e0707000ULL },{ 0x00c1800000406000ULL, 0x00e3c18040607000ULL },
+    { 0x0083010000004000ULL, 0x00c7830100407000ULL },{ 0x0007030100000000ULL, 0x008f070301007000ULL },{ 0x000f070301000000ULL, 0x001f0f0703017f00ULL },{ 0x001f0f0703010100ULL, 0x003f1f0f07037f00ULL },
+    { 0x00f8f0e0f0f07000ULL, 0x00fcf8f0f8f87800ULL },{ 0x00f0e0c0e0707000ULL, 0x00f8f0e0f0f07800ULL },{ 0x00e0c08040607000ULL, 0x00f1e0c0e0707800ULL },{ 0x00c1800000407000ULL, 0x00e3c18040607800ULL },
+    { 0x0083010000007000ULL, 0x00c7830100407800ULL },{ 0x0007030100007000ULL, 0x008f070301007800ULL },{ 0x000f070301007000ULL, 0x001f0f0703017f00ULL },{ 0x001f0f0703017f00ULL, 0x003f1f0f07037f00ULL },
   },
   {
-    { 0x00ff000000000000ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffefb00ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffef300ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffee300ULL, 0x00fffffffffeff00ULL },
+    { 0x00fffffffffeff00ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffefb00ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffef300ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffee300ULL, 0x00fffffffffeff00ULL },
     { 0x00fffffffffec700ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffe8f00ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffe1f00ULL, 0x00fffffffffeff00ULL },{ 0x00fffffffffe3f00ULL, 0x00fffffffffeff00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff020200ULL, 0x00fffffffffefb00ULL },{ 0x00ffffffff020200ULL, 0x00fffffffffef700ULL },
     { 0x00ffffffff060700ULL, 0x00fffffffffeef00ULL },{ 0x00ffffffff060f00ULL, 0x00fffffffffedf00ULL },{ 0x00ffffffff0e0f00ULL, 0x00fffffffffebf00ULL },{ 0x00ffffffff0e0f00ULL, 0x00fffffffffe7f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff02020000ULL, 0x00ffffffff020000ULL },{ 0x00ffffff02020200ULL, 0x00ffffffff060300ULL },
-    { 0x00ffffff07060700ULL, 0x00ffffffff060700ULL },{ 0x00ffffff07060700ULL, 0x00ffffffff0e0f00ULL },{ 0x00ffffff0f0e0f00ULL, 0x00ffffffff0e0f00ULL },{ 0x00ffffff0f0e0f00ULL, 0x00ffffffff1e0f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff02020200ULL, 0x00ffffffff020000ULL },{ 0x00ffffff02020200ULL, 0x00ffffffff060300ULL },
+    { 0x00ffffff07060700ULL, 0x00ffffffff060700ULL },{ 0x00ffffff07060700ULL, 0x00ffffffff0e0f00ULL },{ 0x00ffffff0f0e0f00ULL, 0x00ffffffff0e0f00ULL },{ 0x00ffffff0f0e0f00ULL, 0x00ffffffff1e1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff8000000200ULL, 0x00ffffff82000200ULL },{ 0x00ffff0002020200ULL, 0x00ffffff07020700ULL },
     { 0x00ffff0206060600ULL, 0x00ffffff07060700ULL },{ 0x00ffff0706060600ULL, 0x00ffffff0f0e0f00ULL },{ 0x00ffff0f0f0e0e00ULL, 0x00ffffff0f0e0f00ULL },{ 0x00ffff0f0f0e0f00ULL, 0x00ffffff1f1e1f00ULL },
-    { 0x00fff0e0c0808600ULL, 0x00fffff0e0c0c000ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808600ULL },{ 0x00ffc08000000200ULL, 0x00ffffc080020200ULL },{ 0x00ff800000020200ULL, 0x00ffff8202060600ULL },
+    { 0x00fff0e0c080fe00ULL, 0x00fffff0e0c0c000ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c080fe00ULL },{ 0x00ffc08000000200ULL, 0x00ffffc080020200ULL },{ 0x00ff800000020200ULL, 0x00ffff8202060600ULL },
     { 0x00ff010002060600ULL, 0x00ffff0706060600ULL },{ 0x00ff030306060600ULL, 0x00ffff0f0f0e0e00ULL },{ 0x00ff07070f0e0e00ULL, 0x00ffff0f0f0e0f00ULL },{ 0x00ff0f0f0f0e0f00ULL, 0x00ffff1f1f1e1f00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fff8f0e0cace00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c09e8e00ULL },{ 0x00e0c08000000200ULL, 0x00ffe0c080020200ULL },{ 0x00c1800000020200ULL, 0x00ffc18002060600ULL },
+    { 0x00f8f0e0c080c000ULL, 0x00fff8f0e0fefe00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0fefe00ULL },{ 0x00e0c08000000200ULL, 0x00ffe0c080020600ULL },{ 0x00c1800000020200ULL, 0x00ffc18002060600ULL },
     { 0x0083010002060600ULL, 0x00ff830306060600ULL },{ 0x0007030306060600ULL, 0x00ff07070f0e0e00ULL },{ 0x000f07070f0e0e00ULL, 0x00ff0f0f0f0e0f00ULL },{ 0x001f0f0f0f0e0f00ULL, 0x00ff1f1f1f1e1f00ULL },
-    { 0x00f8f0e0c0808e00ULL, 0x00fcf8f0e0c0d200ULL },{ 0x00f0e0c080000200ULL, 0x00f8f0e0c0808a00ULL },{ 0x00e0c08000000200ULL, 0x00f1e0c080020600ULL },{ 0x00c1800000020600ULL, 0x00e3c18002060600ULL },
-    { 0x0083010002060600ULL, 0x00c7830306060600ULL },{ 0x0007030306060600ULL, 0x008f07070f0e0e00ULL },{ 0x000f07070f0e0e00ULL, 0x001f0f0f0f0e0f00ULL },{ 0x001f0f0f0f0e0f00ULL, 0x003f1f1f1f1e1f00ULL },
-    { 0x00f8f0e0c0808200ULL, 0x00fcf8f0e0fede00ULL },{ 0x00f0e0c080000200ULL, 0x00f8f0e0c0bebe00ULL },{ 0x00e0c08000000a00ULL, 0x00f1e0c0800e0e00ULL },{ 0x00c1800000020a00ULL, 0x00e3c180020e0e00ULL },
-    { 0x0083010002060e00ULL, 0x00c78303060e0e00ULL },{ 0x0007030306060600ULL, 0x008f07070f0e0e00ULL },{ 0x000f07070f0e0e00ULL, 0x001f0f0f0f0e1f00ULL },{ 0x001f0f0f0f0e0f00ULL, 0x003f1f1f1f1e1f00ULL },
+    { 0x00f8f0e0c080fe00ULL, 0x00fcf8f0e0c0fe00ULL },{ 0x00f0e0c080000600ULL, 0x00f8f0e0c080fe00ULL },{ 0x00e0c08000000600ULL, 0x00f1e0c080020e00ULL },{ 0x00c1800000020600ULL, 0x00e3c18002060e00ULL },
+    { 0x0083010002060600ULL, 0x00c7830306060e00ULL },{ 0x0007030306060600ULL, 0x008f07070f0e0e00ULL },{ 0x000f07070f0e0e00ULL, 0x001f0f0f0f0e0f00ULL },{ 0x001f0f0f0f0e0f00ULL, 0x003f1f1f1f1e1f00ULL },
+    { 0x00f8f0e0c080fe00ULL, 0x00fcf8f0e0fefe00ULL },{ 0x00f0e0c080000e00ULL, 0x00f8f0e0c0fefe00ULL },{ 0x00e0c08000000e00ULL, 0x00f1e0c0800e1e00ULL },{ 0x00c1800000020e00ULL, 0x00e3c180020e1e00ULL },
+    { 0x0083010002060e00ULL, 0x00c78303060e1e00ULL },{ 0x0007030306060e00ULL, 0x008f07070f0e1e00ULL },{ 0x000f07070f0e0e00ULL, 0x001f0f0f0f0e1f00ULL },{ 0x001f0f0f0f0e0f00ULL, 0x003f1f1f1f1e1f00ULL },
   },
   {
-    { 0x00ff000000000000ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffdff00ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffdf700ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffde700ULL, 0x00fffffffffdff00ULL },
+    { 0x00fffffffffdff00ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffdff00ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffdf700ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffde700ULL, 0x00fffffffffdff00ULL },
     { 0x00fffffffffdc700ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffd8f00ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffd1f00ULL, 0x00fffffffffdff00ULL },{ 0x00fffffffffd3f00ULL, 0x00fffffffffdff00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff050700ULL, 0x00fffffffffdf700ULL },
     { 0x00ffffffff050700ULL, 0x00fffffffffdef00ULL },{ 0x00ffffffff0d0f00ULL, 0x00fffffffffddf00ULL },{ 0x00ffffffff0d1f00ULL, 0x00fffffffffdbf00ULL },{ 0x00ffffffff1d1f00ULL, 0x00fffffffffd7f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff07050300ULL, 0x00ffffffff050300ULL },
-    { 0x00ffffff07050700ULL, 0x00ffffffff0d0700ULL },{ 0x00ffffff0f0d0f00ULL, 0x00ffffffff0d0f00ULL },{ 0x00ffffff0f0d0f00ULL, 0x00ffffffff1d1f00ULL },{ 0x00ffffff1f1d0f00ULL, 0x00ffffffff1d1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff0002000200ULL, 0x00ffffff07010700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff07050700ULL, 0x00ffffffff050300ULL },
+    { 0x00ffffff07050700ULL, 0x00ffffffff0d0700ULL },{ 0x00ffffff0f0d0f00ULL, 0x00ffffffff0d0f00ULL },{ 0x00ffffff0f0d0f00ULL, 0x00ffffffff1d1f00ULL },{ 0x00ffffff1f1d1f00ULL, 0x00ffffffff1d1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff0002000600ULL, 0x00ffffff07010700ULL },
     { 0x00ffff0206040600ULL, 0x00ffffff0f050f00ULL },{ 0x00ffff070e0c0e00ULL, 0x00ffffff0f0d0f00ULL },{ 0x00ffff0f0f0c0e00ULL, 0x00ffffff1f1d1f00ULL },{ 0x00ffff1f1f1d1f00ULL, 0x00ffffff1f1d1f00ULL },
-    { 0x00fff0e0c0808000ULL, 0x00fffff4f8fcfe00ULL },{ 0x00ffe0c080000e00ULL, 0x00ffffe0c0808000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080001600ULL },{ 0x00ff800000000600ULL, 0x00ffff8202040600ULL },
+    { 0x00fff0e0c0808000ULL, 0x00fffff4f8fcfe00ULL },{ 0x00ffe0c080007e00ULL, 0x00ffffe0c0808000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc080007e00ULL },{ 0x00ff800000000600ULL, 0x00ffff8202040600ULL },
     { 0x00ff010002040600ULL, 0x00ffff07060c0e00ULL },{ 0x00ff0303060c0e00ULL, 0x00ffff0f0f0c0e00ULL },{ 0x00ff07070f0c0e00ULL, 0x00ffff1f1f1d1f00ULL },{ 0x00ff0f0f1f1d1f00ULL, 0x00ffff1f1f1d1f00ULL },
-    { 0x00f8f0e0c0808000ULL, 0x00fff8f0f8fcfe00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0848e00ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0801c1e00ULL },{ 0x00c1800000000600ULL, 0x00ffc18002040e00ULL },
+    { 0x00f8f0e0c0808000ULL, 0x00fff8f0f8fcfe00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0c0fcfe00ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0807c7e00ULL },{ 0x00c1800000000600ULL, 0x00ffc18002040e00ULL },
     { 0x0083010002040600ULL, 0x00ff8303060c0e00ULL },{ 0x00070303060c0e00ULL, 0x00ff07070f0c0e00ULL },{ 0x000f07070f0c0e00ULL, 0x00ff0f0f1f1d1f00ULL },{ 0x001f0f0f1f1d1f00ULL, 0x00ff1f1f1f1d1f00ULL },
-    { 0x00f8f0e0c0809a00ULL, 0x00fcf8f0f8fcfe00ULL },{ 0x00f0e0c080000e00ULL, 0x00f8f0e0c0808e00ULL },{ 0x00e0c08000000e00ULL, 0x00f1e0c080000600ULL },{ 0x00c1800000000e00ULL, 0x00e3c18002041e00ULL },
-    { 0x0083010002040e00ULL, 0x00c78303060c1e00ULL },{ 0x00070303060c0e00ULL, 0x008f07070f0c0e00ULL },{ 0x000f07070f0c0e00ULL, 0x001f0f0f1f1d1f00ULL },{ 0x001f0f0f1f1d1f00ULL, 0x003f1f1f1f1d1f00ULL },
-    { 0x00f8f0e0c0808e00ULL, 0x00fcf8f0f8fcfe00ULL },{ 0x00f0e0c080001600ULL, 0x00f8f0e0c0fcfe00ULL },{ 0x00e0c08000000600ULL, 0x00f1e0c0803c7e00ULL },{ 0x00c1800000000600ULL, 0x00e3c180021c3e00ULL },
-    { 0x0083010002041600ULL, 0x00c78303061c3e00ULL },{ 0x00070303060c0e00ULL, 0x008f07070f1c3e00ULL },{ 0x000f07070f0c0e00ULL, 0x001f0f0f1f1d3f00ULL },{ 0x001f0f0f1f1d1f00ULL, 0x003f1f1f1f1d3f00ULL },
+    { 0x00f8f0e0c080fe00ULL, 0x00fcf8f0f8fcfe00ULL },{ 0x00f0e0c080007e00ULL, 0x00f8f0e0c080fe00ULL },{ 0x00e0c08000000e00ULL, 0x00f1e0c080007e00ULL },{ 0x00c1800000000e00ULL, 0x00e3c18002041e00ULL },
+    { 0x0083010002040e00ULL, 0x00c78303060c1e00ULL },{ 0x00070303060c0e00ULL, 0x008f07070f0c1e00ULL },{ 0x000f07070f0c0e00ULL, 0x001f0f0f1f1d1f00ULL },{ 0x001f0f0f1f1d1f00ULL, 0x003f1f1f1f1d1f00ULL },
+    { 0x00f8f0e0c080fe00ULL, 0x00fcf8f0f8fcfe00ULL },{ 0x00f0e0c080007e00ULL, 0x00f8f0e0c0fcfe00ULL },{ 0x00e0c08000001e00ULL, 0x00f1e0c0807c7e00ULL },{ 0x00c1800000001e00ULL, 0x00e3c180021c3e00ULL },
+    { 0x0083010002041e00ULL, 0x00c78303061c3e00ULL },{ 0x00070303060c1e00ULL, 0x008f07070f1c3e00ULL },{ 0x000f07070f0c1e00ULL, 0x001f0f0f1f1d3f00ULL },{ 0x001f0f0f1f1d1f00ULL, 0x003f1f1f1f1d3f00ULL },
   },
   {
     { 0x00fffffffffbfe00ULL, 0x00fffffffffbff00ULL },{ 0x00fffffffffbfe00ULL, 0x00fffffffffbff00ULL },{ 0x00fffffffffbff00ULL, 0x00fffffffffbff00ULL },{ 0x00fffffffffbef00ULL, 0x00fffffffffbff00ULL },
     { 0x00fffffffffbcf00ULL, 0x00fffffffffbff00ULL },{ 0x00fffffffffb8f00ULL, 0x00fffffffffbff00ULL },{ 0x00fffffffffb1f00ULL, 0x00fffffffffbff00ULL },{ 0x00fffffffffb3f00ULL, 0x00fffffffffbff00ULL },
     { 0x00fffffffffafe00ULL, 0x00fffffffffbfe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00ffffffff0b0f00ULL, 0x00fffffffffbef00ULL },{ 0x00ffffffff0b0f00ULL, 0x00fffffffffbdf00ULL },{ 0x00ffffffff1b1f00ULL, 0x00fffffffffbbf00ULL },{ 0x00ffffffff1b3f00ULL, 0x00fffffffffb7f00ULL },
-    { 0x00fffffffef8fc00ULL, 0x00fffffffffafc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffffff0f0b0700ULL, 0x00ffffffff0b0700ULL },{ 0x00ffffff0f0b0f00ULL, 0x00ffffffff1b0f00ULL },{ 0x00ffffff1f1b1f00ULL, 0x00ffffffff1b1f00ULL },{ 0x00ffffff1f1b1f00ULL, 0x00ffffffff3b3f00ULL },
-    { 0x00ffffe8f4f8fc00ULL, 0x00fffffffef8fe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00fffffffefafe00ULL, 0x00fffffffffafc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffff0f0b0f00ULL, 0x00ffffffff0b0700ULL },{ 0x00ffffff0f0b0f00ULL, 0x00ffffffff1b0f00ULL },{ 0x00ffffff1f1b1f00ULL, 0x00ffffffff1b1f00ULL },{ 0x00ffffff1f1b1f00ULL, 0x00ffffffff3b3f00ULL },
+    { 0x00ffffe8f4f8fe00ULL, 0x00fffffffef8fe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00ffff0204020e00ULL, 0x00ffffff0f030f00ULL },{ 0x00ffff070e0a0e00ULL, 0x00ffffff1f0b1f00ULL },{ 0x00ffff0f1f1a1e00ULL, 0x00ffffff1f1b1f00ULL },{ 0x00ffff1f1f1b1f00ULL, 0x00ffffff3f3b3f00ULL },
-    { 0x00fff0e0f0f8fe00ULL, 0x00fffffcfcfafe00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe8f0f8fe00ULL },{ 0x00ffc08000001c00ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8200021e00ULL },
-    { 0x00ff010000020600ULL, 0x00ffff0706020e00ULL },{ 0x00ff0303060a0e00ULL, 0x00ffff0f0f1a1e00ULL },{ 0x00ff07070f1a1e00ULL, 0x00ffff1f1f1b1f00ULL },{ 0x00ff0f0f1f1b1f00ULL, 0x00ffff3f3f3b3f00ULL },
-    { 0x00f8f0e0f0f8fc00ULL, 0x00fff8f8fcfafe00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0f0fafe00ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0801a1e00ULL },{ 0x00c1800000000000ULL, 0x00ffc180003a7e00ULL },
+    { 0x00fff0e0f0f8fe00ULL, 0x00fffffcfcfafe00ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe8f0f8fe00ULL },{ 0x00ffc08000007e00ULL, 0x00ffffc080000000ULL },{ 0x00ff800000000000ULL, 0x00ffff8200027e00ULL },
+    { 0x00ff010000020e00ULL, 0x00ffff07060a0e00ULL },{ 0x00ff0303060a0e00ULL, 0x00ffff0f0f1a1e00ULL },{ 0x00ff07070f1a1e00ULL, 0x00ffff1f1f1b1f00ULL },{ 0x00ff0f0f1f1b1f00ULL, 0x00ffff3f3f3b3f00ULL },
+    { 0x00f8f0e0f0f8fe00ULL, 0x00fff8f8fcfafe00ULL },{ 0x00f0e0c080000000ULL, 0x00fff0e0f0fafe00ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0807a7e00ULL },{ 0x00c1800000000000ULL, 0x00ffc180007a7e00ULL },
     { 0x0083010000020e00ULL, 0x00ff8303060a1e00ULL },{ 0x00070303060a0e00ULL, 0x00ff07070f1a1e00ULL },{ 0x000f07070f1a1e00ULL, 0x00ff0f0f1f1b1f00ULL },{ 0x001f0f0f1f1b1f00ULL, 0x00ff1f1f3f3b3f00ULL },
-    { 0x00f8f0e0f0f8fe00ULL, 0x00fcf8f8fcfafe00ULL },{ 0x00f0e0c080000e00ULL, 0x00f8f0e0f0f8fe00ULL },{ 0x00e0c08000001e00ULL, 0x00f1e0c080001e00ULL },{ 0x00c1800000001e00ULL, 0x00e3c18000021e00ULL },
-    { 0x0083010000021e00ULL, 0x00c78303060a3e00ULL },{ 0x00070303060a1e00ULL, 0x008f07070f1a3e00ULL },{ 0x000f07070f1a1e00ULL, 0x001f0f0f1f1b1f00ULL },{ 0x001f0f0f1f1b1f00ULL, 0x003f1f1f3f3b3f00ULL },
-    { 0x00f8f0e0f0f8fe00ULL, 0x00fcf8f8fcfafe00ULL },{ 0x00f0e0c080000c00ULL, 0x00f8f0e0f0fafe00ULL },{ 0x00e0c08000003e00ULL, 0x00f1e0c0807a7e00ULL },{ 0x00c1800000002e00ULL, 0x00e3c180007a7e00ULL },
-    { 0x0083010000021e00ULL, 0x00c78303063a3e00ULL },{ 0x00070303060a1e00ULL, 0x008f07070f3a3e00ULL },{ 0x000f07070f1a3e00ULL, 0x001f0f0f1f3b3f00ULL },{ 0x001f0f0f1f1b3f00ULL, 0x003f1f1f3f3b3f00ULL },
+    { 0x00f8f0e0f0f8fe00ULL, 0x00fcf8f8fcfafe00ULL },{ 0x00f0e0c080007e00ULL, 0x00f8f0e0f0f8fe00ULL },{ 0x00e0c08000007e00ULL, 0x00f1e0c080007e00ULL },{ 0x00c1800000001e00ULL, 0x00e3c18000027e00ULL },
+    { 0x0083010000021e00ULL, 0x00c78303060a3e00ULL },{ 0x00070303060a1e00ULL, 0x008f07070f1a3e00ULL },{ 0x000f07070f1a1e00ULL, 0x001f0f0f1f1b3f00ULL },{ 0x001f0f0f1f1b1f00ULL, 0x003f1f1f3f3b3f00ULL },
+    { 0x00f8f0e0f0f8fe00ULL, 0x00fcf8f8fcfafe00ULL },{ 0x00f0e0c080007e00ULL, 0x00f8f0e0f0fafe00ULL },{ 0x00e0c08000007e00ULL, 0x00f1e0c0807a7e00ULL },{ 0x00c1800000003e00ULL, 0x00e3c180007a7e00ULL },
+    { 0x0083010000023e00ULL, 0x00c78303063a7e00ULL },{ 0x00070303060a3e00ULL, 0x008f07070f3a7e00ULL },{ 0x000f07070f1a3e00ULL, 0x001f0f0f1f3b7f00ULL },{ 0x001f0f0f1f1b3f00ULL, 0x003f1f1f3f3b7f00ULL },
   },
   {
     { 0x00fffffffff7fc00ULL, 0x00fffffffff7ff00ULL },{ 0x00fffffffff7fc00ULL, 0x00fffffffff7ff00ULL },{ 0x00fffffffff7fd00ULL, 0x00fffffffff7ff00ULL },{ 0x00fffffffff7ff00ULL, 0x00fffffffff7ff00ULL },
     { 0x00fffffffff7df00ULL, 0x00fffffffff7ff00ULL },{ 0x00fffffffff79f00ULL, 0x00fffffffff7ff00ULL },{ 0x00fffffffff71f00ULL, 0x00fffffffff7ff00ULL },{ 0x00fffffffff73f00ULL, 0x00fffffffff7ff00ULL },
     { 0x00fffffffff4fc00ULL, 0x00fffffffff7fe00ULL },{ 0x00fffffffff4fc00ULL, 0x00fffffffff7fd00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff171f00ULL, 0x00fffffffff7df00ULL },{ 0x00ffffffff171f00ULL, 0x00fffffffff7bf00ULL },{ 0x00ffffffff373f00ULL, 0x00fffffffff77f00ULL },
-    { 0x00fffffffcf4fc00ULL, 0x00fffffffff6fc00ULL },{ 0x00fffffffcf4f800ULL, 0x00fffffffff4f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff1f170f00ULL, 0x00ffffffff170f00ULL },{ 0x00ffffff1f171f00ULL, 0x00ffffffff371f00ULL },{ 0x00ffffff3f373f00ULL, 0x00ffffffff373f00ULL },
+    { 0x00fffffffcf4fc00ULL, 0x00fffffffff6fc00ULL },{ 0x00fffffffcf4fc00ULL, 0x00fffffffff4f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff1f171f00ULL, 0x00ffffffff170f00ULL },{ 0x00ffffff1f171f00ULL, 0x00ffffffff371f00ULL },{ 0x00ffffff3f373f00ULL, 0x00ffffffff373f00ULL },
     { 0x00fffff8fcf4fc00ULL, 0x00fffffffef4fe00ULL },{ 0x00ffffd0e8707c00ULL, 0x00fffffffcf0fc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff050a060e00ULL, 0x00ffffff1f071f00ULL },{ 0x00ffff0f1f161e00ULL, 0x00ffffff3f173f00ULL },{ 0x00ffff1f3f173f00ULL, 0x00ffffff3f373f00ULL },
-    { 0x00fff0f0f8f4fc00ULL, 0x00fffffcfcf6fe00ULL },{ 0x00ffe0c0e0707c00ULL, 0x00fffff8f8f4fc00ULL },{ 0x00ffc08000000000ULL, 0x00ffffd0e0707c00ULL },{ 0x00ff800000001a00ULL, 0x00ffff8000000000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff0502067e00ULL },{ 0x00ff030102061e00ULL, 0x00ffff0f0f161e00ULL },{ 0x00ff07070f161e00ULL, 0x00ffff1f1f173f00ULL },{ 0x00ff0f0f1f173f00ULL, 0x00ffff3f3f373f00ULL },
-    { 0x00f8f0f0f8f4fc00ULL, 0x00fff8f8fcf6fe00ULL },{ 0x00f0e0c0e0707c00ULL, 0x00fff0f0f8f4fe00ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0e0767e00ULL },{ 0x00c1800000000000ULL, 0x00ffc18000367e00ULL },
-    { 0x0083010000000000ULL, 0x00ff830102767e00ULL },{ 0x0007030102061e00ULL, 0x00ff07070f161e00ULL },{ 0x000f07070f161e00ULL, 0x00ff0f0f1f373f00ULL },{ 0x001f0f0f1f173f00ULL, 0x00ff1f1f3f373f00ULL },
-    { 0x00f8f0f0f8f4fe00ULL, 0x00fcf8f8fcf6fe00ULL },{ 0x00f0e0c0e0707e00ULL, 0x00f8f0f0f8f4fc00ULL },{ 0x00e0c08000003e00ULL, 0x00f1e0c0e0707e00ULL },{ 0x00c1800000003e00ULL, 0x00e3c18000003c00ULL },
-    { 0x0083010000003c00ULL, 0x00c7830102067e00ULL },{ 0x0007030102061e00ULL, 0x008f07070f165e00ULL },{ 0x000f07070f163e00ULL, 0x001f0f0f1f377f00ULL },{ 0x001f0f0f1f373f00ULL, 0x003f1f1f3f373f00ULL },
-    { 0x00f8f0f0f8f4fc00ULL, 0x00fcf8f8fcf6fe00ULL },{ 0x00f0e0c0e0707e00ULL, 0x00f8f0f0f8f6fe00ULL },{ 0x00e0c08000007c00ULL, 0x00f1e0c0e0767e00ULL },{ 0x00c1800000001c00ULL, 0x00e3c18000767e00ULL },
-    { 0x0083010000003c00ULL, 0x00c7830102767e00ULL },{ 0x0007030102065e00ULL, 0x008f07070f767e00ULL },{ 0x000f07070f165e00ULL, 0x001f0f0f1f777f00ULL },{ 0x001f0f0f1f377f00ULL, 0x003f1f1f3f777f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff050a061e00ULL, 0x00ffffff1f071f00ULL },{ 0x00ffff0f1f161e00ULL, 0x00ffffff3f173f00ULL },{ 0x00ffff1f3f373f00ULL, 0x00ffffff3f373f00ULL },
+    { 0x00fff0f0f8f4fc00ULL, 0x00fffffcfcf6fe00ULL },{ 0x00ffe0c0e0707c00ULL, 0x00fffff8f8f4fc00ULL },{ 0x00ffc08000000000ULL, 0x00ffffd0e0707e00ULL },{ 0x00ff800000007e00ULL, 0x00ffff8000000000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff0502067e00ULL },{ 0x00ff030102061e00ULL, 0x00ffff0f0f161e00ULL },{ 0x00ff07070f161e00ULL, 0x00ffff1f1f373f00ULL },{ 0x00ff0f0f1f373f00ULL, 0x00ffff3f3f373f00ULL },
+    { 0x00f8f0f0f8f4fc00ULL, 0x00fff8f8fcf6fe00ULL },{ 0x00f0e0c0e0707c00ULL, 0x00fff0f0f8f4fe00ULL },{ 0x00e0c08000000000ULL, 0x00ffe0c0e0767e00ULL },{ 0x00c1800000000000ULL, 0x00ffc18000767e00ULL },
+    { 0x0083010000000000ULL, 0x00ff830102767e00ULL },{ 0x0007030102061e00ULL, 0x00ff07070f163e00ULL },{ 0x000f07070f161e00ULL, 0x00ff0f0f1f373f00ULL },{ 0x001f0f0f1f373f00ULL, 0x00ff1f1f3f373f00ULL },
+    { 0x00f8f0f0f8f4fe00ULL, 0x00fcf8f8fcf6fe00ULL },{ 0x00f0e0c0e0707e00ULL, 0x00f8f0f0f8f4fe00ULL },{ 0x00e0c08000007e00ULL, 0x00f1e0c0e0707e00ULL },{ 0x00c1800000007e00ULL, 0x00e3c18000007e00ULL },
+    { 0x0083010000003e00ULL, 0x00c7830102067e00ULL },{ 0x0007030102063e00ULL, 0x008f07070f167e00ULL },{ 0x000f07070f163e00ULL, 0x001f0f0f1f377f00ULL },{ 0x001f0f0f1f373f00ULL, 0x003f1f1f3f377f00ULL },
+    { 0x00f8f0f0f8f4fe00ULL, 0x00fcf8f8fcf6fe00ULL },{ 0x00f0e0c0e0707e00ULL, 0x00f8f0f0f8f6fe00ULL },{ 0x00e0c08000007e00ULL, 0x00f1e0c0e0767e00ULL },{ 0x00c1800000007e00ULL, 0x00e3c18000767e00ULL },
+    { 0x0083010000007e00ULL, 0x00c7830102767e00ULL },{ 0x0007030102067e00ULL, 0x008f07070f767e00ULL },{ 0x000f07070f167e00ULL, 0x001f0f0f1f777f00ULL },{ 0x001f0f0f1f377f00ULL, 0x003f1f1f3f777f00ULL },
   },
   {
     { 0x00ffffffffeffc00ULL, 0x00ffffffffefff00ULL },{ 0x00ffffffffeff800ULL, 0x00ffffffffefff00ULL },{ 0x00ffffffffeff900ULL, 0x00ffffffffefff00ULL },{ 0x00ffffffffeffb00ULL, 0x00ffffffffefff00ULL },
     { 0x00ffffffffefff00ULL, 0x00ffffffffefff00ULL },{ 0x00ffffffffefbf00ULL, 0x00ffffffffefff00ULL },{ 0x00ffffffffef3f00ULL, 0x00ffffffffefff00ULL },{ 0x00ffffffffef3f00ULL, 0x00ffffffffefff00ULL },
     { 0x00ffffffffecfc00ULL, 0x00ffffffffeffe00ULL },{ 0x00ffffffffe8f800ULL, 0x00ffffffffeffd00ULL },{ 0x00ffffffffe8f800ULL, 0x00ffffffffeffb00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff2f3f00ULL, 0x00ffffffffefbf00ULL },{ 0x00ffffffff2f3f00ULL, 0x00ffffffffef7f00ULL },
-    { 0x00fffffffcecfc00ULL, 0x00ffffffffecfc00ULL },{ 0x00fffffff8e8f800ULL, 0x00ffffffffecf800ULL },{ 0x00fffffff8e8f000ULL, 0x00ffffffffe8f000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff3f2f1f00ULL, 0x00ffffffff2f1f00ULL },{ 0x00ffffff3f2f3f00ULL, 0x00ffffffff6f3f00ULL },
+    { 0x00fffffffcecfc00ULL, 0x00ffffffffecfc00ULL },{ 0x00fffffff8e8f800ULL, 0x00ffffffffecf800ULL },{ 0x00fffffff8e8f800ULL, 0x00ffffffffe8f000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff3f2f3f00ULL, 0x00ffffffff2f1f00ULL },{ 0x00ffffff3f2f3f00ULL, 0x00ffffffff6f3f00ULL },
     { 0x00fffff8fcecfc00ULL, 0x00fffffffcecfc00ULL },{ 0x00fffff0f8687800ULL, 0x00fffffffce8fc00ULL },{ 0x00ffffa050607800ULL, 0x00fffffff8e0f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff0b170e1e00ULL, 0x00ffffff3f0f3f00ULL },{ 0x00ffff1f3f2f3f00ULL, 0x00ffffff7f2f7f00ULL },
-    { 0x00fff0f0f8e8fc00ULL, 0x00fffffcfcecfc00ULL },{ 0x00ffe0e0f0687800ULL, 0x00fffff8f8ecfc00ULL },{ 0x00ffc08040607800ULL, 0x00fffff0f0687800ULL },{ 0x00ff800000000000ULL, 0x00ffffa040607c00ULL },
-    { 0x00ff010000007c00ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0b070e3e00ULL },{ 0x00ff0703070e3e00ULL, 0x00ffff1f1f2f3f00ULL },{ 0x00ff0f0f1f0f3f00ULL, 0x00ffff3f3f6f7f00ULL },
-    { 0x00f8f0f0f8ecfc00ULL, 0x00fff8f8fcecfc00ULL },{ 0x00f0e0e0f0687800ULL, 0x00fff0f0f8ecfc00ULL },{ 0x00e0c08040607800ULL, 0x00ffe0e0f0687c00ULL },{ 0x00c1800000000000ULL, 0x00ffc180406c7e00ULL },
-    { 0x0083010000000000ULL, 0x00ff830100687c00ULL },{ 0x0007030100000000ULL, 0x00ff0703076e7e00ULL },{ 0x000f0703070e3e00ULL, 0x00ff0f0f1f2f7f00ULL },{ 0x001f0f0f1f2f3f00ULL, 0x00ff1f1f3f6f7f00ULL },
-    { 0x00f8f0f0f8ecfc00ULL, 0x00fcf8f8fcecfe00ULL },{ 0x00f0e0e0f0687c00ULL, 0x00f8f0f0f8ecfe00ULL },{ 0x00e0c08040607c00ULL, 0x00f1e0e0f0687c00ULL },{ 0x00c1800000007800ULL, 0x00e3c18040607e00ULL },
-    { 0x0083010000007c00ULL, 0x00c7830100007c00ULL },{ 0x0007030100007c00ULL, 0x008f0703070e7e00ULL },{ 0x000f0703070e7e00ULL, 0x001f0f0f1f2f7f00ULL },{ 0x001f0f0f1f0f7f00ULL, 0x003f1f1f3f6f7f00ULL },
-    { 0x00f8f0f0f8ecfc00ULL, 0x00fcf8f8fceefe00ULL },{ 0x00f0e0e0f0687e00ULL, 0x00f8f0f0f8eefe00ULL },{ 0x00e0c08040607c00ULL, 0x00f1e0e0f06e7e00ULL },{ 0x00c1800000007800ULL, 0x00e3c180406e7e00ULL },
-    { 0x0083010000003800ULL, 0x00c78301006e7e00ULL },{ 0x0007030100007800ULL, 0x008f0703076e7e00ULL },{ 0x000f0703070e7e00ULL, 0x001f0f0f1f6f7f00ULL },{ 0x001f0f0f1f2f7f00ULL, 0x003f1f1f3f6f7f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff0b170e3e00ULL, 0x00ffffff3f0f3f00ULL },{ 0x00ffff1f3f2f3f00ULL, 0x00ffffff7f2f7f00ULL },
+    { 0x00fff0f0f8ecfc00ULL, 0x00fffffcfcecfc00ULL },{ 0x00ffe0e0f0687800ULL, 0x00fffff8f8ecfc00ULL },{ 0x00ffc08040607800ULL, 0x00fffff0f0687800ULL },{ 0x00ff800000000000ULL, 0x00ffffa040607e00ULL },
+    { 0x00ff010000007e00ULL, 0x00ffff0100000000ULL },{ 0x00ff030100000000ULL, 0x00ffff0b070e7e00ULL },{ 0x00ff0703070e3e00ULL, 0x00ffff1f1f2f3f00ULL },{ 0x00ff0f0f1f2f3f00ULL, 0x00ffff3f3f6f7f00ULL },
+    { 0x00f8f0f0f8ecfc00ULL, 0x00fff8f8fcecfc00ULL },{ 0x00f0e0e0f0687800ULL, 0x00fff0f0f8ecfc00ULL },{ 0x00e0c08040607800ULL, 0x00ffe0e0f0687c00ULL },{ 0x00c1800000000000ULL, 0x00ffc180406e7e00ULL },
+    { 0x0083010000000000ULL, 0x00ff8301006e7e00ULL },{ 0x0007030100000000ULL, 0x00ff0703076e7e00ULL },{ 0x000f0703070e3e00ULL, 0x00ff0f0f1f2f7f00ULL },{ 0x001f0f0f1f2f3f00ULL, 0x00ff1f1f3f6f7f00ULL },
+    { 0x00f8f0f0f8ecfc00ULL, 0x00fcf8f8fcecfe00ULL },{ 0x00f0e0e0f0687c00ULL, 0x00f8f0f0f8ecfe00ULL },{ 0x00e0c08040607c00ULL, 0x00f1e0e0f0687e00ULL },{ 0x00c1800000007c00ULL, 0x00e3c18040607e00ULL },
+    { 0x0083010000007e00ULL, 0x00c7830100007e00ULL },{ 0x0007030100007e00ULL, 0x008f0703070e7e00ULL },{ 0x000f0703070e7e00ULL, 0x001f0f0f1f2f7f00ULL },{ 0x001f0f0f1f2f7f00ULL, 0x003f1f1f3f6f7f00ULL },
+    { 0x00f8f0f0f8ecfe00ULL, 0x00fcf8f8fceefe00ULL },{ 0x00f0e0e0f0687e00ULL, 0x00f8f0f0f8eefe00ULL },{ 0x00e0c08040607e00ULL, 0x00f1e0e0f06e7e00ULL },{ 0x00c1800000007e00ULL, 0x00e3c180406e7e00ULL },
+    { 0x0083010000007e00ULL, 0x00c78301006e7e00ULL },{ 0x0007030100007e00ULL, 0x008f0703076e7e00ULL },{ 0x000f0703070e7e00ULL, 0x001f0f0f1f6f7f00ULL },{ 0x001f0f0f1f2f7f00ULL, 0x003f1f1f3f6f7f00ULL },
   },
   {
     { 0x00ffffffffdffc00ULL, 0x00ffffffffdfff00ULL },{ 0x00ffffffffdff800ULL, 0x00ffffffffdfff00ULL },{ 0x00ffffffffdff100ULL, 0x00ffffffffdfff00ULL },{ 0x00ffffffffdff300ULL, 0x00ffffffffdfff00ULL },
     { 0x00ffffffffdff700ULL, 0x00ffffffffdfff00ULL },{ 0x00ffffffffdfff00ULL, 0x00ffffffffdfff00ULL },{ 0x00ffffffffdf7f00ULL, 0x00ffffffffdfff00ULL },{ 0x00ffffffffdf7f00ULL, 0x00ffffffffdfff00ULL },
     { 0x00ffffffffd8fc00ULL, 0x00ffffffffdffe00ULL },{ 0x00ffffffffd8f800ULL, 0x00ffffffffdffd00ULL },{ 0x00ffffffffd0f000ULL, 0x00ffffffffdffb00ULL },{ 0x00ffffffffd0f000ULL, 0x00ffffffffdff700ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffffff5f7f00ULL, 0x00ffffffffdf7f00ULL },
-    { 0x00fffffff8d8f800ULL, 0x00ffffffffdcfc00ULL },{ 0x00fffffff8d8f800ULL, 0x00ffffffffd8f800ULL },{ 0x00fffffff0d0f000ULL, 0x00ffffffffd8f000ULL },{ 0x00fffffff0d0e000ULL, 0x00ffffffffd0e000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff7f1f3f00ULL, 0x00ffffffff5f3f00ULL },
+    { 0x00fffffff8d8f800ULL, 0x00ffffffffdcfc00ULL },{ 0x00fffffff8d8f800ULL, 0x00ffffffffd8f800ULL },{ 0x00fffffff0d0f000ULL, 0x00ffffffffd8f000ULL },{ 0x00fffffff0d0f000ULL, 0x00ffffffffd0e000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff7f5f7f00ULL, 0x00ffffffff5f3f00ULL },
     { 0x00fffff8f8d8f800ULL, 0x00fffffffcdcfc00ULL },{ 0x00fffff0f8587800ULL, 0x00fffffff8d8f800ULL },{ 0x00ffffe070507000ULL, 0x00fffffff8d0f800ULL },{ 0x00ffff4020407000ULL, 0x00fffffff0c0f000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff172f1f7f00ULL, 0x00ffffff7f1f7f00ULL },
-    { 0x00fff0f0f8d0f800ULL, 0x00fffffcfcdcfc00ULL },{ 0x00ffe0e0f0587800ULL, 0x00fffff8f8d8f800ULL },{ 0x00ffc0c060507000ULL, 0x00fffff0f0587800ULL },{ 0x00ff800000407000ULL, 0x00ffffe060507000ULL },
-    { 0x00ff010000000000ULL, 0x00ffff4100407000ULL },{ 0x00ff030100006000ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff170f1f7f00ULL },{ 0x00ff0f070f1f7f00ULL, 0x00ffff3f3f5f7f00ULL },
+    { 0x00fff0f0f8d8f800ULL, 0x00fffffcfcdcfc00ULL },{ 0x00ffe0e0f0587800ULL, 0x00fffff8f8d8f800ULL },{ 0x00ffc0c060507000ULL, 0x00fffff0f0587800ULL },{ 0x00ff800000407000ULL, 0x00ffffe060507000ULL },
+    { 0x00ff010000000000ULL, 0x00ffff4100407e00ULL },{ 0x00ff030100007e00ULL, 0x00ffff0301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff170f1f7f00ULL },{ 0x00ff0f070f1f7f00ULL, 0x00ffff3f3f5f7f00ULL },
     { 0x00f8f0f0f8d8f800ULL, 0x00fff8f8fcdcfc00ULL },{ 0x00f0e0e0f0587800ULL, 0x00fff0f0f8d8f800ULL },{ 0x00e0c0c060507000ULL, 0x00ffe0e0f0587800ULL },{ 0x00c1800000407000ULL, 0x00ffc1c060507800ULL },
-    { 0x0083010000000000ULL, 0x00ff830100587c00ULL },{ 0x0007030100000000ULL, 0x00ff070301507c00ULL },{ 0x000f070301000000ULL, 0x00ff0f070f5f7f00ULL },{ 0x001f0f070f1f7f00ULL, 0x00ff1f1f3f5f7f00ULL },
-    { 0x00f8f0f0f8d8f800ULL, 0x00fcf8f8fcdcfc00ULL },{ 0x00f0e0e0f0507800ULL, 0x00f8f0f0f8d8f800ULL },{ 0x00e0c0c060507000ULL, 0x00f1e0e0f0587800ULL },{ 0x00c1800000407800ULL, 0x00e3c1c060507800ULL },
-    { 0x0083010000007800ULL, 0x00c7830100407c00ULL },{ 0x0007030100007c00ULL, 0x008f070301007800ULL },{ 0x000f070301007400ULL, 0x001f0f070f1f7f00ULL },{ 0x001f0f070f1f7f00ULL, 0x003f1f1f3f5f7f00ULL },
-    { 0x00f8f0f0f8d8f800ULL, 0x00fcf8f8fcdcfc00ULL },{ 0x00f0e0e0f0587800ULL, 0x00f8f0f0f8dcfc00ULL },{ 0x00e0c0c060507000ULL, 0x00f1e0e0f05c7c00ULL },{ 0x00c1800000407c00ULL, 0x00e3c1c0605c7c00ULL },
-    { 0x0083010000007000ULL, 0x00c78301005e7e00ULL },{ 0x0007030100007000ULL, 0x008f0703015c7e00ULL },{ 0x000f070301007000ULL, 0x001f0f070f5f7f00ULL },{ 0x001f0f070f1f7f00ULL, 0x003f1f1f3f5f7f00ULL },
+    { 0x0083010000000000ULL, 0x00ff8301005e7e00ULL },{ 0x0007030100000000ULL, 0x00ff0703015e7e00ULL },{ 0x000f070301000000ULL, 0x00ff0f070f5f7f00ULL },{ 0x001f0f070f1f7f00ULL, 0x00ff1f1f3f5f7f00ULL },
+    { 0x00f8f0f0f8d8f800ULL, 0x00fcf8f8fcdcfc00ULL },{ 0x00f0e0e0f0587800ULL, 0x00f8f0f0f8d8fc00ULL },{ 0x00e0c0c060507800ULL, 0x00f1e0e0f0587c00ULL },{ 0x00c1800000407800ULL, 0x00e3c1c060507c00ULL },
+    { 0x0083010000007800ULL, 0x00c7830100407e00ULL },{ 0x0007030100007e00ULL, 0x008f070301007e00ULL },{ 0x000f070301007e00ULL, 0x001f0f070f1f7f00ULL },{ 0x001f0f070f1f7f00ULL, 0x003f1f1f3f5f7f00ULL },
+    { 0x00f8f0f0f8d8fc00ULL, 0x00fcf8f8fcdcfe00ULL },{ 0x00f0e0e0f0587c00ULL, 0x00f8f0f0f8dcfe00ULL },{ 0x00e0c0c060507c00ULL, 0x00f1e0e0f05c7e00ULL },{ 0x00c1800000407c00ULL, 0x00e3c1c0605c7e00ULL },
+    { 0x0083010000007c00ULL, 0x00c78301005e7e00ULL },{ 0x0007030100007e00ULL, 0x008f0703015e7e00ULL },{ 0x000f070301007e00ULL, 0x001f0f070f5f7f00ULL },{ 0x001f0f070f1f7f00ULL, 0x003f1f1f3f5f7f00ULL },
   },
   {
     { 0x00ffffffffbffc00ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbff800ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbff100ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbfe300ULL, 0x00ffffffffbfff00ULL },
-    { 0x00ffffffffbfe700ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbfef00ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbfff00ULL, 0x00ffffffffbfff00ULL },{ 0x00ff000000000000ULL, 0x00ffffffffbfff00ULL },
+    { 0x00ffffffffbfe700ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbfef00ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbfff00ULL, 0x00ffffffffbfff00ULL },{ 0x00ffffffffbfff00ULL, 0x00ffffffffbfff00ULL },
     { 0x00ffffffffb8f800ULL, 0x00ffffffffbffe00ULL },{ 0x00ffffffffb0f800ULL, 0x00ffffffffbffd00ULL },{ 0x00ffffffffb0f000ULL, 0x00ffffffffbffb00ULL },{ 0x00ffffffffa0e000ULL, 0x00ffffffffbff700ULL },
     { 0x00ffffffffa0e000ULL, 0x00ffffffffbfef00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffffff8b8f800ULL, 0x00ffffffffb8f800ULL },{ 0x00fffffff0b0f000ULL, 0x00ffffffffb8f800ULL },{ 0x00fffffff0b0f000ULL, 0x00ffffffffb0f000ULL },{ 0x00ffffffe0a0e000ULL, 0x00ffffffffb0e000ULL },
-    { 0x00ffffffe0a0c000ULL, 0x00ffffffffa0c000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffffe0a0e000ULL, 0x00ffffffffa0c000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffff8f8b8f800ULL, 0x00fffffff8b8f800ULL },{ 0x00fffff0f0307000ULL, 0x00fffffff8b8f800ULL },{ 0x00ffffe070307000ULL, 0x00fffffff0b0f000ULL },{ 0x00ffff4060206000ULL, 0x00fffffff0a0f000ULL },
     { 0x00ffff0040006000ULL, 0x00ffffffe080e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00fff0f0f8b8f800ULL, 0x00fffff8f8b8f800ULL },{ 0x00ffe0e0f0307000ULL, 0x00fffff8f8b8f800ULL },{ 0x00ffc0c060207000ULL, 0x00fffff0f0307000ULL },{ 0x00ff800040206000ULL, 0x00ffffe060307000ULL },
-    { 0x00ff010000006000ULL, 0x00ffff4140206000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301006000ULL },{ 0x00ff070301006000ULL, 0x00ffff0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff2f1f3f7f00ULL },
-    { 0x00f8f0f0f8b8f800ULL, 0x00fff8f8f8b8f800ULL },{ 0x00f0e0e0f0307000ULL, 0x00fff0f0f8b8f800ULL },{ 0x00e0c0c060306000ULL, 0x00ffe0e0f0307000ULL },{ 0x00c1800040206000ULL, 0x00ffc1c060307000ULL },
-    { 0x0083010000006000ULL, 0x00ff830140206000ULL },{ 0x0007030100000000ULL, 0x00ff070301387c00ULL },{ 0x000f070301000000ULL, 0x00ff0f0703217100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f1f3f7f00ULL },
-    { 0x00f8f0f0f8b8f800ULL, 0x00fcf8f8f8b8f800ULL },{ 0x00f0e0e0f0307000ULL, 0x00f8f0f0f8b8f800ULL },{ 0x00e0c0c060307000ULL, 0x00f1e0e0f0307000ULL },{ 0x00c1800040207000ULL, 0x00e3c1c060307000ULL },
-    { 0x0083010000007000ULL, 0x00c7830140206800ULL },{ 0x0007030100007000ULL, 0x008f070301007800ULL },{ 0x000f070301007c00ULL, 0x001f0f0703016900ULL },{ 0x001f0f0703016100ULL, 0x003f1f0f1f3f7f00ULL },
-    { 0x00f8f0f0f8b8f800ULL, 0x00fcf8f8f8b8fc00ULL },{ 0x00f0e0e0f0307000ULL, 0x00f8f0f0f8b8f800ULL },{ 0x00e0c0c060307000ULL, 0x00f1e0e0f0387c00ULL },{ 0x00c1800040207000ULL, 0x00e3c1c060387800ULL },
-    { 0x0083010000007000ULL, 0x00c7830140387800ULL },{ 0x0007030100007800ULL, 0x008f0703013c7e00ULL },{ 0x000f070301007000ULL, 0x001f0f07033d7f00ULL },{ 0x001f0f0703016100ULL, 0x003f1f0f1f3f7f00ULL },
+    { 0x00fff0f0f8b8f800ULL, 0x00fffff8f8b8f800ULL },{ 0x00ffe0e0f0307000ULL, 0x00fffff8f8b8f800ULL },{ 0x00ffc0c060307000ULL, 0x00fffff0f0307000ULL },{ 0x00ff800040206000ULL, 0x00ffffe060307000ULL },
+    { 0x00ff010000006000ULL, 0x00ffff4140206000ULL },{ 0x00ff030100000000ULL, 0x00ffff0301007e00ULL },{ 0x00ff070301007e00ULL, 0x00ffff0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff2f1f3f7f00ULL },
+    { 0x00f8f0f0f8b8f800ULL, 0x00fff8f8f8b8f800ULL },{ 0x00f0e0e0f0307000ULL, 0x00fff0f0f8b8f800ULL },{ 0x00e0c0c060307000ULL, 0x00ffe0e0f0307000ULL },{ 0x00c1800040206000ULL, 0x00ffc1c060307000ULL },
+    { 0x0083010000006000ULL, 0x00ff830140207000ULL },{ 0x0007030100000000ULL, 0x00ff0703013e7e00ULL },{ 0x000f070301000000ULL, 0x00ff0f07033f7f00ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f1f3f7f00ULL },
+    { 0x00f8f0f0f8b8f800ULL, 0x00fcf8f8f8b8f800ULL },{ 0x00f0e0e0f0307000ULL, 0x00f8f0f0f8b8f800ULL },{ 0x00e0c0c060307000ULL, 0x00f1e0e0f0307800ULL },{ 0x00c1800040207000ULL, 0x00e3c1c060307800ULL },
+    { 0x0083010000007000ULL, 0x00c7830140207800ULL },{ 0x0007030100007000ULL, 0x008f070301007e00ULL },{ 0x000f070301007e00ULL, 0x001f0f0703017f00ULL },{ 0x001f0f0703017f00ULL, 0x003f1f0f1f3f7f00ULL },
+    { 0x00f8f0f0f8b8f800ULL, 0x00fcf8f8f8b8fc00ULL },{ 0x00f0e0e0f0307800ULL, 0x00f8f0f0f8b8fc00ULL },{ 0x00e0c0c060307800ULL, 0x00f1e0e0f0387c00ULL },{ 0x00c1800040207800ULL, 0x00e3c1c060387c00ULL },
+    { 0x0083010000007800ULL, 0x00c7830140387c00ULL },{ 0x0007030100007800ULL, 0x008f0703013e7e00ULL },{ 0x000f070301007e00ULL, 0x001f0f07033f7f00ULL },{ 0x001f0f0703017f00ULL, 0x003f1f0f1f3f7f00ULL },
   },
   {
     { 0x00ffffffff7ffc00ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7ff800ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7ff100ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7fe300ULL, 0x00ffffffff7fff00ULL },
-    { 0x00ffffffff7fc700ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7fcf00ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7fdf00ULL, 0x00ffffffff7fff00ULL },{ 0x00ff000000000000ULL, 0x00ffffffff7fff00ULL },
+    { 0x00ffffffff7fc700ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7fcf00ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7fdf00ULL, 0x00ffffffff7fff00ULL },{ 0x00ffffffff7fff00ULL, 0x00ffffffff7fff00ULL },
     { 0x00ffffffff70f000ULL, 0x00ffffffff7ffe00ULL },{ 0x00ffffffff70f000ULL, 0x00ffffffff7ffd00ULL },{ 0x00ffffffff60f000ULL, 0x00ffffffff7ffb00ULL },{ 0x00ffffffff60e000ULL, 0x00ffffffff7ff700ULL },
     { 0x00ffffffff404000ULL, 0x00ffffffff7fef00ULL },{ 0x00ffffffff404000ULL, 0x00ffffffff7fdf00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffffff070f000ULL, 0x00ffffffff78f800ULL },{ 0x00fffffff070f000ULL, 0x00ffffffff70f000ULL },{ 0x00ffffffe060e000ULL, 0x00ffffffff70f000ULL },{ 0x00ffffffe060e000ULL, 0x00ffffffff60e000ULL },
-    { 0x00ffffff40404000ULL, 0x00ffffffff60c000ULL },{ 0x00ffffff40400000ULL, 0x00ffffffff400000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffff40404000ULL, 0x00ffffffff60c000ULL },{ 0x00ffffff40404000ULL, 0x00ffffffff400000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffff0f070f000ULL, 0x00fffffff878f800ULL },{ 0x00fffff0f0707000ULL, 0x00fffffff070f000ULL },{ 0x00ffffe060606000ULL, 0x00fffffff070f000ULL },{ 0x00ffff4060606000ULL, 0x00ffffffe060e000ULL },
     { 0x00ffff0040404000ULL, 0x00ffffffe040e000ULL },{ 0x00ffff0100004000ULL, 0x00ffffff41004000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fff0f0f070f000ULL, 0x00fffff8f878f800ULL },{ 0x00ffe0e0f0707000ULL, 0x00fffff0f070f000ULL },{ 0x00ffc0c060606000ULL, 0x00fffff0f0707000ULL },{ 0x00ff800040606000ULL, 0x00ffffe060606000ULL },
-    { 0x00ff010000404000ULL, 0x00ffff4140606000ULL },{ 0x00ff030100004000ULL, 0x00ffff0301404000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703014100ULL },{ 0x00ff0f0703014100ULL, 0x00ffff0f07030300ULL },
+    { 0x00ff010000404000ULL, 0x00ffff4140606000ULL },{ 0x00ff030100004000ULL, 0x00ffff0301404000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703017f00ULL },{ 0x00ff0f0703017f00ULL, 0x00ffff0f07030300ULL },
     { 0x00f8f0f0f070f000ULL, 0x00fff8f8f878f800ULL },{ 0x00f0e0e0f0707000ULL, 0x00fff0f0f070f000ULL },{ 0x00e0c0c060606000ULL, 0x00ffe0e0f0707000ULL },{ 0x00c1800040606000ULL, 0x00ffc1c060606000ULL },
-    { 0x0083010000404000ULL, 0x00ff830140606000ULL },{ 0x0007030100004000ULL, 0x00ff070301406000ULL },{ 0x000f070301000000ULL, 0x00ff0f0703717100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f07477300ULL },
-    { 0x00f8f0f0f070f000ULL, 0x00fcf8f8f878f800ULL },{ 0x00f0e0e0f0707000ULL, 0x00f8f0f0f070f000ULL },{ 0x00e0c0c060606000ULL, 0x00f1e0e0f0707000ULL },{ 0x00c1800040606000ULL, 0x00e3c1c060606000ULL },
-    { 0x0083010000406000ULL, 0x00c7830140607000ULL },{ 0x0007030100006000ULL, 0x008f070301407000ULL },{ 0x000f070301004000ULL, 0x001f0f0703017900ULL },{ 0x001f0f0703016100ULL, 0x003f1f0f07036300ULL },
-    { 0x00f8f0f0f070f000ULL, 0x00fcf8f8f878f800ULL },{ 0x00f0e0e0f0707000ULL, 0x00f8f0f0f070f800ULL },{ 0x00e0c0c060606000ULL, 0x00f1e0e0f0707800ULL },{ 0x00c1800040606000ULL, 0x00e3c1c060707000ULL },
-    { 0x0083010000406000ULL, 0x00c7830140707000ULL },{ 0x0007030100006000ULL, 0x008f070301707000ULL },{ 0x000f070301005000ULL, 0x001f0f0703797900ULL },{ 0x001f0f0703014100ULL, 0x003f1f0f077b7f00ULL },
+    { 0x0083010000404000ULL, 0x00ff830140606000ULL },{ 0x0007030100004000ULL, 0x00ff070301406000ULL },{ 0x000f070301000000ULL, 0x00ff0f07037f7f00ULL },{ 0x001f0f0703010300ULL, 0x00ff1f0f077f7f00ULL },
+    { 0x00f8f0f0f070f000ULL, 0x00fcf8f8f878f800ULL },{ 0x00f0e0e0f0707000ULL, 0x00f8f0f0f070f000ULL },{ 0x00e0c0c060606000ULL, 0x00f1e0e0f0707000ULL },{ 0x00c1800040606000ULL, 0x00e3c1c060607000ULL },
+    { 0x0083010000406000ULL, 0x00c7830140607000ULL },{ 0x0007030100006000ULL, 0x008f070301407000ULL },{ 0x000f070301006000ULL, 0x001f0f0703017f00ULL },{ 0x001f0f0703017f00ULL, 0x003f1f0f07037f00ULL },
+    { 0x00f8f0f0f070f000ULL, 0x00fcf8f8f878f800ULL },{ 0x00f0e0e0f0707000ULL, 0x00f8f0f0f070f800ULL },{ 0x00e0c0c060607000ULL, 0x00f1e0e0f0707800ULL },{ 0x00c1800040607000ULL, 0x00e3c1c060707800ULL },
+    { 0x0083010000407000ULL, 0x00c7830140707800ULL },{ 0x0007030100007000ULL, 0x008f070301707800ULL },{ 0x000f070301007000ULL, 0x001f0f07037f7f00ULL },{ 0x001f0f0703017f00ULL, 0x003f1f0f077f7f00ULL },
   },
   {
     { 0x00fffffffefffc00ULL, 0x00fffffffeffff00ULL },{ 0x00fffffffefff800ULL, 0x00fffffffeffff00ULL },{ 0x00fffffffefff100ULL, 0x00fffffffeffff00ULL },{ 0x00fffffffeffe300ULL, 0x00fffffffeffff00ULL },
@@ -442,17 +442,17 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffffffefffc00ULL, 0x00fffffffefffe00ULL },{ 0x00fffffffe030800ULL, 0x00fffffffefffd00ULL },{ 0x00fffffffe030100ULL, 0x00fffffffefffb00ULL },{ 0x00fffffffe030300ULL, 0x00fffffffefff700ULL },
     { 0x00fffffffe070700ULL, 0x00fffffffeffef00ULL },{ 0x00fffffffe070f00ULL, 0x00fffffffeffdf00ULL },{ 0x00fffffffe0f0f00ULL, 0x00fffffffeffbf00ULL },{ 0x00fffffffe0f0f00ULL, 0x00fffffffeff7f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff02020000ULL, 0x00fffffffe030100ULL },{ 0x00ffffff02020200ULL, 0x00fffffffe070300ULL },
-    { 0x00ffffff06070700ULL, 0x00fffffffe070700ULL },{ 0x00ffffff06070700ULL, 0x00fffffffe0f0f00ULL },{ 0x00ffffff0e0f0700ULL, 0x00fffffffe0f0f00ULL },{ 0x00ffffff0e0f0f00ULL, 0x00fffffffe1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff8202000200ULL, 0x00ffffff82000200ULL },{ 0x00ffff0202020200ULL, 0x00ffffff06030700ULL },
+    { 0x00ffffff06070700ULL, 0x00fffffffe070700ULL },{ 0x00ffffff06070700ULL, 0x00fffffffe0f0f00ULL },{ 0x00ffffff0e0f0f00ULL, 0x00fffffffe0f0f00ULL },{ 0x00ffffff0e0f0f00ULL, 0x00fffffffe1f1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff8202020200ULL, 0x00ffffff82000200ULL },{ 0x00ffff0202020200ULL, 0x00ffffff06030700ULL },
     { 0x00ffff0706070700ULL, 0x00ffffff06070700ULL },{ 0x00ffff0706070700ULL, 0x00ffffff0e0f0f00ULL },{ 0x00ffff0f0e0f0f00ULL, 0x00ffffff0e0f0f00ULL },{ 0x00ffff0f0e0f0f00ULL, 0x00ffffff1e1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffc08000020200ULL, 0x00ffffc280020200ULL },{ 0x00ff800202020200ULL, 0x00ffff8702070700ULL },
     { 0x00ff030606060600ULL, 0x00ffff0706070700ULL },{ 0x00ff070706060600ULL, 0x00ffff0f0e0f0f00ULL },{ 0x00ff0f0f0e0f0f00ULL, 0x00ffff0f0e0f0f00ULL },{ 0x00ff0f0f0e0f0f00ULL, 0x00ffff1f1e1f1f00ULL },
-    { 0x00f8f0e0c08e9600ULL, 0x00fff8f0e0c0c600ULL },{ 0x00f0e0c080000200ULL, 0x00fff0e0c09e8e00ULL },{ 0x00e0c08000020200ULL, 0x00ffe0c082020600ULL },{ 0x00c1800002020200ULL, 0x00ffc38206060600ULL },
+    { 0x00f8f0e0c0fefe00ULL, 0x00fff8f0e0c0fe00ULL },{ 0x00f0e0c080000200ULL, 0x00fff0e0c0fefe00ULL },{ 0x00e0c08000020200ULL, 0x00ffe0c082020600ULL },{ 0x00c1800002020200ULL, 0x00ffc38206060600ULL },
     { 0x0083030206060600ULL, 0x00ff870706060600ULL },{ 0x0007070706060600ULL, 0x00ff0f0f0e0f0f00ULL },{ 0x000f0f0f0e0f0f00ULL, 0x00ff0f0f0e0f0f00ULL },{ 0x001f0f0f0e0f0f00ULL, 0x00ff1f1f1e1f1f00ULL },
-    { 0x00f8f0e0c080a600ULL, 0x00fcfcf8fefefe00ULL },{ 0x00f0e0c080000600ULL, 0x00f8f8e0fefe9e00ULL },{ 0x00e0c08000020200ULL, 0x00f1e0c082060600ULL },{ 0x00c1800002020200ULL, 0x00e3c38206060e00ULL },
-    { 0x0083030206060600ULL, 0x00c7870706060600ULL },{ 0x0007070706060600ULL, 0x008f0f0f0e0f0f00ULL },{ 0x000f0f0f0e0f0f00ULL, 0x001f0f0f0e0f0f00ULL },{ 0x001f0f0f0e0f0f00ULL, 0x003f1f1f1e1f1f00ULL },
-    { 0x00f8f8e0c09ebe00ULL, 0x00fcfcf8e0dede00ULL },{ 0x00f0e0c080060600ULL, 0x00f8f8e0c0bebe00ULL },{ 0x00e0c08000060600ULL, 0x00f1e0c0820e1e00ULL },{ 0x00c1800002060600ULL, 0x00e3c382060e0e00ULL },
-    { 0x0083030206060e00ULL, 0x00c78707060e0e00ULL },{ 0x0007070706060600ULL, 0x008f0f0f0e0f0f00ULL },{ 0x000f0f0f0e0f0f00ULL, 0x001f0f0f0e0f0f00ULL },{ 0x001f0f0f0e0f0f00ULL, 0x003f1f1f1e1f1f00ULL },
+    { 0x00f8f0e0c0c0fe00ULL, 0x00fcfcf8fefefe00ULL },{ 0x00f0e0c080000600ULL, 0x00f8f8e0fefefe00ULL },{ 0x00e0c08000020600ULL, 0x00f1e0c082060e00ULL },{ 0x00c1800002020600ULL, 0x00e3c38206060e00ULL },
+    { 0x0083030206060600ULL, 0x00c7870706060e00ULL },{ 0x0007070706060600ULL, 0x008f0f0f0e0f0f00ULL },{ 0x000f0f0f0e0f0f00ULL, 0x001f0f0f0e0f0f00ULL },{ 0x001f0f0f0e0f0f00ULL, 0x003f1f1f1e1f1f00ULL },
+    { 0x00f8f8e0c0fefe00ULL, 0x00fcfcf8e0fefe00ULL },{ 0x00f0e0c080060e00ULL, 0x00f8f8e0c0fefe00ULL },{ 0x00e0c08000060e00ULL, 0x00f1e0c0820e1e00ULL },{ 0x00c1800002060e00ULL, 0x00e3c382060e1e00ULL },
+    { 0x0083030206060e00ULL, 0x00c78707060e1e00ULL },{ 0x0007070706060e00ULL, 0x008f0f0f0e0f1f00ULL },{ 0x000f0f0f0e0f0f00ULL, 0x001f0f0f0e0f1f00ULL },{ 0x001f0f0f0e0f0f00ULL, 0x003f1f1f1e1f1f00ULL },
   },
   {
     { 0x00fffffffdfffc00ULL, 0x00fffffffdffff00ULL },{ 0x00fffffffdfff800ULL, 0x00fffffffdffff00ULL },{ 0x00fffffffdfff100ULL, 0x00fffffffdffff00ULL },{ 0x00fffffffdffe300ULL, 0x00fffffffdffff00ULL },
@@ -461,16 +461,16 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffffffd070700ULL, 0x00fffffffdffef00ULL },{ 0x00fffffffd0f0f00ULL, 0x00fffffffdffdf00ULL },{ 0x00fffffffd0f1f00ULL, 0x00fffffffdffbf00ULL },{ 0x00fffffffd1f1f00ULL, 0x00fffffffdff7f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff05070300ULL, 0x00fffffffd070300ULL },
     { 0x00ffffff05070700ULL, 0x00fffffffd0f0700ULL },{ 0x00ffffff0d0f0f00ULL, 0x00fffffffd0f0f00ULL },{ 0x00ffffff0d0f0f00ULL, 0x00fffffffd1f1f00ULL },{ 0x00ffffff1d1f1f00ULL, 0x00fffffffd1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff0705030700ULL, 0x00ffffff05030700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff0705070700ULL, 0x00ffffff05030700ULL },
     { 0x00ffff0705070700ULL, 0x00ffffff0d070f00ULL },{ 0x00ffff0f0d0f0f00ULL, 0x00ffffff0d0f0f00ULL },{ 0x00ffff0f0d0f0f00ULL, 0x00ffffff1d1f1f00ULL },{ 0x00ffff1f1d1f1f00ULL, 0x00ffffff1d1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff800200060600ULL, 0x00ffff8701070700ULL },
     { 0x00ff030604060600ULL, 0x00ffff0f050f0f00ULL },{ 0x00ff070f0c0e0e00ULL, 0x00ffff0f0d0f0f00ULL },{ 0x00ff0f0f0d0f0f00ULL, 0x00ffff1f1d1f1f00ULL },{ 0x00ff1f1f1d1f1f00ULL, 0x00ffff1f1d1f1f00ULL },
-    { 0x00f8f0e0c0808e00ULL, 0x00fffcf8fcfefe00ULL },{ 0x00f0e0c0801e3e00ULL, 0x00fff0e0c0808e00ULL },{ 0x00e0c08000000600ULL, 0x00ffe0c0803e1e00ULL },{ 0x00c1800000060600ULL, 0x00ffc38204060600ULL },
+    { 0x00f8f0e0c080fe00ULL, 0x00fffcf8fcfefe00ULL },{ 0x00f0e0c0807e7e00ULL, 0x00fff0e0c080fe00ULL },{ 0x00e0c08000000600ULL, 0x00ffe0c0807e7e00ULL },{ 0x00c1800000060600ULL, 0x00ffc38204060e00ULL },
     { 0x0083030204060600ULL, 0x00ff87070c0e0e00ULL },{ 0x000707070c0e0e00ULL, 0x00ff0f0f0d0f0f00ULL },{ 0x000f0f0f0d0f0f00ULL, 0x00ff1f1f1d1f1f00ULL },{ 0x001f1f1f1d1f1f00ULL, 0x00ff1f1f1d1f1f00ULL },
-    { 0x00f8f0e0c0808e00ULL, 0x00fcfcf8fcfefe00ULL },{ 0x00f0e0c080001600ULL, 0x00f8f8f0fcbefe00ULL },{ 0x00e0c08000000600ULL, 0x00f1f0c0fc7e7e00ULL },{ 0x00c1800000060600ULL, 0x00e3c382040e0e00ULL },
-    { 0x0083030204060600ULL, 0x00c787070c0e1e00ULL },{ 0x000707070c0e0e00ULL, 0x008f0f0f0d0f1f00ULL },{ 0x000f0f0f0d0f0f00ULL, 0x001f1f1f1d1f1f00ULL },{ 0x001f1f1f1d1f1f00ULL, 0x003f1f1f1d1f1f00ULL },
-    { 0x00f8f8f0c0bebe00ULL, 0x00fcfcf8fcfefe00ULL },{ 0x00f0f0c0803e3e00ULL, 0x00f8f8f0c0befe00ULL },{ 0x00e0c080000e0e00ULL, 0x00f1f0c0807e7e00ULL },{ 0x00c18000000e0e00ULL, 0x00e3c382041e1e00ULL },
-    { 0x00830302040e0e00ULL, 0x00c787070c1e3e00ULL },{ 0x000707070c0e0e00ULL, 0x008f0f0f0d1f1f00ULL },{ 0x000f0f0f0d0f0f00ULL, 0x001f1f1f1d1f1f00ULL },{ 0x001f1f1f1d1f1f00ULL, 0x003f1f1f1d1f3f00ULL },
+    { 0x00f8f0e0c080fe00ULL, 0x00fcfcf8fcfefe00ULL },{ 0x00f0e0c080007e00ULL, 0x00f8f8f0fcfefe00ULL },{ 0x00e0c08000000e00ULL, 0x00f1f0c0fc7e7e00ULL },{ 0x00c1800000060e00ULL, 0x00e3c382040e1e00ULL },
+    { 0x0083030204060e00ULL, 0x00c787070c0e1e00ULL },{ 0x000707070c0e0e00ULL, 0x008f0f0f0d0f1f00ULL },{ 0x000f0f0f0d0f0f00ULL, 0x001f1f1f1d1f1f00ULL },{ 0x001f1f1f1d1f1f00ULL, 0x003f1f1f1d1f1f00ULL },
+    { 0x00f8f8f0c0fefe00ULL, 0x00fcfcf8fcfefe00ULL },{ 0x00f0f0c0807e7e00ULL, 0x00f8f8f0c0fefe00ULL },{ 0x00e0c080000e1e00ULL, 0x00f1f0c0807e7e00ULL },{ 0x00c18000000e1e00ULL, 0x00e3c382041e3e00ULL },
+    { 0x00830302040e1e00ULL, 0x00c787070c1e3e00ULL },{ 0x000707070c0e1e00ULL, 0x008f0f0f0d1f3f00ULL },{ 0x000f0f0f0d0f1f00ULL, 0x001f1f1f1d1f3f00ULL },{ 0x001f1f1f1d1f1f00ULL, 0x003f1f1f1d1f3f00ULL },
   },
   {
     { 0x00fffffffbfffc00ULL, 0x00fffffffbffff00ULL },{ 0x00fffffffbfff800ULL, 0x00fffffffbffff00ULL },{ 0x00fffffffbfff100ULL, 0x00fffffffbffff00ULL },{ 0x00fffffffbffe300ULL, 0x00fffffffbffff00ULL },
@@ -479,16 +479,16 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffffffb0f0700ULL, 0x00fffffffbffef00ULL },{ 0x00fffffffb0f0f00ULL, 0x00fffffffbffdf00ULL },{ 0x00fffffffb1f1f00ULL, 0x00fffffffbffbf00ULL },{ 0x00fffffffb1f3f00ULL, 0x00fffffffbff7f00ULL },
     { 0x00fffffffafefc00ULL, 0x00fffffffbfefc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00ffffff0b0f0700ULL, 0x00fffffffb0f0700ULL },{ 0x00ffffff0b0f0f00ULL, 0x00fffffffb1f0f00ULL },{ 0x00ffffff1b1f1f00ULL, 0x00fffffffb1f1f00ULL },{ 0x00ffffff1b1f1f00ULL, 0x00fffffffb3f3f00ULL },
-    { 0x00fffffef8fcfc00ULL, 0x00fffffffafcfe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ffff0f0b070f00ULL, 0x00ffffff0b070f00ULL },{ 0x00ffff0f0b0f0f00ULL, 0x00ffffff1b0f1f00ULL },{ 0x00ffff1f1b1f1f00ULL, 0x00ffffff1b1f1f00ULL },{ 0x00ffff1f1b1f1f00ULL, 0x00ffffff3b3f3f00ULL },
+    { 0x00fffffefafefe00ULL, 0x00fffffffafcfe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffff0f0b0f0f00ULL, 0x00ffffff0b070f00ULL },{ 0x00ffff0f0b0f0f00ULL, 0x00ffffff1b0f1f00ULL },{ 0x00ffff1f1b1f1f00ULL, 0x00ffffff1b1f1f00ULL },{ 0x00ffff1f1b1f1f00ULL, 0x00ffffff3b3f3f00ULL },
     { 0x00fff8f4f8fefe00ULL, 0x00fffffef8fefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ff030402060e00ULL, 0x00ffff0f030f0f00ULL },{ 0x00ff070f0a0e0e00ULL, 0x00ffff1f0b1f1f00ULL },{ 0x00ff0f1f1b1f1f00ULL, 0x00ffff1f1b1f1f00ULL },{ 0x00ff1f1f1b1f1f00ULL, 0x00ffff3f3b3f3f00ULL },
-    { 0x00f8f8f0f8fefe00ULL, 0x00fffcfcfafefe00ULL },{ 0x00f0e0c080000e00ULL, 0x00fff8f0f8fefe00ULL },{ 0x00e0c080003e5e00ULL, 0x00ffe0c080002e00ULL },{ 0x00c1800000000e00ULL, 0x00ffc380023e7e00ULL },
+    { 0x00ff0304020e0e00ULL, 0x00ffff0f030f0f00ULL },{ 0x00ff070f0a0e0e00ULL, 0x00ffff1f0b1f1f00ULL },{ 0x00ff0f1f1b1f1f00ULL, 0x00ffff1f1b1f1f00ULL },{ 0x00ff1f1f1b1f1f00ULL, 0x00ffff3f3b3f3f00ULL },
+    { 0x00f8f8f0f8fefe00ULL, 0x00fffcfcfafefe00ULL },{ 0x00f0e0c080007e00ULL, 0x00fff8f0f8fefe00ULL },{ 0x00e0c080007e7e00ULL, 0x00ffe0c080007e00ULL },{ 0x00c1800000000e00ULL, 0x00ffc380027e7e00ULL },
     { 0x00830300020e0e00ULL, 0x00ff87070a0e1e00ULL },{ 0x000707070a0e0e00ULL, 0x00ff0f0f1b1f1f00ULL },{ 0x000f0f0f1b1f1f00ULL, 0x00ff1f1f1b1f1f00ULL },{ 0x001f1f1f1b1f1f00ULL, 0x00ff3f3f3b3f3f00ULL },
-    { 0x00f8f8f0f8fefe00ULL, 0x00fcfcfcfafefe00ULL },{ 0x00f0e0c080002e00ULL, 0x00f8f8f0fafefe00ULL },{ 0x00e0c08000003e00ULL, 0x00f1f0e0fa7e7e00ULL },{ 0x00c1800000001e00ULL, 0x00e3e3803a7e7e00ULL },
-    { 0x00830300020e1e00ULL, 0x00c787070a1e1e00ULL },{ 0x000707070a0e0e00ULL, 0x008f0f0f1b1f3f00ULL },{ 0x000f0f0f1b1f1f00ULL, 0x001f1f1f1b1f3f00ULL },{ 0x001f1f1f1b1f1f00ULL, 0x003f3f3f3b3f3f00ULL },
-    { 0x00f8f8f0f8fefe00ULL, 0x00fcfcfcfafefe00ULL },{ 0x00f0f0e0803e7e00ULL, 0x00f8f8f0f8fefe00ULL },{ 0x00e0e080007e7e00ULL, 0x00f1f0e0803e7e00ULL },{ 0x00c18000001e1e00ULL, 0x00e3e380027e7e00ULL },
-    { 0x00830300021e3e00ULL, 0x00c787070a3e3e00ULL },{ 0x000707070a1e1e00ULL, 0x008f0f0f1b3f7f00ULL },{ 0x000f0f0f1b1f1f00ULL, 0x001f1f1f1b3f7f00ULL },{ 0x001f1f1f1b1f1f00ULL, 0x003f3f3f3b3f3f00ULL },
+    { 0x00f8f8f0f8fefe00ULL, 0x00fcfcfcfafefe00ULL },{ 0x00f0e0c080007e00ULL, 0x00f8f8f0fafefe00ULL },{ 0x00e0c08000007e00ULL, 0x00f1f0e0fa7e7e00ULL },{ 0x00c1800000001e00ULL, 0x00e3e3807a7e7e00ULL },
+    { 0x00830300020e1e00ULL, 0x00c787070a1e3e00ULL },{ 0x000707070a0e1e00ULL, 0x008f0f0f1b1f3f00ULL },{ 0x000f0f0f1b1f1f00ULL, 0x001f1f1f1b1f3f00ULL },{ 0x001f1f1f1b1f1f00ULL, 0x003f3f3f3b3f3f00ULL },
+    { 0x00f8f8f0f8fefe00ULL, 0x00fcfcfcfafefe00ULL },{ 0x00f0f0e0807e7e00ULL, 0x00f8f8f0f8fefe00ULL },{ 0x00e0e080007e7e00ULL, 0x00f1f0e0807e7e00ULL },{ 0x00c18000001e3e00ULL, 0x00e3e380027e7e00ULL },
+    { 0x00830300021e3e00ULL, 0x00c787070a3e7e00ULL },{ 0x000707070a1e3e00ULL, 0x008f0f0f1b3f7f00ULL },{ 0x000f0f0f1b1f3f00ULL, 0x001f1f1f1b3f7f00ULL },{ 0x001f1f1f1b1f3f00ULL, 0x003f3f3f3b3f7f00ULL },
   },
   {
     { 0x00fffffff7fffc00ULL, 0x00fffffff7ffff00ULL },{ 0x00fffffff7fff800ULL, 0x00fffffff7ffff00ULL },{ 0x00fffffff7fff100ULL, 0x00fffffff7ffff00ULL },{ 0x00fffffff7ffe300ULL, 0x00fffffff7ffff00ULL },
@@ -497,16 +497,16 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffffff71f4700ULL, 0x00fffffff7ffef00ULL },{ 0x00fffffff71f0f00ULL, 0x00fffffff7ffdf00ULL },{ 0x00fffffff71f1f00ULL, 0x00fffffff7ffbf00ULL },{ 0x00fffffff73f3f00ULL, 0x00fffffff7ff7f00ULL },
     { 0x00fffffff4fcfc00ULL, 0x00fffffff7fefc00ULL },{ 0x00fffffff4fcf800ULL, 0x00fffffff7fcf800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff171f0f00ULL, 0x00fffffff71f0f00ULL },{ 0x00ffffff171f1f00ULL, 0x00fffffff73f1f00ULL },{ 0x00ffffff373f3f00ULL, 0x00fffffff73f3f00ULL },
-    { 0x00fffffcf4fcfc00ULL, 0x00fffffff6fcfe00ULL },{ 0x00fffffcf4f8fc00ULL, 0x00fffffff4f8fc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff1f170f1f00ULL, 0x00ffffff170f1f00ULL },{ 0x00ffff1f171f1f00ULL, 0x00ffffff371f3f00ULL },{ 0x00ffff3f373f3f00ULL, 0x00ffffff373f3f00ULL },
+    { 0x00fffffcf4fcfc00ULL, 0x00fffffff6fcfe00ULL },{ 0x00fffffcf4fcfc00ULL, 0x00fffffff4f8fc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff1f171f1f00ULL, 0x00ffffff170f1f00ULL },{ 0x00ffff1f171f1f00ULL, 0x00ffffff371f3f00ULL },{ 0x00ffff3f373f3f00ULL, 0x00ffffff373f3f00ULL },
     { 0x00fff8fcf4fcfc00ULL, 0x00fffffef4fefe00ULL },{ 0x00fff0e8f0fcfc00ULL, 0x00fffffcf0fcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff070b061e1e00ULL, 0x00ffff1f071f1f00ULL },{ 0x00ff0f1f171f1f00ULL, 0x00ffff3f173f3f00ULL },{ 0x00ff1f3f373f3f00ULL, 0x00ffff3f373f3f00ULL },
-    { 0x00f8f8f8f4fcfc00ULL, 0x00fffcfcf6fefe00ULL },{ 0x00f0f0e0f0fcfc00ULL, 0x00fff8f8f4fcfe00ULL },{ 0x00e0c08000005c00ULL, 0x00fff0e0f0fefe00ULL },{ 0x00c18000007e7e00ULL, 0x00ffc18000003e00ULL },
-    { 0x0083010000001c00ULL, 0x00ff8703067e7e00ULL },{ 0x00070703061e1e00ULL, 0x00ff0f0f171f1f00ULL },{ 0x000f0f0f171f1f00ULL, 0x00ff1f1f373f3f00ULL },{ 0x001f1f1f373f3f00ULL, 0x00ff3f3f373f3f00ULL },
-    { 0x00f8f8f8f4fcfc00ULL, 0x00fcfcfcf6fefe00ULL },{ 0x00f0f0e0f0fcfe00ULL, 0x00f8f8f8f4fefe00ULL },{ 0x00e0c08000007c00ULL, 0x00f1f0e0f6fefe00ULL },{ 0x00c1800000005e00ULL, 0x00e3e3c0767e7e00ULL },
-    { 0x0083010000001800ULL, 0x00c7c703767e7e00ULL },{ 0x00070703061e1e00ULL, 0x008f0f0f173f3f00ULL },{ 0x000f0f0f171f1f00ULL, 0x001f1f1f373f3f00ULL },{ 0x001f1f1f373f3f00ULL, 0x003f3f3f373f7f00ULL },
+    { 0x00f8f8f8f4fcfc00ULL, 0x00fffcfcf6fefe00ULL },{ 0x00f0f0e0f0fcfc00ULL, 0x00fff8f8f4fcfe00ULL },{ 0x00e0c08000007c00ULL, 0x00fff0e0f0fefe00ULL },{ 0x00c18000007e7e00ULL, 0x00ffc18000007e00ULL },
+    { 0x0083010000001e00ULL, 0x00ff8703067e7e00ULL },{ 0x00070703061e1e00ULL, 0x00ff0f0f171f3f00ULL },{ 0x000f0f0f171f1f00ULL, 0x00ff1f1f373f3f00ULL },{ 0x001f1f1f373f3f00ULL, 0x00ff3f3f373f3f00ULL },
+    { 0x00f8f8f8f4fcfe00ULL, 0x00fcfcfcf6fefe00ULL },{ 0x00f0f0e0f0fcfe00ULL, 0x00f8f8f8f4fefe00ULL },{ 0x00e0c08000007e00ULL, 0x00f1f0e0f6fefe00ULL },{ 0x00c1800000007e00ULL, 0x00e3e3c0767e7e00ULL },
+    { 0x0083010000003e00ULL, 0x00c7c703767e7e00ULL },{ 0x00070703061e3e00ULL, 0x008f0f0f173f7f00ULL },{ 0x000f0f0f171f3f00ULL, 0x001f1f1f373f7f00ULL },{ 0x001f1f1f373f3f00ULL, 0x003f3f3f373f7f00ULL },
     { 0x00f8f8f8f4fefe00ULL, 0x00fcfcfcf6fefe00ULL },{ 0x00f0f0e0f0fefe00ULL, 0x00f8f8f8f4fefe00ULL },{ 0x00e0e0c0007e7e00ULL, 0x00f1f0e0f0fefe00ULL },{ 0x00c1c000007e7e00ULL, 0x00e3e3c0007e7e00ULL },
-    { 0x00830300003e3e00ULL, 0x00c7c703067e7e00ULL },{ 0x00070703063e7e00ULL, 0x008f0f0f177f7f00ULL },{ 0x000f0f0f173f3f00ULL, 0x001f1f1f377f7f00ULL },{ 0x001f1f1f373f3f00ULL, 0x003f3f3f377f7f00ULL },
+    { 0x00830300003e7e00ULL, 0x00c7c703067e7e00ULL },{ 0x00070703063e7e00ULL, 0x008f0f0f177f7f00ULL },{ 0x000f0f0f173f7f00ULL, 0x001f1f1f377f7f00ULL },{ 0x001f1f1f373f7f00ULL, 0x003f3f3f377f7f00ULL },
   },
   {
     { 0x00ffffffeffffc00ULL, 0x00ffffffefffff00ULL },{ 0x00ffffffeffff800ULL, 0x00ffffffefffff00ULL },{ 0x00ffffffeffff100ULL, 0x00ffffffefffff00ULL },{ 0x00ffffffefffe300ULL, 0x00ffffffefffff00ULL },
@@ -515,16 +515,16 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffffffefffc700ULL, 0x00ffffffefffef00ULL },{ 0x00ffffffef3f8f00ULL, 0x00ffffffefffdf00ULL },{ 0x00ffffffef3f1f00ULL, 0x00ffffffefffbf00ULL },{ 0x00ffffffef3f3f00ULL, 0x00ffffffefff7f00ULL },
     { 0x00ffffffecfcfc00ULL, 0x00ffffffeffcfc00ULL },{ 0x00ffffffe8f8f800ULL, 0x00ffffffeffcf800ULL },{ 0x00ffffffe8f8f000ULL, 0x00ffffffeff8f000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff2f3f1f00ULL, 0x00ffffffef3f1f00ULL },{ 0x00ffffff2f3f3f00ULL, 0x00ffffffef7f3f00ULL },
-    { 0x00fffffcecfcfc00ULL, 0x00ffffffecfcfc00ULL },{ 0x00fffff8e8f8f800ULL, 0x00ffffffecf8fc00ULL },{ 0x00fffff8e8f0f800ULL, 0x00ffffffe8f0f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff3f2f1f3f00ULL, 0x00ffffff2f1f3f00ULL },{ 0x00ffff3f2f3f3f00ULL, 0x00ffffff6f3f7f00ULL },
+    { 0x00fffffcecfcfc00ULL, 0x00ffffffecfcfc00ULL },{ 0x00fffff8e8f8f800ULL, 0x00ffffffecf8fc00ULL },{ 0x00fffff8e8f8f800ULL, 0x00ffffffe8f0f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff3f2f3f3f00ULL, 0x00ffffff2f1f3f00ULL },{ 0x00ffff3f2f3f3f00ULL, 0x00ffffff6f3f7f00ULL },
     { 0x00fff8fcecfcfc00ULL, 0x00fffffcecfcfc00ULL },{ 0x00fff0f8e8f8f800ULL, 0x00fffffce8fcfc00ULL },{ 0x00ffe0d060787800ULL, 0x00fffff8e0f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff0f170f3f3f00ULL, 0x00ffff3f0f3f3f00ULL },{ 0x00ff1f3f2f3f3f00ULL, 0x00ffff7f2f7f7f00ULL },
-    { 0x00f8f8f8ecfcfc00ULL, 0x00fffcfcecfcfc00ULL },{ 0x00f0f0f0e8f8f800ULL, 0x00fff8f8ecfcfc00ULL },{ 0x00e0e0c060787800ULL, 0x00fff0f0e8f8fc00ULL },{ 0x00c1800000007800ULL, 0x00ffe1c0607c7e00ULL },
-    { 0x00830100007e7c00ULL, 0x00ff830100007c00ULL },{ 0x0007030100003c00ULL, 0x00ff0f070f7f7f00ULL },{ 0x000f0f070f3f3f00ULL, 0x00ff1f1f2f3f3f00ULL },{ 0x001f1f1f2f3f3f00ULL, 0x00ff3f3f6f7f7f00ULL },
-    { 0x00f8f8f8ecfcfc00ULL, 0x00fcfcfcecfcfc00ULL },{ 0x00f0f0f0e8f8fc00ULL, 0x00f8f8f8ecfcfe00ULL },{ 0x00e0e0c060787c00ULL, 0x00f1f0f0e8fcfc00ULL },{ 0x00c1800000007800ULL, 0x00e3e3c06e7e7e00ULL },
-    { 0x0083010000007a00ULL, 0x00c7c7036e7e7e00ULL },{ 0x0007030100007c00ULL, 0x008f0f076f7f7f00ULL },{ 0x000f0f070f3f7f00ULL, 0x001f1f1f2f7f7f00ULL },{ 0x001f1f1f2f3f7f00ULL, 0x003f3f3f6f7f7f00ULL },
-    { 0x00f8f8f8ecfcfc00ULL, 0x00fcfcfcecfefe00ULL },{ 0x00f0f0f0e8fcfe00ULL, 0x00f8f8f8ecfefe00ULL },{ 0x00e0e0c0607c7c00ULL, 0x00f1f0f0e8fefe00ULL },{ 0x00c1c000007c7c00ULL, 0x00e3e3c0607e7e00ULL },
-    { 0x00830300007e7e00ULL, 0x00c7c703007e7e00ULL },{ 0x00070703003e7e00ULL, 0x008f0f070f7f7f00ULL },{ 0x000f0f070f7f7f00ULL, 0x001f1f1f2f7f7f00ULL },{ 0x001f1f1f2f7f7f00ULL, 0x003f3f3f6f7f7f00ULL },
+    { 0x00f8f8f8ecfcfc00ULL, 0x00fffcfcecfcfc00ULL },{ 0x00f0f0f0e8f8f800ULL, 0x00fff8f8ecfcfc00ULL },{ 0x00e0e0c060787800ULL, 0x00fff0f0e8f8fc00ULL },{ 0x00c1800000007800ULL, 0x00ffe1c0607e7e00ULL },
+    { 0x00830100007e7e00ULL, 0x00ff830100007e00ULL },{ 0x0007030100003e00ULL, 0x00ff0f070f7f7f00ULL },{ 0x000f0f070f3f3f00ULL, 0x00ff1f1f2f3f7f00ULL },{ 0x001f1f1f2f3f3f00ULL, 0x00ff3f3f6f7f7f00ULL },
+    { 0x00f8f8f8ecfcfc00ULL, 0x00fcfcfcecfcfe00ULL },{ 0x00f0f0f0e8f8fc00ULL, 0x00f8f8f8ecfcfe00ULL },{ 0x00e0e0c060787c00ULL, 0x00f1f0f0e8fcfe00ULL },{ 0x00c1800000007c00ULL, 0x00e3e3c06e7e7e00ULL },
+    { 0x0083010000007e00ULL, 0x00c7c7036e7e7e00ULL },{ 0x0007030100007e00ULL, 0x008f0f076f7f7f00ULL },{ 0x000f0f070f3f7f00ULL, 0x001f1f1f2f7f7f00ULL },{ 0x001f1f1f2f3f7f00ULL, 0x003f3f3f6f7f7f00ULL },
+    { 0x00f8f8f8ecfcfe00ULL, 0x00fcfcfcecfefe00ULL },{ 0x00f0f0f0e8fcfe00ULL, 0x00f8f8f8ecfefe00ULL },{ 0x00e0e0c0607c7e00ULL, 0x00f1f0f0e8fefe00ULL },{ 0x00c1c000007c7e00ULL, 0x00e3e3c0607e7e00ULL },
+    { 0x00830300007e7e00ULL, 0x00c7c703007e7e00ULL },{ 0x00070703007e7e00ULL, 0x008f0f070f7f7f00ULL },{ 0x000f0f070f7f7f00ULL, 0x001f1f1f2f7f7f00ULL },{ 0x001f1f1f2f7f7f00ULL, 0x003f3f3f6f7f7f00ULL },
   },
   {
     { 0x00ffffffdffffc00ULL, 0x00ffffffdfffff00ULL },{ 0x00ffffffdffff800ULL, 0x00ffffffdfffff00ULL },{ 0x00ffffffdffff100ULL, 0x00ffffffdfffff00ULL },{ 0x00ffffffdfffe300ULL, 0x00ffffffdfffff00ULL },
@@ -533,16 +533,16 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffffffdff0c400ULL, 0x00ffffffdfffef00ULL },{ 0x00ffffffdfff8f00ULL, 0x00ffffffdfffdf00ULL },{ 0x00ffffffdf7f1f00ULL, 0x00ffffffdfffbf00ULL },{ 0x00ffffffdf7f3f00ULL, 0x00ffffffdfff7f00ULL },
     { 0x00ffffffd8f8f800ULL, 0x00ffffffdffcfc00ULL },{ 0x00ffffffd8f8f800ULL, 0x00ffffffdff8f800ULL },{ 0x00ffffffd0f0f000ULL, 0x00ffffffdff8f000ULL },{ 0x00ffffffd0f0e000ULL, 0x00ffffffdff0e000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffffff5f7f3f00ULL, 0x00ffffffdf7f3f00ULL },
-    { 0x00fffff8d8f8f800ULL, 0x00ffffffdcfcfc00ULL },{ 0x00fffff8d8f8f800ULL, 0x00ffffffd8f8f800ULL },{ 0x00fffff0d0f0f000ULL, 0x00ffffffd8f0f800ULL },{ 0x00fffff0d0e0f000ULL, 0x00ffffffd0e0f000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff7f1f3f3f00ULL, 0x00ffffff5f3f7f00ULL },
+    { 0x00fffff8d8f8f800ULL, 0x00ffffffdcfcfc00ULL },{ 0x00fffff8d8f8f800ULL, 0x00ffffffd8f8f800ULL },{ 0x00fffff0d0f0f000ULL, 0x00ffffffd8f0f800ULL },{ 0x00fffff0d0f0f000ULL, 0x00ffffffd0e0f000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff7f5f7f7f00ULL, 0x00ffffff5f3f7f00ULL },
     { 0x00fff8f8d8f8f800ULL, 0x00fffffcdcfcfc00ULL },{ 0x00fff0f8d8f8f800ULL, 0x00fffff8d8f8f800ULL },{ 0x00ffe0f050707000ULL, 0x00fffff8d0f8f800ULL },{ 0x00ffc02040707000ULL, 0x00fffff0c0f0f000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff1f2f1f7f7f00ULL, 0x00ffff7f1f7f7f00ULL },
     { 0x00f8f8f8d8f8f800ULL, 0x00fffcfcdcfcfc00ULL },{ 0x00f0f0f0d8f8f800ULL, 0x00fff8f8d8f8f800ULL },{ 0x00e0e0e050707000ULL, 0x00fff0f0d8f8f800ULL },{ 0x00c1c00040707000ULL, 0x00ffe1e050707800ULL },
-    { 0x0083010000007000ULL, 0x00ffc301407c7c00ULL },{ 0x00070301007c7c00ULL, 0x00ff070301007800ULL },{ 0x000f070301007000ULL, 0x00ff1f0f1f7f7f00ULL },{ 0x001f1f0f1f7f7f00ULL, 0x00ff3f3f5f7f7f00ULL },
-    { 0x00f8f8f8d8f8f800ULL, 0x00fcfcfcdcfcfc00ULL },{ 0x00f0f0f0d8f8f800ULL, 0x00f8f8f8d8f8f800ULL },{ 0x00e0e0e050707800ULL, 0x00f1f0f0d8f8f800ULL },{ 0x00c1c00040707000ULL, 0x00e3e1e050787800ULL },
-    { 0x0083010000007800ULL, 0x00c7c7015e7e7e00ULL },{ 0x0007030100006400ULL, 0x008f0f075f7e7e00ULL },{ 0x000f070301007000ULL, 0x001f1f0f5f7f7f00ULL },{ 0x001f1f0f1f7f7f00ULL, 0x003f3f3f5f7f7f00ULL },
-    { 0x00f8f8f8d8f8f800ULL, 0x00fcfcfcdcfcfe00ULL },{ 0x00f0f0f0d8f8f800ULL, 0x00f8f8f8d8fcfc00ULL },{ 0x00e0e0e050787c00ULL, 0x00f1f0f0d8fcfc00ULL },{ 0x00c1c00040787800ULL, 0x00e3e1e0507c7c00ULL },
-    { 0x0083010000787800ULL, 0x00c7c701407e7e00ULL },{ 0x00070701007e7e00ULL, 0x008f0f07017e7e00ULL },{ 0x000f0f07017e7e00ULL, 0x001f1f0f1f7f7f00ULL },{ 0x001f1f0f1f7f7f00ULL, 0x003f3f3f5f7f7f00ULL },
+    { 0x0083010000007000ULL, 0x00ffc301407e7e00ULL },{ 0x00070301007e7e00ULL, 0x00ff070301007e00ULL },{ 0x000f070301007e00ULL, 0x00ff1f0f1f7f7f00ULL },{ 0x001f1f0f1f7f7f00ULL, 0x00ff3f3f5f7f7f00ULL },
+    { 0x00f8f8f8d8f8f800ULL, 0x00fcfcfcdcfcfc00ULL },{ 0x00f0f0f0d8f8f800ULL, 0x00f8f8f8d8f8fc00ULL },{ 0x00e0e0e050707800ULL, 0x00f1f0f0d8f8fc00ULL },{ 0x00c1c00040707800ULL, 0x00e3e1e050787c00ULL },
+    { 0x0083010000007800ULL, 0x00c7c7015e7e7e00ULL },{ 0x0007030100007e00ULL, 0x008f0f075f7e7e00ULL },{ 0x000f070301007e00ULL, 0x001f1f0f5f7f7f00ULL },{ 0x001f1f0f1f7f7f00ULL, 0x003f3f3f5f7f7f00ULL },
+    { 0x00f8f8f8d8f8fc00ULL, 0x00fcfcfcdcfcfe00ULL },{ 0x00f0f0f0d8f8fc00ULL, 0x00f8f8f8d8fcfe00ULL },{ 0x00e0e0e050787c00ULL, 0x00f1f0f0d8fcfe00ULL },{ 0x00c1c00040787c00ULL, 0x00e3e1e0507c7e00ULL },
+    { 0x0083010000787c00ULL, 0x00c7c701407e7e00ULL },{ 0x00070701007e7e00ULL, 0x008f0f07017e7e00ULL },{ 0x000f0f07017e7e00ULL, 0x001f1f0f1f7f7f00ULL },{ 0x001f1f0f1f7f7f00ULL, 0x003f3f3f5f7f7f00ULL },
   },
   {
     { 0x00ffffffbffffc00ULL, 0x00ffffffbfffff00ULL },{ 0x00ffffffbffff800ULL, 0x00ffffffbfffff00ULL },{ 0x00ffffffbffff100ULL, 0x00ffffffbfffff00ULL },{ 0x00ffffffbfffe300ULL, 0x00ffffffbfffff00ULL },
@@ -552,15 +552,15 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffffffb8f8f800ULL, 0x00ffffffbff8f800ULL },{ 0x00ffffffb0f0f000ULL, 0x00ffffffbff8f800ULL },{ 0x00ffffffb0f0f000ULL, 0x00ffffffbff0f000ULL },{ 0x00ffffffa0e0e000ULL, 0x00ffffffbff0e000ULL },
     { 0x00ffffffa0e0c000ULL, 0x00ffffffbfe0c000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffff8b8f8f800ULL, 0x00ffffffb8f8f800ULL },{ 0x00fffff0b0f0f000ULL, 0x00ffffffb8f8f800ULL },{ 0x00fffff0b0f0f000ULL, 0x00ffffffb0f0f000ULL },{ 0x00ffffe0a0e0e000ULL, 0x00ffffffb0e0f000ULL },
-    { 0x00ffffe0a0c0e000ULL, 0x00ffffffa0c0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffffe0a0e0e000ULL, 0x00ffffffa0c0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fff8f8b8f8f800ULL, 0x00fffff8b8f8f800ULL },{ 0x00fff0f0b0f0f000ULL, 0x00fffff8b8f8f800ULL },{ 0x00ffe0f030707000ULL, 0x00fffff0b0f0f000ULL },{ 0x00ffc06020606000ULL, 0x00fffff0a0f0f000ULL },
     { 0x00ff014000606000ULL, 0x00ffffe180e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8f8f8b8f8f800ULL, 0x00fff8f8b8f8f800ULL },{ 0x00f0f0f0b0f0f000ULL, 0x00fff8f8b8f8f800ULL },{ 0x00e0e0e030707000ULL, 0x00fff0f0b0f0f000ULL },{ 0x00c1c04020606000ULL, 0x00ffe1e030707000ULL },
-    { 0x0083010000606000ULL, 0x00ffc34120606000ULL },{ 0x0007030100006000ULL, 0x00ff070301747c00ULL },{ 0x000f070301747800ULL, 0x00ff0f0703017100ULL },{ 0x001f0f0703015100ULL, 0x00ff3f1f3f7f7f00ULL },
-    { 0x00f8f8f8b8f8f800ULL, 0x00fcf8f8b8f8f800ULL },{ 0x00f0f0f0b0f0f000ULL, 0x00f8f8f8b8f8f800ULL },{ 0x00e0e0e030707000ULL, 0x00f1f0f0b0f0f000ULL },{ 0x00c1c04020607000ULL, 0x00e3e1e030707000ULL },
-    { 0x0083010000606000ULL, 0x00c7c34120707800ULL },{ 0x0007030100007000ULL, 0x008f0f033f7e7e00ULL },{ 0x000f070301006000ULL, 0x001f1f0f3f7d7f00ULL },{ 0x001f0f0703016100ULL, 0x003f3f1f3f7f7f00ULL },
-    { 0x00f8f8f8b8f8f800ULL, 0x00fcf8f8b8f8f800ULL },{ 0x00f0f0f0b0f0f800ULL, 0x00f8f8f8b8f8f800ULL },{ 0x00e0e0e030707000ULL, 0x00f1f0f0b0f8f800ULL },{ 0x00c1c04020707000ULL, 0x00e3e1e030787800ULL },
-    { 0x0083010000707000ULL, 0x00c7c34120787800ULL },{ 0x0007030100707000ULL, 0x008f0f03017c7c00ULL },{ 0x000f0f03017c7c00ULL, 0x001f1f0f037d7d00ULL },{ 0x001f1f0f037d7d00ULL, 0x003f3f1f3f7f7f00ULL },
+    { 0x0083010000606000ULL, 0x00ffc34120607000ULL },{ 0x0007030100006000ULL, 0x00ff0703017e7e00ULL },{ 0x000f0703017e7e00ULL, 0x00ff0f0703017f00ULL },{ 0x001f0f0703017f00ULL, 0x00ff3f1f3f7f7f00ULL },
+    { 0x00f8f8f8b8f8f800ULL, 0x00fcf8f8b8f8f800ULL },{ 0x00f0f0f0b0f0f000ULL, 0x00f8f8f8b8f8f800ULL },{ 0x00e0e0e030707000ULL, 0x00f1f0f0b0f0f800ULL },{ 0x00c1c04020607000ULL, 0x00e3e1e030707800ULL },
+    { 0x0083010000607000ULL, 0x00c7c34120707800ULL },{ 0x0007030100007000ULL, 0x008f0f033f7e7e00ULL },{ 0x000f070301007e00ULL, 0x001f1f0f3f7f7f00ULL },{ 0x001f0f0703017f00ULL, 0x003f3f1f3f7f7f00ULL },
+    { 0x00f8f8f8b8f8f800ULL, 0x00fcf8f8b8f8fc00ULL },{ 0x00f0f0f0b0f0f800ULL, 0x00f8f8f8b8f8fc00ULL },{ 0x00e0e0e030707800ULL, 0x00f1f0f0b0f8fc00ULL },{ 0x00c1c04020707800ULL, 0x00e3e1e030787c00ULL },
+    { 0x0083010000707800ULL, 0x00c7c34120787c00ULL },{ 0x0007030100707800ULL, 0x008f0f03017e7e00ULL },{ 0x000f0f03017e7e00ULL, 0x001f1f0f037f7f00ULL },{ 0x001f1f0f037f7f00ULL, 0x003f3f1f3f7f7f00ULL },
   },
   {
     { 0x00ffffff7ffffc00ULL, 0x00ffffff7fffff00ULL },{ 0x00ffffff7ffff800ULL, 0x00ffffff7fffff00ULL },{ 0x00ffffff7ffff100ULL, 0x00ffffff7fffff00ULL },{ 0x00ffffff7fffe300ULL, 0x00ffffff7fffff00ULL },
@@ -570,15 +570,15 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffffff70f0f000ULL, 0x00ffffff7ff8f800ULL },{ 0x00ffffff70f0f000ULL, 0x00ffffff7ff0f000ULL },{ 0x00ffffff60e0e000ULL, 0x00ffffff7ff0f000ULL },{ 0x00ffffff60e0e000ULL, 0x00ffffff7fe0e000ULL },
     { 0x00ffffff40404000ULL, 0x00ffffff7fe0c000ULL },{ 0x00ffffff40400000ULL, 0x00ffffff7fc08000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fffff070f0f000ULL, 0x00ffffff78f8f800ULL },{ 0x00fffff070f0f000ULL, 0x00ffffff70f0f000ULL },{ 0x00ffffe060e0e000ULL, 0x00ffffff70f0f000ULL },{ 0x00ffffe060e0e000ULL, 0x00ffffff60e0e000ULL },
-    { 0x00ffff4040404000ULL, 0x00ffffff60c0e000ULL },{ 0x00ffff4140004000ULL, 0x00ffffff41004000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffff4040404000ULL, 0x00ffffff60c0e000ULL },{ 0x00ffff4140404000ULL, 0x00ffffff41004000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fff0f070f0f000ULL, 0x00fffff878f8f800ULL },{ 0x00fff0f070f0f000ULL, 0x00fffff070f0f000ULL },{ 0x00ffe0e060606000ULL, 0x00fffff070f0f000ULL },{ 0x00ffc06060606000ULL, 0x00ffffe060e0e000ULL },
     { 0x00ff014040404000ULL, 0x00ffffe140e0e000ULL },{ 0x00ff030100404000ULL, 0x00ffff4301404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8f0f070f0f000ULL, 0x00fff8f878f8f800ULL },{ 0x00f0f0f070f0f000ULL, 0x00fff0f070f0f000ULL },{ 0x00e0e0e060606000ULL, 0x00fff0f070f0f000ULL },{ 0x00c1c04060606000ULL, 0x00ffe1e060606000ULL },
-    { 0x0083010040404000ULL, 0x00ffc34160606000ULL },{ 0x0007030100404000ULL, 0x00ff070341406000ULL },{ 0x000f070301004000ULL, 0x00ff0f0703717100ULL },{ 0x001f0f0703617100ULL, 0x00ff1f0f07034300ULL },
-    { 0x00f8f0f070f0f000ULL, 0x00fcf8f878f8f800ULL },{ 0x00f0f0f070f0f000ULL, 0x00f8f0f070f0f000ULL },{ 0x00e0e0e060606000ULL, 0x00f1f0f070f0f000ULL },{ 0x00c1c04060606000ULL, 0x00e3e1e060606000ULL },
-    { 0x0083010040406000ULL, 0x00c7c34160607000ULL },{ 0x0007030100404000ULL, 0x008f070341607000ULL },{ 0x000f070301004000ULL, 0x001f1f077f797900ULL },{ 0x001f0f0703015100ULL, 0x003f3f1f7f7f7f00ULL },
-    { 0x00f8f0f070f0f000ULL, 0x00fcf8f878f8f800ULL },{ 0x00f0f0f070f0f000ULL, 0x00f8f0f070f0f000ULL },{ 0x00e0e0e060607000ULL, 0x00f1f0f070f0f000ULL },{ 0x00c1c04060606000ULL, 0x00e3e1e060707000ULL },
-    { 0x0083010040607000ULL, 0x00c7c34160707000ULL },{ 0x0007030100606000ULL, 0x008f070341707000ULL },{ 0x000f070301606000ULL, 0x001f1f07037d7d00ULL },{ 0x001f1f0703717900ULL, 0x003f3f1f077f7b00ULL },
+    { 0x0083010040404000ULL, 0x00ffc34160606000ULL },{ 0x0007030100404000ULL, 0x00ff070341406000ULL },{ 0x000f070301004000ULL, 0x00ff0f07037f7f00ULL },{ 0x001f0f07037f7f00ULL, 0x00ff1f0f07037f00ULL },
+    { 0x00f8f0f070f0f000ULL, 0x00fcf8f878f8f800ULL },{ 0x00f0f0f070f0f000ULL, 0x00f8f0f070f0f000ULL },{ 0x00e0e0e060606000ULL, 0x00f1f0f070f0f000ULL },{ 0x00c1c04060606000ULL, 0x00e3e1e060607000ULL },
+    { 0x0083010040406000ULL, 0x00c7c34160607000ULL },{ 0x0007030100406000ULL, 0x008f070341607000ULL },{ 0x000f070301006000ULL, 0x001f1f077f7f7f00ULL },{ 0x001f0f0703037f00ULL, 0x003f3f1f7f7f7f00ULL },
+    { 0x00f8f0f070f0f000ULL, 0x00fcf8f878f8f800ULL },{ 0x00f0f0f070f0f000ULL, 0x00f8f0f070f0f800ULL },{ 0x00e0e0e060607000ULL, 0x00f1f0f070f0f800ULL },{ 0x00c1c04060607000ULL, 0x00e3e1e060707800ULL },
+    { 0x0083010040607000ULL, 0x00c7c34160707800ULL },{ 0x0007030100607000ULL, 0x008f070341707800ULL },{ 0x000f070301607000ULL, 0x001f1f07037f7f00ULL },{ 0x001f1f07037f7f00ULL, 0x003f3f1f077f7f00ULL },
   },
   {
     { 0x00fffffefffffc00ULL, 0x00fffffeffffff00ULL },{ 0x00fffffefffff800ULL, 0x00fffffeffffff00ULL },{ 0x00fffffefffff100ULL, 0x00fffffeffffff00ULL },{ 0x00fffffeffffe300ULL, 0x00fffffeffffff00ULL },
@@ -589,14 +589,14 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffffe07070700ULL, 0x00fffffeff070700ULL },{ 0x00fffffe07070700ULL, 0x00fffffeff0f0f00ULL },{ 0x00fffffe0f0f0f00ULL, 0x00fffffeff0f0f00ULL },{ 0x00fffffe0f0f0f00ULL, 0x00fffffeff1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff8202000000ULL, 0x00fffffe83000200ULL },{ 0x00ffff0202020200ULL, 0x00fffffe07030700ULL },
     { 0x00ffff0607070700ULL, 0x00fffffe07070700ULL },{ 0x00ffff0607070700ULL, 0x00fffffe0f0f0f00ULL },{ 0x00ffff0e0f0f0f00ULL, 0x00fffffe0f0f0f00ULL },{ 0x00ffff0e0f0f0f00ULL, 0x00fffffe1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffc28200020200ULL, 0x00ffffc280020200ULL },{ 0x00ff820202020200ULL, 0x00ffff8603070700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffc28202020200ULL, 0x00ffffc280020200ULL },{ 0x00ff820202020200ULL, 0x00ffff8603070700ULL },
     { 0x00ff070607070700ULL, 0x00ffff0607070700ULL },{ 0x00ff070607070700ULL, 0x00ffff0e0f0f0f00ULL },{ 0x00ff0f0e0f0f0f00ULL, 0x00ffff0e0f0f0f00ULL },{ 0x00ff0f0e0f0f0f00ULL, 0x00ffff1e1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e0c08002020200ULL, 0x00ffe2c082020200ULL },{ 0x00c1820202020200ULL, 0x00ffc78207070700ULL },
-    { 0x0083070606060600ULL, 0x00ff870607070700ULL },{ 0x0007070607070700ULL, 0x00ff0f0e0f0f0f00ULL },{ 0x000f0f0e0f0f0f00ULL, 0x00ff0f0e0f0f0f00ULL },{ 0x001f0f0e0f0f0f00ULL, 0x00ff1f1e1f1f0f00ULL },
-    { 0x00f8fce0fe9e9e00ULL, 0x00fcfcfce0dede00ULL },{ 0x00f0e0c080020600ULL, 0x00f8f8e0febebe00ULL },{ 0x00e0c08002020200ULL, 0x00f1e0c282060e00ULL },{ 0x00c1820202020600ULL, 0x00e3c38606060e00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e0c08002020200ULL, 0x00ffe2c082020600ULL },{ 0x00c1820202020200ULL, 0x00ffc78207070700ULL },
+    { 0x0083070606060600ULL, 0x00ff870607070700ULL },{ 0x0007070607070700ULL, 0x00ff0f0e0f0f0f00ULL },{ 0x000f0f0e0f0f0f00ULL, 0x00ff0f0e0f0f0f00ULL },{ 0x001f0f0e0f0f0f00ULL, 0x00ff1f1e1f1f1f00ULL },
+    { 0x00f8fce0fefefe00ULL, 0x00fcfcfce0fefe00ULL },{ 0x00f0e0c080020600ULL, 0x00f8f8e0fefefe00ULL },{ 0x00e0c08002020600ULL, 0x00f1e0c282060e00ULL },{ 0x00c1820202020600ULL, 0x00e3c38606060e00ULL },
     { 0x0083070606060600ULL, 0x00c7870607070f00ULL },{ 0x0007070607070700ULL, 0x008f0f0e0f0f0f00ULL },{ 0x000f0f0e0f0f0f00ULL, 0x001f0f0e0f0f0f00ULL },{ 0x001f0f0e0f0f0f00ULL, 0x003f1f1e1f1f1f00ULL },
-    { 0x00f8fce0e09e9e00ULL, 0x00fcfefefefefe00ULL },{ 0x00f0e0c080060600ULL, 0x00fafcfefebefe00ULL },{ 0x00e0c08002060600ULL, 0x00f5e2c6860e1e00ULL },{ 0x00c1820202060e00ULL, 0x00e3c786060e0e00ULL },
-    { 0x0083070606060600ULL, 0x00c78706070f0f00ULL },{ 0x0007070607070700ULL, 0x008f0f0e0f0f0f00ULL },{ 0x000f0f0e0f0f0f00ULL, 0x001f0f0e0f0f0f00ULL },{ 0x001f0f0e0f0f0f00ULL, 0x003f1f1e1f1f1f00ULL },
+    { 0x00f8fce0e0fefe00ULL, 0x00fcfefefefefe00ULL },{ 0x00f0e0c080060e00ULL, 0x00fafcfefefefe00ULL },{ 0x00e0c08002060e00ULL, 0x00f5e2c6860e1e00ULL },{ 0x00c1820202060e00ULL, 0x00e3c786060e1e00ULL },
+    { 0x0083070606060e00ULL, 0x00c78706070f1f00ULL },{ 0x0007070607070f00ULL, 0x008f0f0e0f0f1f00ULL },{ 0x000f0f0e0f0f0f00ULL, 0x001f0f0e0f0f1f00ULL },{ 0x001f0f0e0f0f0f00ULL, 0x003f1f1e1f1f1f00ULL },
   },
   {
     { 0x00fffffdfffffc00ULL, 0x00fffffdffffff00ULL },{ 0x00fffffdfffff800ULL, 0x00fffffdffffff00ULL },{ 0x00fffffdfffff100ULL, 0x00fffffdffffff00ULL },{ 0x00fffffdffffe300ULL, 0x00fffffdffffff00ULL },
@@ -607,14 +607,14 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffffd07070700ULL, 0x00fffffdff0f0700ULL },{ 0x00fffffd0f0f0f00ULL, 0x00fffffdff0f0f00ULL },{ 0x00fffffd0f0f0f00ULL, 0x00fffffdff1f1f00ULL },{ 0x00fffffd1f1f1f00ULL, 0x00fffffdff1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff0507030300ULL, 0x00fffffd07030700ULL },
     { 0x00ffff0507070700ULL, 0x00fffffd0f070f00ULL },{ 0x00ffff0d0f0f0f00ULL, 0x00fffffd0f0f0f00ULL },{ 0x00ffff0d0f0f0f00ULL, 0x00fffffd1f1f1f00ULL },{ 0x00ffff1d1f1f1f00ULL, 0x00fffffd1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff870503070700ULL, 0x00ffff8503070700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff870507070700ULL, 0x00ffff8503070700ULL },
     { 0x00ff070507070700ULL, 0x00ffff0d070f0f00ULL },{ 0x00ff0f0d0f0f0f00ULL, 0x00ffff0d0f0f0f00ULL },{ 0x00ff0f0d0f0f0f00ULL, 0x00ffff1d1f1f1f00ULL },{ 0x00ff1f1d1f1f1f00ULL, 0x00ffff1d1f1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c1820006060600ULL, 0x00ffc78107070f00ULL },
     { 0x0083070406060600ULL, 0x00ff8f050f0f0f00ULL },{ 0x00070f0d0f0f0f00ULL, 0x00ff0f0d0f0f0f00ULL },{ 0x000f0f0d0f0f0f00ULL, 0x00ff1f1d1f1f1f00ULL },{ 0x001f1f1d1f1f1f00ULL, 0x00ff1f1d1f1f1f00ULL },
-    { 0x00f8fcf8c0febe00ULL, 0x00fcfcfcfefefe00ULL },{ 0x00f0f8c0fe3e3e00ULL, 0x00f8f8f8c0befe00ULL },{ 0x00e0c08000060e00ULL, 0x00f1f0c0fe7e7e00ULL },{ 0x00c1820006060600ULL, 0x00e3c384060e0e00ULL },
-    { 0x0083070406060600ULL, 0x00c7870d0f0f1f00ULL },{ 0x00070f0d0f0f0f00ULL, 0x008f0f0d0f0f0f00ULL },{ 0x000f0f0d0f0f0f00ULL, 0x001f1f1d1f1f1f00ULL },{ 0x001f1f1d1f1f1f00ULL, 0x003f1f1d1f1f1f00ULL },
-    { 0x00f8fcf8c0bebe00ULL, 0x00fcfefcfefefe00ULL },{ 0x00f0f8c0803e7e00ULL, 0x00fafcfcfefefe00ULL },{ 0x00e0c080000e0e00ULL, 0x00f5fafcfe7e7e00ULL },{ 0x00c18200060e0e00ULL, 0x00ebc78c0e1e1e00ULL },
-    { 0x00830704060e0e00ULL, 0x00c78f0d0f1f1f00ULL },{ 0x00070f0d0f0f1f00ULL, 0x008f0f0d0f1f1f00ULL },{ 0x000f0f0d0f0f0f00ULL, 0x001f1f1d1f1f1f00ULL },{ 0x001f1f1d1f1f1f00ULL, 0x003f1f1d1f1f1f00ULL },
+    { 0x00f8fcf8c0fefe00ULL, 0x00fcfcfcfefefe00ULL },{ 0x00f0f8c0fe7e7e00ULL, 0x00f8f8f8c0fefe00ULL },{ 0x00e0c08000060e00ULL, 0x00f1f0c0fe7e7e00ULL },{ 0x00c1820006060e00ULL, 0x00e3c384060e1e00ULL },
+    { 0x0083070406060e00ULL, 0x00c7870d0f0f1f00ULL },{ 0x00070f0d0f0f0f00ULL, 0x008f0f0d0f0f1f00ULL },{ 0x000f0f0d0f0f0f00ULL, 0x001f1f1d1f1f1f00ULL },{ 0x001f1f1d1f1f1f00ULL, 0x003f1f1d1f1f1f00ULL },
+    { 0x00f8fcf8c0fefe00ULL, 0x00fcfefcfefefe00ULL },{ 0x00f0f8c0c07e7e00ULL, 0x00fafcfcfefefe00ULL },{ 0x00e0c080000e1e00ULL, 0x00f5fafcfe7e7e00ULL },{ 0x00c18200060e1e00ULL, 0x00ebc78c0e1e3e00ULL },
+    { 0x00830704060e1e00ULL, 0x00c78f0d0f1f3f00ULL },{ 0x00070f0d0f0f1f00ULL, 0x008f0f0d0f1f3f00ULL },{ 0x000f0f0d0f0f1f00ULL, 0x001f1f1d1f1f3f00ULL },{ 0x001f1f1d1f1f1f00ULL, 0x003f1f1d1f1f3f00ULL },
   },
   {
     { 0x00fffffbfffffc00ULL, 0x00fffffbffffff00ULL },{ 0x00fffffbfffff800ULL, 0x00fffffbffffff00ULL },{ 0x00fffffbfffff100ULL, 0x00fffffbffffff00ULL },{ 0x00fffffbffffe300ULL, 0x00fffffbffffff00ULL },
@@ -625,14 +625,14 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffffb0f070700ULL, 0x00fffffbff0f0700ULL },{ 0x00fffffb0f0f0f00ULL, 0x00fffffbff1f0f00ULL },{ 0x00fffffb1f1f1f00ULL, 0x00fffffbff1f1f00ULL },{ 0x00fffffb1f1f1f00ULL, 0x00fffffbff3f3f00ULL },
     { 0x00fffffafefcfc00ULL, 0x00fffffbfefcfe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00ffff0b0f070700ULL, 0x00fffffb0f070f00ULL },{ 0x00ffff0b0f0f0f00ULL, 0x00fffffb1f0f1f00ULL },{ 0x00ffff1b1f1f1f00ULL, 0x00fffffb1f1f1f00ULL },{ 0x00ffff1b1f1f1f00ULL, 0x00fffffb3f3f3f00ULL },
-    { 0x00fffef8fcfcfe00ULL, 0x00fffffafcfefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00ff0f0b070f0f00ULL, 0x00ffff0b070f0f00ULL },{ 0x00ff0f0b0f0f0f00ULL, 0x00ffff1b0f1f1f00ULL },{ 0x00ff1f1b1f1f1f00ULL, 0x00ffff1b1f1f1f00ULL },{ 0x00ff1f1b1f1f1f00ULL, 0x00ffff3b3f3f3f00ULL },
+    { 0x00fffefafefefe00ULL, 0x00fffffafcfefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ff0f0b0f0f0f00ULL, 0x00ffff0b070f0f00ULL },{ 0x00ff0f0b0f0f0f00ULL, 0x00ffff1b0f1f1f00ULL },{ 0x00ff1f1b1f1f1f00ULL, 0x00ffff1b1f1f1f00ULL },{ 0x00ff1f1b1f1f1f00ULL, 0x00ffff3b3f3f3f00ULL },
     { 0x00f8fcf8fefefe00ULL, 0x00fffef8fefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x008307020e0e0e00ULL, 0x00ff8f030f0f0f00ULL },{ 0x00070f0b0f0f0f00ULL, 0x00ff1f0b1f1f1f00ULL },{ 0x000f1f1b1f1f1f00ULL, 0x00ff1f1b1f1f1f00ULL },{ 0x001f1f1b1f1f1f00ULL, 0x00ff3f3b3f3f3f00ULL },
-    { 0x00f8fcf8fefefe00ULL, 0x00fcfcfafefefe00ULL },{ 0x00f0f8f0807e7e00ULL, 0x00f8f8f8fefefe00ULL },{ 0x00e0f0807e7e7e00ULL, 0x00f1f0f0807e7e00ULL },{ 0x00c18200000e0e00ULL, 0x00e3e3827e7e7e00ULL },
-    { 0x008307020e0e0e00ULL, 0x00c7870b0f1f1f00ULL },{ 0x00070f0b0f0f1f00ULL, 0x008f0f1b1f1f3f00ULL },{ 0x000f1f1b1f1f1f00ULL, 0x001f1f1b1f1f3f00ULL },{ 0x001f1f1b1f1f1f00ULL, 0x003f3f3b3f3f3f00ULL },
-    { 0x00f8fcf8fefefe00ULL, 0x00fcfefafefefe00ULL },{ 0x00f0f8f0807e7e00ULL, 0x00fafcfafefefe00ULL },{ 0x00e0f080007e7e00ULL, 0x00f5fafafe7e7e00ULL },{ 0x00c18200001e1e00ULL, 0x00ebf7fa7e7e7e00ULL },
-    { 0x008307020e1e1e00ULL, 0x00d78f1b1f3f3f00ULL },{ 0x00070f0b0f1f1f00ULL, 0x008f1f1b1f3f3f00ULL },{ 0x000f1f1b1f1f3f00ULL, 0x001f1f1b1f3f3f00ULL },{ 0x001f1f1b1f1f1f00ULL, 0x003f3f3b3f3f3f00ULL },
+    { 0x008307020e0e0e00ULL, 0x00ff8f030f0f1f00ULL },{ 0x00070f0b0f0f0f00ULL, 0x00ff1f0b1f1f1f00ULL },{ 0x000f1f1b1f1f1f00ULL, 0x00ff1f1b1f1f1f00ULL },{ 0x001f1f1b1f1f1f00ULL, 0x00ff3f3b3f3f3f00ULL },
+    { 0x00f8fcf8fefefe00ULL, 0x00fcfcfafefefe00ULL },{ 0x00f0f8f0807e7e00ULL, 0x00f8f8f8fefefe00ULL },{ 0x00e0f0807e7e7e00ULL, 0x00f1f0f0807e7e00ULL },{ 0x00c18200000e1e00ULL, 0x00e3e3827e7e7e00ULL },
+    { 0x008307020e0e1e00ULL, 0x00c7870b0f1f3f00ULL },{ 0x00070f0b0f0f1f00ULL, 0x008f0f1b1f1f3f00ULL },{ 0x000f1f1b1f1f1f00ULL, 0x001f1f1b1f1f3f00ULL },{ 0x001f1f1b1f1f1f00ULL, 0x003f3f3b3f3f3f00ULL },
+    { 0x00f8fcf8fefefe00ULL, 0x00fcfefafefefe00ULL },{ 0x00f0f8f0807e7e00ULL, 0x00fafcfafefefe00ULL },{ 0x00e0f080007e7e00ULL, 0x00f5fafafe7e7e00ULL },{ 0x00c18200001e3e00ULL, 0x00ebf7fa7e7e7e00ULL },
+    { 0x008307020e1e3e00ULL, 0x00d78f1b1f3f7f00ULL },{ 0x00070f0b0f1f3f00ULL, 0x008f1f1b1f3f7f00ULL },{ 0x000f1f1b1f1f3f00ULL, 0x001f1f1b1f3f7f00ULL },{ 0x001f1f1b1f1f3f00ULL, 0x003f3f3b3f3f7f00ULL },
   },
   {
     { 0x00fffff7fffffc00ULL, 0x00fffff7ffffff00ULL },{ 0x00fffff7fffff800ULL, 0x00fffff7ffffff00ULL },{ 0x00fffff7fffff100ULL, 0x00fffff7ffffff00ULL },{ 0x00fffff7ffffe300ULL, 0x00fffff7ffffff00ULL },
@@ -643,14 +643,14 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffff71f070700ULL, 0x00fffff7ff0fc700ULL },{ 0x00fffff71f0f0f00ULL, 0x00fffff7ff1f0f00ULL },{ 0x00fffff71f1f1f00ULL, 0x00fffff7ff3f1f00ULL },{ 0x00fffff73f3f3f00ULL, 0x00fffff7ff3f3f00ULL },
     { 0x00fffff4fcfcfc00ULL, 0x00fffff7fefcfe00ULL },{ 0x00fffff4fcf8f800ULL, 0x00fffff7fcf8fc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff171f0f0f00ULL, 0x00fffff71f0f1f00ULL },{ 0x00ffff171f1f1f00ULL, 0x00fffff73f1f3f00ULL },{ 0x00ffff373f3f3f00ULL, 0x00fffff73f3f3f00ULL },
-    { 0x00fffcf4fcfcfc00ULL, 0x00fffff6fcfefe00ULL },{ 0x00fffcf4f8fcfc00ULL, 0x00fffff4f8fcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff1f170f1f1f00ULL, 0x00ffff170f1f1f00ULL },{ 0x00ff1f171f1f1f00ULL, 0x00ffff371f3f3f00ULL },{ 0x00ff3f373f3f3f00ULL, 0x00ffff373f3f3f00ULL },
+    { 0x00fffcf4fcfcfc00ULL, 0x00fffff6fcfefe00ULL },{ 0x00fffcf4fcfcfc00ULL, 0x00fffff4f8fcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff1f171f1f1f00ULL, 0x00ffff170f1f1f00ULL },{ 0x00ff1f171f1f1f00ULL, 0x00ffff371f3f3f00ULL },{ 0x00ff3f373f3f3f00ULL, 0x00ffff373f3f3f00ULL },
     { 0x00f8fcf4fcfcfc00ULL, 0x00fffef4fefefe00ULL },{ 0x00f0f8f0fcfcfc00ULL, 0x00fffcf0fcfcfe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00070f071f1f1f00ULL, 0x00ff1f071f1f3f00ULL },{ 0x000f1f171f1f1f00ULL, 0x00ff3f173f3f3f00ULL },{ 0x001f3f373f3f3f00ULL, 0x00ff3f373f3f3f00ULL },
     { 0x00f8fcf4fcfcfe00ULL, 0x00fcfcf6fefefe00ULL },{ 0x00f0f8f0fcfcfe00ULL, 0x00f8f8f4fcfefe00ULL },{ 0x00e0f0e0007c7e00ULL, 0x00f1f0f0fefefe00ULL },{ 0x00c1e2007e7e7e00ULL, 0x00e3e3e2007e7e00ULL },
-    { 0x00830702001e3e00ULL, 0x00c7c7077f7f7f00ULL },{ 0x00070f071f1f3f00ULL, 0x008f0f171f3f3f00ULL },{ 0x000f1f171f1f3f00ULL, 0x001f1f373f3f3f00ULL },{ 0x001f3f373f3f3f00ULL, 0x003f3f373f3f3f00ULL },
+    { 0x00830702001e3e00ULL, 0x00c7c7077f7f7f00ULL },{ 0x00070f071f1f3f00ULL, 0x008f0f171f3f7f00ULL },{ 0x000f1f171f1f3f00ULL, 0x001f1f373f3f7f00ULL },{ 0x001f3f373f3f3f00ULL, 0x003f3f373f3f7f00ULL },
     { 0x00f8fcf4fcfefe00ULL, 0x00fcfef6fefefe00ULL },{ 0x00f0f8f0fcfefe00ULL, 0x00fafcf6fefefe00ULL },{ 0x00e0f0e0007e7e00ULL, 0x00f5faf6fefefe00ULL },{ 0x00c1e200007e7e00ULL, 0x00ebf7f67e7e7e00ULL },
-    { 0x00830702003e7e00ULL, 0x00d7ef777f7f7f00ULL },{ 0x00070f071f3f7f00ULL, 0x00af1f373f7f7f00ULL },{ 0x000f1f171f3f3f00ULL, 0x001f3f373f7f7f00ULL },{ 0x001f3f373f3f3f00ULL, 0x003f3f373f7f7f00ULL },
+    { 0x00830702003e7e00ULL, 0x00d7ef777f7f7f00ULL },{ 0x00070f071f3f7f00ULL, 0x00af1f373f7f7f00ULL },{ 0x000f1f171f3f7f00ULL, 0x001f3f373f7f7f00ULL },{ 0x001f3f373f3f7f00ULL, 0x003f3f373f7f7f00ULL },
   },
   {
     { 0x00ffffeffffffc00ULL, 0x00ffffefffffff00ULL },{ 0x00ffffeffffff800ULL, 0x00ffffefffffff00ULL },{ 0x00ffffeffffff100ULL, 0x00ffffefffffff00ULL },{ 0x00ffffefffffe300ULL, 0x00ffffefffffff00ULL },
@@ -661,13 +661,13 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffffefff00c700ULL, 0x00ffffefffefc700ULL },{ 0x00ffffef3f0f0f00ULL, 0x00ffffefff1f8f00ULL },{ 0x00ffffef3f1f1f00ULL, 0x00ffffefff3f1f00ULL },{ 0x00ffffef3f3f3f00ULL, 0x00ffffefff7f3f00ULL },
     { 0x00ffffecfcfcfc00ULL, 0x00ffffeffcfcfc00ULL },{ 0x00ffffe8f8f8f800ULL, 0x00ffffeffcf8fc00ULL },{ 0x00ffffe8f8f0f000ULL, 0x00ffffeff8f0f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff2f3f1f1f00ULL, 0x00ffffef3f1f3f00ULL },{ 0x00ffff2f3f3f3f00ULL, 0x00ffffef7f3f7f00ULL },
-    { 0x00fffcecfcfcfc00ULL, 0x00ffffecfcfcfc00ULL },{ 0x00fff8e8f8f8f800ULL, 0x00ffffecf8fcfc00ULL },{ 0x00fff8e8f0f8f800ULL, 0x00ffffe8f0f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff3f2f1f3f3f00ULL, 0x00ffff2f1f3f3f00ULL },{ 0x00ff3f2f3f3f3f00ULL, 0x00ffff6f3f7f7f00ULL },
+    { 0x00fffcecfcfcfc00ULL, 0x00ffffecfcfcfc00ULL },{ 0x00fff8e8f8f8f800ULL, 0x00ffffecf8fcfc00ULL },{ 0x00fff8e8f8f8f800ULL, 0x00ffffe8f0f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff3f2f3f3f3f00ULL, 0x00ffff2f1f3f3f00ULL },{ 0x00ff3f2f3f3f3f00ULL, 0x00ffff6f3f7f7f00ULL },
     { 0x00f8fcecfcfcfc00ULL, 0x00fffcecfcfcfc00ULL },{ 0x00f0f8e8f8f8f800ULL, 0x00fffce8fcfcfc00ULL },{ 0x00e0f0e0f8f8f800ULL, 0x00fff8e0f8f8fc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x000f1f0f3f3f3f00ULL, 0x00ff3f0f3f3f7f00ULL },{ 0x001f3f2f3f3f3f00ULL, 0x00ff7f2f7f7f7f00ULL },
-    { 0x00f8fcecfcfcfc00ULL, 0x00fcfcecfcfcfc00ULL },{ 0x00f0f8e8f8f8fc00ULL, 0x00f8f8ecfcfcfe00ULL },{ 0x00e0f0e0f8f8f800ULL, 0x00f1f0e8f8fcfe00ULL },{ 0x00c1e04000787c00ULL, 0x00e3e3e0fefefe00ULL },
-    { 0x008347007e7e7e00ULL, 0x00c7c747007e7e00ULL },{ 0x00070f07003e7e00ULL, 0x008f0f0f7f7f7f00ULL },{ 0x000f1f0f3f3f3f00ULL, 0x001f1f2f3f7f7f00ULL },{ 0x001f3f2f3f3f7f00ULL, 0x003f3f6f7f7f7f00ULL },
-    { 0x00f8fcecfcfcfe00ULL, 0x00fcfcecfcfefe00ULL },{ 0x00f0f8e8f8fcfc00ULL, 0x00f8fcecfcfefe00ULL },{ 0x00e0f0e0f8fcfe00ULL, 0x00f5f8ecfcfefe00ULL },{ 0x00c1e040007c7e00ULL, 0x00ebf7eefefefe00ULL },
+    { 0x00f8fcecfcfcfc00ULL, 0x00fcfcecfcfcfe00ULL },{ 0x00f0f8e8f8f8fc00ULL, 0x00f8f8ecfcfcfe00ULL },{ 0x00e0f0e0f8f8fc00ULL, 0x00f1f0e8f8fcfe00ULL },{ 0x00c1e04000787c00ULL, 0x00e3e3e0fefefe00ULL },
+    { 0x008347007e7e7e00ULL, 0x00c7c747007e7e00ULL },{ 0x00070f07003e7e00ULL, 0x008f0f0f7f7f7f00ULL },{ 0x000f1f0f3f3f7f00ULL, 0x001f1f2f3f7f7f00ULL },{ 0x001f3f2f3f3f7f00ULL, 0x003f3f6f7f7f7f00ULL },
+    { 0x00f8fcecfcfcfe00ULL, 0x00fcfcecfcfefe00ULL },{ 0x00f0f8e8f8fcfe00ULL, 0x00f8fcecfcfefe00ULL },{ 0x00e0f0e0f8fcfe00ULL, 0x00f5f8ecfcfefe00ULL },{ 0x00c1e040007c7e00ULL, 0x00ebf7eefefefe00ULL },
     { 0x00834700007e7e00ULL, 0x00d7ef6f7e7e7e00ULL },{ 0x00070f07007e7e00ULL, 0x00af5f6f7f7f7f00ULL },{ 0x000f1f0f3f7f7f00ULL, 0x005f3f6f7f7f7f00ULL },{ 0x001f3f2f3f7f7f00ULL, 0x003f7f6f7f7f7f00ULL },
   },
   {
@@ -679,14 +679,14 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffffdff0c0c000ULL, 0x00ffffdfffe0c700ULL },{ 0x00ffffdfff008f00ULL, 0x00ffffdfffdf8f00ULL },{ 0x00ffffdf7f1f1f00ULL, 0x00ffffdfff3f1f00ULL },{ 0x00ffffdf7f3f3f00ULL, 0x00ffffdfff7f3f00ULL },
     { 0x00ffffd8f8f8f800ULL, 0x00ffffdffcfcfc00ULL },{ 0x00ffffd8f8f8f800ULL, 0x00ffffdff8f8f800ULL },{ 0x00ffffd0f0f0f000ULL, 0x00ffffdff8f0f800ULL },{ 0x00ffffd0f0e0e000ULL, 0x00ffffdff0e0f000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffff5f7f3f3f00ULL, 0x00ffffdf7f3f7f00ULL },
-    { 0x00fff8d8f8f8f800ULL, 0x00ffffdcfcfcfc00ULL },{ 0x00fff8d8f8f8f800ULL, 0x00ffffd8f8f8f800ULL },{ 0x00fff0d0f0f0f000ULL, 0x00ffffd8f0f8f800ULL },{ 0x00fff0d0e0f0f000ULL, 0x00ffffd0e0f0f000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff7f1f3f3f7f00ULL, 0x00ffff5f3f7f7f00ULL },
+    { 0x00fff8d8f8f8f800ULL, 0x00ffffdcfcfcfc00ULL },{ 0x00fff8d8f8f8f800ULL, 0x00ffffd8f8f8f800ULL },{ 0x00fff0d0f0f0f000ULL, 0x00ffffd8f0f8f800ULL },{ 0x00fff0d0f0f0f000ULL, 0x00ffffd0e0f0f000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff7f5f7f7f7f00ULL, 0x00ffff5f3f7f7f00ULL },
     { 0x00f8f8d8f8f8f800ULL, 0x00fffcdcfcfcfc00ULL },{ 0x00f0f8d8f8f8f800ULL, 0x00fff8d8f8f8f800ULL },{ 0x00e0f0d0f0f0f000ULL, 0x00fff8d0f8f8f800ULL },{ 0x00c1e04070707000ULL, 0x00fff1c0f0f0f800ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f3f1f7f7f7f00ULL, 0x00ff7f1f7f7f7f00ULL },
-    { 0x00f8f8d8f8f8f800ULL, 0x00fcfcdcfcfcfc00ULL },{ 0x00f0f8d8f8f8f800ULL, 0x00f8f8d8f8f8fc00ULL },{ 0x00e0f0d0f0f0f000ULL, 0x00f1f0d8f8f8f800ULL },{ 0x00c1e04070707000ULL, 0x00e3e1d0f0f8f800ULL },
-    { 0x0083410000707000ULL, 0x00c7c7417e7e7e00ULL },{ 0x00070f017e7c7e00ULL, 0x008f0f0f017e7e00ULL },{ 0x000f1f0f017e7c00ULL, 0x001f1f1f7f7f7f00ULL },{ 0x001f3f1f7f7f7f00ULL, 0x003f3f5f7f7f7f00ULL },
-    { 0x00f8f8d8f8f8f800ULL, 0x00fcfcdcfcfcfc00ULL },{ 0x00f0f8d8f8f8f800ULL, 0x00f8f8d8f8fcfc00ULL },{ 0x00e0f0d0f0f8f800ULL, 0x00f1f8d8f8fcfc00ULL },{ 0x00c1e04070787800ULL, 0x00ebf1d8f8fcfc00ULL },
-    { 0x0083410000787800ULL, 0x00d7ef5f7e7e7e00ULL },{ 0x00070f01007e7e00ULL, 0x00af5f5f7f7e7e00ULL },{ 0x000f1f0f017c7c00ULL, 0x005f3f5f7f7f7f00ULL },{ 0x001f3f1f7f7f7f00ULL, 0x003f7f5f7f7f7f00ULL },
+    { 0x00f8f8d8f8f8f800ULL, 0x00fcfcdcfcfcfc00ULL },{ 0x00f0f8d8f8f8f800ULL, 0x00f8f8d8f8f8fc00ULL },{ 0x00e0f0d0f0f0f800ULL, 0x00f1f0d8f8f8fc00ULL },{ 0x00c1e04070707800ULL, 0x00e3e1d0f0f8fc00ULL },
+    { 0x0083410000707800ULL, 0x00c7c7417e7e7e00ULL },{ 0x00070f017e7e7e00ULL, 0x008f0f0f017e7e00ULL },{ 0x000f1f0f017e7e00ULL, 0x001f1f1f7f7f7f00ULL },{ 0x001f3f1f7f7f7f00ULL, 0x003f3f5f7f7f7f00ULL },
+    { 0x00f8f8d8f8f8fc00ULL, 0x00fcfcdcfcfcfe00ULL },{ 0x00f0f8d8f8f8fc00ULL, 0x00f8f8d8f8fcfe00ULL },{ 0x00e0f0d0f0f8fc00ULL, 0x00f1f8d8f8fcfe00ULL },{ 0x00c1e04070787c00ULL, 0x00ebf1d8f8fcfe00ULL },
+    { 0x0083410000787c00ULL, 0x00d7ef5f7e7e7e00ULL },{ 0x00070f01007e7e00ULL, 0x00af5f5f7f7e7e00ULL },{ 0x000f1f0f017e7e00ULL, 0x005f3f5f7f7f7f00ULL },{ 0x001f3f1f7f7f7f00ULL, 0x003f7f5f7f7f7f00ULL },
   },
   {
     { 0x00ffffbffffffc00ULL, 0x00ffffbfffffff00ULL },{ 0x00ffffbffffff800ULL, 0x00ffffbfffffff00ULL },{ 0x00ffffbffffff100ULL, 0x00ffffbfffffff00ULL },{ 0x00ffffbfffffe300ULL, 0x00ffffbfffffff00ULL },
@@ -698,13 +698,13 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffffb8f8f8f800ULL, 0x00ffffbff8f8f800ULL },{ 0x00ffffb0f0f0f000ULL, 0x00ffffbff8f8f800ULL },{ 0x00ffffb0f0f0f000ULL, 0x00ffffbff0f0f000ULL },{ 0x00ffffa0e0e0e000ULL, 0x00ffffbff0e0f000ULL },
     { 0x00ffffa0e0c0c000ULL, 0x00ffffbfe0c0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fff8b8f8f8f800ULL, 0x00ffffb8f8f8f800ULL },{ 0x00fff0b0f0f0f000ULL, 0x00ffffb8f8f8f800ULL },{ 0x00fff0b0f0f0f000ULL, 0x00ffffb0f0f0f000ULL },{ 0x00ffe0a0e0e0e000ULL, 0x00ffffb0e0f0f000ULL },
-    { 0x00ffe1a0c0e0e000ULL, 0x00ffffa1c0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ffe1a0e0e0e000ULL, 0x00ffffa1c0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8f8b8f8f8f800ULL, 0x00fff8b8f8f8f800ULL },{ 0x00f0f0b0f0f0f000ULL, 0x00fff8b8f8f8f800ULL },{ 0x00e0f0b0f0f0f000ULL, 0x00fff0b0f0f0f000ULL },{ 0x00c1e02060606000ULL, 0x00fff1a0f0f0f000ULL },
-    { 0x0083410060606000ULL, 0x00ffe381e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0083410060606000ULL, 0x00ffe381e0e0f000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8f8b8f8f8f800ULL, 0x00fcf8b8f8f8f800ULL },{ 0x00f0f0b0f0f0f000ULL, 0x00f8f8b8f8f8f800ULL },{ 0x00e0f0b0f0f0f000ULL, 0x00f1f0b0f0f0f800ULL },{ 0x00c1e02060607000ULL, 0x00e3e1b0f0f0f800ULL },
-    { 0x0083410060607000ULL, 0x00c7c32160707800ULL },{ 0x0007030100607000ULL, 0x008f0f037f7e7c00ULL },{ 0x000f1f037f787800ULL, 0x001f1f1f037f7f00ULL },{ 0x001f3f1f037d7d00ULL, 0x003f3f3f7f7f7f00ULL },
-    { 0x00f8f8b8f8f8f800ULL, 0x00fcf8b8f8f8f800ULL },{ 0x00f0f0b0f0f0f000ULL, 0x00f8f8b8f8f8fc00ULL },{ 0x00e0f0b0f0f0f000ULL, 0x00f1f0b0f0f8f800ULL },{ 0x00c1e02060707800ULL, 0x00e3f1b0f0f8f800ULL },
-    { 0x0083410060707000ULL, 0x00d7e33170787800ULL },{ 0x0007030100707800ULL, 0x00af5f3f7f7e7e00ULL },{ 0x000f1f03017c7c00ULL, 0x005f3f3f7f7f7f00ULL },{ 0x001f3f1f037d7d00ULL, 0x003f7f3f7f7f7f00ULL },
+    { 0x0083410060607000ULL, 0x00c7c32160707800ULL },{ 0x0007030100607000ULL, 0x008f0f037f7e7e00ULL },{ 0x000f1f037f7e7e00ULL, 0x001f1f1f037f7f00ULL },{ 0x001f3f1f037f7f00ULL, 0x003f3f3f7f7f7f00ULL },
+    { 0x00f8f8b8f8f8f800ULL, 0x00fcf8b8f8f8fc00ULL },{ 0x00f0f0b0f0f0f800ULL, 0x00f8f8b8f8f8fc00ULL },{ 0x00e0f0b0f0f0f800ULL, 0x00f1f0b0f0f8fc00ULL },{ 0x00c1e02060707800ULL, 0x00e3f1b0f0f8fc00ULL },
+    { 0x0083410060707800ULL, 0x00d7e33170787c00ULL },{ 0x0007030100707800ULL, 0x00af5f3f7f7e7e00ULL },{ 0x000f1f03037e7e00ULL, 0x005f3f3f7f7f7f00ULL },{ 0x001f3f1f037f7f00ULL, 0x003f7f3f7f7f7f00ULL },
   },
   {
     { 0x00ffff7ffffffc00ULL, 0x00ffff7fffffff00ULL },{ 0x00ffff7ffffff800ULL, 0x00ffff7fffffff00ULL },{ 0x00ffff7ffffff100ULL, 0x00ffff7fffffff00ULL },{ 0x00ffff7fffffe300ULL, 0x00ffff7fffffff00ULL },
@@ -716,13 +716,13 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffff70f0f0f000ULL, 0x00ffff7ff8f8f800ULL },{ 0x00ffff70f0f0f000ULL, 0x00ffff7ff0f0f000ULL },{ 0x00ffff60e0e0e000ULL, 0x00ffff7ff0f0f000ULL },{ 0x00ffff60e0e0e000ULL, 0x00ffff7fe0e0e000ULL },
     { 0x00ffff4040404000ULL, 0x00ffff7fe0c0e000ULL },{ 0x00ffff4140000000ULL, 0x00ffff7fc1004000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00fff070f0f0f000ULL, 0x00ffff78f8f8f800ULL },{ 0x00fff070f0f0f000ULL, 0x00ffff70f0f0f000ULL },{ 0x00ffe060e0e0e000ULL, 0x00ffff70f0f0f000ULL },{ 0x00ffe060e0e0e000ULL, 0x00ffff60e0e0e000ULL },
-    { 0x00ff414040404000ULL, 0x00ffff61c0e0e000ULL },{ 0x00ff434100404000ULL, 0x00ffff4301404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00ff414040404000ULL, 0x00ffff61c0e0e000ULL },{ 0x00ff434140404000ULL, 0x00ffff4301404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8f070f0f0f000ULL, 0x00fff878f8f8f800ULL },{ 0x00f0f070f0f0f000ULL, 0x00fff070f0f0f000ULL },{ 0x00e0e060e0e0e000ULL, 0x00fff070f0f0f000ULL },{ 0x00c1e06060606000ULL, 0x00ffe160e0e0e000ULL },
     { 0x0083414040404000ULL, 0x00ffe341e0e0e000ULL },{ 0x0007030140404000ULL, 0x00ff470341406000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00f8f070f0f0f000ULL, 0x00fcf878f8f8f800ULL },{ 0x00f0f070f0f0f000ULL, 0x00f8f070f0f0f000ULL },{ 0x00e0e060e0e0e000ULL, 0x00f1f070f0f0f000ULL },{ 0x00c1e06060606000ULL, 0x00e3e160e0e0e000ULL },
-    { 0x0083414040406000ULL, 0x00c7c36160606000ULL },{ 0x0007030140404000ULL, 0x008f074341606000ULL },{ 0x000f070301406000ULL, 0x001f1f077f797900ULL },{ 0x001f3f077f717900ULL, 0x003f3f3f077b7f00ULL },
-    { 0x00f8f070f0f0f000ULL, 0x00fcf878f8f8f800ULL },{ 0x00f0f070f0f0f000ULL, 0x00f8f070f0f0f000ULL },{ 0x00e0e060e0e0e000ULL, 0x00f1f070f0f0f000ULL },{ 0x00c1e06060607000ULL, 0x00e3e160e0f0f000ULL },
-    { 0x0083414040607000ULL, 0x00c7e36160707000ULL },{ 0x0007030140607000ULL, 0x00af476361707000ULL },{ 0x000f070301607000ULL, 0x005f3f7f7f7f7f00ULL },{ 0x001f3f0707797900ULL, 0x003f7f7f7f7f7f00ULL },
+    { 0x00f8f070f0f0f000ULL, 0x00fcf878f8f8f800ULL },{ 0x00f0f070f0f0f000ULL, 0x00f8f070f0f0f000ULL },{ 0x00e0e060e0e0e000ULL, 0x00f1f070f0f0f000ULL },{ 0x00c1e06060606000ULL, 0x00e3e160e0e0f000ULL },
+    { 0x0083414040406000ULL, 0x00c7c36160607000ULL },{ 0x0007030140406000ULL, 0x008f074341607000ULL },{ 0x000f070301406000ULL, 0x001f1f077f7f7f00ULL },{ 0x001f3f077f7f7f00ULL, 0x003f3f3f077f7f00ULL },
+    { 0x00f8f070f0f0f000ULL, 0x00fcf878f8f8f800ULL },{ 0x00f0f070f0f0f000ULL, 0x00f8f070f0f0f800ULL },{ 0x00e0e060e0e0f000ULL, 0x00f1f070f0f0f800ULL },{ 0x00c1e06060607000ULL, 0x00e3e160e0f0f800ULL },
+    { 0x0083414040607000ULL, 0x00c7e36160707800ULL },{ 0x0007030140607000ULL, 0x00af476361707800ULL },{ 0x000f070301607000ULL, 0x005f3f7f7f7f7f00ULL },{ 0x001f3f07077f7f00ULL, 0x003f7f7f7f7f7f00ULL },
   },
   {
     { 0x00fffefffffffc00ULL, 0x00fffeffffffff00ULL },{ 0x00fffefffffff800ULL, 0x00fffeffffffff00ULL },{ 0x00fffefffffff100ULL, 0x00fffeffffffff00ULL },{ 0x00fffeffffffe300ULL, 0x00fffeffffffff00ULL },
@@ -733,14 +733,14 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffeff07030300ULL, 0x00fffeffff070700ULL },{ 0x00fffeff07070700ULL, 0x00fffeffff0f0f00ULL },{ 0x00fffeff0f0f0f00ULL, 0x00fffeffff0f0f00ULL },{ 0x00fffeff0f0f0f00ULL, 0x00fffeffff1f1f00ULL },
     { 0x00fffeffc0808000ULL, 0x00fffefffec0c000ULL },{ 0x00fffec380000000ULL, 0x00fffeffc1808000ULL },{ 0x00fffe8300000000ULL, 0x00fffeff83000000ULL },{ 0x00fffe0302000000ULL, 0x00fffeff07030300ULL },
     { 0x00fffe0707030300ULL, 0x00fffeff07070700ULL },{ 0x00fffe0707070700ULL, 0x00fffeff0f0f0f00ULL },{ 0x00fffe0f0f0f0f00ULL, 0x00fffeff0f0f0f00ULL },{ 0x00fffe0f0f0f0f00ULL, 0x00fffeff1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffc28200000000ULL, 0x00fffec380020200ULL },{ 0x00ff820202000000ULL, 0x00fffe8703070700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ffc28200000000ULL, 0x00fffec380020200ULL },{ 0x00ff820202020000ULL, 0x00fffe8703070700ULL },
     { 0x00ff060707070300ULL, 0x00fffe0707070700ULL },{ 0x00ff060707070700ULL, 0x00fffe0f0f0f0f00ULL },{ 0x00ff0e0f0f0f0f00ULL, 0x00fffe0f0f0f0f00ULL },{ 0x00ff0e0f0f0f0f00ULL, 0x00fffe1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e3c28002020200ULL, 0x00ffe2c082020200ULL },{ 0x00c3820202020200ULL, 0x00ffc68307070700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e3c28202020200ULL, 0x00ffe2c082020200ULL },{ 0x00c3820202020200ULL, 0x00ffc68307070700ULL },
     { 0x0087060707070700ULL, 0x00ff860707070700ULL },{ 0x0007060707070700ULL, 0x00ff0e0f0f0f0f00ULL },{ 0x000f0e0f0f0f0f00ULL, 0x00ff0e0f0f0f0f00ULL },{ 0x001f0e0f0f0f0f00ULL, 0x00ff1e1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e1c08202020200ULL, 0x00f3e0c282060600ULL },{ 0x00c3820202020200ULL, 0x00e7c28707070700ULL },
-    { 0x0087060707070700ULL, 0x00c7860707070700ULL },{ 0x0007060707070700ULL, 0x008f0e0f0f0f0f00ULL },{ 0x000f0e0f0f0f0f00ULL, 0x001f0e0f0f0f0f00ULL },{ 0x001f0e0f0f0f0f00ULL, 0x003f1e1f1f1f1f00ULL },
-    { 0x00f8000000000000ULL, 0x00fcfcfefefefe00ULL },{ 0x00f0e0c282060600ULL, 0x00f8fefefebebe00ULL },{ 0x00e1c28202060600ULL, 0x00f5e2c6860e0e00ULL },{ 0x00c3820202060600ULL, 0x00e3c687070f0f00ULL },
-    { 0x0087060707070700ULL, 0x00c78607070f0f00ULL },{ 0x0007060707070700ULL, 0x008f0e0f0f0f0f00ULL },{ 0x000f0e0f0f0f0f00ULL, 0x001f0e0f0f0f1f00ULL },{ 0x001f0e0f0f0f0f00ULL, 0x003f1e1f1f1f1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e1c28202020200ULL, 0x00f3e0c282060e00ULL },{ 0x00c3820202020200ULL, 0x00e7c28707070f00ULL },
+    { 0x0087060707070700ULL, 0x00c7860707070f00ULL },{ 0x0007060707070700ULL, 0x008f0e0f0f0f0f00ULL },{ 0x000f0e0f0f0f0f00ULL, 0x001f0e0f0f0f0f00ULL },{ 0x001f0e0f0f0f0f00ULL, 0x003f1e1f1f1f1f00ULL },
+    { 0x00f8fefefefefe00ULL, 0x00fcfcfefefefe00ULL },{ 0x00f2e0c282060e00ULL, 0x00f8fefefefefe00ULL },{ 0x00e1c28202060e00ULL, 0x00f5e2c6860e1e00ULL },{ 0x00c3820202060e00ULL, 0x00e3c687070f1f00ULL },
+    { 0x0087060707070f00ULL, 0x00c78607070f1f00ULL },{ 0x0007060707070f00ULL, 0x008f0e0f0f0f1f00ULL },{ 0x000f0e0f0f0f0f00ULL, 0x001f0e0f0f0f1f00ULL },{ 0x001f0e0f0f0f0f00ULL, 0x003f1e1f1f1f1f00ULL },
   },
   {
     { 0x00fffdfffffffc00ULL, 0x00fffdffffffff00ULL },{ 0x00fffdfffffff800ULL, 0x00fffdffffffff00ULL },{ 0x00fffdfffffff100ULL, 0x00fffdffffffff00ULL },{ 0x00fffdffffffe300ULL, 0x00fffdffffffff00ULL },
@@ -753,12 +753,12 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffd0707030300ULL, 0x00fffdff0f070700ULL },{ 0x00fffd0f0f070700ULL, 0x00fffdff0f0f0f00ULL },{ 0x00fffd0f0f0f0f00ULL, 0x00fffdff1f1f1f00ULL },{ 0x00fffd1f1f1f1f00ULL, 0x00fffdff1f1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff850703030100ULL, 0x00fffd8703070700ULL },
     { 0x00ff050707070300ULL, 0x00fffd0f070f0f00ULL },{ 0x00ff0d0f0f0f0700ULL, 0x00fffd0f0f0f0f00ULL },{ 0x00ff0d0f0f0f0f00ULL, 0x00fffd1f1f1f1f00ULL },{ 0x00ff1d1f1f1f1f00ULL, 0x00fffd1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c7850307070700ULL, 0x00ffc58307070700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c7850707070700ULL, 0x00ffc58307070700ULL },
     { 0x0087050707070700ULL, 0x00ff8d070f0f0f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x00ff0d0f0f0f0f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x00ff1d1f1f1f1f00ULL },{ 0x001f1d1f1f1f1f00ULL, 0x00ff1d1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c3810606060600ULL, 0x00e7c187070f1f00ULL },
-    { 0x0087050707070700ULL, 0x00cf850f0f0f0f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x008f0d0f0f0f1f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x001f1d1f1f1f1f00ULL },{ 0x001f1d1f1f1f1f00ULL, 0x003f1d1f1f1f1f00ULL },
-    { 0x00f8000000000000ULL, 0x00fcfcfefefefe00ULL },{ 0x00f8fcfefe3e7e00ULL, 0x00faf8fefefefe00ULL },{ 0x00e1c086060e0e00ULL, 0x00f1fdfefe7e7e00ULL },{ 0x00c38506060e0e00ULL, 0x00ebc58f0f1f3f00ULL },
-    { 0x00870507070f1f00ULL, 0x00c78d0f0f1f1f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x008f0d0f0f1f3f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x001f1d1f1f1f1f00ULL },{ 0x001f1d1f1f1f1f00ULL, 0x003f1d1f1f1f3f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c3850606060600ULL, 0x00e7c187070f1f00ULL },
+    { 0x0087050707070700ULL, 0x00cf850f0f0f1f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x008f0d0f0f0f1f00ULL },{ 0x000f0d0f0f0f0f00ULL, 0x001f1d1f1f1f1f00ULL },{ 0x001f1d1f1f1f1f00ULL, 0x003f1d1f1f1f1f00ULL },
+    { 0x00faf8fefefefe00ULL, 0x00fcfcfefefefe00ULL },{ 0x00f8fcfefe7e7e00ULL, 0x00faf8fefefefe00ULL },{ 0x00e7c086060e1e00ULL, 0x00f1fdfefe7e7e00ULL },{ 0x00c38506060e1e00ULL, 0x00ebc58f0f1f3f00ULL },
+    { 0x00870507070f1f00ULL, 0x00c78d0f0f1f3f00ULL },{ 0x000f0d0f0f0f1f00ULL, 0x008f0d0f0f1f3f00ULL },{ 0x000f0d0f0f0f1f00ULL, 0x001f1d1f1f1f3f00ULL },{ 0x001f1d1f1f1f1f00ULL, 0x003f1d1f1f1f3f00ULL },
   },
   {
     { 0x00fffbfffffffc00ULL, 0x00fffbffffffff00ULL },{ 0x00fffbfffffff800ULL, 0x00fffbffffffff00ULL },{ 0x00fffbfffffff100ULL, 0x00fffbffffffff00ULL },{ 0x00fffbffffffe300ULL, 0x00fffbffffffff00ULL },
@@ -771,12 +771,12 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fffb0f07030300ULL, 0x00fffbff0f070700ULL },{ 0x00fffb0f0f070700ULL, 0x00fffbff1f0f0f00ULL },{ 0x00fffb1f1f0f0f00ULL, 0x00fffbff1f1f1f00ULL },{ 0x00fffb1f1f1f1f00ULL, 0x00fffbff3f3f3f00ULL },
     { 0x00fffafefcfcf800ULL, 0x00fffbfefcfefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00ff0b0f07070300ULL, 0x00fffb0f070f0f00ULL },{ 0x00ff0b0f0f0f0700ULL, 0x00fffb1f0f1f1f00ULL },{ 0x00ff1b1f1f1f0f00ULL, 0x00fffb1f1f1f1f00ULL },{ 0x00ff1b1f1f1f1f00ULL, 0x00fffb3f3f3f3f00ULL },
-    { 0x00fef8fcfcfefe00ULL, 0x00fffafcfefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x008f0b070f0f0f00ULL, 0x00ff8b070f0f0f00ULL },{ 0x000f0b0f0f0f0f00ULL, 0x00ff1b0f1f1f1f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x00ff1b1f1f1f1f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x00ff3b3f3f3f3f00ULL },
+    { 0x00fefafefefefe00ULL, 0x00fffafcfefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x008f0b0f0f0f0f00ULL, 0x00ff8b070f0f0f00ULL },{ 0x000f0b0f0f0f0f00ULL, 0x00ff1b0f1f1f1f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x00ff1b1f1f1f1f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x00ff3b3f3f3f3f00ULL },
     { 0x00fcf8fefefefe00ULL, 0x00fef8fefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0087030f0f0f0f00ULL, 0x00cf830f0f1f3f00ULL },{ 0x000f0b0f0f0f0f00ULL, 0x009f0b1f1f1f1f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x001f1b1f1f1f3f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x003f3b3f3f3f3f00ULL },
-    { 0x00fcf8fefefefe00ULL, 0x00fcf8fefefefe00ULL },{ 0x00f8f0fefe7e7e00ULL, 0x00f8fafefefefe00ULL },{ 0x00f1fafe7e7e7e00ULL, 0x00f5f1fefe7e7e00ULL },{ 0x00c3810e0e1e1e00ULL, 0x00e3fbff7f7f7f00ULL },
-    { 0x00870b0f0f1f1f00ULL, 0x00d78b1f1f3f7f00ULL },{ 0x000f0b0f0f1f1f00ULL, 0x008f1b1f1f3f7f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x001f1b1f1f3f3f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x003f3b3f3f3f3f00ULL },
+    { 0x00870b0f0f0f0f00ULL, 0x00cf830f0f1f3f00ULL },{ 0x000f0b0f0f0f0f00ULL, 0x009f0b1f1f1f3f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x001f1b1f1f1f3f00ULL },{ 0x001f1b1f1f1f1f00ULL, 0x003f3b3f3f3f3f00ULL },
+    { 0x00fcfafefefefe00ULL, 0x00fcf8fefefefe00ULL },{ 0x00fef0fefe7e7e00ULL, 0x00f8fafefefefe00ULL },{ 0x00f1fafe7e7e7e00ULL, 0x00f5f1fefe7e7e00ULL },{ 0x00cf810e0e1e3e00ULL, 0x00e3fbff7f7f7f00ULL },
+    { 0x00870b0f0f1f3f00ULL, 0x00d78b1f1f3f7f00ULL },{ 0x000f0b0f0f1f3f00ULL, 0x008f1b1f1f3f7f00ULL },{ 0x001f1b1f1f1f3f00ULL, 0x001f1b1f1f3f7f00ULL },{ 0x001f1b1f1f1f3f00ULL, 0x003f3b3f3f3f7f00ULL },
   },
   {
     { 0x00fff7fffffffc00ULL, 0x00fff7ffffffff00ULL },{ 0x00fff7fffffff800ULL, 0x00fff7ffffffff00ULL },{ 0x00fff7fffffff100ULL, 0x00fff7ffffffff00ULL },{ 0x00fff7ffffffe300ULL, 0x00fff7ffffffff00ULL },
@@ -789,12 +789,12 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fff71f07000000ULL, 0x00fff7ff0f070700ULL },{ 0x00fff71f0f070700ULL, 0x00fff7ff1f0f0f00ULL },{ 0x00fff71f1f0f0f00ULL, 0x00fff7ff3f1f1f00ULL },{ 0x00fff73f3f1f1f00ULL, 0x00fff7ff3f3f3f00ULL },
     { 0x00fff4fcfcfcf800ULL, 0x00fff7fefcfefe00ULL },{ 0x00fff4fcf8f8f000ULL, 0x00fff7fcf8fcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff171f0f0f0700ULL, 0x00fff71f0f1f1f00ULL },{ 0x00ff171f1f1f0f00ULL, 0x00fff73f1f3f3f00ULL },{ 0x00ff373f3f3f1f00ULL, 0x00fff73f3f3f3f00ULL },
-    { 0x00fcf4fcfcfcfc00ULL, 0x00fff6fcfefefe00ULL },{ 0x00fcf4f8fcfcfc00ULL, 0x00fff4f8fcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f170f1f1f1f00ULL, 0x00ff170f1f1f1f00ULL },{ 0x001f171f1f1f1f00ULL, 0x00ff371f3f3f3f00ULL },{ 0x003f373f3f3f3f00ULL, 0x00ff373f3f3f3f00ULL },
-    { 0x00fcf4fcfcfcfc00ULL, 0x00fef4fefefefe00ULL },{ 0x00f8f0fcfcfcfc00ULL, 0x00fcf0fcfcfefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x000f071f1f1f1f00ULL, 0x009f071f1f3f3f00ULL },{ 0x001f171f1f1f1f00ULL, 0x003f173f3f3f3f00ULL },{ 0x003f373f3f3f3f00ULL, 0x003f373f3f3f3f00ULL },
-    { 0x00fcf4fcfcfefe00ULL, 0x00fcf6fefefefe00ULL },{ 0x00f8f4fcfcfefe00ULL, 0x00faf4fefefefe00ULL },{ 0x00f0e0fc7c7e7e00ULL, 0x00f1f6fefefefe00ULL },{ 0x00e3f67e7e7e7e00ULL, 0x00ebe3fe7e7e7e00ULL },
-    { 0x0087031e1e3e7e00ULL, 0x00c7f77f7f7f7f00ULL },{ 0x000f171f1f3f3f00ULL, 0x00af173f3f7f7f00ULL },{ 0x001f171f1f3f3f00ULL, 0x001f373f3f7f7f00ULL },{ 0x003f373f3f3f3f00ULL, 0x003f373f3f7f7f00ULL },
+    { 0x00fcf4fcfcfcfc00ULL, 0x00fff6fcfefefe00ULL },{ 0x00fcf4fcfcfcfc00ULL, 0x00fff4f8fcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f171f1f1f1f00ULL, 0x00ff170f1f1f1f00ULL },{ 0x001f171f1f1f1f00ULL, 0x00ff371f3f3f3f00ULL },{ 0x003f373f3f3f3f00ULL, 0x00ff373f3f3f3f00ULL },
+    { 0x00fcf4fcfcfcfc00ULL, 0x00fef4fefefefe00ULL },{ 0x00f8f4fcfcfcfc00ULL, 0x00fcf0fcfcfefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x000f171f1f1f1f00ULL, 0x009f071f1f3f7f00ULL },{ 0x001f171f1f1f1f00ULL, 0x003f173f3f3f7f00ULL },{ 0x003f373f3f3f3f00ULL, 0x003f373f3f3f7f00ULL },
+    { 0x00fcf4fcfcfefe00ULL, 0x00fcf6fefefefe00ULL },{ 0x00f8f4fcfcfefe00ULL, 0x00faf4fefefefe00ULL },{ 0x00fce0fc7c7e7e00ULL, 0x00f1f6fefefefe00ULL },{ 0x00e3f67e7e7e7e00ULL, 0x00ebe3fe7e7e7e00ULL },
+    { 0x009f031e1e3e7e00ULL, 0x00c7f77f7f7f7f00ULL },{ 0x000f171f1f3f7f00ULL, 0x00af173f3f7f7f00ULL },{ 0x001f171f1f3f7f00ULL, 0x001f373f3f7f7f00ULL },{ 0x003f373f3f3f7f00ULL, 0x003f373f3f7f7f00ULL },
   },
   {
     { 0x00ffeffffffffc00ULL, 0x00ffefffffffff00ULL },{ 0x00ffeffffffff800ULL, 0x00ffefffffffff00ULL },{ 0x00ffeffffffff100ULL, 0x00ffefffffffff00ULL },{ 0x00ffefffffffe300ULL, 0x00ffefffffffff00ULL },
@@ -807,12 +807,12 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffefff00000000ULL, 0x00ffefffef000000ULL },{ 0x00ffef3f0f000000ULL, 0x00ffefff1f0f0f00ULL },{ 0x00ffef3f1f0f0f00ULL, 0x00ffefff3f1f1f00ULL },{ 0x00ffef3f3f1f1f00ULL, 0x00ffefff7f3f3f00ULL },
     { 0x00ffecfcfcfcf800ULL, 0x00ffeffcfcfcfc00ULL },{ 0x00ffe8f8f8f8f000ULL, 0x00ffeffcf8fcfc00ULL },{ 0x00ffe8f8f0f0e000ULL, 0x00ffeff8f0f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff2f3f1f1f0f00ULL, 0x00ffef3f1f3f3f00ULL },{ 0x00ff2f3f3f3f1f00ULL, 0x00ffef7f3f7f7f00ULL },
-    { 0x00fcecfcfcfcfc00ULL, 0x00ffecfcfcfcfc00ULL },{ 0x00f8e8f8f8f8f800ULL, 0x00ffecf8fcfcfc00ULL },{ 0x00f8e8f0f8f8f800ULL, 0x00ffe8f0f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x003f2f1f3f3f3f00ULL, 0x00ff2f1f3f3f3f00ULL },{ 0x003f2f3f3f3f3f00ULL, 0x00ff6f3f7f7f7f00ULL },
-    { 0x00fcecfcfcfcfc00ULL, 0x00fcecfcfcfcfe00ULL },{ 0x00f8e8f8f8f8f800ULL, 0x00fce8fcfcfcfe00ULL },{ 0x00f0e0f8f8f8f800ULL, 0x00f9e0f8f8fcfe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f0f3f3f3f3f00ULL, 0x003f0f3f3f7f7f00ULL },{ 0x003f2f3f3f3f3f00ULL, 0x007f2f7f7f7f7f00ULL },
-    { 0x00fcecfcfcfcfc00ULL, 0x00fcecfcfcfefe00ULL },{ 0x00f8e8f8f8fcfc00ULL, 0x00f8ecfcfcfefe00ULL },{ 0x00f0e8f8f8fcfc00ULL, 0x00f5e8fcfcfefe00ULL },{ 0x00e1c078787c7c00ULL, 0x00e3effefefefe00ULL },
-    { 0x00c76f7e7e7e7e00ULL, 0x00d7c77f7e7e7e00ULL },{ 0x000f073f3e7e7e00ULL, 0x008f6f7f7f7f7f00ULL },{ 0x001f2f3f3f7f7f00ULL, 0x005f2f7f7f7f7f00ULL },{ 0x003f2f3f3f7f7f00ULL, 0x003f6f7f7f7f7f00ULL },
+    { 0x00fcecfcfcfcfc00ULL, 0x00ffecfcfcfcfc00ULL },{ 0x00f8e8f8f8f8f800ULL, 0x00ffecf8fcfcfc00ULL },{ 0x00f8e8f8f8f8f800ULL, 0x00ffe8f0f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x003f2f3f3f3f3f00ULL, 0x00ff2f1f3f3f3f00ULL },{ 0x003f2f3f3f3f3f00ULL, 0x00ff6f3f7f7f7f00ULL },
+    { 0x00fcecfcfcfcfc00ULL, 0x00fcecfcfcfcfe00ULL },{ 0x00f8e8f8f8f8f800ULL, 0x00fce8fcfcfcfe00ULL },{ 0x00f0e8f8f8f8f800ULL, 0x00f9e0f8f8fcfe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f2f3f3f3f3f00ULL, 0x003f0f3f3f7f7f00ULL },{ 0x003f2f3f3f3f3f00ULL, 0x007f2f7f7f7f7f00ULL },
+    { 0x00fcecfcfcfcfe00ULL, 0x00fcecfcfcfefe00ULL },{ 0x00f8e8f8f8fcfe00ULL, 0x00f8ecfcfcfefe00ULL },{ 0x00f0e8f8f8fcfe00ULL, 0x00f5e8fcfcfefe00ULL },{ 0x00f9c078787c7e00ULL, 0x00e3effefefefe00ULL },
+    { 0x00c76f7e7e7e7e00ULL, 0x00d7c77f7e7e7e00ULL },{ 0x003f073f3e7e7e00ULL, 0x008f6f7f7f7f7f00ULL },{ 0x001f2f3f3f7f7f00ULL, 0x005f2f7f7f7f7f00ULL },{ 0x003f2f3f3f7f7f00ULL, 0x003f6f7f7f7f7f00ULL },
   },
   {
     { 0x00ffdffffffffc00ULL, 0x00ffdfffffffff00ULL },{ 0x00ffdffffffff800ULL, 0x00ffdfffffffff00ULL },{ 0x00ffdffffffff100ULL, 0x00ffdfffffffff00ULL },{ 0x00ffdfffffffe300ULL, 0x00ffdfffffffff00ULL },
@@ -825,12 +825,12 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffdff0c0000000ULL, 0x00ffdfffe0c0c000ULL },{ 0x00ffdfff00000000ULL, 0x00ffdfffdf000000ULL },{ 0x00ffdf7f1f000000ULL, 0x00ffdfff3f1f1f00ULL },{ 0x00ffdf7f3f1f1f00ULL, 0x00ffdfff7f3f3f00ULL },
     { 0x00ffd8f8f8f8f800ULL, 0x00ffdffcfcfcfc00ULL },{ 0x00ffd8f8f8f8f000ULL, 0x00ffdff8f8f8f800ULL },{ 0x00ffd0f0f0f0e000ULL, 0x00ffdff8f0f8f800ULL },{ 0x00ffd0f0e0e0c000ULL, 0x00ffdff0e0f0f000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00ff5f7f3f3f1f00ULL, 0x00ffdf7f3f7f7f00ULL },
-    { 0x00f8d8f8f8f8f800ULL, 0x00ffdcfcfcfcfc00ULL },{ 0x00f8d8f8f8f8f800ULL, 0x00ffd8f8f8f8f800ULL },{ 0x00f0d0f0f0f0f000ULL, 0x00ffd8f0f8f8f800ULL },{ 0x00f1d0e0f0f0f000ULL, 0x00ffd1e0f0f0f000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x007f1f3f3f7f7f00ULL, 0x00ff5f3f7f7f7f00ULL },
-    { 0x00f8d8f8f8f8f800ULL, 0x00fcdcfcfcfcfc00ULL },{ 0x00f8d8f8f8f8f800ULL, 0x00f8d8f8f8f8fc00ULL },{ 0x00f0d0f0f0f0f000ULL, 0x00f9d0f8f8f8f800ULL },{ 0x00e1c0f0f0f0f000ULL, 0x00f3c1f0f0f8f800ULL },
+    { 0x00f8d8f8f8f8f800ULL, 0x00ffdcfcfcfcfc00ULL },{ 0x00f8d8f8f8f8f800ULL, 0x00ffd8f8f8f8f800ULL },{ 0x00f0d0f0f0f0f000ULL, 0x00ffd8f0f8f8f800ULL },{ 0x00f1d0f0f0f0f000ULL, 0x00ffd1e0f0f0f000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x007f5f7f7f7f7f00ULL, 0x00ff5f3f7f7f7f00ULL },
+    { 0x00f8d8f8f8f8f800ULL, 0x00fcdcfcfcfcfc00ULL },{ 0x00f8d8f8f8f8f800ULL, 0x00f8d8f8f8f8fc00ULL },{ 0x00f0d0f0f0f0f000ULL, 0x00f9d0f8f8f8fc00ULL },{ 0x00e1d0f0f0f0f000ULL, 0x00f3c1f0f0f8fc00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x003f1f7f7f7f7f00ULL, 0x007f1f7f7f7f7f00ULL },
-    { 0x00f8d8f8f8f8f800ULL, 0x00fcdcfcfcfcfc00ULL },{ 0x00f8d8f8f8f8f800ULL, 0x00f8d8f8f8fcfc00ULL },{ 0x00f0d0f0f0f8f800ULL, 0x00f1d8f8f8fcfc00ULL },{ 0x00e1d0f0f0f8f800ULL, 0x00ebd1f8f8fcfc00ULL },
-    { 0x00c3817070787c00ULL, 0x00c7dffffefefe00ULL },{ 0x008f5f7f7e7e7e00ULL, 0x00af8f7f7f7e7e00ULL },{ 0x001f0f7f7f7e7e00ULL, 0x001f5f7f7f7f7f00ULL },{ 0x003f1f7f7f7f7f00ULL, 0x003f1f7f7f7f7f00ULL },
+    { 0x00f8d8f8f8f8fc00ULL, 0x00fcdcfcfcfcfe00ULL },{ 0x00f8d8f8f8f8fc00ULL, 0x00f8d8f8f8fcfe00ULL },{ 0x00f0d0f0f0f8fc00ULL, 0x00f1d8f8f8fcfe00ULL },{ 0x00e1d0f0f0f8fc00ULL, 0x00ebd1f8f8fcfe00ULL },
+    { 0x00f3817070787c00ULL, 0x00c7dffffefefe00ULL },{ 0x008f5f7f7e7e7e00ULL, 0x00af8f7f7f7e7e00ULL },{ 0x007f0f7f7f7e7e00ULL, 0x001f5f7f7f7f7f00ULL },{ 0x003f5f7f7f7f7f00ULL, 0x003f1f7f7f7f7f00ULL },
   },
   {
     { 0x00ffbffffffffc00ULL, 0x00ffbfffffffff00ULL },{ 0x00ffbffffffff800ULL, 0x00ffbfffffffff00ULL },{ 0x00ffbffffffff100ULL, 0x00ffbfffffffff00ULL },{ 0x00ffbfffffffe300ULL, 0x00ffbfffffffff00ULL },
@@ -844,11 +844,11 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffb8f8f8f8f800ULL, 0x00ffbff8f8f8f800ULL },{ 0x00ffb0f0f0f0f000ULL, 0x00ffbff8f8f8f800ULL },{ 0x00ffb0f0f0f0e000ULL, 0x00ffbff0f0f0f000ULL },{ 0x00ffa0e0e0e0c000ULL, 0x00ffbff0e0f0f000ULL },
     { 0x00ffa1e0c0c08000ULL, 0x00ffbfe1c0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8b8f8f8f8f800ULL, 0x00ffb8f8f8f8f800ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00ffb8f8f8f8f800ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00ffb0f0f0f0f000ULL },{ 0x00e1a0e0e0e0e000ULL, 0x00ffb1e0f0f0f000ULL },
-    { 0x00e3a1c0e0e0e000ULL, 0x00ffa3c1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00f8b8f8f8f8f800ULL, 0x00fcb8f8f8f8f800ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00f8b8f8f8f8f800ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00f1b0f0f0f0f000ULL },{ 0x00e1a0e0e0e0e000ULL, 0x00f3a1f0f0f0f000ULL },
-    { 0x00c3816060606000ULL, 0x00e783e1e0f0f000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00f8b8f8f8f8f800ULL, 0x00fcb8f8f8f8f800ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00f8b8f8f8f8fc00ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00f1b0f0f0f8f800ULL },{ 0x00e1a0e0e0f0f800ULL, 0x00e3b1f0f0f8f800ULL },
-    { 0x00c3a16060707800ULL, 0x00d7a3f1f0f8f800ULL },{ 0x0087036160707000ULL, 0x008fbf7f7f7e7e00ULL },{ 0x001f3f7f7f7c7e00ULL, 0x005f1f7f7f7f7f00ULL },{ 0x001f000000000000ULL, 0x003f3f7f7f7f7f00ULL },
+    { 0x00e3a1e0e0e0e000ULL, 0x00ffa3c1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00f8b8f8f8f8f800ULL, 0x00fcb8f8f8f8f800ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00f8b8f8f8f8f800ULL },{ 0x00f0b0f0f0f0f000ULL, 0x00f1b0f0f0f0f800ULL },{ 0x00e1a0e0e0e0e000ULL, 0x00f3a1f0f0f0f800ULL },
+    { 0x00c3a16060606000ULL, 0x00e783e1e0f0f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00f8b8f8f8f8f800ULL, 0x00fcb8f8f8f8fc00ULL },{ 0x00f0b0f0f0f0f800ULL, 0x00f8b8f8f8f8fc00ULL },{ 0x00f0b0f0f0f0f800ULL, 0x00f1b0f0f0f8fc00ULL },{ 0x00e1a0e0e0f0f800ULL, 0x00e3b1f0f0f8fc00ULL },
+    { 0x00c3a16060707800ULL, 0x00d7a3f1f0f8fc00ULL },{ 0x00e7036160707800ULL, 0x008fbf7f7f7e7e00ULL },{ 0x001f3f7f7f7e7e00ULL, 0x005f1f7f7f7f7f00ULL },{ 0x005f1f7f7f7f7f00ULL, 0x003f3f7f7f7f7f00ULL },
   },
   {
     { 0x00ff7ffffffffc00ULL, 0x00ff7fffffffff00ULL },{ 0x00ff7ffffffff800ULL, 0x00ff7fffffffff00ULL },{ 0x00ff7ffffffff100ULL, 0x00ff7fffffffff00ULL },{ 0x00ff7fffffffe300ULL, 0x00ff7fffffffff00ULL },
@@ -862,11 +862,11 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ff70f0f0f0f000ULL, 0x00ff7ff8f8f8f800ULL },{ 0x00ff70f0f0f0f000ULL, 0x00ff7ff0f0f0f000ULL },{ 0x00ff60e0e0e0e000ULL, 0x00ff7ff0f0f0f000ULL },{ 0x00ff60e0e0e0c000ULL, 0x00ff7fe0e0e0e000ULL },
     { 0x00ff414040400000ULL, 0x00ff7fe1c0e0e000ULL },{ 0x00ff434100000000ULL, 0x00ff7fc301404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f870f0f0f0f000ULL, 0x00ff78f8f8f8f800ULL },{ 0x00f070f0f0f0f000ULL, 0x00ff70f0f0f0f000ULL },{ 0x00e060e0e0e0e000ULL, 0x00ff70f0f0f0f000ULL },{ 0x00e160e0e0e0e000ULL, 0x00ff61e0e0e0e000ULL },
-    { 0x00c3414040404000ULL, 0x00ff63c1e0e0e000ULL },{ 0x00c7430140404000ULL, 0x00ff470341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00f870f0f0f0f000ULL, 0x00fc78f8f8f8f800ULL },{ 0x00f070f0f0f0f000ULL, 0x00f870f0f0f0f000ULL },{ 0x00e060e0e0e0e000ULL, 0x00f170f0f0f0f000ULL },{ 0x00e160e0e0e0e000ULL, 0x00e361e0e0e0e000ULL },
-    { 0x00c3414040404000ULL, 0x00e743e1e0e0e000ULL },{ 0x0087034140404000ULL, 0x00cf074341607000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00f870f0f0f0f000ULL, 0x00fc78f8f8f8f800ULL },{ 0x00f070f0f0f0f000ULL, 0x00f870f0f0f0f000ULL },{ 0x00e060e0e0e0f000ULL, 0x00f170f0f0f0f000ULL },{ 0x00e160e0e0e0e000ULL, 0x00e361e0e0f0f000ULL },
-    { 0x00c3414040606000ULL, 0x00c763e1e0f0f000ULL },{ 0x0087434140606000ULL, 0x00af476361707000ULL },{ 0x000f074341606000ULL, 0x001f7f7f7f7f7f00ULL },{ 0x001f000000000000ULL, 0x003f3f7f7f7f7f00ULL },
+    { 0x00c3414040404000ULL, 0x00ff63c1e0e0e000ULL },{ 0x00c7434140404000ULL, 0x00ff470341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00f870f0f0f0f000ULL, 0x00fc78f8f8f8f800ULL },{ 0x00f070f0f0f0f000ULL, 0x00f870f0f0f0f000ULL },{ 0x00e060e0e0e0e000ULL, 0x00f170f0f0f0f000ULL },{ 0x00e160e0e0e0e000ULL, 0x00e361e0e0e0f000ULL },
+    { 0x00c3414040404000ULL, 0x00e743e1e0e0f000ULL },{ 0x0087434140404000ULL, 0x00cf074341607000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00f870f0f0f0f000ULL, 0x00fc78f8f8f8f800ULL },{ 0x00f070f0f0f0f000ULL, 0x00f870f0f0f0f800ULL },{ 0x00e060e0e0e0f000ULL, 0x00f170f0f0f0f800ULL },{ 0x00e160e0e0e0f000ULL, 0x00e361e0e0f0f800ULL },
+    { 0x00c3414040607000ULL, 0x00c763e1e0f0f800ULL },{ 0x0087434140607000ULL, 0x00af476361707800ULL },{ 0x004f074341607000ULL, 0x001f7f7f7f7f7f00ULL },{ 0x001f7f7f7f7f7f00ULL, 0x003f3f7f7f7f7f00ULL },
   },
   {
     { 0x00fefffffffffc00ULL, 0x00feffffffffff00ULL },{ 0x00fefffffffff800ULL, 0x00feffffffffff00ULL },{ 0x00fefffffffff100ULL, 0x00feffffffffff00ULL },{ 0x00feffffffffe300ULL, 0x00feffffffffff00ULL },
@@ -880,11 +880,11 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00feffe0c0808000ULL, 0x00fefffee0c0c000ULL },{ 0x00fee3c080000000ULL, 0x00feffe1c0808000ULL },{ 0x00fec38000000000ULL, 0x00feffc380000000ULL },{ 0x00fe830200000000ULL, 0x00feff8703030100ULL },
     { 0x00fe070703010100ULL, 0x00feff0707070300ULL },{ 0x00fe070707030300ULL, 0x00feff0f0f0f0700ULL },{ 0x00fe0f0f0f070700ULL, 0x00feff0f0f0f0f00ULL },{ 0x00fe0f0f0f0f0f00ULL, 0x00feff1f1f1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e2c28000000000ULL, 0x00fee3c082020200ULL },{ 0x00c2820202000000ULL, 0x00fec78307070700ULL },
-    { 0x0086070707030100ULL, 0x00fe870707070700ULL },{ 0x0006070707070300ULL, 0x00fe0f0f0f0f0f00ULL },{ 0x000e0f0f0f0f0700ULL, 0x00fe0f0f0f0f0f00ULL },{ 0x001e0f0f0f0f0f00ULL, 0x00fe1f1f1f1f0f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e2c08202020200ULL, 0x00f2e0c282020200ULL },{ 0x00c2820202020200ULL, 0x00e6c38707070700ULL },
+    { 0x0086070707030100ULL, 0x00fe870707070700ULL },{ 0x0006070707070300ULL, 0x00fe0f0f0f0f0f00ULL },{ 0x000e0f0f0f0f0700ULL, 0x00fe0f0f0f0f0f00ULL },{ 0x001e0f0f0f0f0f00ULL, 0x00fe1f1f1f1f1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e2c28202020200ULL, 0x00f2e0c282020200ULL },{ 0x00c2820202020200ULL, 0x00e6c38707070700ULL },
     { 0x0086070707070700ULL, 0x00c6870707070700ULL },{ 0x0006070707070700ULL, 0x008e0f0f0f0f0f00ULL },{ 0x000e0f0f0f0f0f00ULL, 0x001e0f0f0f0f0f00ULL },{ 0x001e0f0f0f0f0f00ULL, 0x003e1f1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e0c28202020200ULL, 0x00f4e2c6860e0e00ULL },{ 0x00c2820202020200ULL, 0x00e2c787070f1f00ULL },
-    { 0x0086070707070700ULL, 0x00c68707070f0f00ULL },{ 0x0006070707070700ULL, 0x008e0f0f0f0f0f00ULL },{ 0x000e0f0f0f0f0f00ULL, 0x001e0f0f0f0f0f00ULL },{ 0x001e0f0f0f0f0f00ULL, 0x003e1f1f1f1f1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e2c28202020200ULL, 0x00f4e2c6860e1e00ULL },{ 0x00c2820202020200ULL, 0x00e2c787070f1f00ULL },
+    { 0x0086070707070700ULL, 0x00c68707070f1f00ULL },{ 0x0006070707070700ULL, 0x008e0f0f0f0f1f00ULL },{ 0x000e0f0f0f0f0f00ULL, 0x001e0f0f0f0f1f00ULL },{ 0x001e0f0f0f0f0f00ULL, 0x003e1f1f1f1f1f00ULL },
   },
   {
     { 0x00fdfffffffffc00ULL, 0x00fdffffffffff00ULL },{ 0x00fdfffffffff800ULL, 0x00fdffffffffff00ULL },{ 0x00fdfffffffff100ULL, 0x00fdffffffffff00ULL },{ 0x00fdffffffffe300ULL, 0x00fdffffffffff00ULL },
@@ -899,10 +899,10 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fd070703010100ULL, 0x00fdff0f07070300ULL },{ 0x00fd0f0f07030300ULL, 0x00fdff0f0f0f0700ULL },{ 0x00fd0f0f0f070700ULL, 0x00fdff1f1f1f0f00ULL },{ 0x00fd1f1f1f0f0f00ULL, 0x00fdff1f1f1f1f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c5870303000000ULL, 0x00fdc78307070700ULL },
     { 0x0085070707030100ULL, 0x00fd8f070f0f0f00ULL },{ 0x000d0f0f0f070300ULL, 0x00fd0f0f0f0f0f00ULL },{ 0x000d0f0f0f0f0700ULL, 0x00fd1f1f1f1f1f00ULL },{ 0x001d1f1f1f1f0f00ULL, 0x00fd1f1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c5830707070700ULL, 0x00e5c38707070700ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c5870707070700ULL, 0x00e5c38707070700ULL },
     { 0x0085070707070700ULL, 0x00cd870f0f0f0f00ULL },{ 0x000d0f0f0f0f0f00ULL, 0x008d0f0f0f0f0f00ULL },{ 0x000d0f0f0f0f0f00ULL, 0x001d1f1f1f1f1f00ULL },{ 0x001d1f1f1f1f1f00ULL, 0x003d1f1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c1870707070700ULL, 0x00e9c78f0f1f1f00ULL },
-    { 0x0085070707070700ULL, 0x00c58f0f0f1f1f00ULL },{ 0x000d0f0f0f0f0f00ULL, 0x008d0f0f0f1f1f00ULL },{ 0x000d0f0f0f0f0f00ULL, 0x001d1f1f1f1f1f00ULL },{ 0x001d1f1f1f1f1f00ULL, 0x003d1f1f1f1f1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c5870707070700ULL, 0x00e9c78f0f1f3f00ULL },
+    { 0x0085070707070700ULL, 0x00c58f0f0f1f3f00ULL },{ 0x000d0f0f0f0f0f00ULL, 0x008d0f0f0f1f3f00ULL },{ 0x000d0f0f0f0f0f00ULL, 0x001d1f1f1f1f3f00ULL },{ 0x001d1f1f1f1f1f00ULL, 0x003d1f1f1f1f3f00ULL },
   },
   {
     { 0x00fbfffffffffc00ULL, 0x00fbffffffffff00ULL },{ 0x00fbfffffffff800ULL, 0x00fbffffffffff00ULL },{ 0x00fbfffffffff100ULL, 0x00fbffffffffff00ULL },{ 0x00fbffffffffe300ULL, 0x00fbffffffffff00ULL },
@@ -917,10 +917,10 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fb0f0703010100ULL, 0x00fbff0f07070300ULL },{ 0x00fb0f0f07030300ULL, 0x00fbff1f0f0f0700ULL },{ 0x00fb1f1f0f070700ULL, 0x00fbff1f1f1f0f00ULL },{ 0x00fb1f1f1f0f0f00ULL, 0x00fbff3f3f3f1f00ULL },
     { 0x00fafefcfcf8f000ULL, 0x00fbfefcfefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x008b0f0707030100ULL, 0x00fb8f070f0f0f00ULL },{ 0x000b0f0f0f070300ULL, 0x00fb1f0f1f1f1f00ULL },{ 0x001b1f1f1f0f0700ULL, 0x00fb1f1f1f1f1f00ULL },{ 0x001b1f1f1f1f0f00ULL, 0x00fb3f3f3f3f3f00ULL },
-    { 0x00fafcfcfefefe00ULL, 0x00fafcfefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x008b070f0f0f0f00ULL, 0x00cb870f0f0f0f00ULL },{ 0x000b0f0f0f0f0f00ULL, 0x009b0f1f1f1f1f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x001b1f1f1f1f1f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x003b3f3f3f3f3f00ULL },
-    { 0x00f8000000000000ULL, 0x00f8fefefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00830f0f0f0f0f00ULL, 0x00d38f1f1f3f3f00ULL },{ 0x000b0f0f0f0f0f00ULL, 0x008b1f1f1f3f3f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x001b1f1f1f3f3f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x003b3f3f3f3f7f00ULL },
+    { 0x00fafefefefefe00ULL, 0x00fafcfefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x008b0f0f0f0f0f00ULL, 0x00cb870f0f0f0f00ULL },{ 0x000b0f0f0f0f0f00ULL, 0x009b0f1f1f1f1f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x001b1f1f1f1f1f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x003b3f3f3f3f3f00ULL },
+    { 0x00fafcfefefefe00ULL, 0x00f8fefefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x008b0f0f0f0f0f00ULL, 0x00d38f1f1f3f7f00ULL },{ 0x000b0f0f0f0f0f00ULL, 0x008b1f1f1f3f7f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x001b1f1f1f3f7f00ULL },{ 0x001b1f1f1f1f1f00ULL, 0x003b3f3f3f3f7f00ULL },
   },
   {
     { 0x00f7fffffffffc00ULL, 0x00f7ffffffffff00ULL },{ 0x00f7fffffffff800ULL, 0x00f7ffffffffff00ULL },{ 0x00f7fffffffff100ULL, 0x00f7ffffffffff00ULL },{ 0x00f7ffffffffe300ULL, 0x00f7ffffffffff00ULL },
@@ -935,10 +935,10 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00f71f0700000000ULL, 0x00f7ff0f07070300ULL },{ 0x00f71f0f07030300ULL, 0x00f7ff1f0f0f0700ULL },{ 0x00f71f1f0f070700ULL, 0x00f7ff3f1f1f0f00ULL },{ 0x00f73f3f1f0f0f00ULL, 0x00f7ff3f3f3f1f00ULL },
     { 0x00f4fcfcfcf8f000ULL, 0x00f7fefcfefefe00ULL },{ 0x00f4fcf8f8f0e000ULL, 0x00f7fcf8fcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00171f0f0f070300ULL, 0x00f71f0f1f1f1f00ULL },{ 0x00171f1f1f0f0700ULL, 0x00f73f1f3f3f3f00ULL },{ 0x00373f3f3f1f0f00ULL, 0x00f73f3f3f3f3f00ULL },
-    { 0x00f4fcfcfcfcfc00ULL, 0x00f6fcfefefefe00ULL },{ 0x00f4f8fcfcfcfc00ULL, 0x00f4f8fcfcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00170f1f1f1f1f00ULL, 0x00970f1f1f1f1f00ULL },{ 0x00171f1f1f1f1f00ULL, 0x00371f3f3f3f3f00ULL },{ 0x00373f3f3f3f3f00ULL, 0x00373f3f3f3f3f00ULL },
-    { 0x00f4fcfcfcfcfc00ULL, 0x00f4fefefefefe00ULL },{ 0x00f0fcfcfcfcfc00ULL, 0x00f2fcfefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00071f1f1f1f1f00ULL, 0x00a71f3f3f7f7f00ULL },{ 0x00171f1f1f1f1f00ULL, 0x00173f3f3f7f7f00ULL },{ 0x00373f3f3f3f3f00ULL, 0x00373f3f3f7f7f00ULL },
+    { 0x00f4fcfcfcfcfc00ULL, 0x00f6fcfefefefe00ULL },{ 0x00f4fcfcfcfcfc00ULL, 0x00f4f8fcfcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00171f1f1f1f1f00ULL, 0x00970f1f1f1f1f00ULL },{ 0x00171f1f1f1f1f00ULL, 0x00371f3f3f3f3f00ULL },{ 0x00373f3f3f3f3f00ULL, 0x00373f3f3f3f3f00ULL },
+    { 0x00f4fcfcfcfcfc00ULL, 0x00f4fefefefefe00ULL },{ 0x00f4fcfcfcfcfc00ULL, 0x00f2fcfefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00171f1f1f1f1f00ULL, 0x00a71f3f3f7f7f00ULL },{ 0x00171f1f1f1f1f00ULL, 0x00173f3f3f7f7f00ULL },{ 0x00373f3f3f3f3f00ULL, 0x00373f3f3f7f7f00ULL },
   },
   {
     { 0x00effffffffffc00ULL, 0x00efffffffffff00ULL },{ 0x00effffffffff800ULL, 0x00efffffffffff00ULL },{ 0x00effffffffff100ULL, 0x00efffffffffff00ULL },{ 0x00efffffffffe300ULL, 0x00efffffffffff00ULL },
@@ -953,10 +953,10 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00efff0000000000ULL, 0x00efffef00000000ULL },{ 0x00ef3f0f00000000ULL, 0x00efff1f0f0f0700ULL },{ 0x00ef3f1f0f070700ULL, 0x00efff3f1f1f0f00ULL },{ 0x00ef3f3f1f0f0f00ULL, 0x00efff7f3f3f1f00ULL },
     { 0x00ecfcfcfcf8f000ULL, 0x00effcfcfcfcfc00ULL },{ 0x00e8f8f8f8f0e000ULL, 0x00effcf8fcfcfc00ULL },{ 0x00e8f8f0f0e0c000ULL, 0x00eff8f0f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x002f3f1f1f0f0700ULL, 0x00ef3f1f3f3f3f00ULL },{ 0x002f3f3f3f1f0f00ULL, 0x00ef7f3f7f7f7f00ULL },
-    { 0x00ecfcfcfcfcfc00ULL, 0x00ecfcfcfcfcfc00ULL },{ 0x00e8f8f8f8f8f800ULL, 0x00ecf8fcfcfcfc00ULL },{ 0x00e8f0f8f8f8f800ULL, 0x00e9f0f8f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x002f1f3f3f3f3f00ULL, 0x002f1f3f3f3f3f00ULL },{ 0x002f3f3f3f3f3f00ULL, 0x006f3f7f7f7f7f00ULL },
-    { 0x00ecfcfcfcfcfc00ULL, 0x00ecfcfcfcfefe00ULL },{ 0x00e8f8f8f8f8f800ULL, 0x00e8fcfcfcfefe00ULL },{ 0x00e0f8f8f8f8f800ULL, 0x00e5f8fcfcfefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x000f3f3f3f3f3f00ULL, 0x004f3f7f7f7f7f00ULL },{ 0x002f3f3f3f3f3f00ULL, 0x002f7f7f7f7f7f00ULL },
+    { 0x00ecfcfcfcfcfc00ULL, 0x00ecfcfcfcfcfc00ULL },{ 0x00e8f8f8f8f8f800ULL, 0x00ecf8fcfcfcfc00ULL },{ 0x00e8f8f8f8f8f800ULL, 0x00e9f0f8f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x002f3f3f3f3f3f00ULL, 0x002f1f3f3f3f3f00ULL },{ 0x002f3f3f3f3f3f00ULL, 0x006f3f7f7f7f7f00ULL },
+    { 0x00ecfcfcfcfcfc00ULL, 0x00ecfcfcfcfefe00ULL },{ 0x00e8f8f8f8f8f800ULL, 0x00e8fcfcfcfefe00ULL },{ 0x00e8f8f8f8f8f800ULL, 0x00e5f8fcfcfefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x002f3f3f3f3f3f00ULL, 0x004f3f7f7f7f7f00ULL },{ 0x002f3f3f3f3f3f00ULL, 0x002f7f7f7f7f7f00ULL },
   },
   {
     { 0x00dffffffffffc00ULL, 0x00dfffffffffff00ULL },{ 0x00dffffffffff800ULL, 0x00dfffffffffff00ULL },{ 0x00dffffffffff100ULL, 0x00dfffffffffff00ULL },{ 0x00dfffffffffe300ULL, 0x00dfffffffffff00ULL },
@@ -971,10 +971,10 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00dff1c000000000ULL, 0x00dfffe1c0c08000ULL },{ 0x00dfff0100000000ULL, 0x00dfffdf01000000ULL },{ 0x00df7f1f01000000ULL, 0x00dfff3f1f1f0f00ULL },{ 0x00df7f3f1f0f0f00ULL, 0x00dfff7f3f3f1f00ULL },
     { 0x00d8f8f8f8f8f000ULL, 0x00dffcfcfcfcfc00ULL },{ 0x00d8f8f8f8f0e000ULL, 0x00dff8f8f8f8f800ULL },{ 0x00d0f0f0f0e0c000ULL, 0x00dff8f0f8f8f800ULL },{ 0x00d1f0e0e0c08000ULL, 0x00dff1e0f0f0f000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x005f7f3f3f1f0f00ULL, 0x00df7f3f7f7f7f00ULL },
-    { 0x00d8f8f8f8f8f800ULL, 0x00dcfcfcfcfcfc00ULL },{ 0x00d8f8f8f8f8f800ULL, 0x00d8f8f8f8f8f800ULL },{ 0x00d0f0f0f0f0f000ULL, 0x00d9f0f8f8f8f800ULL },{ 0x00d1e0f0f0f0f000ULL, 0x00d3e1f0f0f0f000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x005f3f3f7f7f7f00ULL, 0x005f3f7f7f7f7f00ULL },
-    { 0x00d8f8f8f8f8f800ULL, 0x00dcfcfcfcfcfc00ULL },{ 0x00d8f8f8f8f8f800ULL, 0x00d8f8f8f8fcfc00ULL },{ 0x00d0f0f0f0f0f000ULL, 0x00d1f8f8f8fcfe00ULL },{ 0x00c1f0f0f0f0f000ULL, 0x00cbf1f8f8fcfc00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f000000000000ULL, 0x001f7f7f7f7f7f00ULL },
+    { 0x00d8f8f8f8f8f800ULL, 0x00dcfcfcfcfcfc00ULL },{ 0x00d8f8f8f8f8f800ULL, 0x00d8f8f8f8f8f800ULL },{ 0x00d0f0f0f0f0f000ULL, 0x00d9f0f8f8f8f800ULL },{ 0x00d1f0f0f0f0f000ULL, 0x00d3e1f0f0f0f000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x005f7f7f7f7f7f00ULL, 0x005f3f7f7f7f7f00ULL },
+    { 0x00d8f8f8f8f8f800ULL, 0x00dcfcfcfcfcfe00ULL },{ 0x00d8f8f8f8f8f800ULL, 0x00d8f8f8f8fcfe00ULL },{ 0x00d0f0f0f0f0f000ULL, 0x00d1f8f8f8fcfe00ULL },{ 0x00d1f0f0f0f0f000ULL, 0x00cbf1f8f8fcfe00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x005f3f7f7f7f7f00ULL, 0x001f7f7f7f7f7f00ULL },
   },
   {
     { 0x00bffffffffffc00ULL, 0x00bfffffffffff00ULL },{ 0x00bffffffffff800ULL, 0x00bfffffffffff00ULL },{ 0x00bffffffffff100ULL, 0x00bfffffffffff00ULL },{ 0x00bfffffffffe300ULL, 0x00bfffffffffff00ULL },
@@ -990,9 +990,9 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00b8f8f8f8f8f000ULL, 0x00bff8f8f8f8f800ULL },{ 0x00b0f0f0f0f0e000ULL, 0x00bff8f8f8f8f800ULL },{ 0x00b0f0f0f0e0c000ULL, 0x00bff0f0f0f0f000ULL },{ 0x00a1e0e0e0c08000ULL, 0x00bff1e0f0f0f000ULL },
     { 0x00a3e1c0c0000000ULL, 0x00bfe3c1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00b8f8f8f8f8f800ULL, 0x00bcf8f8f8f8f800ULL },{ 0x00b0f0f0f0f0f000ULL, 0x00b8f8f8f8f8f800ULL },{ 0x00b0f0f0f0f0f000ULL, 0x00b1f0f0f0f0f000ULL },{ 0x00a1e0e0e0e0e000ULL, 0x00b3e1f0f0f0f000ULL },
-    { 0x00a3c1e0e0e0e000ULL, 0x00a7c3e1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00b8f8f8f8f8f800ULL, 0x00bcf8f8f8f8f800ULL },{ 0x00b0f0f0f0f0f000ULL, 0x00b8f8f8f8f8f800ULL },{ 0x00b0f0f0f0f0f000ULL, 0x00b1f0f0f0f8fc00ULL },{ 0x00a1e0e0e0e0e000ULL, 0x00a3f1f0f0f8f800ULL },
-    { 0x0083e1e0e0e0e000ULL, 0x0097e3f1f0f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00a3e1e0e0e0e000ULL, 0x00a7c3e1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00b8f8f8f8f8f800ULL, 0x00bcf8f8f8f8fc00ULL },{ 0x00b0f0f0f0f0f000ULL, 0x00b8f8f8f8f8fc00ULL },{ 0x00b0f0f0f0f0f000ULL, 0x00b1f0f0f0f8fc00ULL },{ 0x00a1e0e0e0e0e000ULL, 0x00a3f1f0f0f8fc00ULL },
+    { 0x00a3e1e0e0e0e000ULL, 0x0097e3f1f0f8fc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
   },
   {
     { 0x007ffffffffffc00ULL, 0x007fffffffffff00ULL },{ 0x007ffffffffff800ULL, 0x007fffffffffff00ULL },{ 0x007ffffffffff100ULL, 0x007fffffffffff00ULL },{ 0x007fffffffffe300ULL, 0x007fffffffffff00ULL },
@@ -1008,9 +1008,9 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x0078f0f0f0f0f000ULL, 0x007ff8f8f8f8f800ULL },{ 0x0070f0f0f0f0e000ULL, 0x007ff0f0f0f0f000ULL },{ 0x0060e0e0e0e0c000ULL, 0x007ff0f0f0f0f000ULL },{ 0x0061e0e0e0c08000ULL, 0x007fe1e0e0e0e000ULL },
     { 0x0043414040000000ULL, 0x007fe3c1e0e0e000ULL },{ 0x0047430100000000ULL, 0x007fc70341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0078f0f0f0f0f000ULL, 0x007cf8f8f8f8f800ULL },{ 0x0070f0f0f0f0f000ULL, 0x0078f0f0f0f0f000ULL },{ 0x0060e0e0e0e0e000ULL, 0x0071f0f0f0f0f000ULL },{ 0x0061e0e0e0e0e000ULL, 0x0063e1e0e0e0e000ULL },
-    { 0x0043414040400000ULL, 0x0067c3e1e0e0e000ULL },{ 0x0047034140404000ULL, 0x004f074341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0078f0f0f0f0f000ULL, 0x007cf8f8f8f8f800ULL },{ 0x0070f0f0f0f0f000ULL, 0x0078f0f0f0f0f800ULL },{ 0x0060e0e0e0e0e000ULL, 0x0071f0f0f0f0f000ULL },{ 0x0061e0e0e0e0e000ULL, 0x0063e1e0e0f0f800ULL },
-    { 0x0043414040404000ULL, 0x0047e3e1e0f0f000ULL },{ 0x0007434140404000ULL, 0x002f476361707000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0043414040404000ULL, 0x0067c3e1e0e0e000ULL },{ 0x0047434140404000ULL, 0x004f074341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0078f0f0f0f0f000ULL, 0x007cf8f8f8f8f800ULL },{ 0x0070f0f0f0f0f000ULL, 0x0078f0f0f0f0f800ULL },{ 0x0060e0e0e0e0e000ULL, 0x0071f0f0f0f0f800ULL },{ 0x0061e0e0e0e0e000ULL, 0x0063e1e0e0f0f800ULL },
+    { 0x0043414040404000ULL, 0x0047e3e1e0f0f800ULL },{ 0x0047434140404000ULL, 0x002f476361707800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
@@ -1023,11 +1023,11 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ffff0301000000ULL, 0x00ffffff03010100ULL },{ 0x00ffff0703010100ULL, 0x00ffffff07030300ULL },{ 0x00ffff0f07030300ULL, 0x00ffffff0f070700ULL },{ 0x00ffff0f0f070700ULL, 0x00ffffff1f0f0f00ULL },
     { 0x00fff0e0c0808000ULL, 0x00fffffce0c0c000ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808000ULL },{ 0x00ffc08000000000ULL, 0x00ffffc180000000ULL },{ 0x00ff830000000000ULL, 0x00ffff8301000000ULL },
     { 0x00ff070301000000ULL, 0x00ffff0703010100ULL },{ 0x00ff070703010100ULL, 0x00ffff0f07030300ULL },{ 0x00ff0f0f07030300ULL, 0x00ffff0f0f070700ULL },{ 0x00ff0f0f0f070700ULL, 0x00ffff1f1f0f0f00ULL },
-    { 0x00fff0e0c0808000ULL, 0x00fefef0e0c0c000ULL },{ 0x00f2e0c080000000ULL, 0x00fef0e0c0808000ULL },{ 0x00e2c08000000000ULL, 0x00fee3c080000000ULL },{ 0x00c2820000000000ULL, 0x00ffc78303000000ULL },
+    { 0x00fff0e0c0808000ULL, 0x00fffef0e0c0c000ULL },{ 0x00f2e0c080000000ULL, 0x00fff0e0c0808000ULL },{ 0x00e2c08000000000ULL, 0x00ffe3c080000000ULL },{ 0x00c2820000000000ULL, 0x00ffc78303000000ULL },
     { 0x0087070301000000ULL, 0x00ff870707030100ULL },{ 0x0007070703010100ULL, 0x00ff0f0f0f070300ULL },{ 0x000f0f0f07030300ULL, 0x00ff0f0f0f0f0700ULL },{ 0x001f0f0f0f070700ULL, 0x00ff1f1f1f1f0f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e2c08000000000ULL, 0x00f2e0c282020200ULL },{ 0x00c2820200000000ULL, 0x00e7c38707070700ULL },
-    { 0x0087070703000000ULL, 0x00c7870707070700ULL },{ 0x0007070707030100ULL, 0x008f0f0f0f0f0f00ULL },{ 0x000f0f0f0f070300ULL, 0x001f0f0f0f0f0f00ULL },{ 0x001f0f0f0f070700ULL, 0x003f1f1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e0c28202000000ULL, 0x00f0e2c282020200ULL },{ 0x00c2820202000000ULL, 0x00e3c78707070700ULL },
+    { 0x0087070703000000ULL, 0x00c7870707070700ULL },{ 0x0007070707030100ULL, 0x008f0f0f0f0f0f00ULL },{ 0x000f0f0f0f070300ULL, 0x001f0f0f0f0f0f00ULL },{ 0x001f0f0f0f0f0700ULL, 0x003f1f1f1f1f1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00e2c28202020200ULL, 0x00f0e2c282020200ULL },{ 0x00c2820202020200ULL, 0x00e3c78707070700ULL },
     { 0x0087070707070700ULL, 0x00c7870707070700ULL },{ 0x0007070707070700ULL, 0x008f0f0f0f0f0f00ULL },{ 0x000f0f0f0f0f0f00ULL, 0x001f0f0f0f0f0f00ULL },{ 0x001f0f0f0f0f0f00ULL, 0x003f1f1f1f1f1f00ULL },
   },
   {
@@ -1045,8 +1045,8 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x0087070301000000ULL, 0x00ff8f0707030100ULL },{ 0x000f0f0703010100ULL, 0x00ff0f0f0f070300ULL },{ 0x000f0f0f07030300ULL, 0x00ff1f1f1f0f0700ULL },{ 0x001f1f1f0f070700ULL, 0x00ff1f1f1f1f0f00ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c7830300000000ULL, 0x00e7c38707070700ULL },
     { 0x0087070703000000ULL, 0x00cf870f0f0f0f00ULL },{ 0x000f0f0f07030100ULL, 0x008f0f0f0f0f0f00ULL },{ 0x000f0f0f0f070300ULL, 0x001f1f1f1f1f1f00ULL },{ 0x001f1f1f1f0f0700ULL, 0x003f1f1f1f1f1f00ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c3870707070700ULL, 0x00e3c78707070700ULL },
-    { 0x0087070707070300ULL, 0x00c78f0f0f0f0f00ULL },{ 0x000f0f0f0f0f0f00ULL, 0x008f0f0f0f0f0f00ULL },{ 0x000f0f0f0f0f0f00ULL, 0x001f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x003f1f1f1f1f1f00ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x00c7870707070700ULL, 0x00e3c78707070700ULL },
+    { 0x0087070707070700ULL, 0x00c78f0f0f0f0f00ULL },{ 0x000f0f0f0f0f0f00ULL, 0x008f0f0f0f0f0f00ULL },{ 0x000f0f0f0f0f0f00ULL, 0x001f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x003f1f1f1f1f1f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
@@ -1063,8 +1063,8 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x008f070301000000ULL, 0x00ff8f0707030100ULL },{ 0x000f0f0703010100ULL, 0x00ff1f0f0f070300ULL },{ 0x001f1f0f07030300ULL, 0x00ff1f1f1f0f0700ULL },{ 0x001f1f1f0f070700ULL, 0x00ff3f3f3f1f0f00ULL },
     { 0x00fefcfcf8f0e000ULL, 0x00fefcfefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x008f070703000000ULL, 0x00cf870f0f0f0f00ULL },{ 0x000f0f0f07030100ULL, 0x009f0f1f1f1f1f00ULL },{ 0x001f1f1f0f070300ULL, 0x001f1f1f1f1f1f00ULL },{ 0x001f1f1f1f0f0700ULL, 0x003f3f3f3f3f3f00ULL },
-    { 0x00f8000000000000ULL, 0x00fcfefefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x00870f0f0f0f0f00ULL, 0x00c78f0f0f0f0f00ULL },{ 0x000f0f0f0f0f0f00ULL, 0x008f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x001f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x003f3f3f3f3f3f00ULL },
+    { 0x00fefcfefefefe00ULL, 0x00fcfefefefefe00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x008f0f0f0f0f0f00ULL, 0x00c78f0f0f0f0f00ULL },{ 0x000f0f0f0f0f0f00ULL, 0x008f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x001f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x003f3f3f3f3f3f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
@@ -1081,8 +1081,8 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x009f070000000000ULL, 0x00ff8f0707030100ULL },{ 0x001f0f0703010100ULL, 0x00ff1f0f0f070300ULL },{ 0x001f1f0f07030300ULL, 0x00ff3f1f1f0f0700ULL },{ 0x003f3f1f0f070700ULL, 0x00ff3f3f3f1f0f00ULL },
     { 0x00fcfcfcf8f0e000ULL, 0x00fefcfefefefe00ULL },{ 0x00fcf8f8f0e0c000ULL, 0x00fcf8fcfcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f0f0f07030100ULL, 0x009f0f1f1f1f1f00ULL },{ 0x001f1f1f0f070300ULL, 0x003f1f3f3f3f3f00ULL },{ 0x003f3f3f1f0f0700ULL, 0x003f3f3f3f3f3f00ULL },
-    { 0x00fcfcfcfcfcfc00ULL, 0x00fcfcfefefefe00ULL },{ 0x00f8fcfcfcfcfc00ULL, 0x00f8fcfcfcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x000f1f1f1f1f1f00ULL, 0x008f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x001f3f3f3f3f3f00ULL },{ 0x003f3f3f3f3f3f00ULL, 0x003f3f3f3f3f3f00ULL },
+    { 0x00fcfcfcfcfcfc00ULL, 0x00fcfcfefefefe00ULL },{ 0x00fcfcfcfcfcfc00ULL, 0x00f8fcfcfcfcfc00ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f1f1f1f1f1f00ULL, 0x008f1f1f1f1f1f00ULL },{ 0x001f1f1f1f1f1f00ULL, 0x001f3f3f3f3f3f00ULL },{ 0x003f3f3f3f3f3f00ULL, 0x003f3f3f3f3f3f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
@@ -1099,8 +1099,8 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00ff010000000000ULL, 0x00ffef0100000000ULL },{ 0x003f0f0100000000ULL, 0x00ff1f0f0f070300ULL },{ 0x003f1f0f07030300ULL, 0x00ff3f1f1f0f0700ULL },{ 0x003f3f1f0f070700ULL, 0x00ff7f3f3f1f0f00ULL },
     { 0x00fcfcfcf8f0e000ULL, 0x00fcfcfcfcfcfc00ULL },{ 0x00f8f8f8f0e0c000ULL, 0x00fcf8fcfcfcfc00ULL },{ 0x00f8f0f0e0c08000ULL, 0x00f9f0f8f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x003f1f1f0f070300ULL, 0x003f1f3f3f3f3f00ULL },{ 0x003f3f3f1f0f0700ULL, 0x007f3f7f7f7f7f00ULL },
-    { 0x00fcfcfcfcfcfc00ULL, 0x00fcfcfcfcfcfc00ULL },{ 0x00f8f8f8f8f8f800ULL, 0x00f8fcfcfcfcfc00ULL },{ 0x00f0f8f8f8f8f800ULL, 0x00f1f8f8f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f3f3f3f3f3f00ULL, 0x001f3f3f3f3f3f00ULL },{ 0x003f3f3f3f3f3f00ULL, 0x003f3f7f7f7f7f00ULL },
+    { 0x00fcfcfcfcfcfc00ULL, 0x00fcfcfcfcfcfc00ULL },{ 0x00f8f8f8f8f8f800ULL, 0x00f8fcfcfcfcfc00ULL },{ 0x00f8f8f8f8f8f800ULL, 0x00f1f8f8f8f8f800ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x003f3f3f3f3f3f00ULL, 0x001f3f3f3f3f3f00ULL },{ 0x003f3f3f3f3f3f00ULL, 0x003f3f7f7f7f7f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
@@ -1117,8 +1117,8 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00f3c10000000000ULL, 0x00ffe3c1c0000000ULL },{ 0x00ff030100000000ULL, 0x00ffdf0301000000ULL },{ 0x007f1f0301000000ULL, 0x00ff3f1f1f0f0700ULL },{ 0x007f3f1f0f070700ULL, 0x00ff7f3f3f1f0f00ULL },
     { 0x00f8f8f8f8f0e000ULL, 0x00fcfcfcfcfcfc00ULL },{ 0x00f8f8f8f0e0c000ULL, 0x00f8f8f8f8f8f800ULL },{ 0x00f0f0f0e0c08000ULL, 0x00f9f0f8f8f8f800ULL },{ 0x00f1e0e0c0000000ULL, 0x00f3e1f0f0f0f000ULL },
     { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x007f3f3f1f0f0700ULL, 0x007f3f7f7f7f7f00ULL },
-    { 0x00f8f8f8f8f8f800ULL, 0x00fcfcfcfcfcfc00ULL },{ 0x00f8f8f8f8f8f800ULL, 0x00f8f8f8f8f8f800ULL },{ 0x00f0f0f0f0f0f000ULL, 0x00f1f8f8f8f8f800ULL },{ 0x00e1f0f0f0f0f000ULL, 0x00e3f1f0f0f0f000ULL },
-    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x001f000000000000ULL, 0x003f7f7f7f7f7f00ULL },
+    { 0x00f8f8f8f8f8f800ULL, 0x00fcfcfcfcfcfc00ULL },{ 0x00f8f8f8f8f8f800ULL, 0x00f8f8f8f8f8f800ULL },{ 0x00f0f0f0f0f0f000ULL, 0x00f1f8f8f8f8f800ULL },{ 0x00f1f0f0f0f0f000ULL, 0x00e3f1f0f0f0f000ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x007f3f7f7f7f7f00ULL, 0x003f7f7f7f7f7f00ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
@@ -1136,7 +1136,7 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00f8f8f8f8f0e000ULL, 0x00fcf8f8f8f8f800ULL },{ 0x00f0f0f0f0e0c000ULL, 0x00f8f8f8f8f8f800ULL },{ 0x00f0f0f0e0c08000ULL, 0x00f1f0f0f0f0f000ULL },{ 0x00e1e0e0c0000000ULL, 0x00f3e1f0f0f0f000ULL },
     { 0x00e3c1c000000000ULL, 0x00e7c3e1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8f8f8f8f8f800ULL, 0x00fcf8f8f8f8f800ULL },{ 0x00f0f0f0f0f0f000ULL, 0x00f8f8f8f8f8f800ULL },{ 0x00f0f0f0f0f0f000ULL, 0x00f1f0f0f0f0f000ULL },{ 0x00e1e0e0e0e0e000ULL, 0x00e3f1f0f0f0f000ULL },
-    { 0x00c3e1e0e0e0e000ULL, 0x00c7e3e1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x00e3e1e0e0e0e000ULL, 0x00c7e3e1e0e0e000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
   },
   {
     { 0x00fffffffffffc00ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff800ULL, 0x00ffffffffffff00ULL },{ 0x00fffffffffff100ULL, 0x00ffffffffffff00ULL },{ 0x00ffffffffffe300ULL, 0x00ffffffffffff00ULL },
@@ -1150,11 +1150,11 @@ std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {
     { 0x00fff0f0f0e0e000ULL, 0x00fffff8f8f0f000ULL },{ 0x00fff0f0e0c0c000ULL, 0x00fffff0f0e0e000ULL },{ 0x00ffe0e0c0808000ULL, 0x00fffff0e0c0c000ULL },{ 0x00ffe0c080000000ULL, 0x00ffffe0c0808000ULL },
     { 0x00ffc10000000000ULL, 0x00ffffc180000000ULL },{ 0x00ff030100000000ULL, 0x00ffff8301000000ULL },{ 0x00ff070301000000ULL, 0x00ffff0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ffff3f07030300ULL },
     { 0x00f8f0f0f0e0e000ULL, 0x00fff8f8f8f8f000ULL },{ 0x00f0f0f0e0c0c000ULL, 0x00fff0f0f0f0e000ULL },{ 0x00e0e0e0c0808000ULL, 0x00fff0f0f0e0c000ULL },{ 0x00e1e0c080000000ULL, 0x00ffe1e0e0c08000ULL },
-    { 0x0043410000000000ULL, 0x00ffe3c1c0000000ULL },{ 0x0047030100000000ULL, 0x007fc70301000000ULL },{ 0x004f070301000000ULL, 0x007f0f0703010100ULL },{ 0x00ff0f0703010100ULL, 0x007f7f0f07030300ULL },
+    { 0x0043410000000000ULL, 0x00ffe3c1c0000000ULL },{ 0x0047030100000000ULL, 0x00ffc70301000000ULL },{ 0x004f070301000000ULL, 0x00ff0f0703010100ULL },{ 0x00ff0f0703010100ULL, 0x00ff7f0f07030300ULL },
     { 0x00f8f0f0f0f0e000ULL, 0x00fcf8f8f8f8f800ULL },{ 0x00f0f0f0f0e0c000ULL, 0x00f8f0f0f0f0f000ULL },{ 0x00e0e0e0e0c08000ULL, 0x00f1f0f0f0f0f000ULL },{ 0x00e1e0e0c0000000ULL, 0x00e3e1e0e0e0e000ULL },
-    { 0x0043414000000000ULL, 0x00e7c3e1e0c0e000ULL },{ 0x0047030100000000ULL, 0x004f074341004000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0043414000000000ULL, 0x00e7c3e1e0e0e000ULL },{ 0x0047030100000000ULL, 0x004f074341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
     { 0x00f8f0f0f0f0f000ULL, 0x00fcf8f8f8f8f800ULL },{ 0x00f0f0f0f0f0f000ULL, 0x00f8f0f0f0f0f000ULL },{ 0x00e0e0e0e0e0e000ULL, 0x00f1f0f0f0f0f000ULL },{ 0x00e1e0e0e0e0e000ULL, 0x00e3e1e0e0e0e000ULL },
-    { 0x0043414040004000ULL, 0x00c7e3e1e0e0e000ULL },{ 0x0007434140404000ULL, 0x000f474341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { 0x0043414040404000ULL, 0x00c7e3e1e0e0e000ULL },{ 0x0047434140404000ULL, 0x000f474341404000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },{ 0x0000000000000000ULL, 0x0000000000000000ULL },
   },
 };
 
@@ -17,16 +17,10 @@
 namespace NShallow
 {
 
-static const NTime::duration minimalXtimeToGive_ = NTime::duration(0.5);
 static const NTime::duration minimalTimePerMove_ = NTime::duration(0.1);
 
 void Processor::setCallback(NEngine::xCallback& xcbk)
 {
-  xcbk.giveTime_ = [this]()
-  {
-    return this->giveMoreTime();
-  };
-
   engine_.setCallbacks(xcbk);
 }
 
@@ -65,6 +59,15 @@ bool Processor::setScoreLimit(ScoreType score)
   return true;
 }
 
+bool Processor::setNodesLimit(int nodes)
+{
+  if(is_thinking())
+    return false;
+
+  engine_.setNodesLimit(nodes);
+  return true;
+}
+
 bool Processor::setTimePerMove(NTime::duration const& tm)
 {
   if(is_thinking())
@@ -86,13 +89,32 @@ bool Processor::setXtime(NTime::duration const& xtm)
     return false;
 
   maxDepth_ = -1;
-  xtime_ = std::max(xtm, minimalTimePerMove_);
+  // time manager keeps reserve for overhead itself
+  xtime_ = xtm;
   timePerMove_ = NTime::duration(0);
   engine_.setMaxDepth(DepthMaximum);
   engine_.setScoreLimit(NEngine::Figure::MatScore);
   return true;
 }
 
+bool Processor::setIncrement(NTime::duration const& inc)
+{
+  if(is_thinking())
+    return false;
+
+  inc_ = inc;
+  return true;
+}
+
+bool Processor::setMoveOverhead(NTime::duration const& overhead)
+{
+  if(is_thinking())
+    return false;
+
+  engine_.setMoveOverhead(overhead);
+  return true;
+}
+
 bool Processor::setMovesLeft(int mleft)
 {
   if(is_thinking())
@@ -122,44 +144,89 @@ bool Processor::setMovesToGo(int mtogo)
 }
 
 
-NTime::duration Processor::giveMoreTime()
+void Processor::enableBook(int depth)
 {
-  if(timePerMove_ > NTime::duration(0) || xtime_ <= minimalXtimeToGive_ || givetimeCounter_ > 2)
-    return NTime::duration(0);
+  if(is_thinking())
+    return;
 
-  NTime::duration add_t(0);
-  int mcount = 40;
+  bookDepth_ = std::max(depth, 0);
+}
 
-  if(movesLeft_ > 0)
+bool Processor::setOption(std::string const& name, std::string const& value)
+{
+  if(is_thinking())
+    return false;
+
+  int const ivalue = std::atoi(value.c_str());
+  if(name == "Hash")
   {
-    int mcount = engine_.getBoard().movesCount();
-    mcount = movesLeft_ - (mcount-1) % movesLeft_;
+    if(ivalue < 1)
+      return false;
+    setHashSize(ivalue);
   }
-  else if(movesToGo_ > 0)
+  else if(name == "Threads")
   {
-    mcount = movesToGo_;
+    if(ivalue < 1)
+      return false;
+    setThreadsNumber(ivalue);
   }
-
-  givetimeCounter_++;
-
-  if(mcount < 2)
-    return NTime::duration(0);
-
-  add_t = xtime_ / mcount;
-  if(mcount > 20)
-    return add_t;
-  else if(mcount > 13)
-    add_t /= 2;
-  else if(mcount > 7)
-    add_t /= 3;
+  else if(name == "MoveOverhead")
+  {
+    if(ivalue < 0)
+      return false;
+    setMoveOverhead(NTime::from_milliseconds(ivalue));
+  }
+  else if(name == "MultiPV")
+  {
+    if(ivalue < 1)
+      return false;
+    setMultiPV(ivalue);
+  }
+  else if(name == "EvalFile")
+    return value.empty() || loadEvalCoefficients(value);
+  // empty file name unloads previous one
+  else if(name == "BitbaseFile")
+    return loadBitbases(value);
+  else if(name == "BookFile")
+    return loadBook(value);
+  else if(name == "BookDepth")
+  {
+    if(ivalue < 0)
+      return false;
+    enableBook(ivalue);
+  }
+  // transposition table snapshot. it replaces table of Hash size
+  else if(name == "HashFile")
+    return loadHashTable(value);
+  else if(name == "SaveHashFile")
+    return value.empty() || saveHashTable(value);
+  // ponder is enabled by "go ponder"
+  else if(name == "Ponder")
+    return true;
   else
-    add_t /= 6;
+    return setEvalCoefficient(name, ivalue);
+  return true;
+}
 
-  return add_t;
+bool Processor::loadBook(std::string const& fname)
+{
+  if(is_thinking())
+    return false;
+
+  if(fname.empty())
+  {
+    book_.clear();
+    return true;
+  }
+  return book_.load(fname);
 }
 
-void Processor::enableBook(int)
+NEngine::Move Processor::bookMove()
 {
+  auto const& board = engine_.getBoard();
+  if(book_.empty() || board.movesCount() > bookDepth_)
+    return NEngine::Move{true};
+  return book_.move(board);
 }
 
 bool Processor::undo()
@@ -196,6 +263,14 @@ void Processor::setThreadsNumber(int n)
   engine_.setThreadsNumber(n);
 }
 
+void Processor::setMultiPV(int n)
+{
+  if (is_thinking())
+    return;
+
+  engine_.setMultiPV(n);
+}
+
 NEngine::Figure::Color Processor::color() const
 {
   return engine_.getBoard().color();
@@ -236,10 +311,21 @@ bool Processor::analyze(int maxDepth)
 
 void Processor::stop()
 {
+  engine_.setPonder(false);
   engine_.pleaseStop(0);
 }
 
-ReplyStruct Processor::reply(bool winboardFormat)
+void Processor::ponderHit()
+{
+  engine_.ponderHit();
+}
+
+void Processor::needUpdate()
+{
+  engine_.needUpdate();
+}
+
+ReplyStruct Processor::reply(bool winboardFormat, bool ponder)
 {
   if(is_thinking())
     return ReplyStruct{};
@@ -255,9 +341,24 @@ ReplyStruct Processor::reply(bool winboardFormat)
   if(board.matState())
     return rep;
 
+  // book move is played instantly. there is nothing to ponder on
+  if(!ponder)
+  {
+    if(auto mv = bookMove())
+    {
+      board.makeMove(mv);
+      board.verifyState();
+      rep.state_ = board.state();
+      rep.best_ = mv;
+      rep.moveStr_ = moveToStr(mv, winboardFormat);
+      rep.book_ = true;
+      return rep;
+    }
+  }
+
   engine_.setAnalyzeMode(false);
+  engine_.setPonder(ponder);
   thinking_ = true;
-  givetimeCounter_ = 0;
   NEngine::SearchResult sres;
   if(engine_.search())
   {
@@ -266,10 +367,13 @@ ReplyStruct Processor::reply(bool winboardFormat)
     {
       board.makeMove(sres.best_);
       board.verifyState();
+      if(sres.pv_[0] == sres.best_ && sres.pv_[1] && board.validateMoveBruteforce(sres.pv_[1]))
+        rep.ponderStr_ = moveToStr(sres.pv_[1], winboardFormat);
     }
     else
       sres.best_ = NEngine::Move{true};
   }
+  engine_.setPonder(false);
   thinking_ = false;
 
   rep.state_ = board.state();
@@ -426,6 +530,107 @@ void Processor::file2hash(std::string const& fname)
   engine_.loadHash(fname);
 }
 
+bool Processor::saveHashTable(std::string const& fname)
+{
+  if(is_thinking())
+    return false;
+
+  return engine_.saveHashTable(fname);
+}
+
+bool Processor::loadHashTable(std::string const& fname)
+{
+  if(is_thinking())
+    return false;
+
+  if(fname.empty())
+  {
+    engine_.unloadHashTable();
+    return true;
+  }
+  return engine_.loadHashTable(fname);
+}
+
+bool Processor::loadEvalCoefficients(std::string const& fname)
+{
+  if(is_thinking())
+    return false;
+
+  return engine_.loadEvalCoefficients(fname);
+}
+
+bool Processor::loadBitbases(std::string const& fname)
+{
+  if(is_thinking())
+    return false;
+
+  if(fname.empty())
+  {
+    engine_.clearBitbases();
+    return true;
+  }
+  return engine_.loadBitbases(fname);
+}
+
+bool Processor::setEvalCoefficient(std::string const& name, int value)
+{
+  if(is_thinking())
+    return false;
+
+  return engine_.setEvalCoefficient(name, value);
+}
+
+bool Processor::evalTrace(NEngine::EvalTrace& trace)
+{
+  if(is_thinking())
+    return false;
+
+  engine_.evalTrace(trace);
+  return true;
+}
+
+NEngine::EvalProfile Processor::evalProfile() const
+{
+  return engine_.evalProfile();
+}
+
+void Processor::clearEvalProfile()
+{
+  if(is_thinking())
+    return;
+
+  engine_.clearEvalProfile();
+}
+
+bool Processor::setLazyEvalCalibration(bool on)
+{
+  if(is_thinking())
+    return false;
+
+  if(on)
+    engine_.clearLazyEvalStat();
+  engine_.setLazyEvalCalibration(on);
+  return true;
+}
+
+NEngine::LazyEvalStat Processor::lazyEvalStat() const
+{
+  return engine_.lazyEvalStat();
+}
+
+bool Processor::applyLazyEvalStat(double fraction)
+{
+  if(is_thinking())
+    return false;
+
+  return engine_.applyLazyEvalStat(fraction);
+}
+
+NEngine::SearchStat const& Processor::searchStat() const
+{
+  return engine_.searchStat();
+}
+
 //////////////////////////////////////////////////////////////////////////
 void Processor::clear()
 {
@@ -501,6 +706,13 @@ void Processor::editCmd(xCmd const& cmd)
   case xType::xLeaveEdit:
     engine_.getBoard().invalidate();
     break;
+
+  case xType::UCIponderhit:
+  case xType::xEval:
+  case xType::xEvalStat:
+  case xType::xLazyEval:
+  case xType::xSearchStat:
+    break;
   }
 }
 
@@ -575,23 +787,15 @@ void Processor::updateTiming()
     return;
   }
 
-  if(movesLeft_ <= 0 && movesToGo_ <= 0 && xtime_ > NTime::duration(0))
-  {
-    engine_.setTimeLimit(xtime_ / 40);
-    return;
-  }
-
-  int mcount = 2;
+  // 0 moves for sudden death
+  int mcount = 0;
 
   if(movesLeft_ > 0)
     mcount = movesLeft_ - (engine_.getBoard().movesCount()-1) % movesLeft_;
   else if(movesToGo_ > 0)
     mcount = movesToGo_;
 
-  if(mcount < 2)
-    mcount = 2;
-
-  engine_.setTimeLimit(xtime_ / mcount);
+  engine_.setTimeControl(xtime_, inc_, mcount);
 }
 
 } // NShallow
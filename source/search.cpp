@@ -11,10 +11,49 @@
 #include "History.h"
 #include "xalgorithm.h"
 #include "thread"
+#include "chrono"
+#include "cmath"
 
 namespace NEngine
 {
 
+namespace
+{
+
+#ifdef USE_LMR_TABLE
+// [depth in plies][moves counter] -> reduction in ONE_PLY units
+struct LmrTable
+{
+  LmrTable()
+  {
+    for (int d = 0; d < LMR_TableSize; ++d)
+    {
+      for (int m = 0; m < LMR_TableSize; ++m)
+        r_[d][m] = (d && m) ? static_cast<int>(ONE_PLY * std::log(d) * std::log(m) * 100 / LMR_DivisorPercent) : 0;
+    }
+  }
+
+  inline int operator () (int depth, int counter) const
+  {
+    return r_[std::min(depth >> 4, LMR_TableSize - 1)][std::min(counter, LMR_TableSize - 1)];
+  }
+
+  int r_[LMR_TableSize][LMR_TableSize];
+};
+
+const LmrTable lmrTable_;
+#endif // USE_LMR_TABLE
+
+#ifdef USE_LMP
+inline int lmpMovesLimit(int depth, bool improving)
+{
+  int d = depth >> 4;
+  return (LMP_MovesBase + d * d) >> (improving ? 0 : 1);
+}
+#endif // USE_LMP
+
+} // namespace {}
+
 //////////////////////////////////////////////////////////////////////////
 bool Engine::generateStartposMoves(int ictx)
 {
@@ -61,7 +100,7 @@ bool Engine::generateStartposMoves(int ictx)
       board.makeMove(move);
       move.sort_value = 0;
       if (!board.underCheck()) {
-        move.sort_value = sctx.eval_(-ScoreMax, +ScoreMax);
+        move.sort_value = evaluate(sctx, -ScoreMax, +ScoreMax);
       }
       if (!move.see_ok())
         move.sort_value -= 10000;
@@ -102,6 +141,8 @@ bool Engine::search()
   if (!generateStartposMoves(0))
     return false;
 
+  tman_.start();
+
   for (size_t ictx = 1; ictx < scontexts_.size(); ++ictx)
   {
     scontexts_[ictx] = scontexts_[0];
@@ -118,6 +159,10 @@ bool Engine::search()
     threads.emplace_back(std::move(thread));
   }
 
+  // input and time limit are checked in separate thread. search only tests stop flag
+  searching_ = true;
+  std::thread watcher{ [this]() { this->inputAndTimerLoop(); } };
+
   // search in main thread
   auto bres = mainThreadSearch(0);
 
@@ -126,6 +171,19 @@ bool Engine::search()
     thread->join();
   }
 
+  // best move can't be sent while pondering. wait for ponderhit or stop
+  while (sparams_.ponder_)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(InputPollPeriod_ms));
+  }
+
+  searching_ = false;
+  watcher.join();
+
+  stat_.clear();
+  for (auto const& sctx : scontexts_)
+    stat_ += sctx.stat_;
+
   return bres;
 }
 
@@ -144,10 +202,7 @@ bool Engine::mainThreadSearch(int ictx)
 
   for(sdata.depth_ = depth0_; !sctx.stop_ && sdata.depth_ <= sparams_.depthMax_; ++sdata.depth_)
   {
-    sctx.plystack_[0].clearPV(sparams_.depthMax_);
-    sdata.restart();
-    
-    ScoreType score = alphaBetta0(ictx);
+    ScoreType score = aspirationSearch(ictx, sres.score_, sres.best_);
     auto t = NTime::now();
 
     if(sdata.best_)
@@ -175,6 +230,9 @@ bool Engine::mainThreadSearch(int ictx)
             break;
         }
 
+        sres.linesNum_ = sctx.linesNum_;
+        std::copy(sctx.lines_.begin(), sctx.lines_.begin() + sctx.linesNum_, sres.lines_.begin());
+
         X_ASSERT(sres.pv_[0] != sdata.best_, "invalid PV found");
 
         if (ictx == 0 && callbacks_.sendOutput_)
@@ -184,7 +242,9 @@ bool Engine::mainThreadSearch(int ictx)
           (callbacks_.sendOutput_)(sres);
         }
 
-        if (!sparams_.analyze_mode_ && sparams_.timeAdded_) {
+        // there is no time for the next iteration
+        double bestNodesShare = sdata.nodesCount_ > 0 ? (double)sdata.bestNodes_ / sdata.nodesCount_ : 0.0;
+        if (tman_.iteration(sres.best_, score, bestNodesShare) && !sparams_.analyze_mode_ && !sparams_.ponder_) {
           pleaseStop(ictx);
           break;
         }
@@ -278,13 +338,11 @@ bool Engine::threadSearch(const int ictx, const int depth0)
   // copy to print stats later
   sdata.board_ = board;
 
+  ScoreType scorePrev = -ScoreMax;
   for (sdata.depth_ = depth0; !sctx.stop_ && sdata.depth_ <= sparams_.depthMax_;)
   {
-    sctx.plystack_[0].clearPV(sparams_.depthMax_);
-
-    sdata.restart();
-
-    ScoreType score = alphaBetta0(ictx);
+    ScoreType score = aspirationSearch(ictx, scorePrev, sdata.depth_ > depth0);
+    scorePrev = score;
 
     if (sdata.best_)
     {
@@ -311,6 +369,9 @@ bool Engine::threadSearch(const int ictx, const int depth0)
           if (!sres.pv_[i])
             break;
         }
+
+        sres.linesNum_ = sctx.linesNum_;
+        std::copy(sctx.lines_.begin(), sctx.lines_.begin() + sctx.linesNum_, sres.lines_.begin());
       }
 
       X_ASSERT(sres.pv_[0] != sdata.best_, "invalid PV found");
@@ -337,13 +398,99 @@ bool Engine::threadSearch(const int ictx, const int depth0)
 }
 
 //////////////////////////////////////////////////////////////////////////
-ScoreType Engine::alphaBetta0(int ictx)
+ScoreType Engine::aspirationSearch(int ictx, ScoreType scorePrev, bool window)
+{
+  X_ASSERT((size_t)ictx >= scontexts_.size(), "Invalid context index");
+  auto& sctx = scontexts_[ictx];
+  auto& sdata = sctx.sdata_;
+
+  ScoreType alpha = -ScoreMax;
+  ScoreType betta = +ScoreMax;
+  int delta = AspirationWindow_Delta;
+
+#ifdef USE_ASPIRATION_WINDOWS
+  // don't narrow window for mate scores, single move and multi PV
+  if (window
+    && sparams_.multiPV_ == 1
+    && sdata.depth_ >= AspirationWindow_DepthMin
+    && sdata.numOfMoves_ > 1
+    && std::abs(scorePrev) < Figure::MatScore - MaxPly)
+  {
+    alpha = std::max(scorePrev - delta, -ScoreMax);
+    betta = std::min(scorePrev + delta, +ScoreMax);
+  }
+#endif
+
+  for (;;)
+  {
+    sctx.plystack_[0].clearPV(sparams_.depthMax_);
+    sdata.restart();
+
+    ScoreType score = alphaBetta0(ictx, alpha, betta);
+    if (sctx.stop_)
+      return score;
+
+    // widen window on failing side. open it completely if too wide
+    delta += delta / 2;
+    if (score <= alpha && alpha > -ScoreMax)
+    {
+      sendFailBound(ictx, score, SearchResult::Upper);
+      alpha = delta > AspirationWindow_DeltaMax ? -ScoreMax : std::max(score - delta, -ScoreMax);
+    }
+    else if (score >= betta && betta < ScoreMax)
+    {
+      sendFailBound(ictx, score, SearchResult::Lower);
+      betta = delta > AspirationWindow_DeltaMax ? +ScoreMax : std::min(score + delta, +ScoreMax);
+    }
+    else
+    {
+      return score;
+    }
+  }
+}
+
+// report root fail-high/fail-low to GUI. keep previous PV on fail-low
+void Engine::sendFailBound(int ictx, ScoreType score, SearchResult::Bound bound)
+{
+  if (ictx != 0 || !callbacks_.sendOutput_)
+    return;
+
+  auto& sctx = scontexts_[ictx];
+  auto& sdata = sctx.sdata_;
+  if (!sctx.sres_.best_ && !sdata.best_)
+    return;
+
+  SearchResult sres;
+  sres = sctx.sres_;
+  sres.score_ = score;
+  sres.bound_ = bound;
+  sres.depth_ = sdata.depth_;
+  sres.dt_ = NTime::now() - sdata.tstart_;
+  sres.totalNodes_ = sdata.totalNodes_;
+  for (size_t j = 1; j < scontexts_.size(); ++j)
+    sres.totalNodes_ += scontexts_[j].sdata_.totalNodes_;
+
+  if (bound == SearchResult::Lower && sdata.best_)
+  {
+    sres.best_ = sdata.best_;
+    for (int i = 0; i < MaxPly; ++i)
+    {
+      sres.pv_[i] = sctx.plystack_[0].pv_[i];
+      if (!sres.pv_[i])
+        break;
+    }
+  }
+
+  (callbacks_.sendOutput_)(sres);
+}
+
+ScoreType Engine::alphaBetta0(int ictx, ScoreType alpha, ScoreType betta)
 {
   X_ASSERT((size_t)ictx >= scontexts_.size(), "Invalid context index");
   auto& sctx = scontexts_[ictx];
 
   if(sctx.stop_)
-    return sctx.eval_(-ScoreMax, +ScoreMax);
+    return evaluate(sctx, -ScoreMax, +ScoreMax);
 
   auto& sdata = sctx.sdata_;
   X_ASSERT(sdata.numOfMoves_ == 0, "no moves");
@@ -352,34 +499,58 @@ ScoreType Engine::alphaBetta0(int ictx)
   if(sdata.numOfMoves_ == 0)
   {
     board.setNoMoves();
-    ScoreType score = sctx.eval_(-ScoreMax, +ScoreMax);
+    ScoreType score = evaluate(sctx, -ScoreMax, +ScoreMax);
     return score;
   }
 
-  ScoreType alpha = -ScoreMax;
-  ScoreType betta = +ScoreMax;
-
 #ifndef NDEBUG
   Board board0{ board };
 #endif
 
+  int const linesMax = std::min(sparams_.multiPV_, sdata.numOfMoves_);
+  sctx.linesNum_ = 0;
+
   for(sdata.counter_ = 0; sdata.counter_ < sdata.numOfMoves_; ++sdata.counter_)
   {
     if(checkForStop(ictx))
       break;
 
     auto& move = sctx.moves_[sdata.counter_];
-    ScoreType score = processMove0(ictx, move, alpha, betta, !sdata.counter_);
+
+    // multi PV. first lines are searched with full window, others should be better than the worst line
+    bool pv = !sdata.counter_;
+    ScoreType alphaMove = alpha;
+    if(linesMax > 1)
+    {
+      pv = sctx.linesNum_ < linesMax;
+      if(!pv)
+        alphaMove = std::max(alpha, sctx.lines_[linesMax-1].score_);
+    }
+
+    int nodes0 = sdata.nodesCount_;
+    ScoreType score = processMove0(ictx, move, alphaMove, betta, pv);
     X_ASSERT(board != board0, "board undo error");
 
     if(sctx.stop_)
       break;
 
-    auto& hist = history(board.color(), move.from(), move.to());
-    if(score > alpha)
+    auto& hist = history_->history(board.color(), move.from(), move.to());
+    if(linesMax > 1)
+    {
+      if(score > alphaMove)
+        addLine(ictx, move, score, linesMax);
+      if(sctx.lines_[0].pv_[0] == move)
+      {
+        sdata.best_ = move;
+        sdata.scoreBest_ = score;
+        sdata.bestNodes_ = sdata.nodesCount_ - nodes0;
+      }
+    }
+    else if(score > alpha)
     {
       sdata.best_ = move;
       sdata.scoreBest_ = score;
+      sdata.bestNodes_ = sdata.nodesCount_ - nodes0;
       alpha = score;
       assemblePV(ictx, sdata.best_, board.underCheck(), 0);
     }
@@ -388,7 +559,12 @@ ScoreType Engine::alphaBetta0(int ictx)
     move.sort_value = score;
 #endif
 
-    if (ictx == 0 && callbacks_.sendStats_ && sparams_.analyze_mode_)
+    // aspiration window fail-high. will be re-searched with wider window
+    if (alpha >= betta)
+      break;
+
+    // stats are sent on each root move in analyze mode or by request
+    if (ictx == 0 && callbacks_.sendStats_ && (updateRequested_.exchange(false) || sparams_.analyze_mode_))
     {
       SearchData sdataTotal = sdata;
       for (size_t j = 1; j < scontexts_.size(); ++j)
@@ -397,6 +573,18 @@ ScoreType Engine::alphaBetta0(int ictx)
     }
   } // end of for loop
 
+  // PV of the best line
+  if(linesMax > 1 && sctx.linesNum_ > 0)
+  {
+    alpha = sctx.lines_[0].score_;
+    for(int i = 0; i < MaxPly; ++i)
+    {
+      sctx.plystack_[0].pv_[i] = sctx.lines_[0].pv_[i];
+      if(!sctx.plystack_[0].pv_[i])
+        break;
+    }
+  }
+
   // don't need to continue
   if(!sctx.stop_ && sdata.numOfMoves_ == 1 && !sparams_.analyze_mode_)
     pleaseStop(ictx);
@@ -406,7 +594,7 @@ ScoreType Engine::alphaBetta0(int ictx)
 
   if(sdata.best_)
   {
-    auto& hist = history(board.color(), sdata.best_.from(), sdata.best_.to());
+    auto& hist = history_->history(board.color(), sdata.best_.from(), sdata.best_.to());
     hist.inc_score(sdata.depth_);
     sortMoves0(ictx);
 
@@ -435,17 +623,30 @@ void Engine::sortMoves0(int ictx)
   auto& board = sctx.board_;
 
 #ifdef SORT_MOVES_0_HIST
-  if (sdata.numOfMoves_ > 2)
+  if (sdata.numOfMoves_ > 1)
   {
-    bring_to_front(moves.data(), moves.data() + sdata.numOfMoves_, sdata.best_);
     auto* b = moves.data();
     auto* e = b + sdata.numOfMoves_;
-    b++;
+    // keep multi PV lines in front in order of their scores
+    if (sctx.linesNum_ > 1 && sctx.lines_[0].pv_[0] == sdata.best_)
+    {
+      for (int i = 0; i < sctx.linesNum_; ++i, ++b)
+      {
+        SMove move{ true };
+        move = sctx.lines_[i].pv_[0];
+        bring_to_front(b, e, move);
+      }
+    }
+    else
+    {
+      bring_to_front(b, e, sdata.best_);
+      b++;
+    }
     for (auto* m = b; m != e; ++m)
     {
       if (m->new_type() || board.is_capture(*m))
         continue;
-      auto& hist = history(board.color(), m->from(), m->to());
+      auto& hist = history_->history(board.color(), m->from(), m->to());
       m->sort_value = hist.score();
     }
     std::stable_sort(b, e, [](SMove const m1, SMove const m2) { return m1 > m2; });
@@ -455,6 +656,30 @@ void Engine::sortMoves0(int ictx)
 #endif
 }
 
+void Engine::addLine(int ictx, Move const move, ScoreType score, int linesMax)
+{
+  X_ASSERT((size_t)ictx >= scontexts_.size(), "Invalid context index");
+  auto& sctx = scontexts_[ictx];
+
+  assemblePV(ictx, move, sctx.board_.underCheck(), 0);
+
+  int i = std::min(sctx.linesNum_, linesMax - 1);
+  for (; i > 0 && sctx.lines_[i - 1].score_ < score; --i)
+    sctx.lines_[i] = sctx.lines_[i - 1];
+
+  auto& line = sctx.lines_[i];
+  line.score_ = score;
+  for (int j = 0; j < MaxPly; ++j)
+  {
+    line.pv_[j] = sctx.plystack_[0].pv_[j];
+    if (!line.pv_[j])
+      break;
+  }
+
+  if (sctx.linesNum_ < linesMax)
+    sctx.linesNum_++;
+}
+
 ScoreType Engine::processMove0(int ictx, SMove const move, ScoreType const alpha, ScoreType const betta, bool const pv)
 {
   X_ASSERT((size_t)ictx >= scontexts_.size(), "Invalid context index");
@@ -519,13 +744,14 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
   {
     sctx.plystack_[ply].clear(ply);
     sctx.plystack_[ply+1].clearKiller();
+    sctx.plystack_[ply].eval_ = -ScoreMax;
   }
 
   if(board.drawState() || board.hasReps())
     return Figure::DrawScore;
 
   if(sctx.stop_ || ply >= MaxPly)
-    return sctx.eval_(alpha, betta);
+    return evaluate(sctx, alpha, betta);
 
   ScoreType const alpha0 = alpha;
   SMove hmove{true};
@@ -556,6 +782,21 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
   bool nm_threat{false};
   auto const& prev = board.lastUndo();
 
+  // static eval is calculated once for LMP and futility pruning
+  ScoreType staticEval = -ScoreMax;
+
+#ifdef USE_LMP
+  // static eval is better than 2 plies ago. unknown is considered as improving. PV nodes aren't pruned
+  bool improving = true;
+  if(!pv && !board.underCheck() && depth <= LMP_DepthMax + 2 * ONE_PLY)
+  {
+    staticEval = evaluate(sctx, alpha, betta);
+    sctx.plystack_[ply].eval_ = staticEval;
+    if(ply >= 2 && sctx.plystack_[ply-2].eval_ != -ScoreMax)
+      improving = staticEval > sctx.plystack_[ply-2].eval_;
+  }
+#endif
+
 #ifdef USE_FUTILITY_PRUNING
   if (!pv
     && !board.underCheck()
@@ -566,15 +807,17 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
     && ply > 1
     && board.allowNullMove())
   {
-    ScoreType score0 = sctx.eval_(alpha, betta);
+    ScoreType score0 = staticEval != -ScoreMax ? staticEval : evaluate(sctx, alpha, betta);
     int d = depth >> 4;
 #ifdef FUTILITY_PRUNING_BETTA
     if ((int)score0 > (int)betta + Betta_ThresholdFP * d) {
+      SEARCH_STAT_INC(sctx.stat_, futilityPruned_);
       return score0;
     }
     else
 #endif // FUTILITY_PRUNING_BETTA
     if (d <= FutilityPruningPly && (int)score0 < (int)alpha - Position_GainFP * d) {
+      SEARCH_STAT_INC(sctx.stat_, futilityPruned_);
       return captures(ictx, depth, ply, alpha, betta, pv, score0);
     }
   }
@@ -591,6 +834,7 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
     )
   {
     int null_depth = board.nullMoveDepth(depth, betta);
+    SEARCH_STAT_INC(sctx.stat_, nullMoveTries_);
     // do null-move
     board.makeNullMove();
 #ifdef PROCESS_MOVES_SEQ
@@ -606,6 +850,7 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
     // verify null-move with shortened depth
     if (nullScore >= betta)
     {
+      SEARCH_STAT_INC(sctx.stat_, nullMoveCuts_);
       depth = null_depth;
       if (depth <= 0)
         return captures(ictx, depth, ply, alpha, betta, pv);
@@ -625,6 +870,47 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
   }
 #endif // null-move
 
+#ifdef USE_PROBCUT
+  // good capture holds raised betta with reduced depth. verified by quiescence search first
+  if(
+    !pv
+    && !board.underCheck()
+    && depth >= Probcut_Depth
+    && std::abs(betta) < Figure::MatScore - MaxPly - Probcut_Margin
+    )
+  {
+    SEARCH_STAT_INC(sctx.stat_, probcutTries_);
+    ScoreType pcBetta = betta + Probcut_Margin;
+    CapsGenerator<Board, SMove> cg(board, *history_);
+    cg.generateCaps();
+    while(auto* pmove = cg.next())
+    {
+      auto& move = *pmove;
+      if(!board.see(move, 0))
+        continue;
+
+      board.makeMove(move);
+      sdata.inc_nc();
+      ScoreType score = -captures(ictx, 0, ply + 1, -pcBetta, -(pcBetta - 1), false);
+      bool qcut = score >= pcBetta;
+      if(qcut && !sctx.stop_)
+        score = -alphaBetta(ictx, depth - Probcut_PlyReduce, ply + 1, -pcBetta, -(pcBetta - 1), false, true, signular_count);
+      board.unmakeMove(move);
+
+      if(sctx.stop_)
+        break;
+
+      if(score >= pcBetta)
+      {
+        SEARCH_STAT_INC(sctx.stat_, probcutCuts_);
+        return score;
+      }
+      if(qcut)
+        SEARCH_STAT_INC(sctx.stat_, probcutFails_);
+    }
+  }
+#endif // probcut
+
 #ifdef SINGULAR_EXT
   int  aboveAlphaN = 0;
   int  depthIncBest = 0;
@@ -634,6 +920,7 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
 #if((defined USE_IID) && (defined USE_HASH))
   if(!hmove && depth >= (ONE_PLY<<2))
   {
+    SEARCH_STAT_INC(sctx.stat_, iidSearches_);
     alphaBetta(ictx, depth - 3*ONE_PLY, ply, alpha, betta, pv, allow_nm, signular_count);
     auto hitem = hash_.get(board.fmgr().hashCode());
     hitem.decode();
@@ -644,6 +931,42 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
   }
 #endif
 
+#ifdef USE_MULTICUT
+  // several of first moves fail high with reduced depth
+  if(
+    !pv
+    && !board.underCheck()
+    && allow_nm
+    && depth >= Multicut_Depth
+    && std::abs(betta) < Figure::MatScore - MaxPly
+    )
+  {
+    SEARCH_STAT_INC(sctx.stat_, multicutTries_);
+    FastGenerator<Board, SMove> mg(board, *history_, hmove, sctx.plystack_[ply].killer_, sctx.plystack_[ply].killer2_);
+    int cuts = 0;
+    for(int i = 0; i < Multicut_Moves && cuts < Multicut_Cuts; ++i)
+    {
+      auto* pmove = mg.next();
+      if(!pmove)
+        break;
+      auto& move = *pmove;
+      board.makeMove(move);
+      sdata.inc_nc();
+      ScoreType score = -alphaBetta(ictx, depth - Multicut_PlyReduce, ply + 1, -betta, -(betta - 1), false, true, signular_count);
+      board.unmakeMove(move);
+      if(sctx.stop_)
+        break;
+      if(score >= betta)
+        cuts++;
+    }
+    if(cuts >= Multicut_Cuts)
+    {
+      SEARCH_STAT_INC(sctx.stat_, multicutCuts_);
+      return betta;
+    }
+  }
+#endif // multicut
+
 
   ScoreType scoreBest = -ScoreMax;
   Move best{ true };
@@ -660,9 +983,19 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
 
   bool check_escape = board.underCheck();
   auto killer = sctx.plystack_[ply].killer_;
-  FastGenerator<Board, SMove> fg(board, hmove, killer);
+  auto killer2 = sctx.plystack_[ply].killer2_;
+  SMove cmove{ true };
+  cmove = history_->counterMove(board);
+  auto* cont1 = history_->continuationHistory(board, 0);
+  auto* cont2 = history_->continuationHistory(board, 1);
+  FastGenerator<Board, SMove> fg(board, *history_, hmove, killer, killer2, cmove);
   int ngood = 0;
   Move movep{false};
+#ifdef USE_LMP
+  int lmpLimit = 0;
+  if(!pv && !check_escape && depth <= LMP_DepthMax)
+    lmpLimit = lmpMovesLimit(depth, improving);
+#endif
   for (; alpha < betta && !checkForStop(ictx);)
   {
     auto* pmove = fg.next();
@@ -693,9 +1026,25 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
 
     ScoreType score = -ScoreMax;
     board.makeMove(move);
+    auto& curr = board.lastUndo();
+
+#ifdef USE_LMP
+    if(lmpLimit > 0 &&
+       counter >= lmpLimit &&
+       scoreBest > -Figure::MatScore + MaxPly &&
+       !danger_pawn &&
+       !move.new_type() &&
+       move != killer && move != killer2 &&
+       !curr.capture() && !board.underCheck())
+    {
+      board.unmakeMove(move);
+      SEARCH_STAT_INC(sctx.stat_, lmpPruned_);
+      continue;
+    }
+#endif
+
     sdata.inc_nc();
     int depthInc = 0;
-    auto& curr = board.lastUndo();
     bool check_or_cap = curr.capture() || board.underCheck();
 
 #ifdef PROCESS_MOVES_SEQ
@@ -726,8 +1075,33 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
           ((move != killer && !danger_pawn && board.canBeReduced(move)) || !move.see_ok())
         )
       {
+#ifdef USE_LMR_TABLE
+        R = lmrTable_(depth, counter);
+#else
         R = ONE_PLY * (1 + (counter >> 4));
+#endif
+
+#ifdef USE_LMR_HISTORY
+        if(!curr.capture() && !move.new_type())
+        {
+          auto type = board.getField(move.to()).type();
+          int hscore = history_->history(Figure::otherColor(board.color()), move.from(), move.to()).score();
+          if(cont1)
+            hscore += (*cont1)[type][move.to()].score();
+          if(cont2)
+            hscore += (*cont2)[type][move.to()].score();
+          if(hscore > 0)
+            R -= LMR_HistoryStep;
+          else if(hscore < 0)
+            R += LMR_HistoryStep;
+        }
+#endif
+
+#ifdef USE_LMR_TABLE
+        R = std::max(R, LMR_ReductionMin);
+#endif
         curr.mflags_ |= UndoInfo::Reduced;
+        SEARCH_STAT_INC(sctx.stat_, lmrReduced_);
       }
 #endif
 
@@ -735,7 +1109,10 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
       curr.mflags_ &= ~UndoInfo::Reduced;
 
       if (!sctx.stop_ && score > alpha && R > 0)
+      {
+        SEARCH_STAT_INC(sctx.stat_, lmrResearched_);
         score = -alphaBetta(ictx, depth + depthInc - ONE_PLY, ply + 1, -alpha - 1, -alpha, false, allow_nm, singular + signular_count);
+      }
 
       if (!sctx.stop_ && score > alpha && score < betta && pv)
       {
@@ -772,18 +1149,32 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
         if(score > alpha)
         {
           bool capture = board.getField(move.to()) || move.new_type() || (move.to() > 0 && board.enpassant() == move.to() && board.getField(move.from()).type() == Figure::TypePawn);
+          auto d = (depth >> 4) + ngood;
+          auto type = board.getField(move.from()).type();
           if (!capture) {
-            sctx.plystack_[ply].killer_ = move;
-            auto& hist = history(board.color(), move.from(), move.to());
-            auto d = (depth >> 4) + ngood;
+            sctx.plystack_[ply].addKiller(move);
+            history_->setCounterMove(board, move);
+            auto& hist = history_->history(board.color(), move.from(), move.to());
             hist.inc_score(d * d);
+            if (cont1)
+              (*cont1)[type][move.to()].inc_score(d * d);
+            if (cont2)
+              (*cont2)[type][move.to()].inc_score(d * d);
             ngood++;
             if (movep) {
-              auto& phist = history(board.color(), movep.from(), movep.to());
+              auto& phist = history_->history(board.color(), movep.from(), movep.to());
               phist.dec_score(d + ngood);
+              auto ptype = board.getField(movep.from()).type();
+              if (cont1)
+                (*cont1)[ptype][movep.to()].dec_score(d + ngood);
+              if (cont2)
+                (*cont2)[ptype][movep.to()].dec_score(d + ngood);
             }
             movep = move;
           }
+          else if (!move.new_type()) {
+            history_->capturesHistory(board.color(), type, move.to(), board.getField(move.to()).type()).inc_score(d * d);
+          }
           alpha = score;
           if(pv)
             assemblePV(ictx, move, board.underCheck(), ply);
@@ -804,10 +1195,19 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
   if(sctx.stop_)
     return scoreBest;
 
+#ifdef SEARCH_STAT
+  if(alpha >= betta)
+  {
+    sctx.stat_.betaCuts_++;
+    if(counter == 1)
+      sctx.stat_.firstMoveCuts_++;
+  }
+#endif
+
   if(!counter)
   {
     board.setNoMoves();
-    scoreBest = sctx.eval_(alpha, betta);
+    scoreBest = evaluate(sctx, alpha, betta);
     if(board.matState())
     {
       scoreBest += ply;
@@ -820,6 +1220,7 @@ ScoreType Engine::alphaBetta(int ictx, int depth, int ply, ScoreType alpha, Scor
   {
     X_ASSERT(!best, "best move wasn't found but one move was");
     singular = true;
+    SEARCH_STAT_INC(sctx.stat_, singularExts_);
 
 #if ((defined USE_HASH) || (defined USE_EVAL_HASH_ALL))
     auto pfhkey = board.hashAfterMove(best);
@@ -942,7 +1343,7 @@ ScoreType Engine::captures(int ictx, int depth, int ply, ScoreType alpha, ScoreT
 
     // not initialized yet
     if (score0 == -ScoreMax) {
-      score0 = eval(alpha, betta);
+      score0 = evaluate(sctx, alpha, betta);
     }
 
     if (score0 >= betta) {
@@ -979,7 +1380,7 @@ ScoreType Engine::captures(int ictx, int depth, int ply, ScoreType alpha, ScoreT
 #endif
 
   int thr = std::min(threshold, 0);
-  TacticalGenerator<Board, SMove> tg(board, hmove, depth);
+  TacticalGenerator<Board, SMove> tg(board, *history_, hmove, depth);
   for(; alpha < betta && !checkForStop(ictx);)
   {
     auto* pmove = tg.next(thr, counter == 0);
@@ -1028,6 +1429,7 @@ ScoreType Engine::captures(int ictx, int depth, int ply, ScoreType alpha, ScoreT
 #endif
 
     sdata.inc_nc();
+    SEARCH_STAT_INC(sctx.stat_, qsearchNodes_);
 
 #ifdef PROCESS_MOVES_SEQ
     if (!board.stestMovesFoundFileName_.empty() && findSequence(ictx, ply, true))
@@ -1160,6 +1562,4 @@ bool Engine::isRealThreat(int ictx, const Move move)
   return false;
 }
 
-int Engine::xcounter_ = 0;
-
 } // NEngine
@@ -3,12 +3,15 @@
  *************************************************************/
 
 #include "iostream"
+#include "shallow.h"
 #include "xprotocol.h"
 #include "magicbb.h"
 #include "xtests.h"
 #include "xlist.h"
 #include "xalgorithm.h"
 #include "iomanip"
+#include "cstdlib"
+#include "thread"
 
 
 #if ((defined _MSC_VER) && (defined USE_MINIDUMP))
@@ -36,15 +39,121 @@ void main_loop(NShallow::xProtocolMgr & xpr)
 
 int main(int argn, char *argv[])
 {
-  NEngine::init_popcount_ptr();
-  NEngine::magic_ns::initialize();
-  NEngine::EvalCoefficients::initialize();
+  NShallow::initialize();
 
-  std::cout.setf(std::ios_base::unitbuf);
   NShallow::xProtocolMgr xpr;
 
 #ifndef __ANDROID__
 
+  // write built-in evaluation coefficients. text or binary file
+  if (argn > 2 && std::string(argv[1]) == "saveeval")
+  {
+    bool binary = argn > 3 && std::string(argv[3]) == "bin";
+    return NEngine::EvalCoefficients::defaults().save(argv[2], binary) ? 0 : 1;
+  }
+
+  // lazy evaluation margins calibration on epd file
+  if (argn > 2 && std::string(argv[1]) == "lazyeval")
+  {
+    NEngine::calibrateLazyEval(argv[2], argn > 3 ? std::atoi(argv[3]) : 8);
+    return 0;
+  }
+
+  // fixed depth search statistics on epd file
+  if (argn > 2 && std::string(argv[1]) == "bench")
+  {
+    NEngine::bench(argv[2], argn > 3 ? std::atoi(argv[3]) : 10);
+    return 0;
+  }
+
+  // self-play to check time manager. base time, increment (ms) and moves to go
+  if (argn > 2 && std::string(argv[1]) == "timeplay")
+  {
+    NEngine::timePlay(std::atoi(argv[2]), argn > 3 ? std::atoi(argv[3]) : 0, argn > 4 ? std::atoi(argv[4]) : 0);
+    return 0;
+  }
+
+  // endgame bitbases for "BitbaseFile" option. file name, threads number and list of endgames, like KRKP
+  if (argn > 2 && std::string(argv[1]) == "bitbases")
+  {
+    int threadsN = argn > 3 ? std::atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+    std::vector<std::string> names(argv + std::min(argn, 4), argv + argn);
+    NEngine::generateBitbases(argv[2], std::max(threadsN, 1), names);
+    return 0;
+  }
+
+  // parallel analysis of epd file. instances, threads per instance and limit: depth N, nodes N or movetime ms
+  if (argn > 3 && std::string(argv[1]) == "batch")
+  {
+    int instancesN = argn > 4 ? std::atoi(argv[4]) : (int)std::thread::hardware_concurrency();
+    int threadsN = argn > 5 ? std::atoi(argv[5]) : 1;
+    std::string limitType = argn > 6 ? argv[6] : "depth";
+    int limit = argn > 7 ? std::atoi(argv[7]) : 10;
+    NEngine::batchAnalyze(argv[2], argv[3], std::max(instancesN, 1), std::max(threadsN, 1), limitType, limit);
+    return 0;
+  }
+
+  // regex reference vs parser on epd file, move notation round trip and parsing speed
+  if (argn > 2 && std::string(argv[1]) == "parsetest")
+  {
+    int repeat = argn > 3 ? std::atoi(argv[3]) : 10;
+    NEngine::parseTest(argv[2], std::max(repeat, 1));
+    return 0;
+  }
+
+  // epd or pgn to packed binary positions and back
+  if (argn > 3 && std::string(argv[1]) == "pack")
+  {
+    NEngine::packPositions(argv[2], argv[3]);
+    return 0;
+  }
+
+  if (argn > 3 && std::string(argv[1]) == "unpack")
+  {
+    NEngine::unpackPositions(argv[2], argv[3]);
+    return 0;
+  }
+
+  // positions of pgn games to epd or packed file. options are "nocheck" and "quiet"
+  if (argn > 3 && std::string(argv[1]) == "pgn")
+  {
+    int threadsN = argn > 4 ? std::atoi(argv[4]) : (int)std::thread::hardware_concurrency();
+    NEngine::PgnFilter filter;
+    filter.plyMin_ = argn > 5 ? std::atoi(argv[5]) : 0;
+    filter.plyMax_ = argn > 6 ? std::atoi(argv[6]) : 0;
+    for (int i = 7; i < argn; ++i)
+    {
+      filter.noCheck_ |= std::string(argv[i]) == "nocheck";
+      filter.quiet_ |= std::string(argv[i]) == "quiet";
+    }
+    NEngine::extractPositions(argv[2], argv[3], std::max(threadsN, 1), filter);
+    return 0;
+  }
+
+  // self-play games to packed positions file. nodes per move
+  if (argn > 3 && std::string(argv[1]) == "selfplay")
+  {
+    int threadsN = argn > 4 ? std::atoi(argv[4]) : (int)std::thread::hardware_concurrency();
+    int nodes = argn > 5 ? std::atoi(argv[5]) : SelfPlay_NodesDefault;
+    NEngine::selfPlay(argv[2], std::atoi(argv[3]), std::max(threadsN, 1), std::max(nodes, 1));
+    return 0;
+  }
+
+  if (argn > 2 && std::string(argv[1]) == "concurrency")
+  {
+    int enginesN = argn > 3 ? std::atoi(argv[3]) : 4;
+    int depth = argn > 4 ? std::atoi(argv[4]) : 8;
+    NEngine::concurrencyTest(argv[2], std::max(enginesN, 1), std::max(depth, 2));
+    return 0;
+  }
+
+  // built-in KPK table source
+  if (argn > 2 && std::string(argv[1]) == "kpk")
+  {
+    NEngine::kpkTable(argv[2]);
+    return 0;
+  }
+
 #if(!defined(NDEBUG) && !defined(PROCESS_MOVES_SEQ))
   if (argn > 1)
   {
@@ -0,0 +1,259 @@
+/*************************************************************
+shallow_api.cpp - Copyright (C) 2016 by Dmitry Sultanov
+*************************************************************/
+
+#include "shallow.h"
+#include "shallow_c.h"
+#include "processor.h"
+#include "Helpers.h"
+#include "magicbb.h"
+#include "cstring"
+#include "climits"
+
+namespace NShallow
+{
+
+void initialize()
+{
+  static std::once_flag once;
+  std::call_once(once, []()
+  {
+    NEngine::init_popcount_ptr();
+    NEngine::magic_ns::initialize();
+    NEngine::EvalCoefficients::initialize();
+  });
+}
+
+Instance::Instance()
+{
+  initialize();
+  proc_.reset(new Processor);
+
+  NEngine::xCallback xcbk;
+  // polled by timer thread while searching
+  xcbk.queryInput_ = [this]()
+  {
+    if(stop_)
+      proc_->stop();
+    return !stop_;
+  };
+  xcbk.sendOutput_ = [this](NEngine::SearchResult const& sres)
+  {
+    if(!info_)
+      return;
+    Info info;
+    info.depth_ = sres.depth_;
+    info.score_ = sres.score_;
+    info.nodes_ = sres.totalNodes_;
+    info.time_ms_ = NTime::milli_seconds<int>(sres.dt_);
+    for(int i = 0; i < MaxPly && sres.pv_[i]; ++i)
+      info.pv_.push_back(NEngine::moveToStr(sres.pv_[i], false));
+    info_(info);
+  };
+  proc_->setCallback(xcbk);
+  proc_->init();
+}
+
+Instance::~Instance()
+{
+  stop();
+  std::lock_guard<std::mutex> lock(mutex_);
+  proc_.reset();
+}
+
+bool Instance::setOption(std::string const& name, std::string const& value)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return proc_->setOption(name, value);
+}
+
+bool Instance::setPosition(std::string const& fen, std::vector<std::string> const& moves)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if(!proc_->fromFEN(fen))
+    return false;
+  for(auto const& move : moves)
+  {
+    if(!proc_->makeMove(move))
+      return false;
+  }
+  return true;
+}
+
+std::string Instance::fen()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return proc_->toFEN();
+}
+
+Result Instance::search(Limits const& limits, InfoCallback const& info)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  stop_ = false;
+  info_ = info;
+
+  // movetime has priority over depth
+  if(limits.movetime_ms_ > 0)
+    proc_->setTimePerMove(NTime::from_milliseconds(limits.movetime_ms_));
+  else
+    proc_->setDepth(limits.depth_ > 0 ? limits.depth_ : DepthMaximum);
+  proc_->setNodesLimit(static_cast<int>(std::min(limits.nodes_, static_cast<int64_t>(INT_MAX))));
+
+  Result result;
+  auto r = proc_->reply(false);
+  info_ = {};
+  if(!r || !r.best_)
+    return result;
+
+  result.bestmove_ = r.moveStr_;
+  result.ponder_ = r.ponderStr_;
+  result.score_ = r.score_;
+  result.book_ = r.book_;
+  if(!r.book_)
+  {
+    auto const& sres = proc_->result();
+    result.depth_ = sres.depth_;
+    result.nodes_ = sres.totalNodes_;
+  }
+  // reply() plays found move
+  proc_->undo();
+  return result;
+}
+
+void Instance::stop()
+{
+  stop_ = true;
+}
+
+void Instance::newGame()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  proc_->init();
+}
+
+} // NShallow
+
+//////////////////////////////////////////////////////////////////////////
+struct shallow_instance
+{
+  NShallow::Instance instance_;
+};
+
+namespace
+{
+
+void copyMove(char* dst, size_t size, std::string const& move)
+{
+  std::strncpy(dst, move.c_str(), size - 1);
+  dst[size - 1] = 0;
+}
+
+} // namespace {}
+
+shallow_instance* shallow_create(void)
+{
+  try
+  {
+    return new shallow_instance;
+  }
+  catch(...)
+  {
+    return nullptr;
+  }
+}
+
+void shallow_destroy(shallow_instance* instance)
+{
+  delete instance;
+}
+
+int shallow_set_option(shallow_instance* instance, const char* name, const char* value)
+{
+  if(!instance || !name)
+    return 0;
+  try
+  {
+    return instance->instance_.setOption(name, value ? value : "");
+  }
+  catch(...)
+  {
+    return 0;
+  }
+}
+
+int shallow_set_position(shallow_instance* instance, const char* fen, const char* moves)
+{
+  if(!instance)
+    return 0;
+  try
+  {
+    std::vector<std::string> smoves;
+    std::string_view str{ moves ? moves : "" };
+    for(auto smove = NEngine::nextToken(str); !smove.empty(); smove = NEngine::nextToken(str))
+      smoves.emplace_back(smove);
+    return instance->instance_.setPosition(fen ? fen : "", smoves);
+  }
+  catch(...)
+  {
+    return 0;
+  }
+}
+
+int shallow_search(shallow_instance* instance, int depth, long long nodes, int movetime_ms,
+  shallow_info_callback callback, void* user_data, shallow_result* result)
+{
+  if(!instance || !result)
+    return 0;
+
+  std::memset(result, 0, sizeof(*result));
+  try
+  {
+    NShallow::InfoCallback info;
+    if(callback)
+    {
+      info = [callback, user_data](NShallow::Info const& i)
+      {
+        auto pv = NEngine::join(i.pv_, " ");
+        shallow_info ci{ i.depth_, i.score_, i.nodes_, i.time_ms_, pv.c_str() };
+        callback(&ci, user_data);
+      };
+    }
+
+    NShallow::Limits limits;
+    limits.depth_ = depth;
+    limits.nodes_ = nodes;
+    limits.movetime_ms_ = movetime_ms;
+    auto r = instance->instance_.search(limits, info);
+
+    copyMove(result->bestmove, sizeof(result->bestmove), r.bestmove_);
+    copyMove(result->ponder, sizeof(result->ponder), r.ponder_);
+    result->depth = r.depth_;
+    result->score = r.score_;
+    result->nodes = r.nodes_;
+    result->book = r.book_;
+    return !r.bestmove_.empty();
+  }
+  catch(...)
+  {
+    return 0;
+  }
+}
+
+void shallow_stop(shallow_instance* instance)
+{
+  if(instance)
+    instance->instance_.stop();
+}
+
+void shallow_new_game(shallow_instance* instance)
+{
+  if(!instance)
+    return;
+  try
+  {
+    instance->instance_.newGame();
+  }
+  catch(...)
+  {
+  }
+}
@@ -31,7 +31,7 @@ void Engine::saveHash(std::string const&  fname) const
 
   std::ofstream ofs(bfname, std::ios::out);
   save(scontexts_[0].board_, ofs);
-  save_history(hfname);
+  history_->save(hfname);
 }
 
 void Engine::loadHash(std::string const& fname)
@@ -48,81 +48,34 @@ void Engine::loadHash(std::string const& fname)
 
   //std::ifstream ifs(bfname, std::ios::in);
   //load(scontexts_[0].board_, ifs);
-  load_history(hfname);
+  history_->load(hfname);
 }
 
-////////////////////////////////////////////////////////////////////////////
-/// for DEBUG
-////////////////////////////////////////////////////////////////////////////
-void Engine::logPV(int ictx)
+bool Engine::saveHashTable(std::string const& fname) const
 {
-  if(!callbacks_.slog_)
-    return;
-
-  auto tm = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-  std::ostringstream oss;
-  oss << std::put_time(std::localtime(&tm), "%d:%m:%Y %H:%M:%S ");
-
-  auto& sdata = scontexts_[ictx].sdata_;
-  SBoard<Board, UndoInfo, Board::GameLength> board(scontexts_[ictx].board_);
-
-  oss << "iter " << sdata.depth_ << " ";
-  if(sdata.best_)
-  {
-    auto strbest = printSAN(board, sdata.best_);
-    if(!strbest.empty())
-    {
-      oss << " bm " << strbest << " ";
-    }
-  }
-
-  oss << "pv ";
-  for(int i = 0; i < MaxPly; ++i)
-  {
-    auto const move = scontexts_[ictx].plystack_[0].pv_[i];
-    if(!move)
-      break;
-    auto str = printSAN(board, move);
-    if(str.empty())
-      break;
-    board.makeMove(move);
-    oss << str << " ";
-  }
-  (*callbacks_.slog_) << oss.str() << std::endl;
+#ifdef USE_HASH
+  return hash_.save(fname);
+#else
+  return false;
+#endif
 }
 
-void Engine::logMovies(int ictx)
+bool Engine::loadHashTable(std::string const& fname)
 {
-  if(!callbacks_.slog_)
-    return;
-
-  auto& sdata = scontexts_[ictx].sdata_;
-  SBoard<Board, UndoInfo, Board::GameLength> board(scontexts_[ictx].board_);
-
-  auto fen = NEngine::toFEN(board);
-
-  auto tm = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-  std::ostringstream oss;
-  oss << std::put_time(std::localtime(&tm), "%d:%m:%Y %H:%M:%S ");
-  oss << " position " << fen << " ";
-  oss << " halfmovies count " << scontexts_[ictx].board_.halfmovesCount() << " ";
-  oss << "iter " << sdata.depth_ << " ";
-  oss << "movies ";
-
-  for(int i = 0; i < sdata.numOfMoves_; ++i)
-  {
-    if(checkForStop(ictx))
-      break;
-
-    Move move = scontexts_[ictx].moves_[i];
-    auto str = printSAN(board, move);
-    if(str.empty())
-      break;
-    oss << str << " ";
-  }
-  (*callbacks_.slog_) << oss.str() << std::endl;
+#ifdef USE_HASH
+  return hash_.load(fname);
+#else
+  return false;
+#endif
 }
 
+void Engine::unloadHashTable()
+{
+#ifdef USE_HASH
+  if(hash_.mapped())
+    setMemory(memoryMb_);
+#endif
+}
 
 #ifdef PROCESS_MOVES_SEQ
 
@@ -2,6 +2,7 @@
 xcallback.cpp - Copyright (C) 2016 by Dmitry Sultanov
 *************************************************************/
 #include "xcallback.h"
+#include "cstdio"
 
 namespace NEngine
 {
@@ -27,8 +28,12 @@ SearchResult& SearchResult::operator = (SearchResult const& other)
   board_ = other.board_;
   depth_ = other.depth_;
   score_ = other.score_;
+  bound_ = other.bound_;
   for (size_t i = 0; i < pv_.size(); ++i)
     pv_[i] = other.pv_[i];
+  linesNum_ = other.linesNum_;
+  for (int i = 0; i < linesNum_; ++i)
+    lines_[i] = other.lines_[i];
   return *this;
 }
 
@@ -48,6 +53,8 @@ void SearchResult::reset()
   board_ = Board{};
   depth_ = 0;
   score_ = -Figure::MatScore;
+  bound_ = Exact;
+  linesNum_ = 0;
 }
 void SearchData::reset()
 {
@@ -58,6 +65,7 @@ void SearchData::reset()
   numOfMoves_ = 0;
   best_ = SMove{ true };
   scoreBest_ = -Figure::MatScore;
+  bestNodes_ = 0;
   counter_ = 0;
   plyMax_ = 0;
 }
@@ -66,9 +74,78 @@ void SearchData::restart()
 {
   best_ = SMove{ true };
   scoreBest_ = -Figure::MatScore;
+  bestNodes_ = 0;
   nodesCount_ = 0;
   plyMax_ = 0;
   counter_ = 0;
 }
 
+void SearchStat::clear()
+{
+  *this = SearchStat{};
+}
+
+SearchStat& SearchStat::operator += (SearchStat const& other)
+{
+  ttProbes_ += other.ttProbes_;
+  ttHits_ += other.ttHits_;
+  ttCuts_ += other.ttCuts_;
+  nullMoveTries_ += other.nullMoveTries_;
+  nullMoveCuts_ += other.nullMoveCuts_;
+  futilityPruned_ += other.futilityPruned_;
+  probcutTries_ += other.probcutTries_;
+  probcutCuts_ += other.probcutCuts_;
+  probcutFails_ += other.probcutFails_;
+  multicutTries_ += other.multicutTries_;
+  multicutCuts_ += other.multicutCuts_;
+  lmrReduced_ += other.lmrReduced_;
+  lmrResearched_ += other.lmrResearched_;
+  lmpPruned_ += other.lmpPruned_;
+  iidSearches_ += other.iidSearches_;
+  singularExts_ += other.singularExts_;
+  qsearchNodes_ += other.qsearchNodes_;
+  betaCuts_ += other.betaCuts_;
+  firstMoveCuts_ += other.firstMoveCuts_;
+  evalCalls_ += other.evalCalls_;
+  return *this;
+}
+
+namespace
+{
+
+std::string percent(uint64 n, uint64 total)
+{
+  if(!total)
+    return {};
+  char str[32];
+  std::snprintf(str, sizeof(str), " (%.1f%%)", 100.0 * n / total);
+  return str;
+}
+
+} // namespace {}
+
+void SearchStat::print(std::ostream& os) const
+{
+  os << "tt probes:       " << ttProbes_ << std::endl;
+  os << "tt hits:         " << ttHits_ << percent(ttHits_, ttProbes_) << std::endl;
+  os << "tt cuts:         " << ttCuts_ << percent(ttCuts_, ttProbes_) << std::endl;
+  os << "null move tries: " << nullMoveTries_ << std::endl;
+  os << "null move cuts:  " << nullMoveCuts_ << percent(nullMoveCuts_, nullMoveTries_) << std::endl;
+  os << "futility pruned: " << futilityPruned_ << std::endl;
+  os << "probcut tries:   " << probcutTries_ << std::endl;
+  os << "probcut cuts:    " << probcutCuts_ << percent(probcutCuts_, probcutTries_) << std::endl;
+  os << "probcut fails:   " << probcutFails_ << std::endl;
+  os << "multicut tries:  " << multicutTries_ << std::endl;
+  os << "multicut cuts:   " << multicutCuts_ << percent(multicutCuts_, multicutTries_) << std::endl;
+  os << "lmr reduced:     " << lmrReduced_ << std::endl;
+  os << "lmr researched:  " << lmrResearched_ << percent(lmrResearched_, lmrReduced_) << std::endl;
+  os << "lmp pruned:      " << lmpPruned_ << std::endl;
+  os << "iid searches:    " << iidSearches_ << std::endl;
+  os << "singular exts:   " << singularExts_ << std::endl;
+  os << "qsearch nodes:   " << qsearchNodes_ << std::endl;
+  os << "beta cuts:       " << betaCuts_ << std::endl;
+  os << "first move cuts: " << firstMoveCuts_ << percent(firstMoveCuts_, betaCuts_) << std::endl;
+  os << "eval calls:      " << evalCalls_ << std::endl;
+}
+
 } // NEngine
@@ -20,6 +20,11 @@ void xCmdQueue::push(xCmd const& cmd)
     commands_.push(cmd);
 }
 
+bool xCmdQueue::pending() const
+{
+  return !commands_.empty();
+}
+
 xCmd xCmdQueue::peek()
 {
   auto str = input_.peekInput();
@@ -36,6 +36,14 @@ xCmd::xCmd(xType type,
   params_(std::move(params))
 {}
 
+xCmd::xCmd(xType type,
+  std::map<std::string, int>&& params,
+  std::map<std::string, std::string>&& strParams) :
+  type_(type),
+  params_(std::move(params)),
+  strParams_(std::move(strParams))
+{}
+
 xCmd::xCmd(xType type, bool inf) :
   type_(type),
   infinite_(inf)
@@ -64,6 +72,20 @@ int xCmd::param(std::string const& name) const
   return -1;
 }
 
+std::string const& xCmd::strParam(std::string const& name) const
+{
+  static const std::string empty;
+  auto iter = strParams_.find(name);
+  if(iter != strParams_.end())
+    return iter->second;
+  return empty;
+}
+
+std::map<std::string, int> const& xCmd::params() const
+{
+  return params_;
+}
+
 std::string xCmd::param(size_t i) const
 {
   if(i < moves_.size())
@@ -7,13 +7,12 @@
 namespace NEngine
 {
 
-int64 x_movesCounter = 0;
-
-void xcaptures(Board& board, int depth)
+int64 xcaptures(Board& board, int depth)
 {
+  int64 count = 0;
   if(board.drawState() || board.hasReps() || depth < -10)
-    return;
-  TacticalGenerator<Board, SMove> tg(board, SMove{true}, depth);
+    return count;
+  TacticalGenerator<Board, SMove> tg(board, SearchHistory::empty(), SMove{true}, depth);
   //try
   //{
     for(;;)
@@ -27,8 +26,8 @@ void xcaptures(Board& board, int depth)
       //Board brd{ board };
       //std::string fen = toFEN(board);
       board.makeMove(move);
-      x_movesCounter++;
-      xcaptures(board, depth-1);
+      count++;
+      count += xcaptures(board, depth-1);
       board.unmakeMove(move);
       //X_ASSERT(brd != board, "board was not correctly restored");
     }
@@ -37,20 +36,19 @@ void xcaptures(Board& board, int depth)
   //{
   //  throw std::runtime_error(toFEN(board) + "; " + e.what());
   //}
+  return count;
 }
 
-void xsearch(Board& board, int depth)
+int64 xsearch(Board& board, int depth)
 {
+  int64 count = 0;
   if(board.drawState() || board.hasReps())
-    return;
+    return count;
   if(depth <= 0)
-  {
-    xcaptures(board, depth);
-    return;
-  }
+    return xcaptures(board, depth);
   //try
   //{
-  FastGenerator<Board, SMove> fg(board, SMove{ true }, SMove{ true });
+  FastGenerator<Board, SMove> fg(board, SearchHistory::empty(), SMove{ true }, SMove{ true });
     for(;;)
     {
       auto* pmove = fg.next();
@@ -63,8 +61,8 @@ void xsearch(Board& board, int depth)
       //Board brd{ board };
 
       board.makeMove(move);
-      x_movesCounter++;
-      xsearch(board, depth-1);
+      count++;
+      count += xsearch(board, depth-1);
       board.unmakeMove(move);
 
       //X_ASSERT(brd != board, "board was not correctly restored");
@@ -74,6 +72,7 @@ void xsearch(Board& board, int depth)
   //{
   //  throw std::runtime_error(toFEN(board) + "; " + e.what());
   //}
+  return count;
 }
 
 template <class MOVE>
@@ -100,7 +99,7 @@ bool xverifyMoves(Board& board)
 {
   bool ok = false;
   std::vector<SMove> fmoves;
-  FastGenerator<Board, SMove> fg(board, SMove{ true }, SMove{ true });
+  FastGenerator<Board, SMove> fg(board, SearchHistory::empty(), SMove{ true }, SMove{ true });
   for(;;)
   {
     auto* pmove = fg.next();
@@ -143,7 +142,7 @@ bool xverifyMoves(Board& board)
     return false;
   if(board.underCheck())
     return true;
-  ChecksGenerator<Board, SMove> cg(board);
+  ChecksGenerator<Board, SMove> cg(board, SearchHistory::empty());
   cg.generate();
   std::vector<SMove> checks2;
   for(auto& move : cg.moves_)
@@ -3,6 +3,7 @@ xoptions.h - Copyright (C) 2016 by Dmitry Sultanov
 *************************************************************/
 
 #include "xoptions.h"
+#include "xcommon.h"
 
 namespace NEngine
 {
@@ -32,6 +33,105 @@ std::vector<xOptionInfo> all_options()
       "1",
       {},
     }
+    ,
+    {
+      "MultiPV",
+      "spin",
+      "1",
+      std::to_string(MultiPV_Max),
+      "1",
+      {},
+    }
+    ,
+    {
+      "MoveOverhead",
+      "spin",
+      "0",
+      "5000",
+      std::to_string(TimeManager_Overhead_ms),
+      {},
+    }
+    ,
+    {
+      "Ponder",
+      "check",
+      "",
+      "",
+      "false",
+      {},
+    }
+    ,
+    {
+      "EvalFile",
+      "string",
+      "",
+      "",
+      "",
+      {},
+    }
+    ,
+    {
+      "BitbaseFile",
+      "string",
+      "",
+      "",
+      "",
+      {},
+    }
+    ,
+    {
+      "BookFile",
+      "string",
+      "",
+      "",
+      "",
+      {},
+    }
+    ,
+    {
+      "BookDepth",
+      "spin",
+      "0",
+      std::to_string(Book_DepthMax),
+      std::to_string(Book_DepthDefault),
+      {},
+    }
+    ,
+    {
+      "HashFile",
+      "string",
+      "",
+      "",
+      "",
+      {},
+    }
+    ,
+    {
+      "SaveHashFile",
+      "string",
+      "",
+      "",
+      "",
+      {},
+    }
+    ,
+    {
+      "LogFile",
+      "string",
+      "",
+      "",
+      "",
+      {},
+    }
+    ,
+    {
+      "LogBinaryFile",
+      "string",
+      "",
+      "",
+      "",
+      {},
+    }
   };
 }
 
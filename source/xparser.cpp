@@ -105,6 +105,13 @@ namespace
         return xCmd{ xType::UCIgo, true };
       }
 
+      // flag without value
+      if(prm == "ponder")
+      {
+        pmap.emplace(prm, 1);
+        continue;
+      }
+
       if(i+1 >= params.size())
         break;
 
@@ -118,17 +125,21 @@ namespace
   xCmd parseOptions(std::vector<std::string> const& params)
   {
     std::map<std::string, int> pmap;
-    for(size_t i = 0; i < params.size(); i += 4)
+    std::map<std::string, std::string> smap;
+    for(size_t i = 0; i+2 < params.size();)
     {
-      if(i+3 >= params.size())
-        break;
+      // value lasts till the next option, it could be file name with spaces or empty
+      auto j = i+3;
+      for(; j < params.size() && params[j] != "name"; ++j);
       if(params[i] == "name" && params[i+2] == "value")
       {
         pmap.emplace(params[i+1], toInt(params, i+3));
+        smap.emplace(params[i+1], NEngine::join(params.begin()+i+3, params.begin()+j, " "));
       }
+      i = j;
     }
 
-    return xCmd(xType::SetOption, std::move(pmap));
+    return xCmd(xType::SetOption, std::move(pmap), std::move(smap));
   }
 
   xCmd parseXOptions(std::vector<std::string> const& params)
@@ -181,7 +192,14 @@ xCmd parse(std::string const& line, bool const uci)
     { "isready",    xType::IsReady },
     { "ucinewgame", xType::UCInewgame },
     { "position",   xType::Position },
-    { "stop",       xType::xExit }
+    { "stop",       xType::xExit },
+    { "ponderhit",  xType::UCIponderhit },
+
+    // debug commands
+    { "eval",       xType::xEval },
+    { "evalstat",   xType::xEvalStat },
+    { "lazyeval",   xType::xLazyEval },
+    { "stats",      xType::xSearchStat }
   };
 
   auto params = NEngine::split(line, [](char c) { return NEngine::is_any_of(" \t\n\r", c); });
@@ -314,8 +332,15 @@ std::string to_string(xCmd const& cmd)
     { "position",   xType::Position },
     { "stop",       xType::xExit },
     { "go",         xType::UCIgo },
+    { "ponderhit",  xType::UCIponderhit },
+
+    { "quit",       xType::xQuit },
 
-    { "quit",       xType::xQuit }
+    // debug commands
+    { "eval",       xType::xEval },
+    { "evalstat",   xType::xEvalStat },
+    { "lazyeval",   xType::xLazyEval },
+    { "stats",      xType::xSearchStat }
   };
 
   auto iter = std::find_if(xcommands.begin(), xcommands.end(), [cmd] (std::pair<std::string const, xType> p) { return p.second == cmd.type(); });
@@ -9,21 +9,212 @@
 #include "xprotocol.h"
 #include "Helpers.h"
 #include "xoptions.h"
+#include "PackedPosition.h"
 #include "algorithm"
 #include "ctime"
 #include "iomanip"
+#include "cstdlib"
 
 namespace NShallow
 {
 
+namespace
+{
+
+enum EventType : uint16
+{
+  evPV = 1,
+  evStat
+};
+
+// principal variation of iteration. it's formatted by logger thread
+struct PvEvent
+{
+  NEngine::PackedPosition pos_;
+  int depth_{};
+  int depthMax_{};
+  int score_{};
+  int bound_{};
+  int multipv_{};
+  int counter_{};
+  int totalNodes_{};
+  int time_ms_{};
+  bool uci_{};
+  NEngine::Move pv_[MaxPly];
+};
+
+// root move being searched
+struct StatEvent
+{
+  NEngine::PackedPosition pos_;
+  int depth_{};
+  int counter_{};
+  int numOfMoves_{};
+  int totalNodes_{};
+  int time_cs_{};
+  bool uci_{};
+  NEngine::Move best_{ true };
+};
+
+template <class EVENT>
+EVENT const& eventData(NEngine::LogRecord const& rec)
+{
+  X_ASSERT(rec.size_ != sizeof(EVENT), "invalid event size");
+  return *reinterpret_cast<EVENT const*>(rec.data_);
+}
+
+void formatUciInfo(PvEvent const& ev, std::string& text)
+{
+  NEngine::SBoard<NEngine::Board, NEngine::UndoInfo, NEngine::Board::GameLength> board;
+  if(!NEngine::unpack(ev.pos_, board))
+    return;
+
+  std::string pv_str;
+  for(int i = 0; i < MaxPly && ev.pv_[i]; ++i)
+  {
+    auto pv = ev.pv_[i];
+    if(!board.possibleMove(pv) || !board.validateMoveBruteforce(pv))
+      break;
+
+    auto str = moveToStr(pv, false);
+    if(str.empty())
+      break;
+
+    if(i)
+      pv_str += " ";
+    board.makeMove(pv);
+    pv_str += str;
+  }
+
+  auto dt = ev.time_ms_ / 1000.0 + 0.001;
+  int nps = static_cast<int>(ev.totalNodes_ / dt);
+  std::ostringstream oss;
+
+  oss << "info "
+      << "depth " << ev.depth_ << " "
+      << "seldepth " << ev.depthMax_ << " ";
+
+  if(ev.multipv_ > 0)
+    oss << "multipv " << ev.multipv_ << " ";
+
+  if(ev.score_ >= NEngine::Figure::MatScore-MaxPly)
+  {
+    int n = (NEngine::Figure::MatScore - ev.score_) / 2;
+    oss << "score mate " << n << " ";
+  }
+  else if(ev.score_ <= MaxPly-NEngine::Figure::MatScore)
+  {
+    int n = (-NEngine::Figure::MatScore - ev.score_) / 2;
+    oss << "score mate " << n << " ";
+  }
+  else
+    oss << "score cp " << ev.score_ << " ";
+
+  if(ev.bound_ == NEngine::SearchResult::Lower)
+    oss << "lowerbound ";
+  else if(ev.bound_ == NEngine::SearchResult::Upper)
+    oss << "upperbound ";
+
+  oss << "time " << ev.time_ms_ << " ";
+  oss << "nodes " << ev.totalNodes_ << " ";
+  oss << "nps " << nps << " ";
+
+  if(ev.pv_[0])
+  {
+    oss << "currmove " << moveToStr(ev.pv_[0], false) << " ";
+  }
+
+  oss << "currmovenumber " << ev.counter_+1 << " ";
+  oss << "pv " << pv_str;
+
+  text += oss.str();
+}
+
+void formatXboardPV(PvEvent const& ev, std::string& text)
+{
+  NEngine::SBoard<NEngine::Board, NEngine::UndoInfo, NEngine::Board::GameLength> board;
+  if(!NEngine::unpack(ev.pos_, board))
+    return;
+
+  std::ostringstream oss;
+  oss << ev.depth_ << " " << ev.score_ << " " << ev.time_ms_ / 10 << " " << ev.totalNodes_;
+  for(int i = 0; i < ev.depth_ && i < MaxPly && ev.pv_[i]; ++i)
+  {
+    oss << " ";
+
+    auto pv = ev.pv_[i];
+    if(!board.possibleMove(pv))
+      break;
+
+    auto str = NEngine::printSAN(board, pv);
+    if(str.empty())
+      break;
+
+    X_ASSERT(!board.validateMoveBruteforce(pv), "move is invalid but it is not detected by printSAN()");
+
+    board.makeMove(pv);
+
+    oss << str;
+  }
+  text += oss.str();
+}
+
+void formatStat(StatEvent const& ev, std::string& text)
+{
+  if(ev.uci_)
+  {
+    auto smove = moveToStr(ev.best_, false);
+    if(smove.empty())
+      return;
+
+    std::ostringstream oss;
+    oss << "info "
+        << "currmove " << smove << " "
+        << "currmovenumber " << ev.counter_+1 << " "
+        << "nodes " << ev.totalNodes_ << " "
+        << "depth " << ev.depth_;
+    text += oss.str();
+    return;
+  }
+
+  NEngine::SBoard<NEngine::Board, NEngine::UndoInfo, NEngine::Board::GameLength> board;
+  if(!NEngine::unpack(ev.pos_, board))
+    return;
+
+  int movesLeft = ev.numOfMoves_ - ev.counter_;
+  std::ostringstream oss;
+  oss << "stat01: " << ev.time_cs_
+    << " " << ev.totalNodes_ << " " << ev.depth_-1 << " " << movesLeft << " " << ev.numOfMoves_;
+  text += oss.str();
+
+  auto mv = ev.best_;
+  if(mv && board.possibleMove(mv) && board.validateMoveBruteforce(mv))
+  {
+    auto str = printSAN(board, mv);
+    text += " " + str;
+  }
+}
+
+} // namespace {}
+
 xProtocolMgr::xProtocolMgr() :
-  os_(std::cout)
-#ifdef LOG_PV
-  ,ofs_log_(new std::ofstream("log.txt", std::ios::out))
-#endif
+  os_(log_)
 {
+  log_.setOutput(&std::cout);
+  log_.setFormatter(evPV, [](NEngine::LogRecord const& rec, std::string& text)
+  {
+    auto const& ev = eventData<PvEvent>(rec);
+    if(ev.uci_)
+      formatUciInfo(ev, text);
+    else
+      formatXboardPV(ev, text);
+  });
+  log_.setFormatter(evStat, [](NEngine::LogRecord const& rec, std::string& text)
+  {
+    formatStat(eventData<StatEvent>(rec), text);
+  });
+
   NEngine::xCallback xcbk;
-  xcbk.slog_ = ofs_log_.get();
 
   xcbk.queryInput_ = [this]()
   {
@@ -55,6 +246,12 @@ xProtocolMgr::xProtocolMgr() :
   proc_.setCallback(xcbk);
 }
 
+xProtocolMgr::~xProtocolMgr()
+{
+  os_.flush();
+  log_.flush();
+}
+
 void xProtocolMgr::outState(NEngine::StateType state, bool white)
 {
   if(NEngine::State::ChessMat & state)
@@ -82,40 +279,45 @@ void xProtocolMgr::outState(NEngine::StateType state, bool white)
   }
 }
 
+// position is packed and event is pushed to logger. it's formatted by logger thread
 void xProtocolMgr::printPV(NEngine::SearchResult const& sres)
 {
   if(!sres.best_ || sres.best_ != sres.pv_[0])
     return;
 
-  if(cmds_.isUci())
-  {
-    printInfo(sres);
-    return;
-  }
+  bool const uci = cmds_.isUci();
 
-  NEngine::SBoard<NEngine::Board, NEngine::UndoInfo, NEngine::Board::GameLength> board(sres.board_);
-  std::ostringstream oss;
+  // xboard doesn't support bounds
+  if(!uci && sres.bound_ != NEngine::SearchResult::Exact)
+    return;
 
-  oss << sres.depth_ << " " << sres.score_ << " " << NTime::centi_seconds<int>(sres.dt_) << " " << sres.totalNodes_;
-  for(int i = 0; i < sres.depth_ && sres.pv_[i]; ++i)
+  PvEvent ev;
+  if(!NEngine::pack(sres.board_, ev.pos_))
+    return;
+  ev.depth_ = sres.depth_;
+  ev.depthMax_ = sres.depthMax_;
+  ev.bound_ = sres.bound_;
+  ev.counter_ = sres.counter_;
+  ev.totalNodes_ = sres.totalNodes_;
+  ev.time_ms_ = NTime::milli_seconds<int>(sres.dt_);
+  ev.uci_ = uci;
+
+  // one line for each principal variation in multi PV mode
+  if(uci && sres.linesNum_ > 1 && sres.bound_ == NEngine::SearchResult::Exact)
   {
-    oss << " ";
-
-    auto pv = sres.pv_[i];
-    if(!board.possibleMove(pv))
-      break;
-
-    auto str = NEngine::printSAN(board, pv);
-    if(str.empty())
-      break;
-
-    X_ASSERT(!board.validateMoveBruteforce(pv), "move is invalid but it is not detected by printSAN()");
-
-    board.makeMove(pv);
-
-    oss << str;
+    for(int i = 0; i < sres.linesNum_; ++i)
+    {
+      ev.score_ = sres.lines_[i].score_;
+      ev.multipv_ = i+1;
+      std::copy(sres.lines_[i].pv_.begin(), sres.lines_[i].pv_.begin() + MaxPly, ev.pv_);
+      log_.event(evPV, NEngine::LogLevel::Info, ev, true);
+    }
+    return;
   }
-  os_ << oss.str() << std::endl;
+
+  ev.score_ = sres.score_;
+  std::copy(sres.pv_.begin(), sres.pv_.begin() + MaxPly, ev.pv_);
+  log_.event(evPV, NEngine::LogLevel::Info, ev, true);
 }
 
 void xProtocolMgr::printStat(NEngine::SearchData const& sdata)
@@ -123,42 +325,38 @@ void xProtocolMgr::printStat(NEngine::SearchData const& sdata)
   if(sdata.depth_ <= 0)
     return;
 
-  if(cmds_.isUci())
-  {
-    printUciStat(sdata);
+  StatEvent ev;
+  ev.uci_ = cmds_.isUci();
+  if(ev.uci_ && !sdata.best_)
     return;
-  }
-
-  NEngine::SBoard<NEngine::Board, NEngine::UndoInfo, NEngine::Board::GameLength> board(sdata.board_);
-
-  int movesLeft = sdata.numOfMoves_ - sdata.counter_;
-  std::ostringstream oss;
-  oss << "stat01: " << NTime::centi_seconds<int>(NTime::now() - sdata.tstart_)
-    << " " << sdata.totalNodes_ << " " << sdata.depth_-1 << " " << movesLeft << " " << sdata.numOfMoves_;
-  std::string outstr = oss.str();
-
-  auto mv = sdata.best_;
-  if(mv && board.validateMoveBruteforce(mv))
-  {
-    auto str = printSAN(board, mv);
-    outstr += " " + str;
-  }
-
-  os_ << outstr << std::endl;
+  if(!ev.uci_ && !NEngine::pack(sdata.board_, ev.pos_))
+    return;
+  ev.depth_ = sdata.depth_;
+  ev.counter_ = sdata.counter_;
+  ev.numOfMoves_ = sdata.numOfMoves_;
+  ev.totalNodes_ = sdata.totalNodes_;
+  ev.time_cs_ = NTime::centi_seconds<int>(NTime::now() - sdata.tstart_);
+  ev.best_ = sdata.best_;
+  log_.event(evStat, NEngine::LogLevel::Info, ev, true);
 }
 
 void xProtocolMgr::setOption(const xCmd & cmd)
 {
-  auto mb = cmd.param("Hash");
-  if(mb > 1)
-  {
-    proc_.setHashSize(mb);
-  }
-  
-  auto nthreads = cmd.param("Threads");
-  if (nthreads > 0)
+  for (auto const& kv : cmd.params())
   {
-    proc_.setThreadsNumber(nthreads);
+    auto const& value = cmd.strParam(kv.first);
+    bool ok = true;
+    // protocol traffic and debug messages. events are also written to binary file as is
+    if (kv.first == "LogFile")
+      ok = log_.openLog(value);
+    else if (kv.first == "LogBinaryFile")
+      ok = log_.openBinary(value);
+    else
+      ok = proc_.setOption(kv.first, value);
+    if (!ok)
+    {
+      os_ << "info string can't set option " << kv.first << " to " << value << std::endl;
+    }
   }
 }
 
@@ -192,6 +390,8 @@ bool xProtocolMgr::uciGo(const xCmd & cmd)
   {
     proc_.setXtime(NTime::from_milliseconds(xtime));
   }
+  int inc = white ? cmd.param("winc") : cmd.param("binc");
+  proc_.setIncrement(NTime::from_milliseconds(std::max(inc, 0)));
   if(cmd.param("movestogo") > 0)
   {
     proc_.setMovesToGo(cmd.param("movestogo"));
@@ -204,13 +404,24 @@ bool xProtocolMgr::uciGo(const xCmd & cmd)
   {
     proc_.setDepth(cmd.param("depth"));
   }
+  int nodes = std::max(cmd.param("nodes"), 0);
+  proc_.setNodesLimit(nodes);
+  if(nodes > 0 && xtime <= 0 && cmd.param("movetime") <= 0 && cmd.param("depth") <= 0)
+  {
+    proc_.setDepth(DepthMaximum);
+  }
+
+  // search expected position on opponent's time till ponderhit or stop
+  bool const ponder = cmd.param("ponder") > 0;
 
-  if(auto r = proc_.reply(false))
+  if(auto r = proc_.reply(false, ponder))
   {
     std::string outstr("bestmove ");
     if(!r.moveStr_.empty())
     {
       outstr += r.moveStr_;
+      if(!r.ponderStr_.empty())
+        outstr += " ponder " + r.ponderStr_;
       os_ << outstr << std::endl;
       return true;
     }
@@ -220,89 +431,12 @@ bool xProtocolMgr::uciGo(const xCmd & cmd)
   return false;
 }
 
-void xProtocolMgr::printUciStat(NEngine::SearchData const& sdata)
-{
-  if(!sdata.best_)
-    return;
-
-  auto smove = moveToStr(sdata.best_, false);
-  if(smove.empty())
-    return;
-
-  os_ << "info "
-      << "currmove " << smove << " "
-      << "currmovenumber " << sdata.counter_+1 << " "
-      << "nodes " << sdata.totalNodes_ << " "
-      << "depth " << sdata.depth_ << std::endl;
-}
-
-void xProtocolMgr::printInfo(NEngine::SearchResult const& sres)
-{
-  NEngine::SBoard<NEngine::Board, NEngine::UndoInfo, NEngine::Board::GameLength> board(sres.board_);
-
-  std::string pv_str;
-  for(int i = 0; i < MaxPly && sres.pv_[i]; ++i)
-  {
-    if(i)
-      pv_str += " ";
-
-    auto pv = sres.pv_[i];
-    if(!board.possibleMove(pv))
-      break;
-
-    auto str = moveToStr(pv, false);
-    if(str.empty())
-      break;
-
-    X_ASSERT(!board.validateMoveBruteforce(pv), "move is invalid but it is not detected by printSAN()");
-
-    board.makeMove(pv);
-
-    pv_str += str;
-  }
-
-  auto dt = NTime::seconds<double>(sres.dt_) + 0.001;
-  int nps = static_cast<int>(sres.totalNodes_ / dt);
-  std::ostringstream oss;
-
-  oss << "info "
-      << "depth " << sres.depth_ << " "
-      << "seldepth " << sres.depthMax_ << " ";
-
-  if(sres.score_ >= NEngine::Figure::MatScore-MaxPly)
-  {
-    int n = (NEngine::Figure::MatScore - sres.score_) / 2;
-    oss << "score mate " << n << " ";
-  }
-  else if(sres.score_ <= MaxPly-NEngine::Figure::MatScore)
-  {
-    int n = (-NEngine::Figure::MatScore - sres.score_) / 2;
-    oss << "score mate " << n << " ";
-  }
-  else
-    oss << "score cp " << sres.score_ << " ";
-
-  oss << "time " << NTime::milli_seconds<int>(sres.dt_) << " ";
-  oss << "nodes " << sres.totalNodes_ << " ";
-  oss << "nps " << nps << " ";
-
-  if(sres.best_)
-  {
-    oss << "currmove " << moveToStr(sres.best_, false) << " ";
-  }
-
-  oss << "currmovenumber " << sres.counter_+1 << " ";
-  oss << "pv " << pv_str;
-
-  os_ << oss.str() << std::endl;
-}
-
 void xProtocolMgr::printBM(NEngine::SearchResult const& sres)
 {
   if(!sres.best_)
     return;
 
-  os_ << "bestmove " << moveToStr(sres.best_, false) << std::endl;
+  log_.output("bestmove " + moveToStr(sres.best_, false));
 }
 
 bool xProtocolMgr::doCmd()
@@ -337,11 +471,27 @@ bool xProtocolMgr::swallowCmd(xCmd const& cmd)
     swallow = true;
     break;
 
+  // it's called from input thread, so board isn't changed here. '.' is only status request while searching,
+  // but it leaves edit mode if edit commands were postponed before
   case xType::xLeaveEdit:
-    proc_.editCmd(cmd);
+    stop = false;
+    swallow = !cmds_.pending();
+    if(swallow)
+      proc_.needUpdate();
+    break;
+
+  case xType::UCIponderhit:
+    proc_.ponderHit();
     stop = false;
     swallow = true;
     break;
+
+  // debug commands are processed after search is stopped
+  case xType::xEval:
+  case xType::xEvalStat:
+  case xType::xLazyEval:
+  case xType::xSearchStat:
+    break;
   }
   if(stop)
     proc_.stop();
@@ -412,6 +562,53 @@ void xProtocolMgr::processCmd(xCmd const& cmd)
     proc_.save(cmd.param(0));
     break;
 
+  case xType::xEval:
+    {
+      NEngine::EvalTrace trace;
+      if(!proc_.evalTrace(trace))
+        break;
+      if(cmd.param(0) == "trace")
+        trace.print(os_);
+      else
+        os_ << "eval " << trace.result_ << std::endl;
+    }
+    break;
+
+  case xType::xEvalStat:
+    if(cmd.param(0) == "clear")
+      proc_.clearEvalProfile();
+    else
+      proc_.evalProfile().print(os_);
+    break;
+
+  case xType::xLazyEval:
+    {
+      // fraction of evaluations which should be covered by margins
+      double fraction = 0.99;
+      if(!cmd.param(1).empty())
+        fraction = std::atof(cmd.param(1).c_str());
+      if(cmd.param(0) == "start")
+        proc_.setLazyEvalCalibration(true);
+      else if(cmd.param(0) == "stop")
+        proc_.setLazyEvalCalibration(false);
+      else if(cmd.param(0) == "apply" && !proc_.applyLazyEvalStat(fraction))
+        os_ << "info string no lazy eval statistics" << std::endl;
+      else
+        proc_.lazyEvalStat().print(os_, fraction);
+    }
+    break;
+
+  case xType::xSearchStat:
+    {
+      // counters of the last search. UCI GUI shows them as info strings
+      std::ostringstream oss;
+      proc_.searchStat().print(oss);
+      std::istringstream iss(oss.str());
+      for(std::string line; std::getline(iss, line);)
+        os_ << (cmds_.isUci() ? "info string " : "") << line << std::endl;
+    }
+    break;
+
   case xType::xLoadBoard:
     proc_.load(cmd.param(0));
     break;
@@ -478,6 +675,10 @@ void xProtocolMgr::processCmd(xCmd const& cmd)
   case xType::xOtime:
     break;
 
+  // swallowed by input thread
+  case xType::UCIponderhit:
+    break;
+
   case xType::xLevel:
     proc_.setMovesLeft(cmd.value());
     break;
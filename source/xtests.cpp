@@ -9,12 +9,24 @@ xtests.cpp - Copyright (C) 2016 by Dmitry Sultanov
 #include "xoptimize.h"
 #include "xprotocol.h"
 #include "kpk.h"
+#include "Bitbase.h"
 #include "iostream"
 #include "fstream"
 #include "chrono"
 #include "iomanip"
 #include "sstream"
 #include "unordered_set"
+#include "thread"
+#include "mutex"
+#include "condition_variable"
+#include "deque"
+#include "map"
+#include "ctime"
+#include "memory"
+#include "algorithm"
+#include "numeric"
+#include "regex"
+#include "MappedFile.h"
 // #include "boost/filesystem.hpp"
 
 namespace NEngine
@@ -100,6 +112,11 @@ void printInfo(NEngine::SearchResult const& sres)
   else
     oss << "score cp " << sres.score_ << " ";
 
+  if (sres.bound_ == NEngine::SearchResult::Lower)
+    oss << "lowerbound ";
+  else if (sres.bound_ == NEngine::SearchResult::Upper)
+    oss << "upperbound ";
+
   oss << "time " << NTime::milli_seconds<int>(sres.dt_) << " ";
   oss << "nodes " << sres.totalNodes_ << " ";
   oss << "nps " << nps << " ";
@@ -139,7 +156,7 @@ void testMovegen(std::string const& ffname)
     [](size_t i, xEPD<Board, Move, UndoInfo>& epd)
   {
     std::cout << toFEN(epd.board_) << std::endl;
-    ChecksGenerator<Board, SMove> ckg{ epd.board_ };
+    ChecksGenerator<Board, SMove> ckg{ epd.board_, SearchHistory::empty() };
     ckg.generate();
     Move* move = nullptr;
     for (int j = 1; move = ckg.next();)
@@ -212,25 +229,20 @@ void saveFen(std::string const& ffname, std::string const& refname)
   if (!refname.empty()) {
     ofs.open(refname, std::ios::out);
   }
-  testFen<Board, Move, UndoInfo>(
-    ffname,
-    [&ofs](size_t i, xEPD<Board, Move, UndoInfo>& e)
-    {
-      NEngine::Evaluator eval;
-      eval.initialize(&e.board_
-#ifdef USE_EVAL_HASH_ALL
-      , nullptr
-#endif
-      );
-      auto score = eval(-NEngine::Figure::MatScore, NEngine::Figure::MatScore);
-      if (ofs) {
-        ofs << i << ", " << score << std::endl;
-      }
-    },
-    [](std::string const& err_str)
-    {
-      std::cout << "Error: " << err_str << std::endl;
-    });
+  // boards refer to undo stacks of FenTest items
+  FenTest<Board, Move, UndoInfo> ft(ffname, [](std::string const& err_str)
+  {
+    std::cout << "Error: " << err_str << std::endl;
+  });
+  std::vector<Board> boards;
+  for (auto const& e : ft)
+    boards.push_back(e.board_);
+  std::vector<ScoreType> scores(boards.size());
+  NEngine::evaluateBatch(boards.data(), boards.size(), scores.data(), std::thread::hardware_concurrency());
+  if (ofs) {
+    for (size_t i = 0; i < scores.size(); ++i)
+      ofs << i << ", " << scores[i] << std::endl;
+  }
 }
 
 double logisticFunc(const double value, const double alpha)
@@ -253,12 +265,13 @@ void evaluateFen(std::string const& ffname, std::string const& refname)
   }
   std::cout << "N: score, refScore, diff, cp" << std::endl;
   double totalError = 0.0f;
+  // the same Evaluator for all positions. it's expensive to create
+  NEngine::Evaluator eval;
 
   testFen<Board, Move, UndoInfo>(
     ffname,
-    [&totalError, &refEvals](size_t i, xEPD<Board, Move, UndoInfo>& e)
+    [&totalError, &refEvals, &eval](size_t i, xEPD<Board, Move, UndoInfo>& e)
   {
-    NEngine::Evaluator eval;
     eval.initialize(&e.board_
 #ifdef USE_EVAL_HASH_ALL
     ,nullptr
@@ -266,7 +279,7 @@ void evaluateFen(std::string const& ffname, std::string const& refname)
     );
     std::string fen = toFEN(e.board_);
     auto score = eval(-NEngine::Figure::MatScore, NEngine::Figure::MatScore);
-    ChecksGenerator<Board, SMove> ck{ e.board_ };
+    ChecksGenerator<Board, SMove> ck{ e.board_, SearchHistory::empty() };
     ck.generate();
 
     int diff = -100000;
@@ -341,6 +354,1133 @@ void analyzeFen(std::string const& fname, std::string const& bestfname, std::str
   });
 }
 
+void calibrateLazyEval(std::string const& fname, int depth)
+{
+  NEngine::xCallback xcbk;
+  NShallow::Processor proc;
+  proc.setCallback(xcbk);
+  proc.setThreadsNumber(1);
+  proc.setLazyEvalCalibration(true);
+
+  testFen<Board, Move, UndoInfo>(
+    fname,
+    [&proc, depth](size_t i, xEPD<Board, Move, UndoInfo>& e)
+  {
+    SBoard<Board, UndoInfo, 512> board{ e.board_, true };
+    if (!board.invalidate())
+      return;
+    if (board.matState() || board.drawState())
+      return;
+    proc.setBoard(board);
+    proc.clear();
+    proc.analyze(depth);
+  },
+    [](std::string const& err_str)
+  {
+    std::cout << "Error: " << err_str << std::endl;
+  });
+
+  const double fraction = 0.99;
+  auto stat = proc.lazyEvalStat();
+  stat.print(std::cout, fraction);
+  // could be used as EvalFile
+  std::cout << "lazyMargins";
+  for (int stage = 0; stage < LazyEvalStat::StagesNum; ++stage)
+    std::cout << " " << stat.margin(stage, fraction);
+  std::cout << std::endl;
+}
+
+void bench(std::string const& fname, int depth)
+{
+  NEngine::xCallback xcbk;
+  SearchResult sres;
+  xcbk.sendFinished_ = [&sres](NEngine::SearchResult const& r)
+  {
+    sres = r;
+  };
+  NShallow::Processor proc;
+  proc.setCallback(xcbk);
+  proc.setThreadsNumber(1);
+
+  SearchStat stat;
+  int64 nodes{};
+  NTime::duration dt{};
+  int count{};
+  testFen<Board, Move, UndoInfo>(
+    fname,
+    [&](size_t i, xEPD<Board, Move, UndoInfo>& e)
+  {
+    SBoard<Board, UndoInfo, 512> board{ e.board_, true };
+    if (!board.invalidate())
+      return;
+    if (board.matState() || board.drawState())
+      return;
+    proc.setBoard(board);
+    proc.clear();
+    sres.reset();
+    proc.analyze(depth);
+    std::cout << std::setw(4) << i << " " << std::setw(10) << sres.totalNodes_ << " "
+      << std::setw(8) << NTime::milli_seconds<int>(sres.dt_) << " ms  "
+      << std::setw(6) << sres.score_ << " " << moveToStr(sres.best_, false) << std::endl;
+    nodes += sres.totalNodes_;
+    dt += sres.dt_;
+    stat += proc.searchStat();
+    count++;
+  },
+    [](std::string const& err_str)
+  {
+    std::cout << "Error: " << err_str << std::endl;
+  });
+
+  std::cout << count << " positions, depth " << depth << ", nodes " << nodes
+    << ", time " << NTime::milli_seconds<int>(dt) << " ms" << std::endl;
+  stat.print(std::cout);
+}
+
+void timePlay(int xtime_ms, int inc_ms, int movesToGo)
+{
+  NEngine::xCallback xcbk;
+  NShallow::Processor proc;
+  proc.setCallback(xcbk);
+  proc.setThreadsNumber(1);
+  proc.init();
+
+  auto const base = NTime::from_milliseconds(xtime_ms);
+  auto const inc = NTime::from_milliseconds(inc_ms);
+  NTime::duration clocks[2] = { base, base };
+  NTime::duration used[2] = {};
+  double overuse{};
+
+  std::cout << "move  side      used   optimum      soft      hard     clock  score" << std::endl;
+  for(int ply = 0; ply < TimePlay_PliesMax; ++ply)
+  {
+    auto color = proc.color();
+    auto& clock = clocks[color];
+    int moveNumber = ply / 2 + 1;
+    proc.setXtime(clock);
+    proc.setMovesToGo(movesToGo > 0 ? movesToGo - (moveNumber - 1) % movesToGo : 0);
+    proc.setIncrement(inc);
+
+    auto t = NTime::now();
+    auto r = proc.reply(false);
+    auto dt = NTime::now() - t;
+    if(!r || !r.best_)
+      break;
+
+    auto const& tman = proc.timeManager();
+    clock -= dt;
+    used[color] += dt;
+    if(tman.optimum() > NTime::duration(0))
+      overuse = std::max(overuse, dt / tman.optimum());
+
+    std::cout << std::setw(4) << moveNumber << " " << std::setw(5) << (color ? "white" : "black")
+      << std::setw(10) << NTime::milli_seconds<int>(dt)
+      << std::setw(10) << NTime::milli_seconds<int>(tman.optimum())
+      << std::setw(10) << NTime::milli_seconds<int>(tman.softLimit())
+      << std::setw(10) << NTime::milli_seconds<int>(tman.hardLimit())
+      << std::setw(10) << NTime::milli_seconds<int>(clock)
+      << std::setw(7) << r.score_ << "  " << r.moveStr_ << std::endl;
+
+    if(clock < NTime::duration(0))
+    {
+      std::cout << (color ? "white" : "black") << " lost on time" << std::endl;
+      break;
+    }
+
+    clock += inc;
+    if(movesToGo > 0 && moveNumber % movesToGo == 0)
+      clock += base;
+
+    if(r.state_ & (State::ChessMat | State::Stalemat | State::DrawReps | State::DrawInsuf | State::Draw50Moves))
+      break;
+  }
+
+  std::cout << "time used (ms): white " << NTime::milli_seconds<int>(used[Figure::ColorWhite])
+    << ", black " << NTime::milli_seconds<int>(used[Figure::ColorBlack]) << std::endl;
+  std::cout << "time left (ms): white " << NTime::milli_seconds<int>(clocks[Figure::ColorWhite])
+    << ", black " << NTime::milli_seconds<int>(clocks[Figure::ColorBlack]) << std::endl;
+  std::cout << "max used / optimum: " << overuse << std::endl;
+}
+
+namespace
+{
+
+// fen is taken from first 4 fields of epd line. move counters are optional. searched nodes are added to nodes
+std::string batchPosition(NShallow::Processor& proc, std::string const& line, int64& nodes)
+{
+  auto fields = split(line, [](char c) { return is_any_of(" \t", c); });
+  fields.erase(std::remove(fields.begin(), fields.end(), std::string{}), fields.end());
+  if(fields.size() < 4)
+    return line + " c0 \"invalid epd\";";
+
+  std::string epd = join(fields.begin(), fields.begin() + 4, " ");
+  std::string fen = epd;
+  for(size_t i = 4; i < 6 && i < fields.size() && !fields[i].empty() && std::all_of(fields[i].begin(), fields[i].end(), ::isdigit); ++i)
+    fen += " " + fields[i];
+
+  if(!proc.fromFEN(fen))
+    return epd + " c0 \"invalid fen\";";
+
+  proc.clear();
+  auto r = proc.reply(false);
+  auto const& sres = proc.result();
+  if(!r || !r.best_ || !sres.best_)
+    return epd + " c0 \"no moves\";";
+
+  nodes += sres.totalNodes_;
+  std::ostringstream oss;
+  oss << epd
+    << " bm " << moveToStr(sres.best_, false) << ";"
+    << " ce " << sres.score_ << ";"
+    << " acd " << sres.depth_ << ";"
+    << " acn " << sres.totalNodes_ << ";"
+    << " acs " << std::fixed << std::setprecision(3) << NTime::seconds<double>(sres.dt_) << ";"
+    << " pv";
+  SBoard<Board, UndoInfo, Board::GameLength> board(sres.board_);
+  for(int i = 0; i < MaxPly && sres.pv_[i]; ++i)
+  {
+    auto pv = sres.pv_[i];
+    if(!board.possibleMove(pv) || !board.validateMoveBruteforce(pv))
+      break;
+    oss << " " << moveToStr(pv, false);
+    board.makeMove(pv);
+  }
+  oss << ";";
+  return oss.str();
+}
+
+} // namespace {}
+
+void batchAnalyze(std::string const& fname, std::string const& ofname, int instancesN, int threadsN,
+  std::string const& limitType, int limit)
+{
+  std::ifstream ifs(fname);
+  std::ofstream ofs(ofname);
+  if(!ifs || !ofs)
+  {
+    std::cout << "can't open " << (ifs ? ofname : fname) << std::endl;
+    return;
+  }
+
+  std::mutex mtx;
+  std::condition_variable cv;
+  // positions read ahead and finished positions waiting for previous ones.
+  // their total number, including ones being searched, is limited by queueMax
+  std::deque<std::pair<size_t, std::string>> queue;
+  std::map<size_t, std::string> finished;
+  size_t const queueMax = instancesN * BatchAnalyze_QueuePerInstance;
+  size_t nextOut = 0;
+  bool eof = false;
+  // searched by each instance
+  std::vector<int64> nodesN(instancesN);
+
+  // engines are created one by one. each one allocates default hash first.
+  // instances share no search state (history is per engine), so results don't depend on their number
+  std::vector<std::unique_ptr<NShallow::Processor>> procs;
+  for(int i = 0; i < instancesN; ++i)
+  {
+    procs.emplace_back(new NShallow::Processor);
+    auto& proc = *procs.back();
+    proc.setHashSize(BatchAnalyze_HashMb);
+    proc.setThreadsNumber(threadsN);
+    if(limitType == "nodes")
+    {
+      proc.setDepth(NShallow::DepthMaximum);
+      proc.setNodesLimit(limit);
+    }
+    else if(limitType == "movetime")
+      proc.setTimePerMove(NTime::from_milliseconds(limit));
+    else
+      proc.setDepth(limit);
+  }
+
+  auto worker = [&](int i)
+  {
+    auto& proc = *procs[i];
+    for(;;)
+    {
+      std::pair<size_t, std::string> item;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&]() { return !queue.empty() || eof; });
+        if(queue.empty())
+          break;
+        item = std::move(queue.front());
+        queue.pop_front();
+      }
+      cv.notify_all();
+
+      auto result = batchPosition(proc, item.second, nodesN[i]);
+
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        finished.emplace(item.first, std::move(result));
+        for(auto iter = finished.begin(); iter != finished.end() && iter->first == nextOut; iter = finished.erase(iter), ++nextOut)
+          ofs << iter->second << "\n";
+      }
+      cv.notify_all();
+    }
+  };
+
+  auto t = NTime::now();
+  auto const clock0 = std::clock();
+  std::vector<std::thread> workers;
+  for(int i = 0; i < instancesN; ++i)
+    workers.emplace_back(worker, i);
+
+  size_t count = 0;
+  for(std::string line; std::getline(ifs, line);)
+  {
+    trim(line);
+    if(line.empty() || line[0] == '#')
+      continue;
+    std::unique_lock<std::mutex> lock(mtx);
+    // wait for written results too, so one slow position doesn't let finished ones pile up
+    cv.wait(lock, [&]() { return count - nextOut < queueMax; });
+    queue.emplace_back(count++, std::move(line));
+    lock.unlock();
+    cv.notify_all();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    eof = true;
+  }
+  cv.notify_all();
+
+  for(auto& w : workers)
+    w.join();
+
+  auto dt = NTime::seconds<double>(NTime::now() - t) + 0.001;
+  int64 nodes = std::accumulate(nodesN.begin(), nodesN.end(), int64{});
+  double cpu = static_cast<double>(std::clock() - clock0) / CLOCKS_PER_SEC;
+  int cores = std::max((int)std::thread::hardware_concurrency(), 1);
+  std::cout << count << " positions; time: " << std::fixed << std::setprecision(2) << dt << " s; "
+    << count / dt << " positions/s; " << (int64)(nodes / dt) << " nps" << std::endl;
+  std::cout << instancesN << " instances x " << threadsN << " threads; cpu time: " << cpu << " s; utilisation: "
+    << 100.0 * cpu / (dt * cores) << "% of " << cores << " cores" << std::endl;
+}
+
+namespace
+{
+
+// regex based parsing replaced by fromFEN() and parseEPD(). it's kept as reference for parseTest()
+std::regex const legacyFen_{"([a-h1-8pnbrqkPNBRQK/]*)([ \\t]+)([bwKQkqa-h0-9 \\t\\-]*)"};
+std::regex const legacyAfen_{"([bw]+)([ \\t]+)?([\\-KQkq]+)?([ \\t]+)?([\\-a-h\\d]+)?([ \\t]*)?([\\d]*)?([ \\t]*)?([\\d]*)?"};
+std::regex const legacyEpd_{"([0-9a-hpnbrqkPNBRQKw/\\s\\-]+[\\s])([\\s]*bm[\\s])?([0-9a-hpnulrqkPNBRQKOx+=!_\\s\\-]+[\\s]?)?([\\s]*dmin[\\s]+)?([0-9]+)?([\\s]*dmax[\\s]+)?([0-9]+)?([\\s]+hash[\\s]+)?([0-9]+)?([\\s]*;[\\s]*\\\")?([\\w\\-]+)?([\\s]*moves[\\s]*)?([0-9a-hprqkPNBRQKOx+=!_\\s\\-]+)?"};
+
+bool legacyFromFEN(std::string fen, Board& board)
+{
+  board.clear();
+  trim(fen);
+
+  std::smatch m;
+  if(!std::regex_search(fen, m, legacyFen_) || m.size() < 3)
+    return false;
+  std::string fstr = m[1];
+  std::string astr = m[3];
+  auto lines = split(fstr, [](char c) { return c == '/'; });
+  // there was no check of ranks number
+  if(lines.size() < 8)
+    return false;
+  for(int y = 7; y >= 0; --y)
+  {
+    int x = 0;
+    for(char c : lines[7 - y])
+    {
+      if(x > 7)
+        break;
+      if(isdigit(c))
+      {
+        x += c - '0';
+        continue;
+      }
+      else if(isalpha(c))
+      {
+        Figure::Color color = isupper(c) ? Figure::ColorWhite : Figure::ColorBlack;
+        Figure::Type ftype = Figure::toFtype(toupper(c));
+        if(Figure::TypeNone == ftype)
+          return false;
+        board.addFigure(color, ftype, Index(x, y));
+        ++x;
+      }
+    }
+  }
+  std::smatch sr;
+  if(!std::regex_search(astr, sr, legacyAfen_) || sr.size() < 10)
+    return false;
+  std::string scolor = sr[1];
+  std::string scastle = sr[3];
+  std::string senpass = sr[5];
+  std::string sfifty = sr[7];
+  std::string shalf = sr[9];
+  if(!scolor.empty())
+  {
+    if('w' == scolor[0])
+      board.setColor(Figure::ColorWhite);
+    else if('b' == scolor[0])
+    {
+      board.setColor(Figure::ColorBlack);
+      board.hashColor();
+    }
+  }
+  for(char c : scastle)
+  {
+    if('k' == c || 'K' == c)
+      board.set_castling(c == 'k' ? Figure::ColorBlack : Figure::ColorWhite, 0);
+    else if('q' == c || 'Q' == c)
+      board.set_castling(c == 'q' ? Figure::ColorBlack : Figure::ColorWhite, 1);
+  }
+  if(senpass.size() >= 2 && senpass[0] != '-')
+  {
+    char cx = senpass[0];
+    char cy = senpass[1];
+    Index enpassant(cx, cy);
+    if(board.color())
+      cy--;
+    else
+      cy++;
+    const Field fp = board.getField(Index(cx, cy));
+    if(fp.type() != Figure::TypePawn || fp.color() == board.color())
+      return false;
+    board.setEnpassant(enpassant, fp.color());
+  }
+  if(!sfifty.empty() && isdigit(sfifty[0]))
+    board.setFiftyMovesCount(std::stoi(sfifty));
+  if(!shalf.empty() && isdigit(shalf[0]))
+    board.setMovesCounter(std::stoi(shalf));
+  return board.invalidate();
+}
+
+// fen, best moves and score of epd line
+bool legacyEPD(std::string const& sline, std::string& fen, std::vector<std::string>& moves, int& score)
+{
+  std::smatch m;
+  if(!std::regex_search(sline, m, legacyEpd_) || m.size() < 4)
+    return false;
+  fen = m[1];
+  moves = split(m[3], [](char c) { return is_any_of(" \t", c); });
+  moves.erase(std::remove(moves.begin(), moves.end(), std::string{}), moves.end());
+  score = 0;
+  if(m.size() >= 13 && ((std::string)m[11]).find("score") != std::string::npos && m[13].length() > 0)
+    score = std::atoi(((std::string)m[13]).c_str());
+  return true;
+}
+
+// regex didn't take last field of FEN without trailing space, so moves counter isn't compared
+std::string withoutCounter(std::string const& fen)
+{
+  auto n = fen.find_last_of(' ');
+  return n == std::string::npos ? fen : fen.substr(0, n);
+}
+
+struct ParsedEPD
+{
+  bool ok_{};
+  std::string fen_;
+  std::vector<Move> moves_;
+  int score_{};
+};
+
+ParsedEPD parseLegacy(std::string const& line, SBoard<Board, UndoInfo, 32>& board)
+{
+  ParsedEPD r;
+  std::string fen;
+  std::vector<std::string> smoves;
+  try
+  {
+    if(!legacyEPD(line, fen, smoves, r.score_) || !legacyFromFEN(fen, board))
+      return r;
+  }
+  catch(std::exception const&)
+  {
+    // invalid position is detected by asserts in debug
+    return r;
+  }
+  r.ok_ = true;
+  r.fen_ = withoutCounter(toFEN(board));
+  for(auto const& smove : smoves)
+  {
+    if(auto move = strToMove(smove, board))
+      r.moves_.push_back(move);
+  }
+  return r;
+}
+
+ParsedEPD parseNew(std::string const& line, SBoard<Board, UndoInfo, 32>& board)
+{
+  ParsedEPD r;
+  EpdView ev;
+  if(!parseEPD(line, ev) || !fromFEN(ev.fen_, board))
+    return r;
+  r.ok_ = true;
+  r.fen_ = withoutCounter(toFEN(board));
+  r.score_ = ev.score_;
+  for(auto smove = nextToken(ev.bm_); !smove.empty(); smove = nextToken(ev.bm_))
+  {
+    if(auto move = strToMove(smove, board))
+      r.moves_.push_back(move);
+  }
+  return r;
+}
+
+// every legal move should be parsed back from its SAN and Smith notation
+int roundTripErrors(SBoard<Board, UndoInfo, 32>& board)
+{
+  int errors = 0;
+  auto moves = generate<Board, Move>(board);
+  for(auto move : moves)
+  {
+    if(!board.validateMoveBruteforce(move))
+      continue;
+    auto san = printSAN(board, move);
+    auto smith = moveToStr(move, false);
+    if(parseSAN(board, san) != move || strToMove(san, board) != move || strToMove(smith, board) != move)
+    {
+      if(errors++ < 3)
+        std::cout << "  round trip failed: " << toFEN(board) << " " << smith << " " << san << std::endl;
+    }
+  }
+  return errors;
+}
+
+} // namespace {}
+
+void parseTest(std::string const& fname, int repeat)
+{
+  std::vector<std::string> lines;
+  size_t bytes = 0;
+  {
+    std::ifstream ifs(fname);
+    for(std::string line; std::getline(ifs, line);)
+    {
+      trim(line);
+      if(line.empty() || line[0] == '#')
+        continue;
+      bytes += line.size();
+      lines.push_back(std::move(line));
+    }
+  }
+  if(lines.empty())
+  {
+    std::cout << "no positions in " << fname << std::endl;
+    return;
+  }
+
+  SBoard<Board, UndoInfo, 32> lboard, nboard;
+  int mismatches = 0, rejected = 0, roundTrip = 0;
+  for(auto const& line : lines)
+  {
+    auto const l = parseLegacy(line, lboard);
+    auto const n = parseNew(line, nboard);
+    if(!n.ok_)
+      rejected++;
+    else
+      roundTrip += roundTripErrors(nboard);
+    if(l.ok_ == n.ok_ && (!n.ok_ || (l.fen_ == n.fen_ && l.moves_ == n.moves_ && l.score_ == n.score_)))
+      continue;
+    if(mismatches++ < 10)
+    {
+      std::cout << "mismatch: " << line << std::endl;
+      std::cout << "  regex:  " << (l.ok_ ? l.fen_ : "invalid") << "; moves " << l.moves_.size() << "; score " << l.score_ << std::endl;
+      std::cout << "  parser: " << (n.ok_ ? n.fen_ : "invalid") << "; moves " << n.moves_.size() << "; score " << n.score_ << std::endl;
+    }
+  }
+  std::cout << lines.size() << " lines; " << rejected << " rejected; " << mismatches << " mismatches; "
+    << roundTrip << " round trip errors" << std::endl;
+
+  // speed. positions are parsed with moves but without comparison
+  auto speed = [&](char const* name, auto parse)
+  {
+    auto t = NTime::now();
+    size_t n = 0;
+    for(int r = 0; r < repeat; ++r)
+    {
+      for(auto const& line : lines)
+        n += parse(line);
+    }
+    auto dt = NTime::seconds<double>(NTime::now() - t) + 1e-6;
+    std::cout << name << std::fixed << std::setprecision(0) << lines.size() * repeat / dt << " lines/s; "
+      << std::setprecision(2) << bytes * repeat / dt / (1 << 20) << " MB/s" << std::endl;
+    return dt;
+  };
+  auto dtl = speed("regex:  ", [&lboard](std::string const& line)
+  {
+    std::string fen;
+    std::vector<std::string> smoves;
+    int score = 0;
+    try
+    {
+      if(!legacyEPD(line, fen, smoves, score) || !legacyFromFEN(fen, lboard))
+        return size_t{};
+    }
+    catch(std::exception const&)
+    {
+      return size_t{};
+    }
+    for(auto const& smove : smoves)
+      strToMove(smove, lboard);
+    return size_t{1};
+  });
+  auto dtn = speed("parser: ", [&nboard](std::string const& line)
+  {
+    EpdView ev;
+    if(!parseEPD(line, ev) || !fromFEN(ev.fen_, nboard))
+      return size_t{};
+    for(auto smove = nextToken(ev.bm_); !smove.empty(); smove = nextToken(ev.bm_))
+      strToMove(smove, nboard);
+    return size_t{1};
+  });
+  std::cout << "speedup: " << std::setprecision(1) << dtl / dtn << "x" << std::endl;
+}
+
+namespace
+{
+
+char const* const gameResults_[] = { "*", "1-0", "1/2-1/2", "0-1" };
+
+eGameResult gameResult(std::string_view sresult)
+{
+  for(int i = 1; i < 4; ++i)
+  {
+    if(gameResults_[i] == sresult)
+      return static_cast<eGameResult>(i);
+  }
+  return eGameResult::grUnknown;
+}
+
+bool hasExtension(std::string const& fname, std::string const& ext)
+{
+  if(fname.size() < ext.size())
+    return false;
+  auto e = fname.substr(fname.size() - ext.size());
+  to_lower(e);
+  return e == ext;
+}
+
+bool filterPosition(Board const& board, Move const& move, int ply, PgnFilter const& filter)
+{
+  if(ply < filter.plyMin_ || (filter.plyMax_ > 0 && ply > filter.plyMax_))
+    return false;
+  if((filter.noCheck_ || filter.quiet_) && board.underCheck())
+    return false;
+  if(filter.quiet_ && (move.new_type() || board.getField(move.to()) || (board.enpassant() == move.to() && move.to() > 0)))
+    return false;
+  return true;
+}
+
+// games are replayed by worker threads. views refer to mapped file
+struct PgnTask
+{
+  std::vector<std::string_view> games_;
+  std::vector<PackedPosition> positions_;
+  std::string epd_;
+  size_t count_{};
+  size_t errors_{};
+};
+
+void replayGames(PgnTask& task, PgnFilter const& filter, bool packed)
+{
+  PgnView pgn;
+  SBoard<Board, UndoInfo, Board::GameLength> board;
+  std::ostringstream oss;
+  for(auto game : task.games_)
+  {
+    if(!parsePGN(game, pgn) || !fromFEN(pgn.fen_, board))
+    {
+      task.errors_++;
+      continue;
+    }
+    auto const result = gameResult(pgn.result_);
+    int const plyMax = filter.plyMax_ > 0 ? std::min((int)pgn.moves_.size(), filter.plyMax_ + 1) : (int)pgn.moves_.size();
+    for(int ply = 0; ply < plyMax && board.halfmovesCount() < Board::GameLength - 1; ++ply)
+    {
+      auto const move = parseSAN(board, pgn.moves_[ply]);
+      if(!move)
+      {
+        task.errors_++;
+        break;
+      }
+      if(filterPosition(board, move, ply, filter))
+      {
+        PackedPosition pos;
+        if(!packed)
+        {
+          oss << toFEN(board) << " bm " << pgn.moves_[ply] << ";";
+          if(result != eGameResult::grUnknown)
+            oss << " c0 \"" << gameResults_[static_cast<int>(result)] << "\";";
+          oss << "\n";
+          task.count_++;
+        }
+        else if(pack(board, pos))
+        {
+          pos.setMove(move);
+          pos.result_ = result;
+          task.positions_.push_back(pos);
+          task.count_++;
+        }
+      }
+      board.makeMove(move);
+    }
+  }
+  task.epd_ = oss.str();
+}
+
+// returns number of games. output is written in order of games
+size_t extractPGN(std::string const& fname, int threadsN, PgnFilter const& filter, PackedWriter* writer, std::ostream* os)
+{
+  MappedFile file;
+  if(!file.load(fname))
+    return 0;
+  std::string_view text(reinterpret_cast<char const*>(file.data()), file.size());
+
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<std::pair<size_t, PgnTask>> queue;
+  std::map<size_t, PgnTask> finished;
+  size_t const queueMax = threadsN * PgnExtract_QueuePerThread;
+  size_t nextOut = 0;
+  size_t count = 0, errors = 0;
+  bool eof = false;
+
+  auto worker = [&]()
+  {
+    for(;;)
+    {
+      std::pair<size_t, PgnTask> item;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&]() { return !queue.empty() || eof; });
+        if(queue.empty())
+          break;
+        item = std::move(queue.front());
+        queue.pop_front();
+      }
+      cv.notify_all();
+
+      replayGames(item.second, filter, writer != nullptr);
+
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        finished.emplace(item.first, std::move(item.second));
+        for(auto iter = finished.begin(); iter != finished.end() && iter->first == nextOut; iter = finished.erase(iter), ++nextOut)
+        {
+          auto const& task = iter->second;
+          if(writer)
+          {
+            for(auto const& pos : task.positions_)
+              writer->write(pos);
+          }
+          if(os)
+            *os << task.epd_;
+          count += task.count_;
+          errors += task.errors_;
+        }
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for(int i = 0; i < threadsN; ++i)
+    workers.emplace_back(worker);
+
+  // text is split to games here, parsing and replay are done by workers
+  size_t games = 0, tasks = 0;
+  for(std::string_view game; !text.empty();)
+  {
+    PgnTask task;
+    for(; (int)task.games_.size() < PgnExtract_GamesPerTask && nextGame(text, game);)
+      task.games_.push_back(game);
+    if(task.games_.empty())
+      break;
+    games += task.games_.size();
+    std::unique_lock<std::mutex> lock(mtx);
+    // tasks waiting for previous ones are limited too
+    cv.wait(lock, [&]() { return tasks - nextOut < queueMax; });
+    queue.emplace_back(tasks++, std::move(task));
+    lock.unlock();
+    cv.notify_all();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    eof = true;
+  }
+  cv.notify_all();
+
+  for(auto& w : workers)
+    w.join();
+
+  std::cout << games << " games; " << count << " positions; " << errors << " errors" << std::endl;
+  return games;
+}
+
+// every position of every game with move played and game result
+size_t packPGN(std::string const& fname, PackedWriter& writer)
+{
+  return extractPGN(fname, 1, PgnFilter{}, &writer, nullptr);
+}
+
+size_t packEPD(std::string const& fname, PackedWriter& writer)
+{
+  std::ifstream ifs(fname);
+  std::string line;
+  SBoard<Board, UndoInfo, 16> board;
+  size_t errors{};
+  while(std::getline(ifs, line))
+  {
+    EpdView ev;
+    if(line.empty() || line[0] == '#')
+      continue;
+    PackedPosition pos;
+    if(!parseEPD(line, ev) || !fromFEN(ev.fen_, board) || !pack(board, pos))
+    {
+      errors++;
+      continue;
+    }
+    if(auto move = strToMove(nextToken(ev.bm_), board))
+      pos.setMove(move);
+    if(ev.hasScore_)
+    {
+      pos.flags_ |= PackedPosition::HasScore;
+      pos.score_ = static_cast<int16>(std::clamp(ev.score_, -(int)ScoreMax, (int)ScoreMax));
+    }
+    writer.write(pos);
+  }
+  return errors;
+}
+
+} // namespace {}
+
+void packPositions(std::string const& fname, std::string const& ofname)
+{
+  PackedWriter writer;
+  if(!writer.open(ofname))
+  {
+    std::cout << "can't open " << ofname << std::endl;
+    return;
+  }
+  auto t = std::chrono::high_resolution_clock::now();
+  if(hasExtension(fname, ".pgn"))
+    std::cout << packPGN(fname, writer) << " games" << std::endl;
+  else
+    std::cout << packEPD(fname, writer) << " invalid lines" << std::endl;
+  writer.close();
+  auto dt = std::chrono::high_resolution_clock::now() - t;
+  std::cout << writer.count() << " positions packed; time: "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(dt).count() << " (ms)" << std::endl;
+}
+
+void unpackPositions(std::string const& fname, std::string const& ofname)
+{
+  auto t = std::chrono::high_resolution_clock::now();
+  PackedReader reader;
+  if(!reader.load(fname))
+  {
+    std::cout << "invalid packed file " << fname << std::endl;
+    return;
+  }
+  std::ofstream ofs(ofname);
+  SBoard<Board, UndoInfo, 16> board;
+  size_t errors{};
+  for(auto const& pos : reader)
+  {
+    if(!unpack(pos, board))
+    {
+      errors++;
+      continue;
+    }
+    ofs << toFEN(board);
+    auto move = pos.move();
+    if(move && board.possibleMove(move) && board.validateMoveBruteforce(move))
+      ofs << " bm " << printSAN(board, move) << ";";
+    if(pos.hasScore())
+      ofs << " score " << pos.score_ << ";";
+    if(pos.result_ != eGameResult::grUnknown)
+      ofs << " c0 \"" << gameResults_[static_cast<int>(pos.result_)] << "\";";
+    ofs << std::endl;
+  }
+  auto dt = std::chrono::high_resolution_clock::now() - t;
+  std::cout << reader.size() << " positions unpacked, " << errors << " invalid; time: "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(dt).count() << " (ms)" << std::endl;
+}
+
+void extractPositions(std::string const& fname, std::string const& ofname, int threadsN, PgnFilter const& filter)
+{
+  PackedWriter writer;
+  std::ofstream ofs;
+  bool const packed = hasExtension(ofname, ".bin");
+  if(!packed)
+    ofs.open(ofname);
+  if(packed ? !writer.open(ofname) : !ofs)
+  {
+    std::cout << "can't open " << ofname << std::endl;
+    return;
+  }
+  auto t = NTime::now();
+  auto const games = extractPGN(fname, threadsN, filter, packed ? &writer : nullptr, packed ? nullptr : &ofs);
+  writer.close();
+  auto dt = NTime::seconds<double>(NTime::now() - t) + 0.001;
+  std::cout << threadsN << " threads; time: " << std::fixed << std::setprecision(2) << dt << " s; "
+    << games / dt << " games/s" << std::endl;
+}
+
+namespace
+{
+
+// random legal moves from initial position. false if game is finished during opening
+bool randomOpening(Board& board, int plies, std::mt19937& rgen)
+{
+  for(int i = 0; i < plies; ++i)
+  {
+    std::vector<Move> legal;
+    auto moves = generate<Board, Move>(board);
+    for(auto move : moves)
+    {
+      if(board.validateMoveBruteforce(move))
+        legal.push_back(move);
+    }
+    if(legal.empty())
+      return false;
+    board.makeMove(legal[std::uniform_int_distribution<size_t>(0, legal.size() - 1)(rgen)]);
+    board.verifyState();
+    if(board.matState() || board.drawState())
+      return false;
+  }
+  return true;
+}
+
+// game is adjudicated by score or length if it isn't finished by rules. scores are from white point of view
+class Adjudicator
+{
+public:
+  eGameResult update(Board const& board, ScoreType score, int ply)
+  {
+    if(board.matState())
+      return board.color() ? eGameResult::grBlackWins : eGameResult::grWhiteWins;
+    if(board.drawState() || ply >= SelfPlay_PliesMax)
+      return eGameResult::grDraw;
+
+    winPlies_ = std::abs(score) >= SelfPlay_ResignScore && (winPlies_ == 0 || (score > 0) == (winScore_ > 0)) ? winPlies_ + 1 : 0;
+    winScore_ = score;
+    if(winPlies_ >= SelfPlay_ResignPlies)
+      return score > 0 ? eGameResult::grWhiteWins : eGameResult::grBlackWins;
+
+    drawPlies_ = (ply >= SelfPlay_DrawPlyMin && std::abs(score) <= SelfPlay_DrawScore) ? drawPlies_ + 1 : 0;
+    if(drawPlies_ >= SelfPlay_DrawPlies)
+      return eGameResult::grDraw;
+
+    return eGameResult::grUnknown;
+  }
+
+private:
+  int winPlies_{};
+  int winScore_{};
+  int drawPlies_{};
+};
+
+} // namespace {}
+
+void selfPlay(std::string const& ofname, int gamesN, int threadsN, int nodes)
+{
+  PackedWriter writer;
+  if(!writer.open(ofname))
+  {
+    std::cout << "can't open " << ofname << std::endl;
+    return;
+  }
+
+  std::mutex mtx;
+  int started = 0;
+  // failed searches, white wins, draws, black wins
+  int results[4] = {};
+
+  auto worker = [&]()
+  {
+    std::mt19937 rgen(std::random_device{}());
+    Engine engine;
+    engine.setMemory(SelfPlay_HashMb);
+    engine.setThreadsNumber(1);
+    engine.setMaxDepth(NShallow::DepthMaximum);
+    engine.setTimeLimit(NTime::duration(0));
+    engine.setNodesLimit(nodes);
+
+    std::vector<PackedPosition> positions;
+    for(;;)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        if(started >= gamesN)
+          break;
+        started++;
+      }
+
+      engine.fromFEN("");
+      engine.clearHash();
+      auto& board = engine.getBoard();
+      if(!randomOpening(board, SelfPlay_RandomPlies, rgen))
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        started--;
+        continue;
+      }
+
+      positions.clear();
+      Adjudicator adjudicator;
+      auto result = eGameResult::grUnknown;
+      for(int ply = 0; result == eGameResult::grUnknown; ++ply)
+      {
+        // search with nodes limit always finishes 1st iteration, so it has to return valid move
+        bool const found = engine.search() && engine.result().best_ && board.validateMoveBruteforce(engine.result().best_);
+        X_ASSERT(!found, "search didn't return valid move");
+        if(!found)
+          break;
+        auto const& sres = engine.result();
+        PackedPosition pos;
+        if(pack(board, pos))
+        {
+          pos.setMove(sres.best_);
+          pos.score_ = sres.score_;
+          pos.flags_ |= PackedPosition::HasScore;
+          positions.push_back(pos);
+        }
+        ScoreType const score = board.color() ? sres.score_ : -sres.score_;
+        board.makeMove(sres.best_);
+        board.verifyState();
+        result = adjudicator.update(board, score, ply);
+      }
+
+      std::lock_guard<std::mutex> lock(mtx);
+      // game isn't finished, so its positions can't be written
+      if(result == eGameResult::grUnknown)
+      {
+        std::cout << "ERROR: search didn't return valid move in " << toFEN(board) << std::endl;
+        results[0]++;
+        continue;
+      }
+      for(auto& pos : positions)
+      {
+        pos.result_ = result;
+        writer.write(pos);
+      }
+      results[static_cast<int>(result)]++;
+    }
+  };
+
+  auto t = NTime::now();
+  std::vector<std::thread> workers;
+  for(int i = 0; i < threadsN; ++i)
+    workers.emplace_back(worker);
+  for(auto& w : workers)
+    w.join();
+  writer.close();
+
+  auto dt = NTime::seconds<double>(NTime::now() - t) + 0.001;
+  int const games = results[1] + results[2] + results[3];
+  if(results[0] > 0)
+    std::cout << "ERROR: " << results[0] << " games failed" << std::endl;
+  std::cout << games << " games: +" << results[1] << " =" << results[2] << " -" << results[3] << "; "
+    << writer.count() << " positions; time: " << std::fixed << std::setprecision(2) << dt << " s; "
+    << writer.count() / dt << " positions/s" << std::endl;
+}
+
+void concurrencyTest(std::string const& ffname, int enginesN, int depth)
+{
+  std::vector<std::string> fens;
+  testFen<Board, Move, UndoInfo>(ffname, [&fens](size_t, xEPD<Board, Move, UndoInfo>& e)
+  {
+    fens.push_back(toFEN(e.board_));
+  },
+  [](std::string const& err)
+  {
+    std::cout << "Error: " << err << std::endl;
+  });
+
+  struct Result
+  {
+    Move best_{ true };
+    int score_{};
+    int nodes_{};
+
+    bool operator == (Result const& other) const
+    {
+      return best_ == other.best_ && score_ == other.score_ && nodes_ == other.nodes_;
+    }
+  };
+
+  // the same sequence of positions for each engine, so hash contents are the same too
+  auto run = [&fens, depth](std::vector<Result>& results)
+  {
+    Engine engine;
+    engine.setMemory(BatchAnalyze_HashMb);
+    engine.setThreadsNumber(1);
+    engine.setMaxDepth(depth);
+    engine.setTimeLimit(NTime::duration(0));
+    results.assign(fens.size(), Result{});
+    for(size_t i = 0; i < fens.size(); ++i)
+    {
+      if(!engine.fromFEN(fens[i]) || !engine.search())
+        continue;
+      auto const& sres = engine.result();
+      results[i] = Result{ sres.best_, sres.score_, sres.totalNodes_ };
+    }
+  };
+
+  auto t = NTime::now();
+  std::vector<Result> etalon;
+  run(etalon);
+  auto dt0 = NTime::seconds<double>(NTime::now() - t);
+
+  t = NTime::now();
+  std::vector<std::vector<Result>> results(enginesN);
+  std::vector<std::thread> workers;
+  for(auto& r : results)
+    workers.emplace_back(run, std::ref(r));
+  for(auto& w : workers)
+    w.join();
+  auto dt1 = NTime::seconds<double>(NTime::now() - t);
+
+  int errors = 0;
+  for(int n = 0; n < enginesN; ++n)
+  {
+    for(size_t i = 0; i < fens.size(); ++i)
+    {
+      if(results[n][i] == etalon[i])
+        continue;
+      errors++;
+      std::cout << "engine " << n << " mismatch in " << fens[i] << " : "
+        << moveToStr(results[n][i].best_, false) << " " << results[n][i].score_ << " " << results[n][i].nodes_ << " instead of "
+        << moveToStr(etalon[i].best_, false) << " " << etalon[i].score_ << " " << etalon[i].nodes_ << std::endl;
+    }
+  }
+  // the smallest nodes budget still gives legal move
+  {
+    Engine engine;
+    engine.setMemory(BatchAnalyze_HashMb);
+    engine.setThreadsNumber(1);
+    engine.setMaxDepth(NShallow::DepthMaximum);
+    engine.setTimeLimit(NTime::duration(0));
+    engine.setNodesLimit(1);
+    for(auto const& fen : fens)
+    {
+      if(!engine.fromFEN(fen))
+        continue;
+      auto& board = engine.getBoard();
+      if(board.matState() || board.drawState())
+        continue;
+      bool const ok = engine.search();
+      auto const best = engine.result().best_;
+      if(ok && best && board.validateMoveBruteforce(best))
+        continue;
+      errors++;
+      std::cout << "no move with nodes limit 1 in " << fen << std::endl;
+    }
+  }
+
+  std::cout << fens.size() << " positions, " << enginesN << " engines, depth " << depth << ", "
+    << errors << " errors; time: " << std::fixed << std::setprecision(2) << dt0 << " s alone, "
+    << dt1 << " s concurrently" << std::endl;
+}
+
 void generateMoves(std::string const& ffname, std::string const& ofname)
 {
   using GBoard = SBoard<Board, UndoInfo, 16>;
@@ -377,58 +1517,41 @@ void generateMoves(std::string const& ffname, std::string const& ofname)
 
 void kpkTable(std::string const& fname)
 {
-  NShallow::Processor proc;
-  //NTime::duration tm(NTime::from_milliseconds(500));
+  Bitbases bitbases;
+  int threadsN = std::max(1, (int)std::thread::hardware_concurrency());
+  if(!bitbases.generate("KPK", threadsN, [](std::string const& s) { std::cout << s << std::endl; }))
+  {
+    std::cout << "Error" << std::endl;
+    return;
+  }
   std::array<std::array<std::array<BitMask, 2>, 64>, 64> kpk = {};
   for(int kw = 0; kw < 64; ++kw)
   {
     for(int kl = 0; kl < 64; ++kl)
     {
-      if(distanceCounter().getDistance(kl, kw) < 2)
+      if(kl == kw)
         continue;
       for(int p = 8; p < 56; ++p)
       {
         if(p == kl || p == kw)
           continue;
+        BitbasePiece pawn;
+        pawn.color_ = Figure::ColorWhite;
+        pawn.type_ = Figure::TypePawn;
+        pawn.pos_ = p;
+        int kings[2] = { kl, kw };
         for(int color = 0; color < 2; ++color)
         {
-          Figure::Color ccolor = (Figure::Color)color;
-          SBoard<Board, UndoInfo, 256> board;
-          board.initEmpty(ccolor);
-          board.addFigure(Figure::ColorWhite, Figure::TypePawn, p);
-          board.addFigure(Figure::ColorWhite, Figure::TypeKing, kw);
-          board.addFigure(Figure::ColorBlack, Figure::TypeKing, kl);
-          if(!board.invalidate())
-            continue;
-          if(board.state() != State::Ok && board.state() != State::UnderCheck)
-            continue;
-          //proc.setTimePerMove(tm);
-          proc.setDepth(22);
-          proc.setScoreLimit(500);
-          proc.setBoard(board);
-          proc.clear();
-          std::cout << "processing " << kw << " " << kl << " " << p << " " << color << std::endl;
-          auto r = proc.reply(false);
-          if(!r)
-          {
-            std::cout << "Error" << std::endl;
-            return;
-          }
-          if(std::abs(r.score_) > 500)
-          {
+          // bit is set if pawn's side wins
+          auto r = bitbases.probe((Figure::Color)color, kings, &pawn, 1);
+          if((color == Figure::ColorWhite && r == BitbaseResult::Win) || (color == Figure::ColorBlack && r == BitbaseResult::Loss))
             kpk[kw][kl][color] |= 1ULL << p;
-            std::cout << " winner: " << r.score_ << std::endl;
-          }
-          else
-          {
-            std::cout << " draw: " << r.score_ << std::endl;
-          }
         }
       }
     }
   }
   std::ofstream f(fname);
-  f << "#include <kpk.h>" << std::endl << std::endl;
+  f << "#include \"kpk.h\"" << std::endl << std::endl;
   f << "namespace NEngine" << std::endl;
   f << "{" << std::endl << std::endl;
   f << "std::vector<std::vector<std::array<BitMask, 2>>> kpk_ = {" << std::endl;
@@ -452,17 +1575,35 @@ void kpkTable(std::string const& fname)
   f << "} // NEngine" << std::endl;
 }
 
+void generateBitbases(std::string const& fname, int threadsN, std::vector<std::string> names)
+{
+  if(names.empty())
+    names = { "KPK", "KRK", "KQK", "KBNK", "KRKP", "KQKR" };
+  Bitbases bitbases;
+  auto t = NTime::now();
+  for(auto const& name : names)
+  {
+    if(!bitbases.generate(name, threadsN, [](std::string const& s) { std::cout << s << std::endl; }))
+      std::cout << "can't generate " << name << std::endl;
+  }
+  if(!bitbases.save(fname))
+  {
+    std::cout << "can't write " << fname << std::endl;
+    return;
+  }
+  std::cout << "total time: " << NTime::milli_seconds<int>(NTime::now() - t) << " ms" << std::endl;
+}
 
 void speedTest()
 {
   SBoard<Board, UndoInfo, 512> board;
   fromFEN("", board);
   auto t = std::chrono::high_resolution_clock::now();
-  xsearch(board, 4);
+  auto count = xsearch(board, 4);
   auto dt = std::chrono::high_resolution_clock::now() - t;
   auto dt_ms = std::chrono::duration_cast<std::chrono::milliseconds>(dt).count();
-  int nps = int((x_movesCounter / (double)dt_ms) * 1000);
-  std::cout << x_movesCounter
+  int nps = int((count / (double)dt_ms) * 1000);
+  std::cout << count
     << " moves; time: " << dt_ms/1000.0 << " (s);"
     << " nps " << nps << std::endl;
 }
@@ -486,7 +1627,7 @@ std::vector<std::string> board2Test(std::string const& epdfile)
       std::cout << std::setw(4) << i << " failed with " << e.what() << std::endl;
     }
     if(!ok)
-      errors.push_back(epd.fen_ + "; error -> "+ epd.err_);
+      errors.push_back((epd.fen_.empty() ? toFEN(epd.board_) : epd.fen_) + "; error -> "+ epd.err_);
   },
   [](std::string const& err)
   {